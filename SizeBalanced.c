@@ -0,0 +1,31165 @@
+/*
+ * This file was generated automatically by ExtUtils::ParseXS version 3.45 from the
+ * contents of SizeBalanced.xs. Do not edit this file, edit SizeBalanced.xs instead.
+ *
+ *    ANY CHANGES MADE HERE WILL BE LOST!
+ *
+ */
+
+#line 1 "SizeBalanced.xs"
+// vim: filetype=xs
+#define PERL_NO_GET_CONTEXT
+#include "EXTERN.h"
+#include "perl.h"
+#include "XSUB.h"
+
+#include "ppport.h"
+
+#include "const-c.inc"
+
+GV * a_GV, * b_GV;
+
+#include "tree_common.h"
+
+#define KV_PASTER(NAME, KEY, VALUE) NAME ## _ ## KEY ## _ ## VALUE
+#define KV_EVALUATOR(NAME, KEY, VALUE) KV_PASTER(NAME, KEY, VALUE)
+#define KV(NAME) KV_EVALUATOR(NAME, KEY, VALUE)
+
+#define K_PASTER(NAME, KEY) NAME ## _ ## KEY
+#define K_EVALUATOR(NAME, KEY) K_PASTER(NAME, KEY)
+#define K(NAME) K_EVALUATOR(NAME, KEY)
+#define V(NAME) K_EVALUATOR(NAME, VALUE)
+
+#define I_EVALUATOR(NAME) NAME ## _id
+#define I(NAME) I_EVALUATOR(NAME)
+
+#define T_EVALUATOR(NAME) NAME ## _t
+#define T(NAME) T_EVALUATOR(NAME)
+
+#define S_EVALUATOR(NAME) #NAME
+#define S(NAME) S_EVALUATOR(NAME)
+
+#include "tree_customize.h"
+
+#define KEY int
+#  include "include_tree_with_different_value_type.h"
+#undef KEY
+
+#define KEY num
+#  include "include_tree_with_different_value_type.h"
+#undef KEY
+
+#define KEY str
+#  include "include_tree_with_different_value_type.h"
+#undef KEY
+
+#define KEY any
+#  include "include_tree_with_different_value_type.h"
+#undef KEY
+
+#line 61 "SizeBalanced.c"
+#ifndef PERL_UNUSED_VAR
+#  define PERL_UNUSED_VAR(var) if (0) var = var
+#endif
+
+#ifndef dVAR
+#  define dVAR		dNOOP
+#endif
+
+
+/* This stuff is not part of the API! You have been warned. */
+#ifndef PERL_VERSION_DECIMAL
+#  define PERL_VERSION_DECIMAL(r,v,s) (r*1000000 + v*1000 + s)
+#endif
+#ifndef PERL_DECIMAL_VERSION
+#  define PERL_DECIMAL_VERSION \
+	  PERL_VERSION_DECIMAL(PERL_REVISION,PERL_VERSION,PERL_SUBVERSION)
+#endif
+#ifndef PERL_VERSION_GE
+#  define PERL_VERSION_GE(r,v,s) \
+	  (PERL_DECIMAL_VERSION >= PERL_VERSION_DECIMAL(r,v,s))
+#endif
+#ifndef PERL_VERSION_LE
+#  define PERL_VERSION_LE(r,v,s) \
+	  (PERL_DECIMAL_VERSION <= PERL_VERSION_DECIMAL(r,v,s))
+#endif
+
+/* XS_INTERNAL is the explicit static-linkage variant of the default
+ * XS macro.
+ *
+ * XS_EXTERNAL is the same as XS_INTERNAL except it does not include
+ * "STATIC", ie. it exports XSUB symbols. You probably don't want that
+ * for anything but the BOOT XSUB.
+ *
+ * See XSUB.h in core!
+ */
+
+
+/* TODO: This might be compatible further back than 5.10.0. */
+#if PERL_VERSION_GE(5, 10, 0) && PERL_VERSION_LE(5, 15, 1)
+#  undef XS_EXTERNAL
+#  undef XS_INTERNAL
+#  if defined(__CYGWIN__) && defined(USE_DYNAMIC_LOADING)
+#    define XS_EXTERNAL(name) __declspec(dllexport) XSPROTO(name)
+#    define XS_INTERNAL(name) STATIC XSPROTO(name)
+#  endif
+#  if defined(__SYMBIAN32__)
+#    define XS_EXTERNAL(name) EXPORT_C XSPROTO(name)
+#    define XS_INTERNAL(name) EXPORT_C STATIC XSPROTO(name)
+#  endif
+#  ifndef XS_EXTERNAL
+#    if defined(HASATTRIBUTE_UNUSED) && !defined(__cplusplus)
+#      define XS_EXTERNAL(name) void name(pTHX_ CV* cv __attribute__unused__)
+#      define XS_INTERNAL(name) STATIC void name(pTHX_ CV* cv __attribute__unused__)
+#    else
+#      ifdef __cplusplus
+#        define XS_EXTERNAL(name) extern "C" XSPROTO(name)
+#        define XS_INTERNAL(name) static XSPROTO(name)
+#      else
+#        define XS_EXTERNAL(name) XSPROTO(name)
+#        define XS_INTERNAL(name) STATIC XSPROTO(name)
+#      endif
+#    endif
+#  endif
+#endif
+
+/* perl >= 5.10.0 && perl <= 5.15.1 */
+
+
+/* The XS_EXTERNAL macro is used for functions that must not be static
+ * like the boot XSUB of a module. If perl didn't have an XS_EXTERNAL
+ * macro defined, the best we can do is assume XS is the same.
+ * Dito for XS_INTERNAL.
+ */
+#ifndef XS_EXTERNAL
+#  define XS_EXTERNAL(name) XS(name)
+#endif
+#ifndef XS_INTERNAL
+#  define XS_INTERNAL(name) XS(name)
+#endif
+
+/* Now, finally, after all this mess, we want an ExtUtils::ParseXS
+ * internal macro that we're free to redefine for varying linkage due
+ * to the EXPORT_XSUB_SYMBOLS XS keyword. This is internal, use
+ * XS_EXTERNAL(name) or XS_INTERNAL(name) in your code if you need to!
+ */
+
+#undef XS_EUPXS
+#if defined(PERL_EUPXS_ALWAYS_EXPORT)
+#  define XS_EUPXS(name) XS_EXTERNAL(name)
+#else
+   /* default to internal */
+#  define XS_EUPXS(name) XS_INTERNAL(name)
+#endif
+
+#ifndef PERL_ARGS_ASSERT_CROAK_XS_USAGE
+#define PERL_ARGS_ASSERT_CROAK_XS_USAGE assert(cv); assert(params)
+
+/* prototype to pass -Wmissing-prototypes */
+STATIC void
+S_croak_xs_usage(const CV *const cv, const char *const params);
+
+STATIC void
+S_croak_xs_usage(const CV *const cv, const char *const params)
+{
+    const GV *const gv = CvGV(cv);
+
+    PERL_ARGS_ASSERT_CROAK_XS_USAGE;
+
+    if (gv) {
+        const char *const gvname = GvNAME(gv);
+        const HV *const stash = GvSTASH(gv);
+        const char *const hvname = stash ? HvNAME(stash) : NULL;
+
+        if (hvname)
+	    Perl_croak_nocontext("Usage: %s::%s(%s)", hvname, gvname, params);
+        else
+	    Perl_croak_nocontext("Usage: %s(%s)", gvname, params);
+    } else {
+        /* Pants. I don't think that it should be possible to get here. */
+	Perl_croak_nocontext("Usage: CODE(0x%" UVxf ")(%s)", PTR2UV(cv), params);
+    }
+}
+#undef  PERL_ARGS_ASSERT_CROAK_XS_USAGE
+
+#define croak_xs_usage        S_croak_xs_usage
+
+#endif
+
+/* NOTE: the prototype of newXSproto() is different in versions of perls,
+ * so we define a portable version of newXSproto()
+ */
+#ifdef newXS_flags
+#define newXSproto_portable(name, c_impl, file, proto) newXS_flags(name, c_impl, file, proto, 0)
+#else
+#define newXSproto_portable(name, c_impl, file, proto) (PL_Sv=(SV*)newXS(name, c_impl, file), sv_setpv(PL_Sv, proto), (CV*)PL_Sv)
+#endif /* !defined(newXS_flags) */
+
+#if PERL_VERSION_LE(5, 21, 5)
+#  define newXS_deffile(a,b) Perl_newXS(aTHX_ a,b,file)
+#else
+#  define newXS_deffile(a,b) Perl_newXS_deffile(aTHX_ a,b)
+#endif
+
+#line 205 "SizeBalanced.c"
+
+/* INCLUDE:  Including 'const-xs.inc' from 'SizeBalanced.xs' */
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_constant); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_constant)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "sv");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+#line 4 "./const-xs.inc"
+#ifdef dXSTARG
+	dXSTARG; /* Faster if we have it.  */
+#else
+	dTARGET;
+#endif
+	STRLEN		len;
+        int		type;
+	/* IV		iv;	Uncomment this if you need to return IVs */
+	/* NV		nv;	Uncomment this if you need to return NVs */
+	/* const char	*pv;	Uncomment this if you need to return PVs */
+#line 230 "SizeBalanced.c"
+	SV *	sv = ST(0)
+;
+	const char *	s = SvPV(sv, len);
+#line 18 "./const-xs.inc"
+	type = constant(aTHX_ s, len);
+      /* Return 1 or 2 items. First is error message, or undef if no error.
+           Second, if present, is found value */
+        switch (type) {
+        case PERL_constant_NOTFOUND:
+          sv =
+	    sv_2mortal(newSVpvf("%s is not a valid Tree::SizeBalanced macro", s));
+          PUSHs(sv);
+          break;
+        case PERL_constant_NOTDEF:
+          sv = sv_2mortal(newSVpvf(
+	    "Your vendor has not defined Tree::SizeBalanced macro %s, used",
+				   s));
+          PUSHs(sv);
+          break;
+	/* Uncomment this if you need to return IVs
+        case PERL_constant_ISIV:
+          EXTEND(SP, 2);
+          PUSHs(&PL_sv_undef);
+          PUSHi(iv);
+          break; */
+	/* Uncomment this if you need to return NOs
+        case PERL_constant_ISNO:
+          EXTEND(SP, 2);
+          PUSHs(&PL_sv_undef);
+          PUSHs(&PL_sv_no);
+          break; */
+	/* Uncomment this if you need to return NVs
+        case PERL_constant_ISNV:
+          EXTEND(SP, 2);
+          PUSHs(&PL_sv_undef);
+          PUSHn(nv);
+          break; */
+	/* Uncomment this if you need to return PVs
+        case PERL_constant_ISPV:
+          EXTEND(SP, 2);
+          PUSHs(&PL_sv_undef);
+          PUSHp(pv, strlen(pv));
+          break; */
+	/* Uncomment this if you need to return PVNs
+        case PERL_constant_ISPVN:
+          EXTEND(SP, 2);
+          PUSHs(&PL_sv_undef);
+          PUSHp(pv, iv);
+          break; */
+	/* Uncomment this if you need to return SVs
+        case PERL_constant_ISSV:
+          EXTEND(SP, 2);
+          PUSHs(&PL_sv_undef);
+          PUSHs(sv);
+          break; */
+	/* Uncomment this if you need to return UNDEFs
+        case PERL_constant_ISUNDEF:
+          break; */
+	/* Uncomment this if you need to return UVs
+        case PERL_constant_ISUV:
+          EXTEND(SP, 2);
+          PUSHs(&PL_sv_undef);
+          PUSHu((UV)iv);
+          break; */
+	/* Uncomment this if you need to return YESs
+        case PERL_constant_ISYES:
+          EXTEND(SP, 2);
+          PUSHs(&PL_sv_undef);
+          PUSHs(&PL_sv_yes);
+          break; */
+        default:
+          sv = sv_2mortal(newSVpvf(
+	    "Unexpected return type %d while processing Tree::SizeBalanced macro %s, used",
+               type, s));
+          PUSHs(sv);
+        }
+#line 307 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+/* INCLUDE: Returning to 'SizeBalanced.xs' from 'const-xs.inc' */
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_int_void)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "class, cmp= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	class = ST(0)
+;
+	SV *	cmp;
+
+	if (items < 2)
+	    cmp = &PL_sv_undef;
+	else {
+	    cmp = ST(1)
+;
+	}
+#line 62 "SizeBalanced.xs"
+        SP = new_int_void(aTHX_ SP, class,cmp);
+#line 338 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_from_sorted_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_from_sorted_int_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 4)
+       croak_xs_usage(cv,  "class, keys, values= &PL_sv_undef, cmp= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	class = ST(0)
+;
+	SV *	keys = ST(1)
+;
+	SV *	values;
+	SV *	cmp;
+
+	if (items < 3)
+	    values = &PL_sv_undef;
+	else {
+	    values = ST(2)
+;
+	}
+
+	if (items < 4)
+	    cmp = &PL_sv_undef;
+	else {
+	    cmp = ST(3)
+;
+	}
+#line 67 "SizeBalanced.xs"
+        SP = new_from_sorted_int_void(aTHX_ SP, class,keys,values,cmp);
+#line 376 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_DESTROY_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_DESTROY_int_void)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 72 "SizeBalanced.xs"
+        SP = DESTROY_int_void(aTHX_ SP, obj);
+#line 396 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_size_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_size_int_void)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 78 "SizeBalanced.xs"
+        SP = size_int_void(aTHX_ SP, obj);
+#line 416 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_ever_height_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_ever_height_int_void)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 83 "SizeBalanced.xs"
+        SP = ever_height_int_void(aTHX_ SP, obj);
+#line 436 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_cmp_count_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_cmp_count_int_void)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 88 "SizeBalanced.xs"
+        SP = cmp_count_int_void(aTHX_ SP, obj);
+#line 456 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_int_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 93 "SizeBalanced.xs"
+        SP = insert_int_void(aTHX_ SP, obj,key,value);
+#line 486 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_before_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_before_int_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 98 "SizeBalanced.xs"
+        SP = insert_before_int_void(aTHX_ SP, obj,key,value);
+#line 516 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_after_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_after_int_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 103 "SizeBalanced.xs"
+        SP = insert_after_int_void(aTHX_ SP, obj,key,value);
+#line 546 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_unique_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_unique_int_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 108 "SizeBalanced.xs"
+        SP = insert_unique_int_void(aTHX_ SP, obj,key,value);
+#line 576 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_set_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_set_int_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 113 "SizeBalanced.xs"
+        SP = set_int_void(aTHX_ SP, obj,key,value);
+#line 606 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_add_value_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_add_value_int_void)
+{
+    dVAR; dXSARGS;
+    if (items < 3 || items > 4)
+       croak_xs_usage(cv,  "obj, key, delta, insert= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	delta = ST(2)
+;
+	int	insert;
+
+	if (items < 4)
+	    insert = 1;
+	else {
+	    insert = (int)SvIV(ST(3))
+;
+	}
+#line 118 "SizeBalanced.xs"
+        SP = add_value_int_void(aTHX_ SP, obj,key,delta,insert);
+#line 638 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_incr_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_incr_int_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 123 "SizeBalanced.xs"
+        SP = incr_int_void(aTHX_ SP, obj,key);
+#line 660 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_many_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_many_int_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, keys, values= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+	SV *	values;
+
+	if (items < 3)
+	    values = &PL_sv_undef;
+	else {
+	    values = ST(2)
+;
+	}
+#line 128 "SizeBalanced.xs"
+        SP = insert_many_int_void(aTHX_ SP, obj,keys,values);
+#line 690 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_int_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 133 "SizeBalanced.xs"
+        SP = delete_int_void(aTHX_ SP, obj,key);
+#line 712 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_first_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_first_int_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 138 "SizeBalanced.xs"
+        SP = delete_first_int_void(aTHX_ SP, obj,key);
+#line 734 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_last_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_last_int_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 143 "SizeBalanced.xs"
+        SP = delete_last_int_void(aTHX_ SP, obj,key);
+#line 756 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_first_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_first_int_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 148 "SizeBalanced.xs"
+        SP = take_first_int_void(aTHX_ SP, obj,key);
+#line 778 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_last_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_last_int_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 153 "SizeBalanced.xs"
+        SP = take_last_int_void(aTHX_ SP, obj,key);
+#line 800 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_int_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 158 "SizeBalanced.xs"
+        SP = delete_many_int_void(aTHX_ SP, obj,keys);
+#line 822 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_first_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_first_int_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 163 "SizeBalanced.xs"
+        SP = delete_many_first_int_void(aTHX_ SP, obj,keys);
+#line 844 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_last_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_last_int_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 168 "SizeBalanced.xs"
+        SP = delete_many_last_int_void(aTHX_ SP, obj,keys);
+#line 866 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_lt_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_lt_int_void)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 173 "SizeBalanced.xs"
+        SP = delete_gt_lt_int_void(aTHX_ SP, obj,lower_key,upper_key);
+#line 890 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_lt_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_lt_int_void)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 178 "SizeBalanced.xs"
+        SP = delete_ge_lt_int_void(aTHX_ SP, obj,lower_key,upper_key);
+#line 914 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_le_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_le_int_void)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 183 "SizeBalanced.xs"
+        SP = delete_gt_le_int_void(aTHX_ SP, obj,lower_key,upper_key);
+#line 938 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_le_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_le_int_void)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 188 "SizeBalanced.xs"
+        SP = delete_ge_le_int_void(aTHX_ SP, obj,lower_key,upper_key);
+#line 962 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_le_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_le_int_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= -1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = -1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 193 "SizeBalanced.xs"
+        SP = drain_le_int_void(aTHX_ SP, obj,key,limit);
+#line 992 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_ge_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_ge_int_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= -1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = -1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 198 "SizeBalanced.xs"
+        SP = drain_ge_int_void(aTHX_ SP, obj,key,limit);
+#line 1022 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_lt_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_lt_int_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 204 "SizeBalanced.xs"
+        SP = split_lt_int_void(aTHX_ SP, obj,key);
+#line 1044 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_le_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_le_int_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 209 "SizeBalanced.xs"
+        SP = split_le_int_void(aTHX_ SP, obj,key);
+#line 1066 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_join_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_join_int_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 214 "SizeBalanced.xs"
+        SP = join_int_void(aTHX_ SP, obj,other);
+#line 1088 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_union_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_union_int_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 219 "SizeBalanced.xs"
+        SP = union_int_void(aTHX_ SP, obj,other);
+#line 1110 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_intersection_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_intersection_int_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 224 "SizeBalanced.xs"
+        SP = intersection_int_void(aTHX_ SP, obj,other);
+#line 1132 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_difference_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_difference_int_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 229 "SizeBalanced.xs"
+        SP = difference_int_void(aTHX_ SP, obj,other);
+#line 1154 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_int_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 235 "SizeBalanced.xs"
+        SP = find_int_void(aTHX_ SP, obj,key,limit);
+#line 1184 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_first_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_first_int_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 240 "SizeBalanced.xs"
+        SP = find_first_int_void(aTHX_ SP, obj,key,limit);
+#line 1214 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_last_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_last_int_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 245 "SizeBalanced.xs"
+        SP = find_last_int_void(aTHX_ SP, obj,key,limit);
+#line 1244 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_exists_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_exists_int_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 250 "SizeBalanced.xs"
+        SP = exists_int_void(aTHX_ SP, obj,key);
+#line 1266 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_get_many_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_get_many_int_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 255 "SizeBalanced.xs"
+        SP = get_many_int_void(aTHX_ SP, obj,keys);
+#line 1288 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_int_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 260 "SizeBalanced.xs"
+        SP = find_lt_int_void(aTHX_ SP, obj,key,limit);
+#line 1318 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_int_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 265 "SizeBalanced.xs"
+        SP = find_le_int_void(aTHX_ SP, obj,key,limit);
+#line 1348 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_int_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 270 "SizeBalanced.xs"
+        SP = find_gt_int_void(aTHX_ SP, obj,key,limit);
+#line 1378 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_int_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 275 "SizeBalanced.xs"
+        SP = find_ge_int_void(aTHX_ SP, obj,key,limit);
+#line 1408 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_many_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_many_int_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 281 "SizeBalanced.xs"
+        SP = find_lt_many_int_void(aTHX_ SP, obj,keys);
+#line 1430 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_many_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_many_int_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 286 "SizeBalanced.xs"
+        SP = find_le_many_int_void(aTHX_ SP, obj,keys);
+#line 1452 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_many_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_many_int_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 291 "SizeBalanced.xs"
+        SP = find_gt_many_int_void(aTHX_ SP, obj,keys);
+#line 1474 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_many_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_many_int_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 296 "SizeBalanced.xs"
+        SP = find_ge_many_int_void(aTHX_ SP, obj,keys);
+#line 1496 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_lt_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_lt_int_void)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 302 "SizeBalanced.xs"
+        SP = find_gt_lt_int_void(aTHX_ SP, obj,lower_key,upper_key);
+#line 1520 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_lt_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_lt_int_void)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 307 "SizeBalanced.xs"
+        SP = find_ge_lt_int_void(aTHX_ SP, obj,lower_key,upper_key);
+#line 1544 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_le_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_le_int_void)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 312 "SizeBalanced.xs"
+        SP = find_gt_le_int_void(aTHX_ SP, obj,lower_key,upper_key);
+#line 1568 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_le_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_le_int_void)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 317 "SizeBalanced.xs"
+        SP = find_ge_le_int_void(aTHX_ SP, obj,lower_key,upper_key);
+#line 1592 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_int_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 323 "SizeBalanced.xs"
+        SP = count_lt_int_void(aTHX_ SP, obj,key);
+#line 1614 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_int_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 328 "SizeBalanced.xs"
+        SP = count_le_int_void(aTHX_ SP, obj,key);
+#line 1636 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_int_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 333 "SizeBalanced.xs"
+        SP = count_gt_int_void(aTHX_ SP, obj,key);
+#line 1658 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_int_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 338 "SizeBalanced.xs"
+        SP = count_ge_int_void(aTHX_ SP, obj,key);
+#line 1680 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_eq_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_eq_int_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 343 "SizeBalanced.xs"
+        SP = count_eq_int_void(aTHX_ SP, obj,key);
+#line 1702 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_equal_range_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_equal_range_int_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 348 "SizeBalanced.xs"
+        SP = equal_range_int_void(aTHX_ SP, obj,key);
+#line 1724 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_many_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_many_int_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 354 "SizeBalanced.xs"
+        SP = count_lt_many_int_void(aTHX_ SP, obj,keys);
+#line 1746 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_many_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_many_int_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 359 "SizeBalanced.xs"
+        SP = count_le_many_int_void(aTHX_ SP, obj,keys);
+#line 1768 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_many_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_many_int_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 364 "SizeBalanced.xs"
+        SP = count_gt_many_int_void(aTHX_ SP, obj,keys);
+#line 1790 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_many_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_many_int_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 369 "SizeBalanced.xs"
+        SP = count_ge_many_int_void(aTHX_ SP, obj,keys);
+#line 1812 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_apply_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_apply_int_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, ops");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	ops = ST(1)
+;
+#line 375 "SizeBalanced.xs"
+        SP = apply_int_void(aTHX_ SP, obj,ops);
+#line 1834 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_min_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_min_int_void)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 381 "SizeBalanced.xs"
+        SP = find_min_int_void(aTHX_ SP, obj,limit);
+#line 1862 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_max_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_max_int_void)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 386 "SizeBalanced.xs"
+        SP = find_max_int_void(aTHX_ SP, obj,limit);
+#line 1890 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_min_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_min_int_void)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 392 "SizeBalanced.xs"
+        SP = pop_min_int_void(aTHX_ SP, obj,limit);
+#line 1918 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_max_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_max_int_void)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 397 "SizeBalanced.xs"
+        SP = pop_max_int_void(aTHX_ SP, obj,limit);
+#line 1946 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_l_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_l_int_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, offset, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	offset = (int)SvIV(ST(1))
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 403 "SizeBalanced.xs"
+        SP = skip_l_int_void(aTHX_ SP, obj,offset,limit);
+#line 1976 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_g_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_g_int_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, offset, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	offset = (int)SvIV(ST(1))
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 408 "SizeBalanced.xs"
+        SP = skip_g_int_void(aTHX_ SP, obj,offset,limit);
+#line 2006 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_at_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_at_int_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, offset");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	offset = (int)SvIV(ST(1))
+;
+#line 413 "SizeBalanced.xs"
+        SP = delete_at_int_void(aTHX_ SP, obj,offset);
+#line 2028 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ranks_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ranks_int_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, from, count= -1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	from = (int)SvIV(ST(1))
+;
+	int	count;
+
+	if (items < 3)
+	    count = -1;
+	else {
+	    count = (int)SvIV(ST(2))
+;
+	}
+#line 418 "SizeBalanced.xs"
+        SP = delete_ranks_int_void(aTHX_ SP, obj,from,count);
+#line 2058 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_clear_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_clear_int_void)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 424 "SizeBalanced.xs"
+        SP = clear_int_void(aTHX_ SP, obj);
+#line 2078 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_reserve_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_reserve_int_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, n");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	IV	n = (IV)SvIV(ST(1))
+;
+#line 429 "SizeBalanced.xs"
+        SP = reserve_int_void(aTHX_ SP, obj,n);
+#line 2100 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_compact_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_compact_int_void)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 434 "SizeBalanced.xs"
+        SP = compact_int_void(aTHX_ SP, obj);
+#line 2120 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_dump_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_dump_int_void)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 440 "SizeBalanced.xs"
+        SP = dump_int_void(aTHX_ SP, obj);
+#line 2140 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_check_int_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_check_int_void)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 445 "SizeBalanced.xs"
+        SP = check_int_void(aTHX_ SP, obj);
+#line 2160 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_int_int)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "class, cmp= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	class = ST(0)
+;
+	SV *	cmp;
+
+	if (items < 2)
+	    cmp = &PL_sv_undef;
+	else {
+	    cmp = ST(1)
+;
+	}
+#line 451 "SizeBalanced.xs"
+        SP = new_int_int(aTHX_ SP, class,cmp);
+#line 2188 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_from_sorted_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_from_sorted_int_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 4)
+       croak_xs_usage(cv,  "class, keys, values= &PL_sv_undef, cmp= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	class = ST(0)
+;
+	SV *	keys = ST(1)
+;
+	SV *	values;
+	SV *	cmp;
+
+	if (items < 3)
+	    values = &PL_sv_undef;
+	else {
+	    values = ST(2)
+;
+	}
+
+	if (items < 4)
+	    cmp = &PL_sv_undef;
+	else {
+	    cmp = ST(3)
+;
+	}
+#line 456 "SizeBalanced.xs"
+        SP = new_from_sorted_int_int(aTHX_ SP, class,keys,values,cmp);
+#line 2226 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_DESTROY_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_DESTROY_int_int)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 461 "SizeBalanced.xs"
+        SP = DESTROY_int_int(aTHX_ SP, obj);
+#line 2246 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_size_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_size_int_int)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 467 "SizeBalanced.xs"
+        SP = size_int_int(aTHX_ SP, obj);
+#line 2266 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_ever_height_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_ever_height_int_int)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 472 "SizeBalanced.xs"
+        SP = ever_height_int_int(aTHX_ SP, obj);
+#line 2286 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_cmp_count_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_cmp_count_int_int)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 477 "SizeBalanced.xs"
+        SP = cmp_count_int_int(aTHX_ SP, obj);
+#line 2306 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_int_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 482 "SizeBalanced.xs"
+        SP = insert_int_int(aTHX_ SP, obj,key,value);
+#line 2336 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_before_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_before_int_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 487 "SizeBalanced.xs"
+        SP = insert_before_int_int(aTHX_ SP, obj,key,value);
+#line 2366 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_after_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_after_int_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 492 "SizeBalanced.xs"
+        SP = insert_after_int_int(aTHX_ SP, obj,key,value);
+#line 2396 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_unique_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_unique_int_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 497 "SizeBalanced.xs"
+        SP = insert_unique_int_int(aTHX_ SP, obj,key,value);
+#line 2426 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_set_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_set_int_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 502 "SizeBalanced.xs"
+        SP = set_int_int(aTHX_ SP, obj,key,value);
+#line 2456 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_add_value_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_add_value_int_int)
+{
+    dVAR; dXSARGS;
+    if (items < 3 || items > 4)
+       croak_xs_usage(cv,  "obj, key, delta, insert= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	delta = ST(2)
+;
+	int	insert;
+
+	if (items < 4)
+	    insert = 1;
+	else {
+	    insert = (int)SvIV(ST(3))
+;
+	}
+#line 507 "SizeBalanced.xs"
+        SP = add_value_int_int(aTHX_ SP, obj,key,delta,insert);
+#line 2488 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_incr_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_incr_int_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 512 "SizeBalanced.xs"
+        SP = incr_int_int(aTHX_ SP, obj,key);
+#line 2510 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_many_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_many_int_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, keys, values= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+	SV *	values;
+
+	if (items < 3)
+	    values = &PL_sv_undef;
+	else {
+	    values = ST(2)
+;
+	}
+#line 517 "SizeBalanced.xs"
+        SP = insert_many_int_int(aTHX_ SP, obj,keys,values);
+#line 2540 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_int_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 522 "SizeBalanced.xs"
+        SP = delete_int_int(aTHX_ SP, obj,key);
+#line 2562 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_first_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_first_int_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 527 "SizeBalanced.xs"
+        SP = delete_first_int_int(aTHX_ SP, obj,key);
+#line 2584 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_last_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_last_int_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 532 "SizeBalanced.xs"
+        SP = delete_last_int_int(aTHX_ SP, obj,key);
+#line 2606 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_first_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_first_int_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 537 "SizeBalanced.xs"
+        SP = take_first_int_int(aTHX_ SP, obj,key);
+#line 2628 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_last_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_last_int_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 542 "SizeBalanced.xs"
+        SP = take_last_int_int(aTHX_ SP, obj,key);
+#line 2650 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_int_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 547 "SizeBalanced.xs"
+        SP = delete_many_int_int(aTHX_ SP, obj,keys);
+#line 2672 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_first_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_first_int_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 552 "SizeBalanced.xs"
+        SP = delete_many_first_int_int(aTHX_ SP, obj,keys);
+#line 2694 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_last_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_last_int_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 557 "SizeBalanced.xs"
+        SP = delete_many_last_int_int(aTHX_ SP, obj,keys);
+#line 2716 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_lt_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_lt_int_int)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 562 "SizeBalanced.xs"
+        SP = delete_gt_lt_int_int(aTHX_ SP, obj,lower_key,upper_key);
+#line 2740 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_lt_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_lt_int_int)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 567 "SizeBalanced.xs"
+        SP = delete_ge_lt_int_int(aTHX_ SP, obj,lower_key,upper_key);
+#line 2764 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_le_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_le_int_int)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 572 "SizeBalanced.xs"
+        SP = delete_gt_le_int_int(aTHX_ SP, obj,lower_key,upper_key);
+#line 2788 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_le_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_le_int_int)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 577 "SizeBalanced.xs"
+        SP = delete_ge_le_int_int(aTHX_ SP, obj,lower_key,upper_key);
+#line 2812 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_le_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_le_int_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= -1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = -1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 582 "SizeBalanced.xs"
+        SP = drain_le_int_int(aTHX_ SP, obj,key,limit);
+#line 2842 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_ge_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_ge_int_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= -1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = -1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 587 "SizeBalanced.xs"
+        SP = drain_ge_int_int(aTHX_ SP, obj,key,limit);
+#line 2872 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_lt_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_lt_int_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 593 "SizeBalanced.xs"
+        SP = split_lt_int_int(aTHX_ SP, obj,key);
+#line 2894 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_le_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_le_int_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 598 "SizeBalanced.xs"
+        SP = split_le_int_int(aTHX_ SP, obj,key);
+#line 2916 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_join_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_join_int_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 603 "SizeBalanced.xs"
+        SP = join_int_int(aTHX_ SP, obj,other);
+#line 2938 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_union_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_union_int_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 608 "SizeBalanced.xs"
+        SP = union_int_int(aTHX_ SP, obj,other);
+#line 2960 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_intersection_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_intersection_int_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 613 "SizeBalanced.xs"
+        SP = intersection_int_int(aTHX_ SP, obj,other);
+#line 2982 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_difference_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_difference_int_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 618 "SizeBalanced.xs"
+        SP = difference_int_int(aTHX_ SP, obj,other);
+#line 3004 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_int_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 624 "SizeBalanced.xs"
+        SP = find_int_int(aTHX_ SP, obj,key,limit);
+#line 3034 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_first_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_first_int_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 629 "SizeBalanced.xs"
+        SP = find_first_int_int(aTHX_ SP, obj,key,limit);
+#line 3064 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_last_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_last_int_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 634 "SizeBalanced.xs"
+        SP = find_last_int_int(aTHX_ SP, obj,key,limit);
+#line 3094 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_exists_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_exists_int_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 639 "SizeBalanced.xs"
+        SP = exists_int_int(aTHX_ SP, obj,key);
+#line 3116 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_get_many_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_get_many_int_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 644 "SizeBalanced.xs"
+        SP = get_many_int_int(aTHX_ SP, obj,keys);
+#line 3138 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_int_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 649 "SizeBalanced.xs"
+        SP = find_lt_int_int(aTHX_ SP, obj,key,limit);
+#line 3168 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_int_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 654 "SizeBalanced.xs"
+        SP = find_le_int_int(aTHX_ SP, obj,key,limit);
+#line 3198 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_int_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 659 "SizeBalanced.xs"
+        SP = find_gt_int_int(aTHX_ SP, obj,key,limit);
+#line 3228 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_int_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 664 "SizeBalanced.xs"
+        SP = find_ge_int_int(aTHX_ SP, obj,key,limit);
+#line 3258 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_many_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_many_int_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 670 "SizeBalanced.xs"
+        SP = find_lt_many_int_int(aTHX_ SP, obj,keys);
+#line 3280 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_many_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_many_int_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 675 "SizeBalanced.xs"
+        SP = find_le_many_int_int(aTHX_ SP, obj,keys);
+#line 3302 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_many_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_many_int_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 680 "SizeBalanced.xs"
+        SP = find_gt_many_int_int(aTHX_ SP, obj,keys);
+#line 3324 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_many_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_many_int_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 685 "SizeBalanced.xs"
+        SP = find_ge_many_int_int(aTHX_ SP, obj,keys);
+#line 3346 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_lt_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_lt_int_int)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 691 "SizeBalanced.xs"
+        SP = find_gt_lt_int_int(aTHX_ SP, obj,lower_key,upper_key);
+#line 3370 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_lt_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_lt_int_int)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 696 "SizeBalanced.xs"
+        SP = find_ge_lt_int_int(aTHX_ SP, obj,lower_key,upper_key);
+#line 3394 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_le_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_le_int_int)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 701 "SizeBalanced.xs"
+        SP = find_gt_le_int_int(aTHX_ SP, obj,lower_key,upper_key);
+#line 3418 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_le_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_le_int_int)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 706 "SizeBalanced.xs"
+        SP = find_ge_le_int_int(aTHX_ SP, obj,lower_key,upper_key);
+#line 3442 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_int_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 712 "SizeBalanced.xs"
+        SP = count_lt_int_int(aTHX_ SP, obj,key);
+#line 3464 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_int_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 717 "SizeBalanced.xs"
+        SP = count_le_int_int(aTHX_ SP, obj,key);
+#line 3486 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_int_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 722 "SizeBalanced.xs"
+        SP = count_gt_int_int(aTHX_ SP, obj,key);
+#line 3508 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_int_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 727 "SizeBalanced.xs"
+        SP = count_ge_int_int(aTHX_ SP, obj,key);
+#line 3530 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_eq_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_eq_int_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 732 "SizeBalanced.xs"
+        SP = count_eq_int_int(aTHX_ SP, obj,key);
+#line 3552 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_equal_range_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_equal_range_int_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 737 "SizeBalanced.xs"
+        SP = equal_range_int_int(aTHX_ SP, obj,key);
+#line 3574 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_many_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_many_int_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 743 "SizeBalanced.xs"
+        SP = count_lt_many_int_int(aTHX_ SP, obj,keys);
+#line 3596 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_many_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_many_int_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 748 "SizeBalanced.xs"
+        SP = count_le_many_int_int(aTHX_ SP, obj,keys);
+#line 3618 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_many_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_many_int_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 753 "SizeBalanced.xs"
+        SP = count_gt_many_int_int(aTHX_ SP, obj,keys);
+#line 3640 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_many_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_many_int_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 758 "SizeBalanced.xs"
+        SP = count_ge_many_int_int(aTHX_ SP, obj,keys);
+#line 3662 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_apply_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_apply_int_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, ops");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	ops = ST(1)
+;
+#line 764 "SizeBalanced.xs"
+        SP = apply_int_int(aTHX_ SP, obj,ops);
+#line 3684 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_min_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_min_int_int)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 770 "SizeBalanced.xs"
+        SP = find_min_int_int(aTHX_ SP, obj,limit);
+#line 3712 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_max_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_max_int_int)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 775 "SizeBalanced.xs"
+        SP = find_max_int_int(aTHX_ SP, obj,limit);
+#line 3740 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_min_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_min_int_int)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 781 "SizeBalanced.xs"
+        SP = pop_min_int_int(aTHX_ SP, obj,limit);
+#line 3768 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_max_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_max_int_int)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 786 "SizeBalanced.xs"
+        SP = pop_max_int_int(aTHX_ SP, obj,limit);
+#line 3796 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_l_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_l_int_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, offset, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	offset = (int)SvIV(ST(1))
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 792 "SizeBalanced.xs"
+        SP = skip_l_int_int(aTHX_ SP, obj,offset,limit);
+#line 3826 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_g_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_g_int_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, offset, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	offset = (int)SvIV(ST(1))
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 797 "SizeBalanced.xs"
+        SP = skip_g_int_int(aTHX_ SP, obj,offset,limit);
+#line 3856 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_at_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_at_int_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, offset");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	offset = (int)SvIV(ST(1))
+;
+#line 802 "SizeBalanced.xs"
+        SP = delete_at_int_int(aTHX_ SP, obj,offset);
+#line 3878 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ranks_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ranks_int_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, from, count= -1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	from = (int)SvIV(ST(1))
+;
+	int	count;
+
+	if (items < 3)
+	    count = -1;
+	else {
+	    count = (int)SvIV(ST(2))
+;
+	}
+#line 807 "SizeBalanced.xs"
+        SP = delete_ranks_int_int(aTHX_ SP, obj,from,count);
+#line 3908 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_clear_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_clear_int_int)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 813 "SizeBalanced.xs"
+        SP = clear_int_int(aTHX_ SP, obj);
+#line 3928 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_reserve_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_reserve_int_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, n");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	IV	n = (IV)SvIV(ST(1))
+;
+#line 818 "SizeBalanced.xs"
+        SP = reserve_int_int(aTHX_ SP, obj,n);
+#line 3950 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_compact_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_compact_int_int)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 823 "SizeBalanced.xs"
+        SP = compact_int_int(aTHX_ SP, obj);
+#line 3970 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_dump_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_dump_int_int)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 829 "SizeBalanced.xs"
+        SP = dump_int_int(aTHX_ SP, obj);
+#line 3990 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_check_int_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_check_int_int)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 834 "SizeBalanced.xs"
+        SP = check_int_int(aTHX_ SP, obj);
+#line 4010 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_int_num)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "class, cmp= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	class = ST(0)
+;
+	SV *	cmp;
+
+	if (items < 2)
+	    cmp = &PL_sv_undef;
+	else {
+	    cmp = ST(1)
+;
+	}
+#line 840 "SizeBalanced.xs"
+        SP = new_int_num(aTHX_ SP, class,cmp);
+#line 4038 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_from_sorted_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_from_sorted_int_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 4)
+       croak_xs_usage(cv,  "class, keys, values= &PL_sv_undef, cmp= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	class = ST(0)
+;
+	SV *	keys = ST(1)
+;
+	SV *	values;
+	SV *	cmp;
+
+	if (items < 3)
+	    values = &PL_sv_undef;
+	else {
+	    values = ST(2)
+;
+	}
+
+	if (items < 4)
+	    cmp = &PL_sv_undef;
+	else {
+	    cmp = ST(3)
+;
+	}
+#line 845 "SizeBalanced.xs"
+        SP = new_from_sorted_int_num(aTHX_ SP, class,keys,values,cmp);
+#line 4076 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_DESTROY_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_DESTROY_int_num)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 850 "SizeBalanced.xs"
+        SP = DESTROY_int_num(aTHX_ SP, obj);
+#line 4096 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_size_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_size_int_num)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 856 "SizeBalanced.xs"
+        SP = size_int_num(aTHX_ SP, obj);
+#line 4116 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_ever_height_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_ever_height_int_num)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 861 "SizeBalanced.xs"
+        SP = ever_height_int_num(aTHX_ SP, obj);
+#line 4136 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_cmp_count_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_cmp_count_int_num)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 866 "SizeBalanced.xs"
+        SP = cmp_count_int_num(aTHX_ SP, obj);
+#line 4156 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_int_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 871 "SizeBalanced.xs"
+        SP = insert_int_num(aTHX_ SP, obj,key,value);
+#line 4186 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_before_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_before_int_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 876 "SizeBalanced.xs"
+        SP = insert_before_int_num(aTHX_ SP, obj,key,value);
+#line 4216 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_after_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_after_int_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 881 "SizeBalanced.xs"
+        SP = insert_after_int_num(aTHX_ SP, obj,key,value);
+#line 4246 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_unique_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_unique_int_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 886 "SizeBalanced.xs"
+        SP = insert_unique_int_num(aTHX_ SP, obj,key,value);
+#line 4276 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_set_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_set_int_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 891 "SizeBalanced.xs"
+        SP = set_int_num(aTHX_ SP, obj,key,value);
+#line 4306 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_add_value_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_add_value_int_num)
+{
+    dVAR; dXSARGS;
+    if (items < 3 || items > 4)
+       croak_xs_usage(cv,  "obj, key, delta, insert= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	delta = ST(2)
+;
+	int	insert;
+
+	if (items < 4)
+	    insert = 1;
+	else {
+	    insert = (int)SvIV(ST(3))
+;
+	}
+#line 896 "SizeBalanced.xs"
+        SP = add_value_int_num(aTHX_ SP, obj,key,delta,insert);
+#line 4338 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_incr_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_incr_int_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 901 "SizeBalanced.xs"
+        SP = incr_int_num(aTHX_ SP, obj,key);
+#line 4360 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_many_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_many_int_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, keys, values= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+	SV *	values;
+
+	if (items < 3)
+	    values = &PL_sv_undef;
+	else {
+	    values = ST(2)
+;
+	}
+#line 906 "SizeBalanced.xs"
+        SP = insert_many_int_num(aTHX_ SP, obj,keys,values);
+#line 4390 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_int_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 911 "SizeBalanced.xs"
+        SP = delete_int_num(aTHX_ SP, obj,key);
+#line 4412 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_first_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_first_int_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 916 "SizeBalanced.xs"
+        SP = delete_first_int_num(aTHX_ SP, obj,key);
+#line 4434 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_last_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_last_int_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 921 "SizeBalanced.xs"
+        SP = delete_last_int_num(aTHX_ SP, obj,key);
+#line 4456 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_first_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_first_int_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 926 "SizeBalanced.xs"
+        SP = take_first_int_num(aTHX_ SP, obj,key);
+#line 4478 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_last_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_last_int_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 931 "SizeBalanced.xs"
+        SP = take_last_int_num(aTHX_ SP, obj,key);
+#line 4500 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_int_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 936 "SizeBalanced.xs"
+        SP = delete_many_int_num(aTHX_ SP, obj,keys);
+#line 4522 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_first_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_first_int_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 941 "SizeBalanced.xs"
+        SP = delete_many_first_int_num(aTHX_ SP, obj,keys);
+#line 4544 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_last_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_last_int_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 946 "SizeBalanced.xs"
+        SP = delete_many_last_int_num(aTHX_ SP, obj,keys);
+#line 4566 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_lt_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_lt_int_num)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 951 "SizeBalanced.xs"
+        SP = delete_gt_lt_int_num(aTHX_ SP, obj,lower_key,upper_key);
+#line 4590 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_lt_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_lt_int_num)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 956 "SizeBalanced.xs"
+        SP = delete_ge_lt_int_num(aTHX_ SP, obj,lower_key,upper_key);
+#line 4614 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_le_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_le_int_num)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 961 "SizeBalanced.xs"
+        SP = delete_gt_le_int_num(aTHX_ SP, obj,lower_key,upper_key);
+#line 4638 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_le_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_le_int_num)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 966 "SizeBalanced.xs"
+        SP = delete_ge_le_int_num(aTHX_ SP, obj,lower_key,upper_key);
+#line 4662 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_le_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_le_int_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= -1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = -1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 971 "SizeBalanced.xs"
+        SP = drain_le_int_num(aTHX_ SP, obj,key,limit);
+#line 4692 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_ge_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_ge_int_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= -1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = -1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 976 "SizeBalanced.xs"
+        SP = drain_ge_int_num(aTHX_ SP, obj,key,limit);
+#line 4722 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_lt_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_lt_int_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 982 "SizeBalanced.xs"
+        SP = split_lt_int_num(aTHX_ SP, obj,key);
+#line 4744 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_le_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_le_int_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 987 "SizeBalanced.xs"
+        SP = split_le_int_num(aTHX_ SP, obj,key);
+#line 4766 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_join_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_join_int_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 992 "SizeBalanced.xs"
+        SP = join_int_num(aTHX_ SP, obj,other);
+#line 4788 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_union_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_union_int_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 997 "SizeBalanced.xs"
+        SP = union_int_num(aTHX_ SP, obj,other);
+#line 4810 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_intersection_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_intersection_int_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 1002 "SizeBalanced.xs"
+        SP = intersection_int_num(aTHX_ SP, obj,other);
+#line 4832 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_difference_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_difference_int_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 1007 "SizeBalanced.xs"
+        SP = difference_int_num(aTHX_ SP, obj,other);
+#line 4854 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_int_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 1013 "SizeBalanced.xs"
+        SP = find_int_num(aTHX_ SP, obj,key,limit);
+#line 4884 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_first_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_first_int_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 1018 "SizeBalanced.xs"
+        SP = find_first_int_num(aTHX_ SP, obj,key,limit);
+#line 4914 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_last_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_last_int_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 1023 "SizeBalanced.xs"
+        SP = find_last_int_num(aTHX_ SP, obj,key,limit);
+#line 4944 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_exists_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_exists_int_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 1028 "SizeBalanced.xs"
+        SP = exists_int_num(aTHX_ SP, obj,key);
+#line 4966 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_get_many_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_get_many_int_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 1033 "SizeBalanced.xs"
+        SP = get_many_int_num(aTHX_ SP, obj,keys);
+#line 4988 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_int_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 1038 "SizeBalanced.xs"
+        SP = find_lt_int_num(aTHX_ SP, obj,key,limit);
+#line 5018 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_int_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 1043 "SizeBalanced.xs"
+        SP = find_le_int_num(aTHX_ SP, obj,key,limit);
+#line 5048 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_int_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 1048 "SizeBalanced.xs"
+        SP = find_gt_int_num(aTHX_ SP, obj,key,limit);
+#line 5078 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_int_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 1053 "SizeBalanced.xs"
+        SP = find_ge_int_num(aTHX_ SP, obj,key,limit);
+#line 5108 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_many_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_many_int_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 1059 "SizeBalanced.xs"
+        SP = find_lt_many_int_num(aTHX_ SP, obj,keys);
+#line 5130 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_many_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_many_int_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 1064 "SizeBalanced.xs"
+        SP = find_le_many_int_num(aTHX_ SP, obj,keys);
+#line 5152 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_many_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_many_int_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 1069 "SizeBalanced.xs"
+        SP = find_gt_many_int_num(aTHX_ SP, obj,keys);
+#line 5174 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_many_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_many_int_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 1074 "SizeBalanced.xs"
+        SP = find_ge_many_int_num(aTHX_ SP, obj,keys);
+#line 5196 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_lt_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_lt_int_num)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 1080 "SizeBalanced.xs"
+        SP = find_gt_lt_int_num(aTHX_ SP, obj,lower_key,upper_key);
+#line 5220 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_lt_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_lt_int_num)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 1085 "SizeBalanced.xs"
+        SP = find_ge_lt_int_num(aTHX_ SP, obj,lower_key,upper_key);
+#line 5244 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_le_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_le_int_num)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 1090 "SizeBalanced.xs"
+        SP = find_gt_le_int_num(aTHX_ SP, obj,lower_key,upper_key);
+#line 5268 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_le_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_le_int_num)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 1095 "SizeBalanced.xs"
+        SP = find_ge_le_int_num(aTHX_ SP, obj,lower_key,upper_key);
+#line 5292 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_int_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 1101 "SizeBalanced.xs"
+        SP = count_lt_int_num(aTHX_ SP, obj,key);
+#line 5314 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_int_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 1106 "SizeBalanced.xs"
+        SP = count_le_int_num(aTHX_ SP, obj,key);
+#line 5336 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_int_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 1111 "SizeBalanced.xs"
+        SP = count_gt_int_num(aTHX_ SP, obj,key);
+#line 5358 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_int_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 1116 "SizeBalanced.xs"
+        SP = count_ge_int_num(aTHX_ SP, obj,key);
+#line 5380 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_eq_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_eq_int_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 1121 "SizeBalanced.xs"
+        SP = count_eq_int_num(aTHX_ SP, obj,key);
+#line 5402 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_equal_range_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_equal_range_int_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 1126 "SizeBalanced.xs"
+        SP = equal_range_int_num(aTHX_ SP, obj,key);
+#line 5424 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_many_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_many_int_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 1132 "SizeBalanced.xs"
+        SP = count_lt_many_int_num(aTHX_ SP, obj,keys);
+#line 5446 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_many_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_many_int_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 1137 "SizeBalanced.xs"
+        SP = count_le_many_int_num(aTHX_ SP, obj,keys);
+#line 5468 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_many_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_many_int_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 1142 "SizeBalanced.xs"
+        SP = count_gt_many_int_num(aTHX_ SP, obj,keys);
+#line 5490 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_many_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_many_int_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 1147 "SizeBalanced.xs"
+        SP = count_ge_many_int_num(aTHX_ SP, obj,keys);
+#line 5512 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_apply_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_apply_int_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, ops");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	ops = ST(1)
+;
+#line 1153 "SizeBalanced.xs"
+        SP = apply_int_num(aTHX_ SP, obj,ops);
+#line 5534 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_min_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_min_int_num)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 1159 "SizeBalanced.xs"
+        SP = find_min_int_num(aTHX_ SP, obj,limit);
+#line 5562 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_max_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_max_int_num)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 1164 "SizeBalanced.xs"
+        SP = find_max_int_num(aTHX_ SP, obj,limit);
+#line 5590 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_min_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_min_int_num)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 1170 "SizeBalanced.xs"
+        SP = pop_min_int_num(aTHX_ SP, obj,limit);
+#line 5618 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_max_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_max_int_num)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 1175 "SizeBalanced.xs"
+        SP = pop_max_int_num(aTHX_ SP, obj,limit);
+#line 5646 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_l_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_l_int_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, offset, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	offset = (int)SvIV(ST(1))
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 1181 "SizeBalanced.xs"
+        SP = skip_l_int_num(aTHX_ SP, obj,offset,limit);
+#line 5676 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_g_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_g_int_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, offset, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	offset = (int)SvIV(ST(1))
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 1186 "SizeBalanced.xs"
+        SP = skip_g_int_num(aTHX_ SP, obj,offset,limit);
+#line 5706 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_at_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_at_int_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, offset");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	offset = (int)SvIV(ST(1))
+;
+#line 1191 "SizeBalanced.xs"
+        SP = delete_at_int_num(aTHX_ SP, obj,offset);
+#line 5728 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ranks_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ranks_int_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, from, count= -1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	from = (int)SvIV(ST(1))
+;
+	int	count;
+
+	if (items < 3)
+	    count = -1;
+	else {
+	    count = (int)SvIV(ST(2))
+;
+	}
+#line 1196 "SizeBalanced.xs"
+        SP = delete_ranks_int_num(aTHX_ SP, obj,from,count);
+#line 5758 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_clear_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_clear_int_num)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 1202 "SizeBalanced.xs"
+        SP = clear_int_num(aTHX_ SP, obj);
+#line 5778 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_reserve_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_reserve_int_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, n");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	IV	n = (IV)SvIV(ST(1))
+;
+#line 1207 "SizeBalanced.xs"
+        SP = reserve_int_num(aTHX_ SP, obj,n);
+#line 5800 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_compact_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_compact_int_num)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 1212 "SizeBalanced.xs"
+        SP = compact_int_num(aTHX_ SP, obj);
+#line 5820 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_dump_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_dump_int_num)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 1218 "SizeBalanced.xs"
+        SP = dump_int_num(aTHX_ SP, obj);
+#line 5840 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_check_int_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_check_int_num)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 1223 "SizeBalanced.xs"
+        SP = check_int_num(aTHX_ SP, obj);
+#line 5860 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_int_any)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "class, cmp= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	class = ST(0)
+;
+	SV *	cmp;
+
+	if (items < 2)
+	    cmp = &PL_sv_undef;
+	else {
+	    cmp = ST(1)
+;
+	}
+#line 1229 "SizeBalanced.xs"
+        SP = new_int_any(aTHX_ SP, class,cmp);
+#line 5888 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_from_sorted_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_from_sorted_int_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 4)
+       croak_xs_usage(cv,  "class, keys, values= &PL_sv_undef, cmp= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	class = ST(0)
+;
+	SV *	keys = ST(1)
+;
+	SV *	values;
+	SV *	cmp;
+
+	if (items < 3)
+	    values = &PL_sv_undef;
+	else {
+	    values = ST(2)
+;
+	}
+
+	if (items < 4)
+	    cmp = &PL_sv_undef;
+	else {
+	    cmp = ST(3)
+;
+	}
+#line 1234 "SizeBalanced.xs"
+        SP = new_from_sorted_int_any(aTHX_ SP, class,keys,values,cmp);
+#line 5926 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_DESTROY_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_DESTROY_int_any)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 1239 "SizeBalanced.xs"
+        SP = DESTROY_int_any(aTHX_ SP, obj);
+#line 5946 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_size_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_size_int_any)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 1245 "SizeBalanced.xs"
+        SP = size_int_any(aTHX_ SP, obj);
+#line 5966 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_ever_height_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_ever_height_int_any)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 1250 "SizeBalanced.xs"
+        SP = ever_height_int_any(aTHX_ SP, obj);
+#line 5986 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_cmp_count_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_cmp_count_int_any)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 1255 "SizeBalanced.xs"
+        SP = cmp_count_int_any(aTHX_ SP, obj);
+#line 6006 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_int_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 1260 "SizeBalanced.xs"
+        SP = insert_int_any(aTHX_ SP, obj,key,value);
+#line 6036 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_before_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_before_int_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 1265 "SizeBalanced.xs"
+        SP = insert_before_int_any(aTHX_ SP, obj,key,value);
+#line 6066 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_after_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_after_int_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 1270 "SizeBalanced.xs"
+        SP = insert_after_int_any(aTHX_ SP, obj,key,value);
+#line 6096 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_unique_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_unique_int_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 1275 "SizeBalanced.xs"
+        SP = insert_unique_int_any(aTHX_ SP, obj,key,value);
+#line 6126 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_set_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_set_int_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 1280 "SizeBalanced.xs"
+        SP = set_int_any(aTHX_ SP, obj,key,value);
+#line 6156 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_add_value_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_add_value_int_any)
+{
+    dVAR; dXSARGS;
+    if (items < 3 || items > 4)
+       croak_xs_usage(cv,  "obj, key, delta, insert= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	delta = ST(2)
+;
+	int	insert;
+
+	if (items < 4)
+	    insert = 1;
+	else {
+	    insert = (int)SvIV(ST(3))
+;
+	}
+#line 1285 "SizeBalanced.xs"
+        SP = add_value_int_any(aTHX_ SP, obj,key,delta,insert);
+#line 6188 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_incr_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_incr_int_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 1290 "SizeBalanced.xs"
+        SP = incr_int_any(aTHX_ SP, obj,key);
+#line 6210 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_many_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_many_int_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, keys, values= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+	SV *	values;
+
+	if (items < 3)
+	    values = &PL_sv_undef;
+	else {
+	    values = ST(2)
+;
+	}
+#line 1295 "SizeBalanced.xs"
+        SP = insert_many_int_any(aTHX_ SP, obj,keys,values);
+#line 6240 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_int_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 1300 "SizeBalanced.xs"
+        SP = delete_int_any(aTHX_ SP, obj,key);
+#line 6262 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_first_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_first_int_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 1305 "SizeBalanced.xs"
+        SP = delete_first_int_any(aTHX_ SP, obj,key);
+#line 6284 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_last_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_last_int_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 1310 "SizeBalanced.xs"
+        SP = delete_last_int_any(aTHX_ SP, obj,key);
+#line 6306 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_first_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_first_int_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 1315 "SizeBalanced.xs"
+        SP = take_first_int_any(aTHX_ SP, obj,key);
+#line 6328 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_last_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_last_int_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 1320 "SizeBalanced.xs"
+        SP = take_last_int_any(aTHX_ SP, obj,key);
+#line 6350 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_int_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 1325 "SizeBalanced.xs"
+        SP = delete_many_int_any(aTHX_ SP, obj,keys);
+#line 6372 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_first_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_first_int_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 1330 "SizeBalanced.xs"
+        SP = delete_many_first_int_any(aTHX_ SP, obj,keys);
+#line 6394 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_last_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_last_int_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 1335 "SizeBalanced.xs"
+        SP = delete_many_last_int_any(aTHX_ SP, obj,keys);
+#line 6416 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_lt_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_lt_int_any)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 1340 "SizeBalanced.xs"
+        SP = delete_gt_lt_int_any(aTHX_ SP, obj,lower_key,upper_key);
+#line 6440 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_lt_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_lt_int_any)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 1345 "SizeBalanced.xs"
+        SP = delete_ge_lt_int_any(aTHX_ SP, obj,lower_key,upper_key);
+#line 6464 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_le_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_le_int_any)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 1350 "SizeBalanced.xs"
+        SP = delete_gt_le_int_any(aTHX_ SP, obj,lower_key,upper_key);
+#line 6488 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_le_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_le_int_any)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 1355 "SizeBalanced.xs"
+        SP = delete_ge_le_int_any(aTHX_ SP, obj,lower_key,upper_key);
+#line 6512 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_le_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_le_int_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= -1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = -1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 1360 "SizeBalanced.xs"
+        SP = drain_le_int_any(aTHX_ SP, obj,key,limit);
+#line 6542 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_ge_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_ge_int_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= -1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = -1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 1365 "SizeBalanced.xs"
+        SP = drain_ge_int_any(aTHX_ SP, obj,key,limit);
+#line 6572 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_lt_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_lt_int_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 1371 "SizeBalanced.xs"
+        SP = split_lt_int_any(aTHX_ SP, obj,key);
+#line 6594 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_le_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_le_int_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 1376 "SizeBalanced.xs"
+        SP = split_le_int_any(aTHX_ SP, obj,key);
+#line 6616 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_join_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_join_int_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 1381 "SizeBalanced.xs"
+        SP = join_int_any(aTHX_ SP, obj,other);
+#line 6638 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_union_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_union_int_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 1386 "SizeBalanced.xs"
+        SP = union_int_any(aTHX_ SP, obj,other);
+#line 6660 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_intersection_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_intersection_int_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 1391 "SizeBalanced.xs"
+        SP = intersection_int_any(aTHX_ SP, obj,other);
+#line 6682 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_difference_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_difference_int_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 1396 "SizeBalanced.xs"
+        SP = difference_int_any(aTHX_ SP, obj,other);
+#line 6704 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_int_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 1402 "SizeBalanced.xs"
+        SP = find_int_any(aTHX_ SP, obj,key,limit);
+#line 6734 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_first_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_first_int_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 1407 "SizeBalanced.xs"
+        SP = find_first_int_any(aTHX_ SP, obj,key,limit);
+#line 6764 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_last_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_last_int_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 1412 "SizeBalanced.xs"
+        SP = find_last_int_any(aTHX_ SP, obj,key,limit);
+#line 6794 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_exists_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_exists_int_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 1417 "SizeBalanced.xs"
+        SP = exists_int_any(aTHX_ SP, obj,key);
+#line 6816 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_get_many_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_get_many_int_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 1422 "SizeBalanced.xs"
+        SP = get_many_int_any(aTHX_ SP, obj,keys);
+#line 6838 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_int_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 1427 "SizeBalanced.xs"
+        SP = find_lt_int_any(aTHX_ SP, obj,key,limit);
+#line 6868 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_int_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 1432 "SizeBalanced.xs"
+        SP = find_le_int_any(aTHX_ SP, obj,key,limit);
+#line 6898 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_int_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 1437 "SizeBalanced.xs"
+        SP = find_gt_int_any(aTHX_ SP, obj,key,limit);
+#line 6928 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_int_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 1442 "SizeBalanced.xs"
+        SP = find_ge_int_any(aTHX_ SP, obj,key,limit);
+#line 6958 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_many_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_many_int_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 1448 "SizeBalanced.xs"
+        SP = find_lt_many_int_any(aTHX_ SP, obj,keys);
+#line 6980 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_many_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_many_int_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 1453 "SizeBalanced.xs"
+        SP = find_le_many_int_any(aTHX_ SP, obj,keys);
+#line 7002 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_many_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_many_int_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 1458 "SizeBalanced.xs"
+        SP = find_gt_many_int_any(aTHX_ SP, obj,keys);
+#line 7024 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_many_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_many_int_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 1463 "SizeBalanced.xs"
+        SP = find_ge_many_int_any(aTHX_ SP, obj,keys);
+#line 7046 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_lt_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_lt_int_any)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 1469 "SizeBalanced.xs"
+        SP = find_gt_lt_int_any(aTHX_ SP, obj,lower_key,upper_key);
+#line 7070 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_lt_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_lt_int_any)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 1474 "SizeBalanced.xs"
+        SP = find_ge_lt_int_any(aTHX_ SP, obj,lower_key,upper_key);
+#line 7094 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_le_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_le_int_any)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 1479 "SizeBalanced.xs"
+        SP = find_gt_le_int_any(aTHX_ SP, obj,lower_key,upper_key);
+#line 7118 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_le_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_le_int_any)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 1484 "SizeBalanced.xs"
+        SP = find_ge_le_int_any(aTHX_ SP, obj,lower_key,upper_key);
+#line 7142 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_int_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 1490 "SizeBalanced.xs"
+        SP = count_lt_int_any(aTHX_ SP, obj,key);
+#line 7164 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_int_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 1495 "SizeBalanced.xs"
+        SP = count_le_int_any(aTHX_ SP, obj,key);
+#line 7186 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_int_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 1500 "SizeBalanced.xs"
+        SP = count_gt_int_any(aTHX_ SP, obj,key);
+#line 7208 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_int_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 1505 "SizeBalanced.xs"
+        SP = count_ge_int_any(aTHX_ SP, obj,key);
+#line 7230 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_eq_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_eq_int_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 1510 "SizeBalanced.xs"
+        SP = count_eq_int_any(aTHX_ SP, obj,key);
+#line 7252 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_equal_range_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_equal_range_int_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 1515 "SizeBalanced.xs"
+        SP = equal_range_int_any(aTHX_ SP, obj,key);
+#line 7274 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_many_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_many_int_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 1521 "SizeBalanced.xs"
+        SP = count_lt_many_int_any(aTHX_ SP, obj,keys);
+#line 7296 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_many_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_many_int_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 1526 "SizeBalanced.xs"
+        SP = count_le_many_int_any(aTHX_ SP, obj,keys);
+#line 7318 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_many_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_many_int_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 1531 "SizeBalanced.xs"
+        SP = count_gt_many_int_any(aTHX_ SP, obj,keys);
+#line 7340 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_many_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_many_int_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 1536 "SizeBalanced.xs"
+        SP = count_ge_many_int_any(aTHX_ SP, obj,keys);
+#line 7362 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_apply_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_apply_int_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, ops");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	ops = ST(1)
+;
+#line 1542 "SizeBalanced.xs"
+        SP = apply_int_any(aTHX_ SP, obj,ops);
+#line 7384 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_min_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_min_int_any)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 1548 "SizeBalanced.xs"
+        SP = find_min_int_any(aTHX_ SP, obj,limit);
+#line 7412 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_max_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_max_int_any)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 1553 "SizeBalanced.xs"
+        SP = find_max_int_any(aTHX_ SP, obj,limit);
+#line 7440 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_min_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_min_int_any)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 1559 "SizeBalanced.xs"
+        SP = pop_min_int_any(aTHX_ SP, obj,limit);
+#line 7468 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_max_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_max_int_any)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 1564 "SizeBalanced.xs"
+        SP = pop_max_int_any(aTHX_ SP, obj,limit);
+#line 7496 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_l_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_l_int_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, offset, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	offset = (int)SvIV(ST(1))
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 1570 "SizeBalanced.xs"
+        SP = skip_l_int_any(aTHX_ SP, obj,offset,limit);
+#line 7526 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_g_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_g_int_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, offset, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	offset = (int)SvIV(ST(1))
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 1575 "SizeBalanced.xs"
+        SP = skip_g_int_any(aTHX_ SP, obj,offset,limit);
+#line 7556 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_at_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_at_int_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, offset");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	offset = (int)SvIV(ST(1))
+;
+#line 1580 "SizeBalanced.xs"
+        SP = delete_at_int_any(aTHX_ SP, obj,offset);
+#line 7578 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ranks_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ranks_int_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, from, count= -1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	from = (int)SvIV(ST(1))
+;
+	int	count;
+
+	if (items < 3)
+	    count = -1;
+	else {
+	    count = (int)SvIV(ST(2))
+;
+	}
+#line 1585 "SizeBalanced.xs"
+        SP = delete_ranks_int_any(aTHX_ SP, obj,from,count);
+#line 7608 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_clear_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_clear_int_any)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 1591 "SizeBalanced.xs"
+        SP = clear_int_any(aTHX_ SP, obj);
+#line 7628 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_reserve_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_reserve_int_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, n");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	IV	n = (IV)SvIV(ST(1))
+;
+#line 1596 "SizeBalanced.xs"
+        SP = reserve_int_any(aTHX_ SP, obj,n);
+#line 7650 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_compact_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_compact_int_any)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 1601 "SizeBalanced.xs"
+        SP = compact_int_any(aTHX_ SP, obj);
+#line 7670 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_dump_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_dump_int_any)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 1607 "SizeBalanced.xs"
+        SP = dump_int_any(aTHX_ SP, obj);
+#line 7690 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_check_int_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_check_int_any)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 1612 "SizeBalanced.xs"
+        SP = check_int_any(aTHX_ SP, obj);
+#line 7710 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_num_void)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "class, cmp= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	class = ST(0)
+;
+	SV *	cmp;
+
+	if (items < 2)
+	    cmp = &PL_sv_undef;
+	else {
+	    cmp = ST(1)
+;
+	}
+#line 1618 "SizeBalanced.xs"
+        SP = new_num_void(aTHX_ SP, class,cmp);
+#line 7738 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_from_sorted_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_from_sorted_num_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 4)
+       croak_xs_usage(cv,  "class, keys, values= &PL_sv_undef, cmp= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	class = ST(0)
+;
+	SV *	keys = ST(1)
+;
+	SV *	values;
+	SV *	cmp;
+
+	if (items < 3)
+	    values = &PL_sv_undef;
+	else {
+	    values = ST(2)
+;
+	}
+
+	if (items < 4)
+	    cmp = &PL_sv_undef;
+	else {
+	    cmp = ST(3)
+;
+	}
+#line 1623 "SizeBalanced.xs"
+        SP = new_from_sorted_num_void(aTHX_ SP, class,keys,values,cmp);
+#line 7776 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_DESTROY_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_DESTROY_num_void)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 1628 "SizeBalanced.xs"
+        SP = DESTROY_num_void(aTHX_ SP, obj);
+#line 7796 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_size_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_size_num_void)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 1634 "SizeBalanced.xs"
+        SP = size_num_void(aTHX_ SP, obj);
+#line 7816 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_ever_height_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_ever_height_num_void)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 1639 "SizeBalanced.xs"
+        SP = ever_height_num_void(aTHX_ SP, obj);
+#line 7836 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_cmp_count_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_cmp_count_num_void)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 1644 "SizeBalanced.xs"
+        SP = cmp_count_num_void(aTHX_ SP, obj);
+#line 7856 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_num_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 1649 "SizeBalanced.xs"
+        SP = insert_num_void(aTHX_ SP, obj,key,value);
+#line 7886 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_before_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_before_num_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 1654 "SizeBalanced.xs"
+        SP = insert_before_num_void(aTHX_ SP, obj,key,value);
+#line 7916 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_after_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_after_num_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 1659 "SizeBalanced.xs"
+        SP = insert_after_num_void(aTHX_ SP, obj,key,value);
+#line 7946 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_unique_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_unique_num_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 1664 "SizeBalanced.xs"
+        SP = insert_unique_num_void(aTHX_ SP, obj,key,value);
+#line 7976 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_set_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_set_num_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 1669 "SizeBalanced.xs"
+        SP = set_num_void(aTHX_ SP, obj,key,value);
+#line 8006 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_add_value_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_add_value_num_void)
+{
+    dVAR; dXSARGS;
+    if (items < 3 || items > 4)
+       croak_xs_usage(cv,  "obj, key, delta, insert= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	delta = ST(2)
+;
+	int	insert;
+
+	if (items < 4)
+	    insert = 1;
+	else {
+	    insert = (int)SvIV(ST(3))
+;
+	}
+#line 1674 "SizeBalanced.xs"
+        SP = add_value_num_void(aTHX_ SP, obj,key,delta,insert);
+#line 8038 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_incr_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_incr_num_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 1679 "SizeBalanced.xs"
+        SP = incr_num_void(aTHX_ SP, obj,key);
+#line 8060 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_many_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_many_num_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, keys, values= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+	SV *	values;
+
+	if (items < 3)
+	    values = &PL_sv_undef;
+	else {
+	    values = ST(2)
+;
+	}
+#line 1684 "SizeBalanced.xs"
+        SP = insert_many_num_void(aTHX_ SP, obj,keys,values);
+#line 8090 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_num_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 1689 "SizeBalanced.xs"
+        SP = delete_num_void(aTHX_ SP, obj,key);
+#line 8112 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_first_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_first_num_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 1694 "SizeBalanced.xs"
+        SP = delete_first_num_void(aTHX_ SP, obj,key);
+#line 8134 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_last_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_last_num_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 1699 "SizeBalanced.xs"
+        SP = delete_last_num_void(aTHX_ SP, obj,key);
+#line 8156 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_first_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_first_num_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 1704 "SizeBalanced.xs"
+        SP = take_first_num_void(aTHX_ SP, obj,key);
+#line 8178 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_last_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_last_num_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 1709 "SizeBalanced.xs"
+        SP = take_last_num_void(aTHX_ SP, obj,key);
+#line 8200 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_num_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 1714 "SizeBalanced.xs"
+        SP = delete_many_num_void(aTHX_ SP, obj,keys);
+#line 8222 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_first_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_first_num_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 1719 "SizeBalanced.xs"
+        SP = delete_many_first_num_void(aTHX_ SP, obj,keys);
+#line 8244 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_last_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_last_num_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 1724 "SizeBalanced.xs"
+        SP = delete_many_last_num_void(aTHX_ SP, obj,keys);
+#line 8266 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_lt_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_lt_num_void)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 1729 "SizeBalanced.xs"
+        SP = delete_gt_lt_num_void(aTHX_ SP, obj,lower_key,upper_key);
+#line 8290 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_lt_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_lt_num_void)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 1734 "SizeBalanced.xs"
+        SP = delete_ge_lt_num_void(aTHX_ SP, obj,lower_key,upper_key);
+#line 8314 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_le_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_le_num_void)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 1739 "SizeBalanced.xs"
+        SP = delete_gt_le_num_void(aTHX_ SP, obj,lower_key,upper_key);
+#line 8338 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_le_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_le_num_void)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 1744 "SizeBalanced.xs"
+        SP = delete_ge_le_num_void(aTHX_ SP, obj,lower_key,upper_key);
+#line 8362 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_le_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_le_num_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= -1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = -1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 1749 "SizeBalanced.xs"
+        SP = drain_le_num_void(aTHX_ SP, obj,key,limit);
+#line 8392 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_ge_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_ge_num_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= -1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = -1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 1754 "SizeBalanced.xs"
+        SP = drain_ge_num_void(aTHX_ SP, obj,key,limit);
+#line 8422 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_lt_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_lt_num_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 1760 "SizeBalanced.xs"
+        SP = split_lt_num_void(aTHX_ SP, obj,key);
+#line 8444 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_le_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_le_num_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 1765 "SizeBalanced.xs"
+        SP = split_le_num_void(aTHX_ SP, obj,key);
+#line 8466 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_join_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_join_num_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 1770 "SizeBalanced.xs"
+        SP = join_num_void(aTHX_ SP, obj,other);
+#line 8488 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_union_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_union_num_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 1775 "SizeBalanced.xs"
+        SP = union_num_void(aTHX_ SP, obj,other);
+#line 8510 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_intersection_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_intersection_num_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 1780 "SizeBalanced.xs"
+        SP = intersection_num_void(aTHX_ SP, obj,other);
+#line 8532 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_difference_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_difference_num_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 1785 "SizeBalanced.xs"
+        SP = difference_num_void(aTHX_ SP, obj,other);
+#line 8554 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_num_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 1791 "SizeBalanced.xs"
+        SP = find_num_void(aTHX_ SP, obj,key,limit);
+#line 8584 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_first_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_first_num_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 1796 "SizeBalanced.xs"
+        SP = find_first_num_void(aTHX_ SP, obj,key,limit);
+#line 8614 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_last_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_last_num_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 1801 "SizeBalanced.xs"
+        SP = find_last_num_void(aTHX_ SP, obj,key,limit);
+#line 8644 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_exists_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_exists_num_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 1806 "SizeBalanced.xs"
+        SP = exists_num_void(aTHX_ SP, obj,key);
+#line 8666 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_get_many_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_get_many_num_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 1811 "SizeBalanced.xs"
+        SP = get_many_num_void(aTHX_ SP, obj,keys);
+#line 8688 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_num_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 1816 "SizeBalanced.xs"
+        SP = find_lt_num_void(aTHX_ SP, obj,key,limit);
+#line 8718 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_num_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 1821 "SizeBalanced.xs"
+        SP = find_le_num_void(aTHX_ SP, obj,key,limit);
+#line 8748 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_num_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 1826 "SizeBalanced.xs"
+        SP = find_gt_num_void(aTHX_ SP, obj,key,limit);
+#line 8778 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_num_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 1831 "SizeBalanced.xs"
+        SP = find_ge_num_void(aTHX_ SP, obj,key,limit);
+#line 8808 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_many_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_many_num_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 1837 "SizeBalanced.xs"
+        SP = find_lt_many_num_void(aTHX_ SP, obj,keys);
+#line 8830 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_many_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_many_num_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 1842 "SizeBalanced.xs"
+        SP = find_le_many_num_void(aTHX_ SP, obj,keys);
+#line 8852 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_many_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_many_num_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 1847 "SizeBalanced.xs"
+        SP = find_gt_many_num_void(aTHX_ SP, obj,keys);
+#line 8874 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_many_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_many_num_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 1852 "SizeBalanced.xs"
+        SP = find_ge_many_num_void(aTHX_ SP, obj,keys);
+#line 8896 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_lt_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_lt_num_void)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 1858 "SizeBalanced.xs"
+        SP = find_gt_lt_num_void(aTHX_ SP, obj,lower_key,upper_key);
+#line 8920 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_lt_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_lt_num_void)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 1863 "SizeBalanced.xs"
+        SP = find_ge_lt_num_void(aTHX_ SP, obj,lower_key,upper_key);
+#line 8944 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_le_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_le_num_void)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 1868 "SizeBalanced.xs"
+        SP = find_gt_le_num_void(aTHX_ SP, obj,lower_key,upper_key);
+#line 8968 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_le_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_le_num_void)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 1873 "SizeBalanced.xs"
+        SP = find_ge_le_num_void(aTHX_ SP, obj,lower_key,upper_key);
+#line 8992 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_num_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 1879 "SizeBalanced.xs"
+        SP = count_lt_num_void(aTHX_ SP, obj,key);
+#line 9014 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_num_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 1884 "SizeBalanced.xs"
+        SP = count_le_num_void(aTHX_ SP, obj,key);
+#line 9036 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_num_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 1889 "SizeBalanced.xs"
+        SP = count_gt_num_void(aTHX_ SP, obj,key);
+#line 9058 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_num_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 1894 "SizeBalanced.xs"
+        SP = count_ge_num_void(aTHX_ SP, obj,key);
+#line 9080 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_eq_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_eq_num_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 1899 "SizeBalanced.xs"
+        SP = count_eq_num_void(aTHX_ SP, obj,key);
+#line 9102 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_equal_range_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_equal_range_num_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 1904 "SizeBalanced.xs"
+        SP = equal_range_num_void(aTHX_ SP, obj,key);
+#line 9124 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_many_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_many_num_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 1910 "SizeBalanced.xs"
+        SP = count_lt_many_num_void(aTHX_ SP, obj,keys);
+#line 9146 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_many_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_many_num_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 1915 "SizeBalanced.xs"
+        SP = count_le_many_num_void(aTHX_ SP, obj,keys);
+#line 9168 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_many_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_many_num_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 1920 "SizeBalanced.xs"
+        SP = count_gt_many_num_void(aTHX_ SP, obj,keys);
+#line 9190 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_many_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_many_num_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 1925 "SizeBalanced.xs"
+        SP = count_ge_many_num_void(aTHX_ SP, obj,keys);
+#line 9212 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_apply_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_apply_num_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, ops");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	ops = ST(1)
+;
+#line 1931 "SizeBalanced.xs"
+        SP = apply_num_void(aTHX_ SP, obj,ops);
+#line 9234 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_min_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_min_num_void)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 1937 "SizeBalanced.xs"
+        SP = find_min_num_void(aTHX_ SP, obj,limit);
+#line 9262 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_max_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_max_num_void)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 1942 "SizeBalanced.xs"
+        SP = find_max_num_void(aTHX_ SP, obj,limit);
+#line 9290 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_min_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_min_num_void)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 1948 "SizeBalanced.xs"
+        SP = pop_min_num_void(aTHX_ SP, obj,limit);
+#line 9318 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_max_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_max_num_void)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 1953 "SizeBalanced.xs"
+        SP = pop_max_num_void(aTHX_ SP, obj,limit);
+#line 9346 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_l_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_l_num_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, offset, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	offset = (int)SvIV(ST(1))
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 1959 "SizeBalanced.xs"
+        SP = skip_l_num_void(aTHX_ SP, obj,offset,limit);
+#line 9376 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_g_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_g_num_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, offset, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	offset = (int)SvIV(ST(1))
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 1964 "SizeBalanced.xs"
+        SP = skip_g_num_void(aTHX_ SP, obj,offset,limit);
+#line 9406 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_at_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_at_num_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, offset");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	offset = (int)SvIV(ST(1))
+;
+#line 1969 "SizeBalanced.xs"
+        SP = delete_at_num_void(aTHX_ SP, obj,offset);
+#line 9428 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ranks_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ranks_num_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, from, count= -1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	from = (int)SvIV(ST(1))
+;
+	int	count;
+
+	if (items < 3)
+	    count = -1;
+	else {
+	    count = (int)SvIV(ST(2))
+;
+	}
+#line 1974 "SizeBalanced.xs"
+        SP = delete_ranks_num_void(aTHX_ SP, obj,from,count);
+#line 9458 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_clear_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_clear_num_void)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 1980 "SizeBalanced.xs"
+        SP = clear_num_void(aTHX_ SP, obj);
+#line 9478 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_reserve_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_reserve_num_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, n");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	IV	n = (IV)SvIV(ST(1))
+;
+#line 1985 "SizeBalanced.xs"
+        SP = reserve_num_void(aTHX_ SP, obj,n);
+#line 9500 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_compact_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_compact_num_void)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 1990 "SizeBalanced.xs"
+        SP = compact_num_void(aTHX_ SP, obj);
+#line 9520 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_dump_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_dump_num_void)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 1996 "SizeBalanced.xs"
+        SP = dump_num_void(aTHX_ SP, obj);
+#line 9540 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_check_num_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_check_num_void)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 2001 "SizeBalanced.xs"
+        SP = check_num_void(aTHX_ SP, obj);
+#line 9560 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_num_int)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "class, cmp= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	class = ST(0)
+;
+	SV *	cmp;
+
+	if (items < 2)
+	    cmp = &PL_sv_undef;
+	else {
+	    cmp = ST(1)
+;
+	}
+#line 2007 "SizeBalanced.xs"
+        SP = new_num_int(aTHX_ SP, class,cmp);
+#line 9588 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_from_sorted_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_from_sorted_num_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 4)
+       croak_xs_usage(cv,  "class, keys, values= &PL_sv_undef, cmp= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	class = ST(0)
+;
+	SV *	keys = ST(1)
+;
+	SV *	values;
+	SV *	cmp;
+
+	if (items < 3)
+	    values = &PL_sv_undef;
+	else {
+	    values = ST(2)
+;
+	}
+
+	if (items < 4)
+	    cmp = &PL_sv_undef;
+	else {
+	    cmp = ST(3)
+;
+	}
+#line 2012 "SizeBalanced.xs"
+        SP = new_from_sorted_num_int(aTHX_ SP, class,keys,values,cmp);
+#line 9626 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_DESTROY_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_DESTROY_num_int)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 2017 "SizeBalanced.xs"
+        SP = DESTROY_num_int(aTHX_ SP, obj);
+#line 9646 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_size_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_size_num_int)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 2023 "SizeBalanced.xs"
+        SP = size_num_int(aTHX_ SP, obj);
+#line 9666 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_ever_height_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_ever_height_num_int)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 2028 "SizeBalanced.xs"
+        SP = ever_height_num_int(aTHX_ SP, obj);
+#line 9686 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_cmp_count_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_cmp_count_num_int)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 2033 "SizeBalanced.xs"
+        SP = cmp_count_num_int(aTHX_ SP, obj);
+#line 9706 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_num_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 2038 "SizeBalanced.xs"
+        SP = insert_num_int(aTHX_ SP, obj,key,value);
+#line 9736 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_before_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_before_num_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 2043 "SizeBalanced.xs"
+        SP = insert_before_num_int(aTHX_ SP, obj,key,value);
+#line 9766 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_after_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_after_num_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 2048 "SizeBalanced.xs"
+        SP = insert_after_num_int(aTHX_ SP, obj,key,value);
+#line 9796 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_unique_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_unique_num_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 2053 "SizeBalanced.xs"
+        SP = insert_unique_num_int(aTHX_ SP, obj,key,value);
+#line 9826 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_set_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_set_num_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 2058 "SizeBalanced.xs"
+        SP = set_num_int(aTHX_ SP, obj,key,value);
+#line 9856 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_add_value_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_add_value_num_int)
+{
+    dVAR; dXSARGS;
+    if (items < 3 || items > 4)
+       croak_xs_usage(cv,  "obj, key, delta, insert= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	delta = ST(2)
+;
+	int	insert;
+
+	if (items < 4)
+	    insert = 1;
+	else {
+	    insert = (int)SvIV(ST(3))
+;
+	}
+#line 2063 "SizeBalanced.xs"
+        SP = add_value_num_int(aTHX_ SP, obj,key,delta,insert);
+#line 9888 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_incr_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_incr_num_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 2068 "SizeBalanced.xs"
+        SP = incr_num_int(aTHX_ SP, obj,key);
+#line 9910 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_many_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_many_num_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, keys, values= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+	SV *	values;
+
+	if (items < 3)
+	    values = &PL_sv_undef;
+	else {
+	    values = ST(2)
+;
+	}
+#line 2073 "SizeBalanced.xs"
+        SP = insert_many_num_int(aTHX_ SP, obj,keys,values);
+#line 9940 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_num_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 2078 "SizeBalanced.xs"
+        SP = delete_num_int(aTHX_ SP, obj,key);
+#line 9962 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_first_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_first_num_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 2083 "SizeBalanced.xs"
+        SP = delete_first_num_int(aTHX_ SP, obj,key);
+#line 9984 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_last_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_last_num_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 2088 "SizeBalanced.xs"
+        SP = delete_last_num_int(aTHX_ SP, obj,key);
+#line 10006 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_first_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_first_num_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 2093 "SizeBalanced.xs"
+        SP = take_first_num_int(aTHX_ SP, obj,key);
+#line 10028 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_last_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_last_num_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 2098 "SizeBalanced.xs"
+        SP = take_last_num_int(aTHX_ SP, obj,key);
+#line 10050 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_num_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 2103 "SizeBalanced.xs"
+        SP = delete_many_num_int(aTHX_ SP, obj,keys);
+#line 10072 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_first_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_first_num_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 2108 "SizeBalanced.xs"
+        SP = delete_many_first_num_int(aTHX_ SP, obj,keys);
+#line 10094 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_last_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_last_num_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 2113 "SizeBalanced.xs"
+        SP = delete_many_last_num_int(aTHX_ SP, obj,keys);
+#line 10116 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_lt_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_lt_num_int)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 2118 "SizeBalanced.xs"
+        SP = delete_gt_lt_num_int(aTHX_ SP, obj,lower_key,upper_key);
+#line 10140 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_lt_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_lt_num_int)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 2123 "SizeBalanced.xs"
+        SP = delete_ge_lt_num_int(aTHX_ SP, obj,lower_key,upper_key);
+#line 10164 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_le_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_le_num_int)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 2128 "SizeBalanced.xs"
+        SP = delete_gt_le_num_int(aTHX_ SP, obj,lower_key,upper_key);
+#line 10188 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_le_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_le_num_int)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 2133 "SizeBalanced.xs"
+        SP = delete_ge_le_num_int(aTHX_ SP, obj,lower_key,upper_key);
+#line 10212 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_le_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_le_num_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= -1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = -1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 2138 "SizeBalanced.xs"
+        SP = drain_le_num_int(aTHX_ SP, obj,key,limit);
+#line 10242 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_ge_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_ge_num_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= -1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = -1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 2143 "SizeBalanced.xs"
+        SP = drain_ge_num_int(aTHX_ SP, obj,key,limit);
+#line 10272 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_lt_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_lt_num_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 2149 "SizeBalanced.xs"
+        SP = split_lt_num_int(aTHX_ SP, obj,key);
+#line 10294 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_le_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_le_num_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 2154 "SizeBalanced.xs"
+        SP = split_le_num_int(aTHX_ SP, obj,key);
+#line 10316 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_join_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_join_num_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 2159 "SizeBalanced.xs"
+        SP = join_num_int(aTHX_ SP, obj,other);
+#line 10338 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_union_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_union_num_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 2164 "SizeBalanced.xs"
+        SP = union_num_int(aTHX_ SP, obj,other);
+#line 10360 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_intersection_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_intersection_num_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 2169 "SizeBalanced.xs"
+        SP = intersection_num_int(aTHX_ SP, obj,other);
+#line 10382 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_difference_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_difference_num_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 2174 "SizeBalanced.xs"
+        SP = difference_num_int(aTHX_ SP, obj,other);
+#line 10404 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_num_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 2180 "SizeBalanced.xs"
+        SP = find_num_int(aTHX_ SP, obj,key,limit);
+#line 10434 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_first_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_first_num_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 2185 "SizeBalanced.xs"
+        SP = find_first_num_int(aTHX_ SP, obj,key,limit);
+#line 10464 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_last_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_last_num_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 2190 "SizeBalanced.xs"
+        SP = find_last_num_int(aTHX_ SP, obj,key,limit);
+#line 10494 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_exists_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_exists_num_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 2195 "SizeBalanced.xs"
+        SP = exists_num_int(aTHX_ SP, obj,key);
+#line 10516 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_get_many_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_get_many_num_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 2200 "SizeBalanced.xs"
+        SP = get_many_num_int(aTHX_ SP, obj,keys);
+#line 10538 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_num_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 2205 "SizeBalanced.xs"
+        SP = find_lt_num_int(aTHX_ SP, obj,key,limit);
+#line 10568 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_num_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 2210 "SizeBalanced.xs"
+        SP = find_le_num_int(aTHX_ SP, obj,key,limit);
+#line 10598 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_num_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 2215 "SizeBalanced.xs"
+        SP = find_gt_num_int(aTHX_ SP, obj,key,limit);
+#line 10628 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_num_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 2220 "SizeBalanced.xs"
+        SP = find_ge_num_int(aTHX_ SP, obj,key,limit);
+#line 10658 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_many_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_many_num_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 2226 "SizeBalanced.xs"
+        SP = find_lt_many_num_int(aTHX_ SP, obj,keys);
+#line 10680 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_many_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_many_num_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 2231 "SizeBalanced.xs"
+        SP = find_le_many_num_int(aTHX_ SP, obj,keys);
+#line 10702 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_many_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_many_num_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 2236 "SizeBalanced.xs"
+        SP = find_gt_many_num_int(aTHX_ SP, obj,keys);
+#line 10724 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_many_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_many_num_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 2241 "SizeBalanced.xs"
+        SP = find_ge_many_num_int(aTHX_ SP, obj,keys);
+#line 10746 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_lt_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_lt_num_int)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 2247 "SizeBalanced.xs"
+        SP = find_gt_lt_num_int(aTHX_ SP, obj,lower_key,upper_key);
+#line 10770 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_lt_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_lt_num_int)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 2252 "SizeBalanced.xs"
+        SP = find_ge_lt_num_int(aTHX_ SP, obj,lower_key,upper_key);
+#line 10794 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_le_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_le_num_int)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 2257 "SizeBalanced.xs"
+        SP = find_gt_le_num_int(aTHX_ SP, obj,lower_key,upper_key);
+#line 10818 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_le_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_le_num_int)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 2262 "SizeBalanced.xs"
+        SP = find_ge_le_num_int(aTHX_ SP, obj,lower_key,upper_key);
+#line 10842 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_num_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 2268 "SizeBalanced.xs"
+        SP = count_lt_num_int(aTHX_ SP, obj,key);
+#line 10864 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_num_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 2273 "SizeBalanced.xs"
+        SP = count_le_num_int(aTHX_ SP, obj,key);
+#line 10886 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_num_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 2278 "SizeBalanced.xs"
+        SP = count_gt_num_int(aTHX_ SP, obj,key);
+#line 10908 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_num_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 2283 "SizeBalanced.xs"
+        SP = count_ge_num_int(aTHX_ SP, obj,key);
+#line 10930 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_eq_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_eq_num_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 2288 "SizeBalanced.xs"
+        SP = count_eq_num_int(aTHX_ SP, obj,key);
+#line 10952 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_equal_range_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_equal_range_num_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 2293 "SizeBalanced.xs"
+        SP = equal_range_num_int(aTHX_ SP, obj,key);
+#line 10974 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_many_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_many_num_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 2299 "SizeBalanced.xs"
+        SP = count_lt_many_num_int(aTHX_ SP, obj,keys);
+#line 10996 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_many_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_many_num_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 2304 "SizeBalanced.xs"
+        SP = count_le_many_num_int(aTHX_ SP, obj,keys);
+#line 11018 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_many_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_many_num_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 2309 "SizeBalanced.xs"
+        SP = count_gt_many_num_int(aTHX_ SP, obj,keys);
+#line 11040 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_many_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_many_num_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 2314 "SizeBalanced.xs"
+        SP = count_ge_many_num_int(aTHX_ SP, obj,keys);
+#line 11062 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_apply_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_apply_num_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, ops");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	ops = ST(1)
+;
+#line 2320 "SizeBalanced.xs"
+        SP = apply_num_int(aTHX_ SP, obj,ops);
+#line 11084 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_min_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_min_num_int)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 2326 "SizeBalanced.xs"
+        SP = find_min_num_int(aTHX_ SP, obj,limit);
+#line 11112 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_max_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_max_num_int)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 2331 "SizeBalanced.xs"
+        SP = find_max_num_int(aTHX_ SP, obj,limit);
+#line 11140 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_min_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_min_num_int)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 2337 "SizeBalanced.xs"
+        SP = pop_min_num_int(aTHX_ SP, obj,limit);
+#line 11168 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_max_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_max_num_int)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 2342 "SizeBalanced.xs"
+        SP = pop_max_num_int(aTHX_ SP, obj,limit);
+#line 11196 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_l_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_l_num_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, offset, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	offset = (int)SvIV(ST(1))
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 2348 "SizeBalanced.xs"
+        SP = skip_l_num_int(aTHX_ SP, obj,offset,limit);
+#line 11226 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_g_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_g_num_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, offset, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	offset = (int)SvIV(ST(1))
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 2353 "SizeBalanced.xs"
+        SP = skip_g_num_int(aTHX_ SP, obj,offset,limit);
+#line 11256 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_at_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_at_num_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, offset");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	offset = (int)SvIV(ST(1))
+;
+#line 2358 "SizeBalanced.xs"
+        SP = delete_at_num_int(aTHX_ SP, obj,offset);
+#line 11278 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ranks_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ranks_num_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, from, count= -1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	from = (int)SvIV(ST(1))
+;
+	int	count;
+
+	if (items < 3)
+	    count = -1;
+	else {
+	    count = (int)SvIV(ST(2))
+;
+	}
+#line 2363 "SizeBalanced.xs"
+        SP = delete_ranks_num_int(aTHX_ SP, obj,from,count);
+#line 11308 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_clear_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_clear_num_int)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 2369 "SizeBalanced.xs"
+        SP = clear_num_int(aTHX_ SP, obj);
+#line 11328 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_reserve_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_reserve_num_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, n");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	IV	n = (IV)SvIV(ST(1))
+;
+#line 2374 "SizeBalanced.xs"
+        SP = reserve_num_int(aTHX_ SP, obj,n);
+#line 11350 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_compact_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_compact_num_int)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 2379 "SizeBalanced.xs"
+        SP = compact_num_int(aTHX_ SP, obj);
+#line 11370 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_dump_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_dump_num_int)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 2385 "SizeBalanced.xs"
+        SP = dump_num_int(aTHX_ SP, obj);
+#line 11390 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_check_num_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_check_num_int)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 2390 "SizeBalanced.xs"
+        SP = check_num_int(aTHX_ SP, obj);
+#line 11410 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_num_num)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "class, cmp= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	class = ST(0)
+;
+	SV *	cmp;
+
+	if (items < 2)
+	    cmp = &PL_sv_undef;
+	else {
+	    cmp = ST(1)
+;
+	}
+#line 2396 "SizeBalanced.xs"
+        SP = new_num_num(aTHX_ SP, class,cmp);
+#line 11438 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_from_sorted_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_from_sorted_num_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 4)
+       croak_xs_usage(cv,  "class, keys, values= &PL_sv_undef, cmp= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	class = ST(0)
+;
+	SV *	keys = ST(1)
+;
+	SV *	values;
+	SV *	cmp;
+
+	if (items < 3)
+	    values = &PL_sv_undef;
+	else {
+	    values = ST(2)
+;
+	}
+
+	if (items < 4)
+	    cmp = &PL_sv_undef;
+	else {
+	    cmp = ST(3)
+;
+	}
+#line 2401 "SizeBalanced.xs"
+        SP = new_from_sorted_num_num(aTHX_ SP, class,keys,values,cmp);
+#line 11476 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_DESTROY_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_DESTROY_num_num)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 2406 "SizeBalanced.xs"
+        SP = DESTROY_num_num(aTHX_ SP, obj);
+#line 11496 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_size_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_size_num_num)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 2412 "SizeBalanced.xs"
+        SP = size_num_num(aTHX_ SP, obj);
+#line 11516 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_ever_height_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_ever_height_num_num)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 2417 "SizeBalanced.xs"
+        SP = ever_height_num_num(aTHX_ SP, obj);
+#line 11536 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_cmp_count_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_cmp_count_num_num)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 2422 "SizeBalanced.xs"
+        SP = cmp_count_num_num(aTHX_ SP, obj);
+#line 11556 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_num_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 2427 "SizeBalanced.xs"
+        SP = insert_num_num(aTHX_ SP, obj,key,value);
+#line 11586 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_before_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_before_num_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 2432 "SizeBalanced.xs"
+        SP = insert_before_num_num(aTHX_ SP, obj,key,value);
+#line 11616 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_after_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_after_num_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 2437 "SizeBalanced.xs"
+        SP = insert_after_num_num(aTHX_ SP, obj,key,value);
+#line 11646 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_unique_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_unique_num_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 2442 "SizeBalanced.xs"
+        SP = insert_unique_num_num(aTHX_ SP, obj,key,value);
+#line 11676 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_set_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_set_num_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 2447 "SizeBalanced.xs"
+        SP = set_num_num(aTHX_ SP, obj,key,value);
+#line 11706 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_add_value_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_add_value_num_num)
+{
+    dVAR; dXSARGS;
+    if (items < 3 || items > 4)
+       croak_xs_usage(cv,  "obj, key, delta, insert= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	delta = ST(2)
+;
+	int	insert;
+
+	if (items < 4)
+	    insert = 1;
+	else {
+	    insert = (int)SvIV(ST(3))
+;
+	}
+#line 2452 "SizeBalanced.xs"
+        SP = add_value_num_num(aTHX_ SP, obj,key,delta,insert);
+#line 11738 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_incr_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_incr_num_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 2457 "SizeBalanced.xs"
+        SP = incr_num_num(aTHX_ SP, obj,key);
+#line 11760 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_many_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_many_num_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, keys, values= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+	SV *	values;
+
+	if (items < 3)
+	    values = &PL_sv_undef;
+	else {
+	    values = ST(2)
+;
+	}
+#line 2462 "SizeBalanced.xs"
+        SP = insert_many_num_num(aTHX_ SP, obj,keys,values);
+#line 11790 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_num_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 2467 "SizeBalanced.xs"
+        SP = delete_num_num(aTHX_ SP, obj,key);
+#line 11812 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_first_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_first_num_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 2472 "SizeBalanced.xs"
+        SP = delete_first_num_num(aTHX_ SP, obj,key);
+#line 11834 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_last_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_last_num_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 2477 "SizeBalanced.xs"
+        SP = delete_last_num_num(aTHX_ SP, obj,key);
+#line 11856 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_first_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_first_num_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 2482 "SizeBalanced.xs"
+        SP = take_first_num_num(aTHX_ SP, obj,key);
+#line 11878 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_last_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_last_num_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 2487 "SizeBalanced.xs"
+        SP = take_last_num_num(aTHX_ SP, obj,key);
+#line 11900 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_num_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 2492 "SizeBalanced.xs"
+        SP = delete_many_num_num(aTHX_ SP, obj,keys);
+#line 11922 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_first_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_first_num_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 2497 "SizeBalanced.xs"
+        SP = delete_many_first_num_num(aTHX_ SP, obj,keys);
+#line 11944 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_last_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_last_num_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 2502 "SizeBalanced.xs"
+        SP = delete_many_last_num_num(aTHX_ SP, obj,keys);
+#line 11966 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_lt_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_lt_num_num)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 2507 "SizeBalanced.xs"
+        SP = delete_gt_lt_num_num(aTHX_ SP, obj,lower_key,upper_key);
+#line 11990 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_lt_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_lt_num_num)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 2512 "SizeBalanced.xs"
+        SP = delete_ge_lt_num_num(aTHX_ SP, obj,lower_key,upper_key);
+#line 12014 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_le_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_le_num_num)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 2517 "SizeBalanced.xs"
+        SP = delete_gt_le_num_num(aTHX_ SP, obj,lower_key,upper_key);
+#line 12038 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_le_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_le_num_num)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 2522 "SizeBalanced.xs"
+        SP = delete_ge_le_num_num(aTHX_ SP, obj,lower_key,upper_key);
+#line 12062 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_le_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_le_num_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= -1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = -1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 2527 "SizeBalanced.xs"
+        SP = drain_le_num_num(aTHX_ SP, obj,key,limit);
+#line 12092 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_ge_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_ge_num_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= -1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = -1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 2532 "SizeBalanced.xs"
+        SP = drain_ge_num_num(aTHX_ SP, obj,key,limit);
+#line 12122 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_lt_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_lt_num_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 2538 "SizeBalanced.xs"
+        SP = split_lt_num_num(aTHX_ SP, obj,key);
+#line 12144 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_le_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_le_num_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 2543 "SizeBalanced.xs"
+        SP = split_le_num_num(aTHX_ SP, obj,key);
+#line 12166 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_join_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_join_num_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 2548 "SizeBalanced.xs"
+        SP = join_num_num(aTHX_ SP, obj,other);
+#line 12188 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_union_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_union_num_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 2553 "SizeBalanced.xs"
+        SP = union_num_num(aTHX_ SP, obj,other);
+#line 12210 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_intersection_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_intersection_num_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 2558 "SizeBalanced.xs"
+        SP = intersection_num_num(aTHX_ SP, obj,other);
+#line 12232 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_difference_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_difference_num_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 2563 "SizeBalanced.xs"
+        SP = difference_num_num(aTHX_ SP, obj,other);
+#line 12254 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_num_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 2569 "SizeBalanced.xs"
+        SP = find_num_num(aTHX_ SP, obj,key,limit);
+#line 12284 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_first_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_first_num_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 2574 "SizeBalanced.xs"
+        SP = find_first_num_num(aTHX_ SP, obj,key,limit);
+#line 12314 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_last_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_last_num_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 2579 "SizeBalanced.xs"
+        SP = find_last_num_num(aTHX_ SP, obj,key,limit);
+#line 12344 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_exists_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_exists_num_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 2584 "SizeBalanced.xs"
+        SP = exists_num_num(aTHX_ SP, obj,key);
+#line 12366 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_get_many_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_get_many_num_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 2589 "SizeBalanced.xs"
+        SP = get_many_num_num(aTHX_ SP, obj,keys);
+#line 12388 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_num_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 2594 "SizeBalanced.xs"
+        SP = find_lt_num_num(aTHX_ SP, obj,key,limit);
+#line 12418 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_num_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 2599 "SizeBalanced.xs"
+        SP = find_le_num_num(aTHX_ SP, obj,key,limit);
+#line 12448 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_num_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 2604 "SizeBalanced.xs"
+        SP = find_gt_num_num(aTHX_ SP, obj,key,limit);
+#line 12478 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_num_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 2609 "SizeBalanced.xs"
+        SP = find_ge_num_num(aTHX_ SP, obj,key,limit);
+#line 12508 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_many_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_many_num_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 2615 "SizeBalanced.xs"
+        SP = find_lt_many_num_num(aTHX_ SP, obj,keys);
+#line 12530 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_many_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_many_num_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 2620 "SizeBalanced.xs"
+        SP = find_le_many_num_num(aTHX_ SP, obj,keys);
+#line 12552 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_many_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_many_num_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 2625 "SizeBalanced.xs"
+        SP = find_gt_many_num_num(aTHX_ SP, obj,keys);
+#line 12574 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_many_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_many_num_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 2630 "SizeBalanced.xs"
+        SP = find_ge_many_num_num(aTHX_ SP, obj,keys);
+#line 12596 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_lt_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_lt_num_num)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 2636 "SizeBalanced.xs"
+        SP = find_gt_lt_num_num(aTHX_ SP, obj,lower_key,upper_key);
+#line 12620 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_lt_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_lt_num_num)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 2641 "SizeBalanced.xs"
+        SP = find_ge_lt_num_num(aTHX_ SP, obj,lower_key,upper_key);
+#line 12644 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_le_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_le_num_num)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 2646 "SizeBalanced.xs"
+        SP = find_gt_le_num_num(aTHX_ SP, obj,lower_key,upper_key);
+#line 12668 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_le_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_le_num_num)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 2651 "SizeBalanced.xs"
+        SP = find_ge_le_num_num(aTHX_ SP, obj,lower_key,upper_key);
+#line 12692 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_num_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 2657 "SizeBalanced.xs"
+        SP = count_lt_num_num(aTHX_ SP, obj,key);
+#line 12714 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_num_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 2662 "SizeBalanced.xs"
+        SP = count_le_num_num(aTHX_ SP, obj,key);
+#line 12736 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_num_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 2667 "SizeBalanced.xs"
+        SP = count_gt_num_num(aTHX_ SP, obj,key);
+#line 12758 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_num_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 2672 "SizeBalanced.xs"
+        SP = count_ge_num_num(aTHX_ SP, obj,key);
+#line 12780 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_eq_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_eq_num_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 2677 "SizeBalanced.xs"
+        SP = count_eq_num_num(aTHX_ SP, obj,key);
+#line 12802 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_equal_range_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_equal_range_num_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 2682 "SizeBalanced.xs"
+        SP = equal_range_num_num(aTHX_ SP, obj,key);
+#line 12824 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_many_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_many_num_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 2688 "SizeBalanced.xs"
+        SP = count_lt_many_num_num(aTHX_ SP, obj,keys);
+#line 12846 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_many_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_many_num_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 2693 "SizeBalanced.xs"
+        SP = count_le_many_num_num(aTHX_ SP, obj,keys);
+#line 12868 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_many_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_many_num_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 2698 "SizeBalanced.xs"
+        SP = count_gt_many_num_num(aTHX_ SP, obj,keys);
+#line 12890 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_many_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_many_num_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 2703 "SizeBalanced.xs"
+        SP = count_ge_many_num_num(aTHX_ SP, obj,keys);
+#line 12912 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_apply_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_apply_num_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, ops");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	ops = ST(1)
+;
+#line 2709 "SizeBalanced.xs"
+        SP = apply_num_num(aTHX_ SP, obj,ops);
+#line 12934 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_min_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_min_num_num)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 2715 "SizeBalanced.xs"
+        SP = find_min_num_num(aTHX_ SP, obj,limit);
+#line 12962 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_max_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_max_num_num)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 2720 "SizeBalanced.xs"
+        SP = find_max_num_num(aTHX_ SP, obj,limit);
+#line 12990 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_min_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_min_num_num)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 2726 "SizeBalanced.xs"
+        SP = pop_min_num_num(aTHX_ SP, obj,limit);
+#line 13018 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_max_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_max_num_num)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 2731 "SizeBalanced.xs"
+        SP = pop_max_num_num(aTHX_ SP, obj,limit);
+#line 13046 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_l_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_l_num_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, offset, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	offset = (int)SvIV(ST(1))
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 2737 "SizeBalanced.xs"
+        SP = skip_l_num_num(aTHX_ SP, obj,offset,limit);
+#line 13076 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_g_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_g_num_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, offset, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	offset = (int)SvIV(ST(1))
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 2742 "SizeBalanced.xs"
+        SP = skip_g_num_num(aTHX_ SP, obj,offset,limit);
+#line 13106 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_at_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_at_num_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, offset");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	offset = (int)SvIV(ST(1))
+;
+#line 2747 "SizeBalanced.xs"
+        SP = delete_at_num_num(aTHX_ SP, obj,offset);
+#line 13128 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ranks_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ranks_num_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, from, count= -1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	from = (int)SvIV(ST(1))
+;
+	int	count;
+
+	if (items < 3)
+	    count = -1;
+	else {
+	    count = (int)SvIV(ST(2))
+;
+	}
+#line 2752 "SizeBalanced.xs"
+        SP = delete_ranks_num_num(aTHX_ SP, obj,from,count);
+#line 13158 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_clear_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_clear_num_num)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 2758 "SizeBalanced.xs"
+        SP = clear_num_num(aTHX_ SP, obj);
+#line 13178 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_reserve_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_reserve_num_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, n");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	IV	n = (IV)SvIV(ST(1))
+;
+#line 2763 "SizeBalanced.xs"
+        SP = reserve_num_num(aTHX_ SP, obj,n);
+#line 13200 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_compact_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_compact_num_num)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 2768 "SizeBalanced.xs"
+        SP = compact_num_num(aTHX_ SP, obj);
+#line 13220 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_dump_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_dump_num_num)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 2774 "SizeBalanced.xs"
+        SP = dump_num_num(aTHX_ SP, obj);
+#line 13240 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_check_num_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_check_num_num)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 2779 "SizeBalanced.xs"
+        SP = check_num_num(aTHX_ SP, obj);
+#line 13260 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_num_any)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "class, cmp= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	class = ST(0)
+;
+	SV *	cmp;
+
+	if (items < 2)
+	    cmp = &PL_sv_undef;
+	else {
+	    cmp = ST(1)
+;
+	}
+#line 2785 "SizeBalanced.xs"
+        SP = new_num_any(aTHX_ SP, class,cmp);
+#line 13288 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_from_sorted_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_from_sorted_num_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 4)
+       croak_xs_usage(cv,  "class, keys, values= &PL_sv_undef, cmp= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	class = ST(0)
+;
+	SV *	keys = ST(1)
+;
+	SV *	values;
+	SV *	cmp;
+
+	if (items < 3)
+	    values = &PL_sv_undef;
+	else {
+	    values = ST(2)
+;
+	}
+
+	if (items < 4)
+	    cmp = &PL_sv_undef;
+	else {
+	    cmp = ST(3)
+;
+	}
+#line 2790 "SizeBalanced.xs"
+        SP = new_from_sorted_num_any(aTHX_ SP, class,keys,values,cmp);
+#line 13326 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_DESTROY_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_DESTROY_num_any)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 2795 "SizeBalanced.xs"
+        SP = DESTROY_num_any(aTHX_ SP, obj);
+#line 13346 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_size_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_size_num_any)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 2801 "SizeBalanced.xs"
+        SP = size_num_any(aTHX_ SP, obj);
+#line 13366 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_ever_height_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_ever_height_num_any)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 2806 "SizeBalanced.xs"
+        SP = ever_height_num_any(aTHX_ SP, obj);
+#line 13386 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_cmp_count_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_cmp_count_num_any)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 2811 "SizeBalanced.xs"
+        SP = cmp_count_num_any(aTHX_ SP, obj);
+#line 13406 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_num_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 2816 "SizeBalanced.xs"
+        SP = insert_num_any(aTHX_ SP, obj,key,value);
+#line 13436 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_before_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_before_num_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 2821 "SizeBalanced.xs"
+        SP = insert_before_num_any(aTHX_ SP, obj,key,value);
+#line 13466 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_after_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_after_num_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 2826 "SizeBalanced.xs"
+        SP = insert_after_num_any(aTHX_ SP, obj,key,value);
+#line 13496 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_unique_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_unique_num_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 2831 "SizeBalanced.xs"
+        SP = insert_unique_num_any(aTHX_ SP, obj,key,value);
+#line 13526 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_set_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_set_num_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 2836 "SizeBalanced.xs"
+        SP = set_num_any(aTHX_ SP, obj,key,value);
+#line 13556 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_add_value_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_add_value_num_any)
+{
+    dVAR; dXSARGS;
+    if (items < 3 || items > 4)
+       croak_xs_usage(cv,  "obj, key, delta, insert= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	delta = ST(2)
+;
+	int	insert;
+
+	if (items < 4)
+	    insert = 1;
+	else {
+	    insert = (int)SvIV(ST(3))
+;
+	}
+#line 2841 "SizeBalanced.xs"
+        SP = add_value_num_any(aTHX_ SP, obj,key,delta,insert);
+#line 13588 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_incr_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_incr_num_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 2846 "SizeBalanced.xs"
+        SP = incr_num_any(aTHX_ SP, obj,key);
+#line 13610 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_many_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_many_num_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, keys, values= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+	SV *	values;
+
+	if (items < 3)
+	    values = &PL_sv_undef;
+	else {
+	    values = ST(2)
+;
+	}
+#line 2851 "SizeBalanced.xs"
+        SP = insert_many_num_any(aTHX_ SP, obj,keys,values);
+#line 13640 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_num_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 2856 "SizeBalanced.xs"
+        SP = delete_num_any(aTHX_ SP, obj,key);
+#line 13662 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_first_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_first_num_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 2861 "SizeBalanced.xs"
+        SP = delete_first_num_any(aTHX_ SP, obj,key);
+#line 13684 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_last_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_last_num_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 2866 "SizeBalanced.xs"
+        SP = delete_last_num_any(aTHX_ SP, obj,key);
+#line 13706 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_first_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_first_num_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 2871 "SizeBalanced.xs"
+        SP = take_first_num_any(aTHX_ SP, obj,key);
+#line 13728 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_last_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_last_num_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 2876 "SizeBalanced.xs"
+        SP = take_last_num_any(aTHX_ SP, obj,key);
+#line 13750 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_num_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 2881 "SizeBalanced.xs"
+        SP = delete_many_num_any(aTHX_ SP, obj,keys);
+#line 13772 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_first_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_first_num_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 2886 "SizeBalanced.xs"
+        SP = delete_many_first_num_any(aTHX_ SP, obj,keys);
+#line 13794 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_last_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_last_num_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 2891 "SizeBalanced.xs"
+        SP = delete_many_last_num_any(aTHX_ SP, obj,keys);
+#line 13816 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_lt_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_lt_num_any)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 2896 "SizeBalanced.xs"
+        SP = delete_gt_lt_num_any(aTHX_ SP, obj,lower_key,upper_key);
+#line 13840 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_lt_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_lt_num_any)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 2901 "SizeBalanced.xs"
+        SP = delete_ge_lt_num_any(aTHX_ SP, obj,lower_key,upper_key);
+#line 13864 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_le_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_le_num_any)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 2906 "SizeBalanced.xs"
+        SP = delete_gt_le_num_any(aTHX_ SP, obj,lower_key,upper_key);
+#line 13888 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_le_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_le_num_any)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 2911 "SizeBalanced.xs"
+        SP = delete_ge_le_num_any(aTHX_ SP, obj,lower_key,upper_key);
+#line 13912 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_le_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_le_num_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= -1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = -1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 2916 "SizeBalanced.xs"
+        SP = drain_le_num_any(aTHX_ SP, obj,key,limit);
+#line 13942 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_ge_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_ge_num_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= -1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = -1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 2921 "SizeBalanced.xs"
+        SP = drain_ge_num_any(aTHX_ SP, obj,key,limit);
+#line 13972 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_lt_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_lt_num_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 2927 "SizeBalanced.xs"
+        SP = split_lt_num_any(aTHX_ SP, obj,key);
+#line 13994 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_le_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_le_num_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 2932 "SizeBalanced.xs"
+        SP = split_le_num_any(aTHX_ SP, obj,key);
+#line 14016 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_join_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_join_num_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 2937 "SizeBalanced.xs"
+        SP = join_num_any(aTHX_ SP, obj,other);
+#line 14038 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_union_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_union_num_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 2942 "SizeBalanced.xs"
+        SP = union_num_any(aTHX_ SP, obj,other);
+#line 14060 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_intersection_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_intersection_num_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 2947 "SizeBalanced.xs"
+        SP = intersection_num_any(aTHX_ SP, obj,other);
+#line 14082 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_difference_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_difference_num_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 2952 "SizeBalanced.xs"
+        SP = difference_num_any(aTHX_ SP, obj,other);
+#line 14104 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_num_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 2958 "SizeBalanced.xs"
+        SP = find_num_any(aTHX_ SP, obj,key,limit);
+#line 14134 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_first_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_first_num_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 2963 "SizeBalanced.xs"
+        SP = find_first_num_any(aTHX_ SP, obj,key,limit);
+#line 14164 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_last_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_last_num_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 2968 "SizeBalanced.xs"
+        SP = find_last_num_any(aTHX_ SP, obj,key,limit);
+#line 14194 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_exists_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_exists_num_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 2973 "SizeBalanced.xs"
+        SP = exists_num_any(aTHX_ SP, obj,key);
+#line 14216 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_get_many_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_get_many_num_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 2978 "SizeBalanced.xs"
+        SP = get_many_num_any(aTHX_ SP, obj,keys);
+#line 14238 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_num_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 2983 "SizeBalanced.xs"
+        SP = find_lt_num_any(aTHX_ SP, obj,key,limit);
+#line 14268 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_num_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 2988 "SizeBalanced.xs"
+        SP = find_le_num_any(aTHX_ SP, obj,key,limit);
+#line 14298 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_num_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 2993 "SizeBalanced.xs"
+        SP = find_gt_num_any(aTHX_ SP, obj,key,limit);
+#line 14328 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_num_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 2998 "SizeBalanced.xs"
+        SP = find_ge_num_any(aTHX_ SP, obj,key,limit);
+#line 14358 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_many_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_many_num_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 3004 "SizeBalanced.xs"
+        SP = find_lt_many_num_any(aTHX_ SP, obj,keys);
+#line 14380 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_many_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_many_num_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 3009 "SizeBalanced.xs"
+        SP = find_le_many_num_any(aTHX_ SP, obj,keys);
+#line 14402 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_many_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_many_num_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 3014 "SizeBalanced.xs"
+        SP = find_gt_many_num_any(aTHX_ SP, obj,keys);
+#line 14424 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_many_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_many_num_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 3019 "SizeBalanced.xs"
+        SP = find_ge_many_num_any(aTHX_ SP, obj,keys);
+#line 14446 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_lt_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_lt_num_any)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 3025 "SizeBalanced.xs"
+        SP = find_gt_lt_num_any(aTHX_ SP, obj,lower_key,upper_key);
+#line 14470 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_lt_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_lt_num_any)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 3030 "SizeBalanced.xs"
+        SP = find_ge_lt_num_any(aTHX_ SP, obj,lower_key,upper_key);
+#line 14494 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_le_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_le_num_any)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 3035 "SizeBalanced.xs"
+        SP = find_gt_le_num_any(aTHX_ SP, obj,lower_key,upper_key);
+#line 14518 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_le_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_le_num_any)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 3040 "SizeBalanced.xs"
+        SP = find_ge_le_num_any(aTHX_ SP, obj,lower_key,upper_key);
+#line 14542 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_num_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 3046 "SizeBalanced.xs"
+        SP = count_lt_num_any(aTHX_ SP, obj,key);
+#line 14564 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_num_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 3051 "SizeBalanced.xs"
+        SP = count_le_num_any(aTHX_ SP, obj,key);
+#line 14586 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_num_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 3056 "SizeBalanced.xs"
+        SP = count_gt_num_any(aTHX_ SP, obj,key);
+#line 14608 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_num_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 3061 "SizeBalanced.xs"
+        SP = count_ge_num_any(aTHX_ SP, obj,key);
+#line 14630 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_eq_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_eq_num_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 3066 "SizeBalanced.xs"
+        SP = count_eq_num_any(aTHX_ SP, obj,key);
+#line 14652 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_equal_range_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_equal_range_num_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 3071 "SizeBalanced.xs"
+        SP = equal_range_num_any(aTHX_ SP, obj,key);
+#line 14674 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_many_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_many_num_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 3077 "SizeBalanced.xs"
+        SP = count_lt_many_num_any(aTHX_ SP, obj,keys);
+#line 14696 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_many_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_many_num_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 3082 "SizeBalanced.xs"
+        SP = count_le_many_num_any(aTHX_ SP, obj,keys);
+#line 14718 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_many_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_many_num_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 3087 "SizeBalanced.xs"
+        SP = count_gt_many_num_any(aTHX_ SP, obj,keys);
+#line 14740 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_many_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_many_num_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 3092 "SizeBalanced.xs"
+        SP = count_ge_many_num_any(aTHX_ SP, obj,keys);
+#line 14762 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_apply_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_apply_num_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, ops");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	ops = ST(1)
+;
+#line 3098 "SizeBalanced.xs"
+        SP = apply_num_any(aTHX_ SP, obj,ops);
+#line 14784 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_min_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_min_num_any)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 3104 "SizeBalanced.xs"
+        SP = find_min_num_any(aTHX_ SP, obj,limit);
+#line 14812 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_max_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_max_num_any)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 3109 "SizeBalanced.xs"
+        SP = find_max_num_any(aTHX_ SP, obj,limit);
+#line 14840 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_min_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_min_num_any)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 3115 "SizeBalanced.xs"
+        SP = pop_min_num_any(aTHX_ SP, obj,limit);
+#line 14868 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_max_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_max_num_any)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 3120 "SizeBalanced.xs"
+        SP = pop_max_num_any(aTHX_ SP, obj,limit);
+#line 14896 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_l_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_l_num_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, offset, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	offset = (int)SvIV(ST(1))
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 3126 "SizeBalanced.xs"
+        SP = skip_l_num_any(aTHX_ SP, obj,offset,limit);
+#line 14926 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_g_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_g_num_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, offset, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	offset = (int)SvIV(ST(1))
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 3131 "SizeBalanced.xs"
+        SP = skip_g_num_any(aTHX_ SP, obj,offset,limit);
+#line 14956 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_at_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_at_num_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, offset");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	offset = (int)SvIV(ST(1))
+;
+#line 3136 "SizeBalanced.xs"
+        SP = delete_at_num_any(aTHX_ SP, obj,offset);
+#line 14978 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ranks_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ranks_num_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, from, count= -1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	from = (int)SvIV(ST(1))
+;
+	int	count;
+
+	if (items < 3)
+	    count = -1;
+	else {
+	    count = (int)SvIV(ST(2))
+;
+	}
+#line 3141 "SizeBalanced.xs"
+        SP = delete_ranks_num_any(aTHX_ SP, obj,from,count);
+#line 15008 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_clear_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_clear_num_any)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 3147 "SizeBalanced.xs"
+        SP = clear_num_any(aTHX_ SP, obj);
+#line 15028 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_reserve_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_reserve_num_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, n");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	IV	n = (IV)SvIV(ST(1))
+;
+#line 3152 "SizeBalanced.xs"
+        SP = reserve_num_any(aTHX_ SP, obj,n);
+#line 15050 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_compact_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_compact_num_any)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 3157 "SizeBalanced.xs"
+        SP = compact_num_any(aTHX_ SP, obj);
+#line 15070 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_dump_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_dump_num_any)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 3163 "SizeBalanced.xs"
+        SP = dump_num_any(aTHX_ SP, obj);
+#line 15090 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_check_num_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_check_num_any)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 3168 "SizeBalanced.xs"
+        SP = check_num_any(aTHX_ SP, obj);
+#line 15110 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_str_void)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "class, cmp= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	class = ST(0)
+;
+	SV *	cmp;
+
+	if (items < 2)
+	    cmp = &PL_sv_undef;
+	else {
+	    cmp = ST(1)
+;
+	}
+#line 3174 "SizeBalanced.xs"
+        SP = new_str_void(aTHX_ SP, class,cmp);
+#line 15138 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_from_sorted_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_from_sorted_str_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 4)
+       croak_xs_usage(cv,  "class, keys, values= &PL_sv_undef, cmp= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	class = ST(0)
+;
+	SV *	keys = ST(1)
+;
+	SV *	values;
+	SV *	cmp;
+
+	if (items < 3)
+	    values = &PL_sv_undef;
+	else {
+	    values = ST(2)
+;
+	}
+
+	if (items < 4)
+	    cmp = &PL_sv_undef;
+	else {
+	    cmp = ST(3)
+;
+	}
+#line 3179 "SizeBalanced.xs"
+        SP = new_from_sorted_str_void(aTHX_ SP, class,keys,values,cmp);
+#line 15176 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_DESTROY_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_DESTROY_str_void)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 3184 "SizeBalanced.xs"
+        SP = DESTROY_str_void(aTHX_ SP, obj);
+#line 15196 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_size_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_size_str_void)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 3190 "SizeBalanced.xs"
+        SP = size_str_void(aTHX_ SP, obj);
+#line 15216 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_ever_height_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_ever_height_str_void)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 3195 "SizeBalanced.xs"
+        SP = ever_height_str_void(aTHX_ SP, obj);
+#line 15236 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_cmp_count_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_cmp_count_str_void)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 3200 "SizeBalanced.xs"
+        SP = cmp_count_str_void(aTHX_ SP, obj);
+#line 15256 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_str_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 3205 "SizeBalanced.xs"
+        SP = insert_str_void(aTHX_ SP, obj,key,value);
+#line 15286 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_before_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_before_str_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 3210 "SizeBalanced.xs"
+        SP = insert_before_str_void(aTHX_ SP, obj,key,value);
+#line 15316 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_after_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_after_str_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 3215 "SizeBalanced.xs"
+        SP = insert_after_str_void(aTHX_ SP, obj,key,value);
+#line 15346 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_unique_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_unique_str_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 3220 "SizeBalanced.xs"
+        SP = insert_unique_str_void(aTHX_ SP, obj,key,value);
+#line 15376 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_set_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_set_str_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 3225 "SizeBalanced.xs"
+        SP = set_str_void(aTHX_ SP, obj,key,value);
+#line 15406 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_add_value_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_add_value_str_void)
+{
+    dVAR; dXSARGS;
+    if (items < 3 || items > 4)
+       croak_xs_usage(cv,  "obj, key, delta, insert= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	delta = ST(2)
+;
+	int	insert;
+
+	if (items < 4)
+	    insert = 1;
+	else {
+	    insert = (int)SvIV(ST(3))
+;
+	}
+#line 3230 "SizeBalanced.xs"
+        SP = add_value_str_void(aTHX_ SP, obj,key,delta,insert);
+#line 15438 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_incr_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_incr_str_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 3235 "SizeBalanced.xs"
+        SP = incr_str_void(aTHX_ SP, obj,key);
+#line 15460 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_many_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_many_str_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, keys, values= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+	SV *	values;
+
+	if (items < 3)
+	    values = &PL_sv_undef;
+	else {
+	    values = ST(2)
+;
+	}
+#line 3240 "SizeBalanced.xs"
+        SP = insert_many_str_void(aTHX_ SP, obj,keys,values);
+#line 15490 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_str_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 3245 "SizeBalanced.xs"
+        SP = delete_str_void(aTHX_ SP, obj,key);
+#line 15512 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_first_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_first_str_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 3250 "SizeBalanced.xs"
+        SP = delete_first_str_void(aTHX_ SP, obj,key);
+#line 15534 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_last_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_last_str_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 3255 "SizeBalanced.xs"
+        SP = delete_last_str_void(aTHX_ SP, obj,key);
+#line 15556 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_first_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_first_str_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 3260 "SizeBalanced.xs"
+        SP = take_first_str_void(aTHX_ SP, obj,key);
+#line 15578 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_last_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_last_str_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 3265 "SizeBalanced.xs"
+        SP = take_last_str_void(aTHX_ SP, obj,key);
+#line 15600 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_str_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 3270 "SizeBalanced.xs"
+        SP = delete_many_str_void(aTHX_ SP, obj,keys);
+#line 15622 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_first_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_first_str_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 3275 "SizeBalanced.xs"
+        SP = delete_many_first_str_void(aTHX_ SP, obj,keys);
+#line 15644 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_last_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_last_str_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 3280 "SizeBalanced.xs"
+        SP = delete_many_last_str_void(aTHX_ SP, obj,keys);
+#line 15666 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_lt_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_lt_str_void)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 3285 "SizeBalanced.xs"
+        SP = delete_gt_lt_str_void(aTHX_ SP, obj,lower_key,upper_key);
+#line 15690 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_lt_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_lt_str_void)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 3290 "SizeBalanced.xs"
+        SP = delete_ge_lt_str_void(aTHX_ SP, obj,lower_key,upper_key);
+#line 15714 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_le_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_le_str_void)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 3295 "SizeBalanced.xs"
+        SP = delete_gt_le_str_void(aTHX_ SP, obj,lower_key,upper_key);
+#line 15738 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_le_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_le_str_void)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 3300 "SizeBalanced.xs"
+        SP = delete_ge_le_str_void(aTHX_ SP, obj,lower_key,upper_key);
+#line 15762 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_le_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_le_str_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= -1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = -1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 3305 "SizeBalanced.xs"
+        SP = drain_le_str_void(aTHX_ SP, obj,key,limit);
+#line 15792 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_ge_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_ge_str_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= -1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = -1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 3310 "SizeBalanced.xs"
+        SP = drain_ge_str_void(aTHX_ SP, obj,key,limit);
+#line 15822 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_lt_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_lt_str_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 3316 "SizeBalanced.xs"
+        SP = split_lt_str_void(aTHX_ SP, obj,key);
+#line 15844 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_le_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_le_str_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 3321 "SizeBalanced.xs"
+        SP = split_le_str_void(aTHX_ SP, obj,key);
+#line 15866 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_join_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_join_str_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 3326 "SizeBalanced.xs"
+        SP = join_str_void(aTHX_ SP, obj,other);
+#line 15888 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_union_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_union_str_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 3331 "SizeBalanced.xs"
+        SP = union_str_void(aTHX_ SP, obj,other);
+#line 15910 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_intersection_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_intersection_str_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 3336 "SizeBalanced.xs"
+        SP = intersection_str_void(aTHX_ SP, obj,other);
+#line 15932 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_difference_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_difference_str_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 3341 "SizeBalanced.xs"
+        SP = difference_str_void(aTHX_ SP, obj,other);
+#line 15954 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_str_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 3347 "SizeBalanced.xs"
+        SP = find_str_void(aTHX_ SP, obj,key,limit);
+#line 15984 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_first_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_first_str_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 3352 "SizeBalanced.xs"
+        SP = find_first_str_void(aTHX_ SP, obj,key,limit);
+#line 16014 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_last_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_last_str_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 3357 "SizeBalanced.xs"
+        SP = find_last_str_void(aTHX_ SP, obj,key,limit);
+#line 16044 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_exists_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_exists_str_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 3362 "SizeBalanced.xs"
+        SP = exists_str_void(aTHX_ SP, obj,key);
+#line 16066 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_get_many_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_get_many_str_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 3367 "SizeBalanced.xs"
+        SP = get_many_str_void(aTHX_ SP, obj,keys);
+#line 16088 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_str_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 3372 "SizeBalanced.xs"
+        SP = find_lt_str_void(aTHX_ SP, obj,key,limit);
+#line 16118 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_str_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 3377 "SizeBalanced.xs"
+        SP = find_le_str_void(aTHX_ SP, obj,key,limit);
+#line 16148 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_str_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 3382 "SizeBalanced.xs"
+        SP = find_gt_str_void(aTHX_ SP, obj,key,limit);
+#line 16178 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_str_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 3387 "SizeBalanced.xs"
+        SP = find_ge_str_void(aTHX_ SP, obj,key,limit);
+#line 16208 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_many_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_many_str_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 3393 "SizeBalanced.xs"
+        SP = find_lt_many_str_void(aTHX_ SP, obj,keys);
+#line 16230 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_many_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_many_str_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 3398 "SizeBalanced.xs"
+        SP = find_le_many_str_void(aTHX_ SP, obj,keys);
+#line 16252 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_many_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_many_str_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 3403 "SizeBalanced.xs"
+        SP = find_gt_many_str_void(aTHX_ SP, obj,keys);
+#line 16274 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_many_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_many_str_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 3408 "SizeBalanced.xs"
+        SP = find_ge_many_str_void(aTHX_ SP, obj,keys);
+#line 16296 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_lt_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_lt_str_void)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 3414 "SizeBalanced.xs"
+        SP = find_gt_lt_str_void(aTHX_ SP, obj,lower_key,upper_key);
+#line 16320 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_lt_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_lt_str_void)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 3419 "SizeBalanced.xs"
+        SP = find_ge_lt_str_void(aTHX_ SP, obj,lower_key,upper_key);
+#line 16344 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_le_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_le_str_void)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 3424 "SizeBalanced.xs"
+        SP = find_gt_le_str_void(aTHX_ SP, obj,lower_key,upper_key);
+#line 16368 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_le_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_le_str_void)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 3429 "SizeBalanced.xs"
+        SP = find_ge_le_str_void(aTHX_ SP, obj,lower_key,upper_key);
+#line 16392 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_str_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 3435 "SizeBalanced.xs"
+        SP = count_lt_str_void(aTHX_ SP, obj,key);
+#line 16414 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_str_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 3440 "SizeBalanced.xs"
+        SP = count_le_str_void(aTHX_ SP, obj,key);
+#line 16436 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_str_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 3445 "SizeBalanced.xs"
+        SP = count_gt_str_void(aTHX_ SP, obj,key);
+#line 16458 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_str_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 3450 "SizeBalanced.xs"
+        SP = count_ge_str_void(aTHX_ SP, obj,key);
+#line 16480 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_eq_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_eq_str_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 3455 "SizeBalanced.xs"
+        SP = count_eq_str_void(aTHX_ SP, obj,key);
+#line 16502 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_equal_range_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_equal_range_str_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 3460 "SizeBalanced.xs"
+        SP = equal_range_str_void(aTHX_ SP, obj,key);
+#line 16524 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_many_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_many_str_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 3466 "SizeBalanced.xs"
+        SP = count_lt_many_str_void(aTHX_ SP, obj,keys);
+#line 16546 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_many_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_many_str_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 3471 "SizeBalanced.xs"
+        SP = count_le_many_str_void(aTHX_ SP, obj,keys);
+#line 16568 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_many_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_many_str_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 3476 "SizeBalanced.xs"
+        SP = count_gt_many_str_void(aTHX_ SP, obj,keys);
+#line 16590 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_many_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_many_str_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 3481 "SizeBalanced.xs"
+        SP = count_ge_many_str_void(aTHX_ SP, obj,keys);
+#line 16612 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_apply_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_apply_str_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, ops");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	ops = ST(1)
+;
+#line 3487 "SizeBalanced.xs"
+        SP = apply_str_void(aTHX_ SP, obj,ops);
+#line 16634 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_min_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_min_str_void)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 3493 "SizeBalanced.xs"
+        SP = find_min_str_void(aTHX_ SP, obj,limit);
+#line 16662 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_max_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_max_str_void)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 3498 "SizeBalanced.xs"
+        SP = find_max_str_void(aTHX_ SP, obj,limit);
+#line 16690 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_min_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_min_str_void)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 3504 "SizeBalanced.xs"
+        SP = pop_min_str_void(aTHX_ SP, obj,limit);
+#line 16718 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_max_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_max_str_void)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 3509 "SizeBalanced.xs"
+        SP = pop_max_str_void(aTHX_ SP, obj,limit);
+#line 16746 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_l_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_l_str_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, offset, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	offset = (int)SvIV(ST(1))
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 3515 "SizeBalanced.xs"
+        SP = skip_l_str_void(aTHX_ SP, obj,offset,limit);
+#line 16776 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_g_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_g_str_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, offset, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	offset = (int)SvIV(ST(1))
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 3520 "SizeBalanced.xs"
+        SP = skip_g_str_void(aTHX_ SP, obj,offset,limit);
+#line 16806 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_at_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_at_str_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, offset");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	offset = (int)SvIV(ST(1))
+;
+#line 3525 "SizeBalanced.xs"
+        SP = delete_at_str_void(aTHX_ SP, obj,offset);
+#line 16828 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ranks_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ranks_str_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, from, count= -1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	from = (int)SvIV(ST(1))
+;
+	int	count;
+
+	if (items < 3)
+	    count = -1;
+	else {
+	    count = (int)SvIV(ST(2))
+;
+	}
+#line 3530 "SizeBalanced.xs"
+        SP = delete_ranks_str_void(aTHX_ SP, obj,from,count);
+#line 16858 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_clear_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_clear_str_void)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 3536 "SizeBalanced.xs"
+        SP = clear_str_void(aTHX_ SP, obj);
+#line 16878 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_reserve_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_reserve_str_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, n");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	IV	n = (IV)SvIV(ST(1))
+;
+#line 3541 "SizeBalanced.xs"
+        SP = reserve_str_void(aTHX_ SP, obj,n);
+#line 16900 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_compact_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_compact_str_void)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 3546 "SizeBalanced.xs"
+        SP = compact_str_void(aTHX_ SP, obj);
+#line 16920 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_dump_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_dump_str_void)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 3552 "SizeBalanced.xs"
+        SP = dump_str_void(aTHX_ SP, obj);
+#line 16940 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_check_str_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_check_str_void)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 3557 "SizeBalanced.xs"
+        SP = check_str_void(aTHX_ SP, obj);
+#line 16960 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_str_int)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "class, cmp= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	class = ST(0)
+;
+	SV *	cmp;
+
+	if (items < 2)
+	    cmp = &PL_sv_undef;
+	else {
+	    cmp = ST(1)
+;
+	}
+#line 3563 "SizeBalanced.xs"
+        SP = new_str_int(aTHX_ SP, class,cmp);
+#line 16988 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_from_sorted_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_from_sorted_str_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 4)
+       croak_xs_usage(cv,  "class, keys, values= &PL_sv_undef, cmp= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	class = ST(0)
+;
+	SV *	keys = ST(1)
+;
+	SV *	values;
+	SV *	cmp;
+
+	if (items < 3)
+	    values = &PL_sv_undef;
+	else {
+	    values = ST(2)
+;
+	}
+
+	if (items < 4)
+	    cmp = &PL_sv_undef;
+	else {
+	    cmp = ST(3)
+;
+	}
+#line 3568 "SizeBalanced.xs"
+        SP = new_from_sorted_str_int(aTHX_ SP, class,keys,values,cmp);
+#line 17026 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_DESTROY_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_DESTROY_str_int)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 3573 "SizeBalanced.xs"
+        SP = DESTROY_str_int(aTHX_ SP, obj);
+#line 17046 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_size_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_size_str_int)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 3579 "SizeBalanced.xs"
+        SP = size_str_int(aTHX_ SP, obj);
+#line 17066 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_ever_height_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_ever_height_str_int)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 3584 "SizeBalanced.xs"
+        SP = ever_height_str_int(aTHX_ SP, obj);
+#line 17086 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_cmp_count_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_cmp_count_str_int)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 3589 "SizeBalanced.xs"
+        SP = cmp_count_str_int(aTHX_ SP, obj);
+#line 17106 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_str_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 3594 "SizeBalanced.xs"
+        SP = insert_str_int(aTHX_ SP, obj,key,value);
+#line 17136 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_before_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_before_str_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 3599 "SizeBalanced.xs"
+        SP = insert_before_str_int(aTHX_ SP, obj,key,value);
+#line 17166 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_after_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_after_str_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 3604 "SizeBalanced.xs"
+        SP = insert_after_str_int(aTHX_ SP, obj,key,value);
+#line 17196 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_unique_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_unique_str_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 3609 "SizeBalanced.xs"
+        SP = insert_unique_str_int(aTHX_ SP, obj,key,value);
+#line 17226 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_set_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_set_str_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 3614 "SizeBalanced.xs"
+        SP = set_str_int(aTHX_ SP, obj,key,value);
+#line 17256 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_add_value_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_add_value_str_int)
+{
+    dVAR; dXSARGS;
+    if (items < 3 || items > 4)
+       croak_xs_usage(cv,  "obj, key, delta, insert= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	delta = ST(2)
+;
+	int	insert;
+
+	if (items < 4)
+	    insert = 1;
+	else {
+	    insert = (int)SvIV(ST(3))
+;
+	}
+#line 3619 "SizeBalanced.xs"
+        SP = add_value_str_int(aTHX_ SP, obj,key,delta,insert);
+#line 17288 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_incr_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_incr_str_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 3624 "SizeBalanced.xs"
+        SP = incr_str_int(aTHX_ SP, obj,key);
+#line 17310 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_many_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_many_str_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, keys, values= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+	SV *	values;
+
+	if (items < 3)
+	    values = &PL_sv_undef;
+	else {
+	    values = ST(2)
+;
+	}
+#line 3629 "SizeBalanced.xs"
+        SP = insert_many_str_int(aTHX_ SP, obj,keys,values);
+#line 17340 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_str_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 3634 "SizeBalanced.xs"
+        SP = delete_str_int(aTHX_ SP, obj,key);
+#line 17362 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_first_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_first_str_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 3639 "SizeBalanced.xs"
+        SP = delete_first_str_int(aTHX_ SP, obj,key);
+#line 17384 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_last_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_last_str_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 3644 "SizeBalanced.xs"
+        SP = delete_last_str_int(aTHX_ SP, obj,key);
+#line 17406 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_first_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_first_str_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 3649 "SizeBalanced.xs"
+        SP = take_first_str_int(aTHX_ SP, obj,key);
+#line 17428 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_last_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_last_str_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 3654 "SizeBalanced.xs"
+        SP = take_last_str_int(aTHX_ SP, obj,key);
+#line 17450 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_str_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 3659 "SizeBalanced.xs"
+        SP = delete_many_str_int(aTHX_ SP, obj,keys);
+#line 17472 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_first_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_first_str_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 3664 "SizeBalanced.xs"
+        SP = delete_many_first_str_int(aTHX_ SP, obj,keys);
+#line 17494 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_last_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_last_str_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 3669 "SizeBalanced.xs"
+        SP = delete_many_last_str_int(aTHX_ SP, obj,keys);
+#line 17516 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_lt_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_lt_str_int)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 3674 "SizeBalanced.xs"
+        SP = delete_gt_lt_str_int(aTHX_ SP, obj,lower_key,upper_key);
+#line 17540 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_lt_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_lt_str_int)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 3679 "SizeBalanced.xs"
+        SP = delete_ge_lt_str_int(aTHX_ SP, obj,lower_key,upper_key);
+#line 17564 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_le_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_le_str_int)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 3684 "SizeBalanced.xs"
+        SP = delete_gt_le_str_int(aTHX_ SP, obj,lower_key,upper_key);
+#line 17588 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_le_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_le_str_int)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 3689 "SizeBalanced.xs"
+        SP = delete_ge_le_str_int(aTHX_ SP, obj,lower_key,upper_key);
+#line 17612 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_le_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_le_str_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= -1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = -1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 3694 "SizeBalanced.xs"
+        SP = drain_le_str_int(aTHX_ SP, obj,key,limit);
+#line 17642 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_ge_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_ge_str_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= -1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = -1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 3699 "SizeBalanced.xs"
+        SP = drain_ge_str_int(aTHX_ SP, obj,key,limit);
+#line 17672 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_lt_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_lt_str_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 3705 "SizeBalanced.xs"
+        SP = split_lt_str_int(aTHX_ SP, obj,key);
+#line 17694 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_le_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_le_str_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 3710 "SizeBalanced.xs"
+        SP = split_le_str_int(aTHX_ SP, obj,key);
+#line 17716 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_join_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_join_str_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 3715 "SizeBalanced.xs"
+        SP = join_str_int(aTHX_ SP, obj,other);
+#line 17738 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_union_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_union_str_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 3720 "SizeBalanced.xs"
+        SP = union_str_int(aTHX_ SP, obj,other);
+#line 17760 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_intersection_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_intersection_str_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 3725 "SizeBalanced.xs"
+        SP = intersection_str_int(aTHX_ SP, obj,other);
+#line 17782 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_difference_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_difference_str_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 3730 "SizeBalanced.xs"
+        SP = difference_str_int(aTHX_ SP, obj,other);
+#line 17804 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_str_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 3736 "SizeBalanced.xs"
+        SP = find_str_int(aTHX_ SP, obj,key,limit);
+#line 17834 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_first_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_first_str_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 3741 "SizeBalanced.xs"
+        SP = find_first_str_int(aTHX_ SP, obj,key,limit);
+#line 17864 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_last_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_last_str_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 3746 "SizeBalanced.xs"
+        SP = find_last_str_int(aTHX_ SP, obj,key,limit);
+#line 17894 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_exists_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_exists_str_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 3751 "SizeBalanced.xs"
+        SP = exists_str_int(aTHX_ SP, obj,key);
+#line 17916 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_get_many_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_get_many_str_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 3756 "SizeBalanced.xs"
+        SP = get_many_str_int(aTHX_ SP, obj,keys);
+#line 17938 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_str_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 3761 "SizeBalanced.xs"
+        SP = find_lt_str_int(aTHX_ SP, obj,key,limit);
+#line 17968 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_str_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 3766 "SizeBalanced.xs"
+        SP = find_le_str_int(aTHX_ SP, obj,key,limit);
+#line 17998 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_str_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 3771 "SizeBalanced.xs"
+        SP = find_gt_str_int(aTHX_ SP, obj,key,limit);
+#line 18028 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_str_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 3776 "SizeBalanced.xs"
+        SP = find_ge_str_int(aTHX_ SP, obj,key,limit);
+#line 18058 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_many_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_many_str_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 3782 "SizeBalanced.xs"
+        SP = find_lt_many_str_int(aTHX_ SP, obj,keys);
+#line 18080 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_many_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_many_str_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 3787 "SizeBalanced.xs"
+        SP = find_le_many_str_int(aTHX_ SP, obj,keys);
+#line 18102 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_many_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_many_str_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 3792 "SizeBalanced.xs"
+        SP = find_gt_many_str_int(aTHX_ SP, obj,keys);
+#line 18124 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_many_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_many_str_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 3797 "SizeBalanced.xs"
+        SP = find_ge_many_str_int(aTHX_ SP, obj,keys);
+#line 18146 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_lt_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_lt_str_int)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 3803 "SizeBalanced.xs"
+        SP = find_gt_lt_str_int(aTHX_ SP, obj,lower_key,upper_key);
+#line 18170 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_lt_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_lt_str_int)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 3808 "SizeBalanced.xs"
+        SP = find_ge_lt_str_int(aTHX_ SP, obj,lower_key,upper_key);
+#line 18194 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_le_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_le_str_int)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 3813 "SizeBalanced.xs"
+        SP = find_gt_le_str_int(aTHX_ SP, obj,lower_key,upper_key);
+#line 18218 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_le_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_le_str_int)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 3818 "SizeBalanced.xs"
+        SP = find_ge_le_str_int(aTHX_ SP, obj,lower_key,upper_key);
+#line 18242 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_str_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 3824 "SizeBalanced.xs"
+        SP = count_lt_str_int(aTHX_ SP, obj,key);
+#line 18264 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_str_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 3829 "SizeBalanced.xs"
+        SP = count_le_str_int(aTHX_ SP, obj,key);
+#line 18286 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_str_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 3834 "SizeBalanced.xs"
+        SP = count_gt_str_int(aTHX_ SP, obj,key);
+#line 18308 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_str_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 3839 "SizeBalanced.xs"
+        SP = count_ge_str_int(aTHX_ SP, obj,key);
+#line 18330 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_eq_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_eq_str_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 3844 "SizeBalanced.xs"
+        SP = count_eq_str_int(aTHX_ SP, obj,key);
+#line 18352 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_equal_range_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_equal_range_str_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 3849 "SizeBalanced.xs"
+        SP = equal_range_str_int(aTHX_ SP, obj,key);
+#line 18374 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_many_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_many_str_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 3855 "SizeBalanced.xs"
+        SP = count_lt_many_str_int(aTHX_ SP, obj,keys);
+#line 18396 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_many_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_many_str_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 3860 "SizeBalanced.xs"
+        SP = count_le_many_str_int(aTHX_ SP, obj,keys);
+#line 18418 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_many_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_many_str_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 3865 "SizeBalanced.xs"
+        SP = count_gt_many_str_int(aTHX_ SP, obj,keys);
+#line 18440 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_many_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_many_str_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 3870 "SizeBalanced.xs"
+        SP = count_ge_many_str_int(aTHX_ SP, obj,keys);
+#line 18462 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_apply_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_apply_str_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, ops");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	ops = ST(1)
+;
+#line 3876 "SizeBalanced.xs"
+        SP = apply_str_int(aTHX_ SP, obj,ops);
+#line 18484 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_min_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_min_str_int)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 3882 "SizeBalanced.xs"
+        SP = find_min_str_int(aTHX_ SP, obj,limit);
+#line 18512 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_max_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_max_str_int)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 3887 "SizeBalanced.xs"
+        SP = find_max_str_int(aTHX_ SP, obj,limit);
+#line 18540 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_min_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_min_str_int)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 3893 "SizeBalanced.xs"
+        SP = pop_min_str_int(aTHX_ SP, obj,limit);
+#line 18568 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_max_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_max_str_int)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 3898 "SizeBalanced.xs"
+        SP = pop_max_str_int(aTHX_ SP, obj,limit);
+#line 18596 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_l_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_l_str_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, offset, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	offset = (int)SvIV(ST(1))
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 3904 "SizeBalanced.xs"
+        SP = skip_l_str_int(aTHX_ SP, obj,offset,limit);
+#line 18626 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_g_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_g_str_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, offset, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	offset = (int)SvIV(ST(1))
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 3909 "SizeBalanced.xs"
+        SP = skip_g_str_int(aTHX_ SP, obj,offset,limit);
+#line 18656 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_at_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_at_str_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, offset");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	offset = (int)SvIV(ST(1))
+;
+#line 3914 "SizeBalanced.xs"
+        SP = delete_at_str_int(aTHX_ SP, obj,offset);
+#line 18678 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ranks_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ranks_str_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, from, count= -1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	from = (int)SvIV(ST(1))
+;
+	int	count;
+
+	if (items < 3)
+	    count = -1;
+	else {
+	    count = (int)SvIV(ST(2))
+;
+	}
+#line 3919 "SizeBalanced.xs"
+        SP = delete_ranks_str_int(aTHX_ SP, obj,from,count);
+#line 18708 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_clear_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_clear_str_int)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 3925 "SizeBalanced.xs"
+        SP = clear_str_int(aTHX_ SP, obj);
+#line 18728 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_reserve_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_reserve_str_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, n");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	IV	n = (IV)SvIV(ST(1))
+;
+#line 3930 "SizeBalanced.xs"
+        SP = reserve_str_int(aTHX_ SP, obj,n);
+#line 18750 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_compact_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_compact_str_int)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 3935 "SizeBalanced.xs"
+        SP = compact_str_int(aTHX_ SP, obj);
+#line 18770 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_dump_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_dump_str_int)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 3941 "SizeBalanced.xs"
+        SP = dump_str_int(aTHX_ SP, obj);
+#line 18790 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_check_str_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_check_str_int)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 3946 "SizeBalanced.xs"
+        SP = check_str_int(aTHX_ SP, obj);
+#line 18810 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_str_num)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "class, cmp= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	class = ST(0)
+;
+	SV *	cmp;
+
+	if (items < 2)
+	    cmp = &PL_sv_undef;
+	else {
+	    cmp = ST(1)
+;
+	}
+#line 3952 "SizeBalanced.xs"
+        SP = new_str_num(aTHX_ SP, class,cmp);
+#line 18838 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_from_sorted_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_from_sorted_str_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 4)
+       croak_xs_usage(cv,  "class, keys, values= &PL_sv_undef, cmp= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	class = ST(0)
+;
+	SV *	keys = ST(1)
+;
+	SV *	values;
+	SV *	cmp;
+
+	if (items < 3)
+	    values = &PL_sv_undef;
+	else {
+	    values = ST(2)
+;
+	}
+
+	if (items < 4)
+	    cmp = &PL_sv_undef;
+	else {
+	    cmp = ST(3)
+;
+	}
+#line 3957 "SizeBalanced.xs"
+        SP = new_from_sorted_str_num(aTHX_ SP, class,keys,values,cmp);
+#line 18876 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_DESTROY_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_DESTROY_str_num)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 3962 "SizeBalanced.xs"
+        SP = DESTROY_str_num(aTHX_ SP, obj);
+#line 18896 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_size_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_size_str_num)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 3968 "SizeBalanced.xs"
+        SP = size_str_num(aTHX_ SP, obj);
+#line 18916 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_ever_height_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_ever_height_str_num)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 3973 "SizeBalanced.xs"
+        SP = ever_height_str_num(aTHX_ SP, obj);
+#line 18936 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_cmp_count_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_cmp_count_str_num)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 3978 "SizeBalanced.xs"
+        SP = cmp_count_str_num(aTHX_ SP, obj);
+#line 18956 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_str_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 3983 "SizeBalanced.xs"
+        SP = insert_str_num(aTHX_ SP, obj,key,value);
+#line 18986 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_before_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_before_str_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 3988 "SizeBalanced.xs"
+        SP = insert_before_str_num(aTHX_ SP, obj,key,value);
+#line 19016 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_after_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_after_str_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 3993 "SizeBalanced.xs"
+        SP = insert_after_str_num(aTHX_ SP, obj,key,value);
+#line 19046 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_unique_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_unique_str_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 3998 "SizeBalanced.xs"
+        SP = insert_unique_str_num(aTHX_ SP, obj,key,value);
+#line 19076 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_set_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_set_str_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 4003 "SizeBalanced.xs"
+        SP = set_str_num(aTHX_ SP, obj,key,value);
+#line 19106 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_add_value_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_add_value_str_num)
+{
+    dVAR; dXSARGS;
+    if (items < 3 || items > 4)
+       croak_xs_usage(cv,  "obj, key, delta, insert= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	delta = ST(2)
+;
+	int	insert;
+
+	if (items < 4)
+	    insert = 1;
+	else {
+	    insert = (int)SvIV(ST(3))
+;
+	}
+#line 4008 "SizeBalanced.xs"
+        SP = add_value_str_num(aTHX_ SP, obj,key,delta,insert);
+#line 19138 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_incr_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_incr_str_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 4013 "SizeBalanced.xs"
+        SP = incr_str_num(aTHX_ SP, obj,key);
+#line 19160 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_many_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_many_str_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, keys, values= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+	SV *	values;
+
+	if (items < 3)
+	    values = &PL_sv_undef;
+	else {
+	    values = ST(2)
+;
+	}
+#line 4018 "SizeBalanced.xs"
+        SP = insert_many_str_num(aTHX_ SP, obj,keys,values);
+#line 19190 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_str_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 4023 "SizeBalanced.xs"
+        SP = delete_str_num(aTHX_ SP, obj,key);
+#line 19212 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_first_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_first_str_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 4028 "SizeBalanced.xs"
+        SP = delete_first_str_num(aTHX_ SP, obj,key);
+#line 19234 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_last_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_last_str_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 4033 "SizeBalanced.xs"
+        SP = delete_last_str_num(aTHX_ SP, obj,key);
+#line 19256 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_first_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_first_str_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 4038 "SizeBalanced.xs"
+        SP = take_first_str_num(aTHX_ SP, obj,key);
+#line 19278 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_last_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_last_str_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 4043 "SizeBalanced.xs"
+        SP = take_last_str_num(aTHX_ SP, obj,key);
+#line 19300 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_str_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 4048 "SizeBalanced.xs"
+        SP = delete_many_str_num(aTHX_ SP, obj,keys);
+#line 19322 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_first_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_first_str_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 4053 "SizeBalanced.xs"
+        SP = delete_many_first_str_num(aTHX_ SP, obj,keys);
+#line 19344 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_last_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_last_str_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 4058 "SizeBalanced.xs"
+        SP = delete_many_last_str_num(aTHX_ SP, obj,keys);
+#line 19366 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_lt_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_lt_str_num)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 4063 "SizeBalanced.xs"
+        SP = delete_gt_lt_str_num(aTHX_ SP, obj,lower_key,upper_key);
+#line 19390 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_lt_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_lt_str_num)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 4068 "SizeBalanced.xs"
+        SP = delete_ge_lt_str_num(aTHX_ SP, obj,lower_key,upper_key);
+#line 19414 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_le_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_le_str_num)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 4073 "SizeBalanced.xs"
+        SP = delete_gt_le_str_num(aTHX_ SP, obj,lower_key,upper_key);
+#line 19438 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_le_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_le_str_num)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 4078 "SizeBalanced.xs"
+        SP = delete_ge_le_str_num(aTHX_ SP, obj,lower_key,upper_key);
+#line 19462 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_le_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_le_str_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= -1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = -1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 4083 "SizeBalanced.xs"
+        SP = drain_le_str_num(aTHX_ SP, obj,key,limit);
+#line 19492 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_ge_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_ge_str_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= -1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = -1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 4088 "SizeBalanced.xs"
+        SP = drain_ge_str_num(aTHX_ SP, obj,key,limit);
+#line 19522 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_lt_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_lt_str_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 4094 "SizeBalanced.xs"
+        SP = split_lt_str_num(aTHX_ SP, obj,key);
+#line 19544 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_le_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_le_str_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 4099 "SizeBalanced.xs"
+        SP = split_le_str_num(aTHX_ SP, obj,key);
+#line 19566 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_join_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_join_str_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 4104 "SizeBalanced.xs"
+        SP = join_str_num(aTHX_ SP, obj,other);
+#line 19588 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_union_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_union_str_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 4109 "SizeBalanced.xs"
+        SP = union_str_num(aTHX_ SP, obj,other);
+#line 19610 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_intersection_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_intersection_str_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 4114 "SizeBalanced.xs"
+        SP = intersection_str_num(aTHX_ SP, obj,other);
+#line 19632 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_difference_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_difference_str_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 4119 "SizeBalanced.xs"
+        SP = difference_str_num(aTHX_ SP, obj,other);
+#line 19654 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_str_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 4125 "SizeBalanced.xs"
+        SP = find_str_num(aTHX_ SP, obj,key,limit);
+#line 19684 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_first_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_first_str_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 4130 "SizeBalanced.xs"
+        SP = find_first_str_num(aTHX_ SP, obj,key,limit);
+#line 19714 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_last_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_last_str_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 4135 "SizeBalanced.xs"
+        SP = find_last_str_num(aTHX_ SP, obj,key,limit);
+#line 19744 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_exists_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_exists_str_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 4140 "SizeBalanced.xs"
+        SP = exists_str_num(aTHX_ SP, obj,key);
+#line 19766 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_get_many_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_get_many_str_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 4145 "SizeBalanced.xs"
+        SP = get_many_str_num(aTHX_ SP, obj,keys);
+#line 19788 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_str_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 4150 "SizeBalanced.xs"
+        SP = find_lt_str_num(aTHX_ SP, obj,key,limit);
+#line 19818 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_str_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 4155 "SizeBalanced.xs"
+        SP = find_le_str_num(aTHX_ SP, obj,key,limit);
+#line 19848 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_str_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 4160 "SizeBalanced.xs"
+        SP = find_gt_str_num(aTHX_ SP, obj,key,limit);
+#line 19878 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_str_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 4165 "SizeBalanced.xs"
+        SP = find_ge_str_num(aTHX_ SP, obj,key,limit);
+#line 19908 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_many_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_many_str_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 4171 "SizeBalanced.xs"
+        SP = find_lt_many_str_num(aTHX_ SP, obj,keys);
+#line 19930 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_many_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_many_str_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 4176 "SizeBalanced.xs"
+        SP = find_le_many_str_num(aTHX_ SP, obj,keys);
+#line 19952 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_many_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_many_str_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 4181 "SizeBalanced.xs"
+        SP = find_gt_many_str_num(aTHX_ SP, obj,keys);
+#line 19974 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_many_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_many_str_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 4186 "SizeBalanced.xs"
+        SP = find_ge_many_str_num(aTHX_ SP, obj,keys);
+#line 19996 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_lt_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_lt_str_num)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 4192 "SizeBalanced.xs"
+        SP = find_gt_lt_str_num(aTHX_ SP, obj,lower_key,upper_key);
+#line 20020 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_lt_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_lt_str_num)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 4197 "SizeBalanced.xs"
+        SP = find_ge_lt_str_num(aTHX_ SP, obj,lower_key,upper_key);
+#line 20044 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_le_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_le_str_num)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 4202 "SizeBalanced.xs"
+        SP = find_gt_le_str_num(aTHX_ SP, obj,lower_key,upper_key);
+#line 20068 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_le_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_le_str_num)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 4207 "SizeBalanced.xs"
+        SP = find_ge_le_str_num(aTHX_ SP, obj,lower_key,upper_key);
+#line 20092 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_str_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 4213 "SizeBalanced.xs"
+        SP = count_lt_str_num(aTHX_ SP, obj,key);
+#line 20114 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_str_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 4218 "SizeBalanced.xs"
+        SP = count_le_str_num(aTHX_ SP, obj,key);
+#line 20136 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_str_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 4223 "SizeBalanced.xs"
+        SP = count_gt_str_num(aTHX_ SP, obj,key);
+#line 20158 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_str_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 4228 "SizeBalanced.xs"
+        SP = count_ge_str_num(aTHX_ SP, obj,key);
+#line 20180 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_eq_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_eq_str_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 4233 "SizeBalanced.xs"
+        SP = count_eq_str_num(aTHX_ SP, obj,key);
+#line 20202 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_equal_range_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_equal_range_str_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 4238 "SizeBalanced.xs"
+        SP = equal_range_str_num(aTHX_ SP, obj,key);
+#line 20224 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_many_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_many_str_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 4244 "SizeBalanced.xs"
+        SP = count_lt_many_str_num(aTHX_ SP, obj,keys);
+#line 20246 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_many_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_many_str_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 4249 "SizeBalanced.xs"
+        SP = count_le_many_str_num(aTHX_ SP, obj,keys);
+#line 20268 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_many_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_many_str_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 4254 "SizeBalanced.xs"
+        SP = count_gt_many_str_num(aTHX_ SP, obj,keys);
+#line 20290 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_many_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_many_str_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 4259 "SizeBalanced.xs"
+        SP = count_ge_many_str_num(aTHX_ SP, obj,keys);
+#line 20312 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_apply_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_apply_str_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, ops");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	ops = ST(1)
+;
+#line 4265 "SizeBalanced.xs"
+        SP = apply_str_num(aTHX_ SP, obj,ops);
+#line 20334 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_min_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_min_str_num)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 4271 "SizeBalanced.xs"
+        SP = find_min_str_num(aTHX_ SP, obj,limit);
+#line 20362 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_max_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_max_str_num)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 4276 "SizeBalanced.xs"
+        SP = find_max_str_num(aTHX_ SP, obj,limit);
+#line 20390 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_min_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_min_str_num)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 4282 "SizeBalanced.xs"
+        SP = pop_min_str_num(aTHX_ SP, obj,limit);
+#line 20418 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_max_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_max_str_num)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 4287 "SizeBalanced.xs"
+        SP = pop_max_str_num(aTHX_ SP, obj,limit);
+#line 20446 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_l_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_l_str_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, offset, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	offset = (int)SvIV(ST(1))
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 4293 "SizeBalanced.xs"
+        SP = skip_l_str_num(aTHX_ SP, obj,offset,limit);
+#line 20476 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_g_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_g_str_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, offset, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	offset = (int)SvIV(ST(1))
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 4298 "SizeBalanced.xs"
+        SP = skip_g_str_num(aTHX_ SP, obj,offset,limit);
+#line 20506 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_at_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_at_str_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, offset");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	offset = (int)SvIV(ST(1))
+;
+#line 4303 "SizeBalanced.xs"
+        SP = delete_at_str_num(aTHX_ SP, obj,offset);
+#line 20528 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ranks_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ranks_str_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, from, count= -1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	from = (int)SvIV(ST(1))
+;
+	int	count;
+
+	if (items < 3)
+	    count = -1;
+	else {
+	    count = (int)SvIV(ST(2))
+;
+	}
+#line 4308 "SizeBalanced.xs"
+        SP = delete_ranks_str_num(aTHX_ SP, obj,from,count);
+#line 20558 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_clear_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_clear_str_num)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 4314 "SizeBalanced.xs"
+        SP = clear_str_num(aTHX_ SP, obj);
+#line 20578 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_reserve_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_reserve_str_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, n");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	IV	n = (IV)SvIV(ST(1))
+;
+#line 4319 "SizeBalanced.xs"
+        SP = reserve_str_num(aTHX_ SP, obj,n);
+#line 20600 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_compact_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_compact_str_num)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 4324 "SizeBalanced.xs"
+        SP = compact_str_num(aTHX_ SP, obj);
+#line 20620 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_dump_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_dump_str_num)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 4330 "SizeBalanced.xs"
+        SP = dump_str_num(aTHX_ SP, obj);
+#line 20640 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_check_str_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_check_str_num)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 4335 "SizeBalanced.xs"
+        SP = check_str_num(aTHX_ SP, obj);
+#line 20660 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_str_any)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "class, cmp= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	class = ST(0)
+;
+	SV *	cmp;
+
+	if (items < 2)
+	    cmp = &PL_sv_undef;
+	else {
+	    cmp = ST(1)
+;
+	}
+#line 4341 "SizeBalanced.xs"
+        SP = new_str_any(aTHX_ SP, class,cmp);
+#line 20688 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_from_sorted_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_from_sorted_str_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 4)
+       croak_xs_usage(cv,  "class, keys, values= &PL_sv_undef, cmp= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	class = ST(0)
+;
+	SV *	keys = ST(1)
+;
+	SV *	values;
+	SV *	cmp;
+
+	if (items < 3)
+	    values = &PL_sv_undef;
+	else {
+	    values = ST(2)
+;
+	}
+
+	if (items < 4)
+	    cmp = &PL_sv_undef;
+	else {
+	    cmp = ST(3)
+;
+	}
+#line 4346 "SizeBalanced.xs"
+        SP = new_from_sorted_str_any(aTHX_ SP, class,keys,values,cmp);
+#line 20726 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_DESTROY_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_DESTROY_str_any)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 4351 "SizeBalanced.xs"
+        SP = DESTROY_str_any(aTHX_ SP, obj);
+#line 20746 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_size_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_size_str_any)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 4357 "SizeBalanced.xs"
+        SP = size_str_any(aTHX_ SP, obj);
+#line 20766 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_ever_height_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_ever_height_str_any)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 4362 "SizeBalanced.xs"
+        SP = ever_height_str_any(aTHX_ SP, obj);
+#line 20786 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_cmp_count_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_cmp_count_str_any)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 4367 "SizeBalanced.xs"
+        SP = cmp_count_str_any(aTHX_ SP, obj);
+#line 20806 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_str_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 4372 "SizeBalanced.xs"
+        SP = insert_str_any(aTHX_ SP, obj,key,value);
+#line 20836 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_before_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_before_str_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 4377 "SizeBalanced.xs"
+        SP = insert_before_str_any(aTHX_ SP, obj,key,value);
+#line 20866 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_after_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_after_str_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 4382 "SizeBalanced.xs"
+        SP = insert_after_str_any(aTHX_ SP, obj,key,value);
+#line 20896 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_unique_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_unique_str_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 4387 "SizeBalanced.xs"
+        SP = insert_unique_str_any(aTHX_ SP, obj,key,value);
+#line 20926 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_set_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_set_str_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 4392 "SizeBalanced.xs"
+        SP = set_str_any(aTHX_ SP, obj,key,value);
+#line 20956 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_add_value_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_add_value_str_any)
+{
+    dVAR; dXSARGS;
+    if (items < 3 || items > 4)
+       croak_xs_usage(cv,  "obj, key, delta, insert= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	delta = ST(2)
+;
+	int	insert;
+
+	if (items < 4)
+	    insert = 1;
+	else {
+	    insert = (int)SvIV(ST(3))
+;
+	}
+#line 4397 "SizeBalanced.xs"
+        SP = add_value_str_any(aTHX_ SP, obj,key,delta,insert);
+#line 20988 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_incr_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_incr_str_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 4402 "SizeBalanced.xs"
+        SP = incr_str_any(aTHX_ SP, obj,key);
+#line 21010 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_many_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_many_str_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, keys, values= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+	SV *	values;
+
+	if (items < 3)
+	    values = &PL_sv_undef;
+	else {
+	    values = ST(2)
+;
+	}
+#line 4407 "SizeBalanced.xs"
+        SP = insert_many_str_any(aTHX_ SP, obj,keys,values);
+#line 21040 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_str_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 4412 "SizeBalanced.xs"
+        SP = delete_str_any(aTHX_ SP, obj,key);
+#line 21062 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_first_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_first_str_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 4417 "SizeBalanced.xs"
+        SP = delete_first_str_any(aTHX_ SP, obj,key);
+#line 21084 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_last_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_last_str_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 4422 "SizeBalanced.xs"
+        SP = delete_last_str_any(aTHX_ SP, obj,key);
+#line 21106 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_first_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_first_str_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 4427 "SizeBalanced.xs"
+        SP = take_first_str_any(aTHX_ SP, obj,key);
+#line 21128 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_last_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_last_str_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 4432 "SizeBalanced.xs"
+        SP = take_last_str_any(aTHX_ SP, obj,key);
+#line 21150 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_str_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 4437 "SizeBalanced.xs"
+        SP = delete_many_str_any(aTHX_ SP, obj,keys);
+#line 21172 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_first_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_first_str_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 4442 "SizeBalanced.xs"
+        SP = delete_many_first_str_any(aTHX_ SP, obj,keys);
+#line 21194 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_last_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_last_str_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 4447 "SizeBalanced.xs"
+        SP = delete_many_last_str_any(aTHX_ SP, obj,keys);
+#line 21216 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_lt_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_lt_str_any)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 4452 "SizeBalanced.xs"
+        SP = delete_gt_lt_str_any(aTHX_ SP, obj,lower_key,upper_key);
+#line 21240 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_lt_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_lt_str_any)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 4457 "SizeBalanced.xs"
+        SP = delete_ge_lt_str_any(aTHX_ SP, obj,lower_key,upper_key);
+#line 21264 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_le_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_le_str_any)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 4462 "SizeBalanced.xs"
+        SP = delete_gt_le_str_any(aTHX_ SP, obj,lower_key,upper_key);
+#line 21288 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_le_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_le_str_any)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 4467 "SizeBalanced.xs"
+        SP = delete_ge_le_str_any(aTHX_ SP, obj,lower_key,upper_key);
+#line 21312 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_le_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_le_str_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= -1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = -1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 4472 "SizeBalanced.xs"
+        SP = drain_le_str_any(aTHX_ SP, obj,key,limit);
+#line 21342 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_ge_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_ge_str_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= -1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = -1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 4477 "SizeBalanced.xs"
+        SP = drain_ge_str_any(aTHX_ SP, obj,key,limit);
+#line 21372 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_lt_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_lt_str_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 4483 "SizeBalanced.xs"
+        SP = split_lt_str_any(aTHX_ SP, obj,key);
+#line 21394 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_le_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_le_str_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 4488 "SizeBalanced.xs"
+        SP = split_le_str_any(aTHX_ SP, obj,key);
+#line 21416 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_join_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_join_str_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 4493 "SizeBalanced.xs"
+        SP = join_str_any(aTHX_ SP, obj,other);
+#line 21438 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_union_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_union_str_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 4498 "SizeBalanced.xs"
+        SP = union_str_any(aTHX_ SP, obj,other);
+#line 21460 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_intersection_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_intersection_str_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 4503 "SizeBalanced.xs"
+        SP = intersection_str_any(aTHX_ SP, obj,other);
+#line 21482 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_difference_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_difference_str_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 4508 "SizeBalanced.xs"
+        SP = difference_str_any(aTHX_ SP, obj,other);
+#line 21504 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_str_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 4514 "SizeBalanced.xs"
+        SP = find_str_any(aTHX_ SP, obj,key,limit);
+#line 21534 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_first_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_first_str_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 4519 "SizeBalanced.xs"
+        SP = find_first_str_any(aTHX_ SP, obj,key,limit);
+#line 21564 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_last_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_last_str_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 4524 "SizeBalanced.xs"
+        SP = find_last_str_any(aTHX_ SP, obj,key,limit);
+#line 21594 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_exists_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_exists_str_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 4529 "SizeBalanced.xs"
+        SP = exists_str_any(aTHX_ SP, obj,key);
+#line 21616 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_get_many_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_get_many_str_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 4534 "SizeBalanced.xs"
+        SP = get_many_str_any(aTHX_ SP, obj,keys);
+#line 21638 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_str_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 4539 "SizeBalanced.xs"
+        SP = find_lt_str_any(aTHX_ SP, obj,key,limit);
+#line 21668 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_str_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 4544 "SizeBalanced.xs"
+        SP = find_le_str_any(aTHX_ SP, obj,key,limit);
+#line 21698 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_str_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 4549 "SizeBalanced.xs"
+        SP = find_gt_str_any(aTHX_ SP, obj,key,limit);
+#line 21728 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_str_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 4554 "SizeBalanced.xs"
+        SP = find_ge_str_any(aTHX_ SP, obj,key,limit);
+#line 21758 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_many_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_many_str_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 4560 "SizeBalanced.xs"
+        SP = find_lt_many_str_any(aTHX_ SP, obj,keys);
+#line 21780 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_many_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_many_str_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 4565 "SizeBalanced.xs"
+        SP = find_le_many_str_any(aTHX_ SP, obj,keys);
+#line 21802 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_many_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_many_str_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 4570 "SizeBalanced.xs"
+        SP = find_gt_many_str_any(aTHX_ SP, obj,keys);
+#line 21824 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_many_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_many_str_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 4575 "SizeBalanced.xs"
+        SP = find_ge_many_str_any(aTHX_ SP, obj,keys);
+#line 21846 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_lt_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_lt_str_any)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 4581 "SizeBalanced.xs"
+        SP = find_gt_lt_str_any(aTHX_ SP, obj,lower_key,upper_key);
+#line 21870 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_lt_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_lt_str_any)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 4586 "SizeBalanced.xs"
+        SP = find_ge_lt_str_any(aTHX_ SP, obj,lower_key,upper_key);
+#line 21894 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_le_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_le_str_any)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 4591 "SizeBalanced.xs"
+        SP = find_gt_le_str_any(aTHX_ SP, obj,lower_key,upper_key);
+#line 21918 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_le_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_le_str_any)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 4596 "SizeBalanced.xs"
+        SP = find_ge_le_str_any(aTHX_ SP, obj,lower_key,upper_key);
+#line 21942 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_str_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 4602 "SizeBalanced.xs"
+        SP = count_lt_str_any(aTHX_ SP, obj,key);
+#line 21964 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_str_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 4607 "SizeBalanced.xs"
+        SP = count_le_str_any(aTHX_ SP, obj,key);
+#line 21986 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_str_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 4612 "SizeBalanced.xs"
+        SP = count_gt_str_any(aTHX_ SP, obj,key);
+#line 22008 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_str_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 4617 "SizeBalanced.xs"
+        SP = count_ge_str_any(aTHX_ SP, obj,key);
+#line 22030 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_eq_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_eq_str_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 4622 "SizeBalanced.xs"
+        SP = count_eq_str_any(aTHX_ SP, obj,key);
+#line 22052 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_equal_range_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_equal_range_str_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 4627 "SizeBalanced.xs"
+        SP = equal_range_str_any(aTHX_ SP, obj,key);
+#line 22074 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_many_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_many_str_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 4633 "SizeBalanced.xs"
+        SP = count_lt_many_str_any(aTHX_ SP, obj,keys);
+#line 22096 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_many_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_many_str_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 4638 "SizeBalanced.xs"
+        SP = count_le_many_str_any(aTHX_ SP, obj,keys);
+#line 22118 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_many_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_many_str_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 4643 "SizeBalanced.xs"
+        SP = count_gt_many_str_any(aTHX_ SP, obj,keys);
+#line 22140 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_many_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_many_str_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 4648 "SizeBalanced.xs"
+        SP = count_ge_many_str_any(aTHX_ SP, obj,keys);
+#line 22162 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_apply_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_apply_str_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, ops");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	ops = ST(1)
+;
+#line 4654 "SizeBalanced.xs"
+        SP = apply_str_any(aTHX_ SP, obj,ops);
+#line 22184 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_min_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_min_str_any)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 4660 "SizeBalanced.xs"
+        SP = find_min_str_any(aTHX_ SP, obj,limit);
+#line 22212 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_max_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_max_str_any)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 4665 "SizeBalanced.xs"
+        SP = find_max_str_any(aTHX_ SP, obj,limit);
+#line 22240 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_min_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_min_str_any)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 4671 "SizeBalanced.xs"
+        SP = pop_min_str_any(aTHX_ SP, obj,limit);
+#line 22268 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_max_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_max_str_any)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 4676 "SizeBalanced.xs"
+        SP = pop_max_str_any(aTHX_ SP, obj,limit);
+#line 22296 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_l_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_l_str_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, offset, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	offset = (int)SvIV(ST(1))
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 4682 "SizeBalanced.xs"
+        SP = skip_l_str_any(aTHX_ SP, obj,offset,limit);
+#line 22326 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_g_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_g_str_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, offset, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	offset = (int)SvIV(ST(1))
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 4687 "SizeBalanced.xs"
+        SP = skip_g_str_any(aTHX_ SP, obj,offset,limit);
+#line 22356 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_at_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_at_str_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, offset");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	offset = (int)SvIV(ST(1))
+;
+#line 4692 "SizeBalanced.xs"
+        SP = delete_at_str_any(aTHX_ SP, obj,offset);
+#line 22378 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ranks_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ranks_str_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, from, count= -1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	from = (int)SvIV(ST(1))
+;
+	int	count;
+
+	if (items < 3)
+	    count = -1;
+	else {
+	    count = (int)SvIV(ST(2))
+;
+	}
+#line 4697 "SizeBalanced.xs"
+        SP = delete_ranks_str_any(aTHX_ SP, obj,from,count);
+#line 22408 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_clear_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_clear_str_any)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 4703 "SizeBalanced.xs"
+        SP = clear_str_any(aTHX_ SP, obj);
+#line 22428 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_reserve_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_reserve_str_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, n");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	IV	n = (IV)SvIV(ST(1))
+;
+#line 4708 "SizeBalanced.xs"
+        SP = reserve_str_any(aTHX_ SP, obj,n);
+#line 22450 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_compact_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_compact_str_any)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 4713 "SizeBalanced.xs"
+        SP = compact_str_any(aTHX_ SP, obj);
+#line 22470 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_dump_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_dump_str_any)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 4719 "SizeBalanced.xs"
+        SP = dump_str_any(aTHX_ SP, obj);
+#line 22490 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_check_str_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_check_str_any)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 4724 "SizeBalanced.xs"
+        SP = check_str_any(aTHX_ SP, obj);
+#line 22510 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_any_void)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "class, cmp= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	class = ST(0)
+;
+	SV *	cmp;
+
+	if (items < 2)
+	    cmp = &PL_sv_undef;
+	else {
+	    cmp = ST(1)
+;
+	}
+#line 4730 "SizeBalanced.xs"
+        SP = new_any_void(aTHX_ SP, class,cmp);
+#line 22538 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_from_sorted_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_from_sorted_any_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 4)
+       croak_xs_usage(cv,  "class, keys, values= &PL_sv_undef, cmp= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	class = ST(0)
+;
+	SV *	keys = ST(1)
+;
+	SV *	values;
+	SV *	cmp;
+
+	if (items < 3)
+	    values = &PL_sv_undef;
+	else {
+	    values = ST(2)
+;
+	}
+
+	if (items < 4)
+	    cmp = &PL_sv_undef;
+	else {
+	    cmp = ST(3)
+;
+	}
+#line 4735 "SizeBalanced.xs"
+        SP = new_from_sorted_any_void(aTHX_ SP, class,keys,values,cmp);
+#line 22576 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_DESTROY_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_DESTROY_any_void)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 4740 "SizeBalanced.xs"
+        SP = DESTROY_any_void(aTHX_ SP, obj);
+#line 22596 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_size_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_size_any_void)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 4746 "SizeBalanced.xs"
+        SP = size_any_void(aTHX_ SP, obj);
+#line 22616 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_ever_height_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_ever_height_any_void)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 4751 "SizeBalanced.xs"
+        SP = ever_height_any_void(aTHX_ SP, obj);
+#line 22636 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_cmp_count_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_cmp_count_any_void)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 4756 "SizeBalanced.xs"
+        SP = cmp_count_any_void(aTHX_ SP, obj);
+#line 22656 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_any_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 4761 "SizeBalanced.xs"
+        SP = insert_any_void(aTHX_ SP, obj,key,value);
+#line 22686 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_before_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_before_any_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 4766 "SizeBalanced.xs"
+        SP = insert_before_any_void(aTHX_ SP, obj,key,value);
+#line 22716 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_after_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_after_any_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 4771 "SizeBalanced.xs"
+        SP = insert_after_any_void(aTHX_ SP, obj,key,value);
+#line 22746 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_unique_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_unique_any_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 4776 "SizeBalanced.xs"
+        SP = insert_unique_any_void(aTHX_ SP, obj,key,value);
+#line 22776 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_set_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_set_any_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 4781 "SizeBalanced.xs"
+        SP = set_any_void(aTHX_ SP, obj,key,value);
+#line 22806 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_add_value_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_add_value_any_void)
+{
+    dVAR; dXSARGS;
+    if (items < 3 || items > 4)
+       croak_xs_usage(cv,  "obj, key, delta, insert= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	delta = ST(2)
+;
+	int	insert;
+
+	if (items < 4)
+	    insert = 1;
+	else {
+	    insert = (int)SvIV(ST(3))
+;
+	}
+#line 4786 "SizeBalanced.xs"
+        SP = add_value_any_void(aTHX_ SP, obj,key,delta,insert);
+#line 22838 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_incr_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_incr_any_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 4791 "SizeBalanced.xs"
+        SP = incr_any_void(aTHX_ SP, obj,key);
+#line 22860 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_many_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_many_any_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, keys, values= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+	SV *	values;
+
+	if (items < 3)
+	    values = &PL_sv_undef;
+	else {
+	    values = ST(2)
+;
+	}
+#line 4796 "SizeBalanced.xs"
+        SP = insert_many_any_void(aTHX_ SP, obj,keys,values);
+#line 22890 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_any_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 4801 "SizeBalanced.xs"
+        SP = delete_any_void(aTHX_ SP, obj,key);
+#line 22912 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_first_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_first_any_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 4806 "SizeBalanced.xs"
+        SP = delete_first_any_void(aTHX_ SP, obj,key);
+#line 22934 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_last_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_last_any_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 4811 "SizeBalanced.xs"
+        SP = delete_last_any_void(aTHX_ SP, obj,key);
+#line 22956 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_first_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_first_any_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 4816 "SizeBalanced.xs"
+        SP = take_first_any_void(aTHX_ SP, obj,key);
+#line 22978 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_last_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_last_any_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 4821 "SizeBalanced.xs"
+        SP = take_last_any_void(aTHX_ SP, obj,key);
+#line 23000 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_any_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 4826 "SizeBalanced.xs"
+        SP = delete_many_any_void(aTHX_ SP, obj,keys);
+#line 23022 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_first_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_first_any_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 4831 "SizeBalanced.xs"
+        SP = delete_many_first_any_void(aTHX_ SP, obj,keys);
+#line 23044 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_last_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_last_any_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 4836 "SizeBalanced.xs"
+        SP = delete_many_last_any_void(aTHX_ SP, obj,keys);
+#line 23066 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_lt_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_lt_any_void)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 4841 "SizeBalanced.xs"
+        SP = delete_gt_lt_any_void(aTHX_ SP, obj,lower_key,upper_key);
+#line 23090 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_lt_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_lt_any_void)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 4846 "SizeBalanced.xs"
+        SP = delete_ge_lt_any_void(aTHX_ SP, obj,lower_key,upper_key);
+#line 23114 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_le_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_le_any_void)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 4851 "SizeBalanced.xs"
+        SP = delete_gt_le_any_void(aTHX_ SP, obj,lower_key,upper_key);
+#line 23138 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_le_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_le_any_void)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 4856 "SizeBalanced.xs"
+        SP = delete_ge_le_any_void(aTHX_ SP, obj,lower_key,upper_key);
+#line 23162 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_le_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_le_any_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= -1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = -1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 4861 "SizeBalanced.xs"
+        SP = drain_le_any_void(aTHX_ SP, obj,key,limit);
+#line 23192 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_ge_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_ge_any_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= -1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = -1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 4866 "SizeBalanced.xs"
+        SP = drain_ge_any_void(aTHX_ SP, obj,key,limit);
+#line 23222 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_lt_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_lt_any_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 4872 "SizeBalanced.xs"
+        SP = split_lt_any_void(aTHX_ SP, obj,key);
+#line 23244 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_le_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_le_any_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 4877 "SizeBalanced.xs"
+        SP = split_le_any_void(aTHX_ SP, obj,key);
+#line 23266 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_join_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_join_any_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 4882 "SizeBalanced.xs"
+        SP = join_any_void(aTHX_ SP, obj,other);
+#line 23288 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_union_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_union_any_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 4887 "SizeBalanced.xs"
+        SP = union_any_void(aTHX_ SP, obj,other);
+#line 23310 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_intersection_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_intersection_any_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 4892 "SizeBalanced.xs"
+        SP = intersection_any_void(aTHX_ SP, obj,other);
+#line 23332 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_difference_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_difference_any_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 4897 "SizeBalanced.xs"
+        SP = difference_any_void(aTHX_ SP, obj,other);
+#line 23354 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_any_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 4903 "SizeBalanced.xs"
+        SP = find_any_void(aTHX_ SP, obj,key,limit);
+#line 23384 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_first_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_first_any_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 4908 "SizeBalanced.xs"
+        SP = find_first_any_void(aTHX_ SP, obj,key,limit);
+#line 23414 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_last_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_last_any_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 4913 "SizeBalanced.xs"
+        SP = find_last_any_void(aTHX_ SP, obj,key,limit);
+#line 23444 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_exists_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_exists_any_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 4918 "SizeBalanced.xs"
+        SP = exists_any_void(aTHX_ SP, obj,key);
+#line 23466 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_get_many_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_get_many_any_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 4923 "SizeBalanced.xs"
+        SP = get_many_any_void(aTHX_ SP, obj,keys);
+#line 23488 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_any_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 4928 "SizeBalanced.xs"
+        SP = find_lt_any_void(aTHX_ SP, obj,key,limit);
+#line 23518 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_any_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 4933 "SizeBalanced.xs"
+        SP = find_le_any_void(aTHX_ SP, obj,key,limit);
+#line 23548 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_any_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 4938 "SizeBalanced.xs"
+        SP = find_gt_any_void(aTHX_ SP, obj,key,limit);
+#line 23578 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_any_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 4943 "SizeBalanced.xs"
+        SP = find_ge_any_void(aTHX_ SP, obj,key,limit);
+#line 23608 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_many_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_many_any_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 4949 "SizeBalanced.xs"
+        SP = find_lt_many_any_void(aTHX_ SP, obj,keys);
+#line 23630 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_many_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_many_any_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 4954 "SizeBalanced.xs"
+        SP = find_le_many_any_void(aTHX_ SP, obj,keys);
+#line 23652 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_many_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_many_any_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 4959 "SizeBalanced.xs"
+        SP = find_gt_many_any_void(aTHX_ SP, obj,keys);
+#line 23674 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_many_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_many_any_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 4964 "SizeBalanced.xs"
+        SP = find_ge_many_any_void(aTHX_ SP, obj,keys);
+#line 23696 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_lt_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_lt_any_void)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 4970 "SizeBalanced.xs"
+        SP = find_gt_lt_any_void(aTHX_ SP, obj,lower_key,upper_key);
+#line 23720 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_lt_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_lt_any_void)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 4975 "SizeBalanced.xs"
+        SP = find_ge_lt_any_void(aTHX_ SP, obj,lower_key,upper_key);
+#line 23744 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_le_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_le_any_void)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 4980 "SizeBalanced.xs"
+        SP = find_gt_le_any_void(aTHX_ SP, obj,lower_key,upper_key);
+#line 23768 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_le_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_le_any_void)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 4985 "SizeBalanced.xs"
+        SP = find_ge_le_any_void(aTHX_ SP, obj,lower_key,upper_key);
+#line 23792 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_any_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 4991 "SizeBalanced.xs"
+        SP = count_lt_any_void(aTHX_ SP, obj,key);
+#line 23814 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_any_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 4996 "SizeBalanced.xs"
+        SP = count_le_any_void(aTHX_ SP, obj,key);
+#line 23836 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_any_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 5001 "SizeBalanced.xs"
+        SP = count_gt_any_void(aTHX_ SP, obj,key);
+#line 23858 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_any_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 5006 "SizeBalanced.xs"
+        SP = count_ge_any_void(aTHX_ SP, obj,key);
+#line 23880 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_eq_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_eq_any_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 5011 "SizeBalanced.xs"
+        SP = count_eq_any_void(aTHX_ SP, obj,key);
+#line 23902 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_equal_range_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_equal_range_any_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 5016 "SizeBalanced.xs"
+        SP = equal_range_any_void(aTHX_ SP, obj,key);
+#line 23924 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_many_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_many_any_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 5022 "SizeBalanced.xs"
+        SP = count_lt_many_any_void(aTHX_ SP, obj,keys);
+#line 23946 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_many_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_many_any_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 5027 "SizeBalanced.xs"
+        SP = count_le_many_any_void(aTHX_ SP, obj,keys);
+#line 23968 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_many_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_many_any_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 5032 "SizeBalanced.xs"
+        SP = count_gt_many_any_void(aTHX_ SP, obj,keys);
+#line 23990 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_many_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_many_any_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 5037 "SizeBalanced.xs"
+        SP = count_ge_many_any_void(aTHX_ SP, obj,keys);
+#line 24012 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_apply_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_apply_any_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, ops");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	ops = ST(1)
+;
+#line 5043 "SizeBalanced.xs"
+        SP = apply_any_void(aTHX_ SP, obj,ops);
+#line 24034 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_min_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_min_any_void)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 5049 "SizeBalanced.xs"
+        SP = find_min_any_void(aTHX_ SP, obj,limit);
+#line 24062 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_max_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_max_any_void)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 5054 "SizeBalanced.xs"
+        SP = find_max_any_void(aTHX_ SP, obj,limit);
+#line 24090 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_min_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_min_any_void)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 5060 "SizeBalanced.xs"
+        SP = pop_min_any_void(aTHX_ SP, obj,limit);
+#line 24118 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_max_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_max_any_void)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 5065 "SizeBalanced.xs"
+        SP = pop_max_any_void(aTHX_ SP, obj,limit);
+#line 24146 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_l_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_l_any_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, offset, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	offset = (int)SvIV(ST(1))
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 5071 "SizeBalanced.xs"
+        SP = skip_l_any_void(aTHX_ SP, obj,offset,limit);
+#line 24176 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_g_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_g_any_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, offset, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	offset = (int)SvIV(ST(1))
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 5076 "SizeBalanced.xs"
+        SP = skip_g_any_void(aTHX_ SP, obj,offset,limit);
+#line 24206 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_at_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_at_any_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, offset");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	offset = (int)SvIV(ST(1))
+;
+#line 5081 "SizeBalanced.xs"
+        SP = delete_at_any_void(aTHX_ SP, obj,offset);
+#line 24228 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ranks_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ranks_any_void)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, from, count= -1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	from = (int)SvIV(ST(1))
+;
+	int	count;
+
+	if (items < 3)
+	    count = -1;
+	else {
+	    count = (int)SvIV(ST(2))
+;
+	}
+#line 5086 "SizeBalanced.xs"
+        SP = delete_ranks_any_void(aTHX_ SP, obj,from,count);
+#line 24258 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_clear_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_clear_any_void)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 5092 "SizeBalanced.xs"
+        SP = clear_any_void(aTHX_ SP, obj);
+#line 24278 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_reserve_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_reserve_any_void)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, n");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	IV	n = (IV)SvIV(ST(1))
+;
+#line 5097 "SizeBalanced.xs"
+        SP = reserve_any_void(aTHX_ SP, obj,n);
+#line 24300 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_compact_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_compact_any_void)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 5102 "SizeBalanced.xs"
+        SP = compact_any_void(aTHX_ SP, obj);
+#line 24320 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_dump_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_dump_any_void)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 5108 "SizeBalanced.xs"
+        SP = dump_any_void(aTHX_ SP, obj);
+#line 24340 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_check_any_void); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_check_any_void)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 5113 "SizeBalanced.xs"
+        SP = check_any_void(aTHX_ SP, obj);
+#line 24360 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_any_int)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "class, cmp= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	class = ST(0)
+;
+	SV *	cmp;
+
+	if (items < 2)
+	    cmp = &PL_sv_undef;
+	else {
+	    cmp = ST(1)
+;
+	}
+#line 5119 "SizeBalanced.xs"
+        SP = new_any_int(aTHX_ SP, class,cmp);
+#line 24388 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_from_sorted_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_from_sorted_any_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 4)
+       croak_xs_usage(cv,  "class, keys, values= &PL_sv_undef, cmp= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	class = ST(0)
+;
+	SV *	keys = ST(1)
+;
+	SV *	values;
+	SV *	cmp;
+
+	if (items < 3)
+	    values = &PL_sv_undef;
+	else {
+	    values = ST(2)
+;
+	}
+
+	if (items < 4)
+	    cmp = &PL_sv_undef;
+	else {
+	    cmp = ST(3)
+;
+	}
+#line 5124 "SizeBalanced.xs"
+        SP = new_from_sorted_any_int(aTHX_ SP, class,keys,values,cmp);
+#line 24426 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_DESTROY_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_DESTROY_any_int)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 5129 "SizeBalanced.xs"
+        SP = DESTROY_any_int(aTHX_ SP, obj);
+#line 24446 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_size_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_size_any_int)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 5135 "SizeBalanced.xs"
+        SP = size_any_int(aTHX_ SP, obj);
+#line 24466 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_ever_height_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_ever_height_any_int)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 5140 "SizeBalanced.xs"
+        SP = ever_height_any_int(aTHX_ SP, obj);
+#line 24486 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_cmp_count_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_cmp_count_any_int)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 5145 "SizeBalanced.xs"
+        SP = cmp_count_any_int(aTHX_ SP, obj);
+#line 24506 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_any_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 5150 "SizeBalanced.xs"
+        SP = insert_any_int(aTHX_ SP, obj,key,value);
+#line 24536 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_before_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_before_any_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 5155 "SizeBalanced.xs"
+        SP = insert_before_any_int(aTHX_ SP, obj,key,value);
+#line 24566 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_after_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_after_any_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 5160 "SizeBalanced.xs"
+        SP = insert_after_any_int(aTHX_ SP, obj,key,value);
+#line 24596 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_unique_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_unique_any_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 5165 "SizeBalanced.xs"
+        SP = insert_unique_any_int(aTHX_ SP, obj,key,value);
+#line 24626 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_set_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_set_any_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 5170 "SizeBalanced.xs"
+        SP = set_any_int(aTHX_ SP, obj,key,value);
+#line 24656 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_add_value_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_add_value_any_int)
+{
+    dVAR; dXSARGS;
+    if (items < 3 || items > 4)
+       croak_xs_usage(cv,  "obj, key, delta, insert= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	delta = ST(2)
+;
+	int	insert;
+
+	if (items < 4)
+	    insert = 1;
+	else {
+	    insert = (int)SvIV(ST(3))
+;
+	}
+#line 5175 "SizeBalanced.xs"
+        SP = add_value_any_int(aTHX_ SP, obj,key,delta,insert);
+#line 24688 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_incr_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_incr_any_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 5180 "SizeBalanced.xs"
+        SP = incr_any_int(aTHX_ SP, obj,key);
+#line 24710 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_many_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_many_any_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, keys, values= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+	SV *	values;
+
+	if (items < 3)
+	    values = &PL_sv_undef;
+	else {
+	    values = ST(2)
+;
+	}
+#line 5185 "SizeBalanced.xs"
+        SP = insert_many_any_int(aTHX_ SP, obj,keys,values);
+#line 24740 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_any_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 5190 "SizeBalanced.xs"
+        SP = delete_any_int(aTHX_ SP, obj,key);
+#line 24762 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_first_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_first_any_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 5195 "SizeBalanced.xs"
+        SP = delete_first_any_int(aTHX_ SP, obj,key);
+#line 24784 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_last_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_last_any_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 5200 "SizeBalanced.xs"
+        SP = delete_last_any_int(aTHX_ SP, obj,key);
+#line 24806 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_first_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_first_any_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 5205 "SizeBalanced.xs"
+        SP = take_first_any_int(aTHX_ SP, obj,key);
+#line 24828 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_last_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_last_any_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 5210 "SizeBalanced.xs"
+        SP = take_last_any_int(aTHX_ SP, obj,key);
+#line 24850 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_any_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 5215 "SizeBalanced.xs"
+        SP = delete_many_any_int(aTHX_ SP, obj,keys);
+#line 24872 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_first_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_first_any_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 5220 "SizeBalanced.xs"
+        SP = delete_many_first_any_int(aTHX_ SP, obj,keys);
+#line 24894 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_last_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_last_any_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 5225 "SizeBalanced.xs"
+        SP = delete_many_last_any_int(aTHX_ SP, obj,keys);
+#line 24916 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_lt_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_lt_any_int)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 5230 "SizeBalanced.xs"
+        SP = delete_gt_lt_any_int(aTHX_ SP, obj,lower_key,upper_key);
+#line 24940 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_lt_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_lt_any_int)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 5235 "SizeBalanced.xs"
+        SP = delete_ge_lt_any_int(aTHX_ SP, obj,lower_key,upper_key);
+#line 24964 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_le_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_le_any_int)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 5240 "SizeBalanced.xs"
+        SP = delete_gt_le_any_int(aTHX_ SP, obj,lower_key,upper_key);
+#line 24988 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_le_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_le_any_int)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 5245 "SizeBalanced.xs"
+        SP = delete_ge_le_any_int(aTHX_ SP, obj,lower_key,upper_key);
+#line 25012 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_le_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_le_any_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= -1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = -1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 5250 "SizeBalanced.xs"
+        SP = drain_le_any_int(aTHX_ SP, obj,key,limit);
+#line 25042 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_ge_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_ge_any_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= -1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = -1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 5255 "SizeBalanced.xs"
+        SP = drain_ge_any_int(aTHX_ SP, obj,key,limit);
+#line 25072 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_lt_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_lt_any_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 5261 "SizeBalanced.xs"
+        SP = split_lt_any_int(aTHX_ SP, obj,key);
+#line 25094 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_le_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_le_any_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 5266 "SizeBalanced.xs"
+        SP = split_le_any_int(aTHX_ SP, obj,key);
+#line 25116 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_join_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_join_any_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 5271 "SizeBalanced.xs"
+        SP = join_any_int(aTHX_ SP, obj,other);
+#line 25138 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_union_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_union_any_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 5276 "SizeBalanced.xs"
+        SP = union_any_int(aTHX_ SP, obj,other);
+#line 25160 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_intersection_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_intersection_any_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 5281 "SizeBalanced.xs"
+        SP = intersection_any_int(aTHX_ SP, obj,other);
+#line 25182 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_difference_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_difference_any_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 5286 "SizeBalanced.xs"
+        SP = difference_any_int(aTHX_ SP, obj,other);
+#line 25204 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_any_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 5292 "SizeBalanced.xs"
+        SP = find_any_int(aTHX_ SP, obj,key,limit);
+#line 25234 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_first_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_first_any_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 5297 "SizeBalanced.xs"
+        SP = find_first_any_int(aTHX_ SP, obj,key,limit);
+#line 25264 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_last_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_last_any_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 5302 "SizeBalanced.xs"
+        SP = find_last_any_int(aTHX_ SP, obj,key,limit);
+#line 25294 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_exists_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_exists_any_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 5307 "SizeBalanced.xs"
+        SP = exists_any_int(aTHX_ SP, obj,key);
+#line 25316 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_get_many_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_get_many_any_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 5312 "SizeBalanced.xs"
+        SP = get_many_any_int(aTHX_ SP, obj,keys);
+#line 25338 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_any_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 5317 "SizeBalanced.xs"
+        SP = find_lt_any_int(aTHX_ SP, obj,key,limit);
+#line 25368 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_any_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 5322 "SizeBalanced.xs"
+        SP = find_le_any_int(aTHX_ SP, obj,key,limit);
+#line 25398 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_any_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 5327 "SizeBalanced.xs"
+        SP = find_gt_any_int(aTHX_ SP, obj,key,limit);
+#line 25428 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_any_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 5332 "SizeBalanced.xs"
+        SP = find_ge_any_int(aTHX_ SP, obj,key,limit);
+#line 25458 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_many_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_many_any_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 5338 "SizeBalanced.xs"
+        SP = find_lt_many_any_int(aTHX_ SP, obj,keys);
+#line 25480 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_many_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_many_any_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 5343 "SizeBalanced.xs"
+        SP = find_le_many_any_int(aTHX_ SP, obj,keys);
+#line 25502 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_many_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_many_any_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 5348 "SizeBalanced.xs"
+        SP = find_gt_many_any_int(aTHX_ SP, obj,keys);
+#line 25524 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_many_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_many_any_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 5353 "SizeBalanced.xs"
+        SP = find_ge_many_any_int(aTHX_ SP, obj,keys);
+#line 25546 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_lt_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_lt_any_int)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 5359 "SizeBalanced.xs"
+        SP = find_gt_lt_any_int(aTHX_ SP, obj,lower_key,upper_key);
+#line 25570 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_lt_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_lt_any_int)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 5364 "SizeBalanced.xs"
+        SP = find_ge_lt_any_int(aTHX_ SP, obj,lower_key,upper_key);
+#line 25594 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_le_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_le_any_int)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 5369 "SizeBalanced.xs"
+        SP = find_gt_le_any_int(aTHX_ SP, obj,lower_key,upper_key);
+#line 25618 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_le_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_le_any_int)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 5374 "SizeBalanced.xs"
+        SP = find_ge_le_any_int(aTHX_ SP, obj,lower_key,upper_key);
+#line 25642 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_any_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 5380 "SizeBalanced.xs"
+        SP = count_lt_any_int(aTHX_ SP, obj,key);
+#line 25664 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_any_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 5385 "SizeBalanced.xs"
+        SP = count_le_any_int(aTHX_ SP, obj,key);
+#line 25686 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_any_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 5390 "SizeBalanced.xs"
+        SP = count_gt_any_int(aTHX_ SP, obj,key);
+#line 25708 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_any_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 5395 "SizeBalanced.xs"
+        SP = count_ge_any_int(aTHX_ SP, obj,key);
+#line 25730 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_eq_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_eq_any_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 5400 "SizeBalanced.xs"
+        SP = count_eq_any_int(aTHX_ SP, obj,key);
+#line 25752 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_equal_range_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_equal_range_any_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 5405 "SizeBalanced.xs"
+        SP = equal_range_any_int(aTHX_ SP, obj,key);
+#line 25774 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_many_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_many_any_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 5411 "SizeBalanced.xs"
+        SP = count_lt_many_any_int(aTHX_ SP, obj,keys);
+#line 25796 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_many_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_many_any_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 5416 "SizeBalanced.xs"
+        SP = count_le_many_any_int(aTHX_ SP, obj,keys);
+#line 25818 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_many_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_many_any_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 5421 "SizeBalanced.xs"
+        SP = count_gt_many_any_int(aTHX_ SP, obj,keys);
+#line 25840 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_many_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_many_any_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 5426 "SizeBalanced.xs"
+        SP = count_ge_many_any_int(aTHX_ SP, obj,keys);
+#line 25862 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_apply_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_apply_any_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, ops");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	ops = ST(1)
+;
+#line 5432 "SizeBalanced.xs"
+        SP = apply_any_int(aTHX_ SP, obj,ops);
+#line 25884 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_min_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_min_any_int)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 5438 "SizeBalanced.xs"
+        SP = find_min_any_int(aTHX_ SP, obj,limit);
+#line 25912 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_max_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_max_any_int)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 5443 "SizeBalanced.xs"
+        SP = find_max_any_int(aTHX_ SP, obj,limit);
+#line 25940 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_min_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_min_any_int)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 5449 "SizeBalanced.xs"
+        SP = pop_min_any_int(aTHX_ SP, obj,limit);
+#line 25968 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_max_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_max_any_int)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 5454 "SizeBalanced.xs"
+        SP = pop_max_any_int(aTHX_ SP, obj,limit);
+#line 25996 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_l_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_l_any_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, offset, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	offset = (int)SvIV(ST(1))
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 5460 "SizeBalanced.xs"
+        SP = skip_l_any_int(aTHX_ SP, obj,offset,limit);
+#line 26026 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_g_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_g_any_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, offset, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	offset = (int)SvIV(ST(1))
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 5465 "SizeBalanced.xs"
+        SP = skip_g_any_int(aTHX_ SP, obj,offset,limit);
+#line 26056 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_at_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_at_any_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, offset");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	offset = (int)SvIV(ST(1))
+;
+#line 5470 "SizeBalanced.xs"
+        SP = delete_at_any_int(aTHX_ SP, obj,offset);
+#line 26078 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ranks_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ranks_any_int)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, from, count= -1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	from = (int)SvIV(ST(1))
+;
+	int	count;
+
+	if (items < 3)
+	    count = -1;
+	else {
+	    count = (int)SvIV(ST(2))
+;
+	}
+#line 5475 "SizeBalanced.xs"
+        SP = delete_ranks_any_int(aTHX_ SP, obj,from,count);
+#line 26108 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_clear_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_clear_any_int)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 5481 "SizeBalanced.xs"
+        SP = clear_any_int(aTHX_ SP, obj);
+#line 26128 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_reserve_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_reserve_any_int)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, n");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	IV	n = (IV)SvIV(ST(1))
+;
+#line 5486 "SizeBalanced.xs"
+        SP = reserve_any_int(aTHX_ SP, obj,n);
+#line 26150 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_compact_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_compact_any_int)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 5491 "SizeBalanced.xs"
+        SP = compact_any_int(aTHX_ SP, obj);
+#line 26170 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_dump_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_dump_any_int)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 5497 "SizeBalanced.xs"
+        SP = dump_any_int(aTHX_ SP, obj);
+#line 26190 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_check_any_int); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_check_any_int)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 5502 "SizeBalanced.xs"
+        SP = check_any_int(aTHX_ SP, obj);
+#line 26210 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_any_num)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "class, cmp= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	class = ST(0)
+;
+	SV *	cmp;
+
+	if (items < 2)
+	    cmp = &PL_sv_undef;
+	else {
+	    cmp = ST(1)
+;
+	}
+#line 5508 "SizeBalanced.xs"
+        SP = new_any_num(aTHX_ SP, class,cmp);
+#line 26238 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_from_sorted_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_from_sorted_any_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 4)
+       croak_xs_usage(cv,  "class, keys, values= &PL_sv_undef, cmp= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	class = ST(0)
+;
+	SV *	keys = ST(1)
+;
+	SV *	values;
+	SV *	cmp;
+
+	if (items < 3)
+	    values = &PL_sv_undef;
+	else {
+	    values = ST(2)
+;
+	}
+
+	if (items < 4)
+	    cmp = &PL_sv_undef;
+	else {
+	    cmp = ST(3)
+;
+	}
+#line 5513 "SizeBalanced.xs"
+        SP = new_from_sorted_any_num(aTHX_ SP, class,keys,values,cmp);
+#line 26276 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_DESTROY_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_DESTROY_any_num)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 5518 "SizeBalanced.xs"
+        SP = DESTROY_any_num(aTHX_ SP, obj);
+#line 26296 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_size_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_size_any_num)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 5524 "SizeBalanced.xs"
+        SP = size_any_num(aTHX_ SP, obj);
+#line 26316 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_ever_height_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_ever_height_any_num)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 5529 "SizeBalanced.xs"
+        SP = ever_height_any_num(aTHX_ SP, obj);
+#line 26336 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_cmp_count_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_cmp_count_any_num)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 5534 "SizeBalanced.xs"
+        SP = cmp_count_any_num(aTHX_ SP, obj);
+#line 26356 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_any_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 5539 "SizeBalanced.xs"
+        SP = insert_any_num(aTHX_ SP, obj,key,value);
+#line 26386 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_before_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_before_any_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 5544 "SizeBalanced.xs"
+        SP = insert_before_any_num(aTHX_ SP, obj,key,value);
+#line 26416 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_after_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_after_any_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 5549 "SizeBalanced.xs"
+        SP = insert_after_any_num(aTHX_ SP, obj,key,value);
+#line 26446 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_unique_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_unique_any_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 5554 "SizeBalanced.xs"
+        SP = insert_unique_any_num(aTHX_ SP, obj,key,value);
+#line 26476 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_set_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_set_any_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 5559 "SizeBalanced.xs"
+        SP = set_any_num(aTHX_ SP, obj,key,value);
+#line 26506 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_add_value_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_add_value_any_num)
+{
+    dVAR; dXSARGS;
+    if (items < 3 || items > 4)
+       croak_xs_usage(cv,  "obj, key, delta, insert= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	delta = ST(2)
+;
+	int	insert;
+
+	if (items < 4)
+	    insert = 1;
+	else {
+	    insert = (int)SvIV(ST(3))
+;
+	}
+#line 5564 "SizeBalanced.xs"
+        SP = add_value_any_num(aTHX_ SP, obj,key,delta,insert);
+#line 26538 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_incr_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_incr_any_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 5569 "SizeBalanced.xs"
+        SP = incr_any_num(aTHX_ SP, obj,key);
+#line 26560 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_many_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_many_any_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, keys, values= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+	SV *	values;
+
+	if (items < 3)
+	    values = &PL_sv_undef;
+	else {
+	    values = ST(2)
+;
+	}
+#line 5574 "SizeBalanced.xs"
+        SP = insert_many_any_num(aTHX_ SP, obj,keys,values);
+#line 26590 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_any_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 5579 "SizeBalanced.xs"
+        SP = delete_any_num(aTHX_ SP, obj,key);
+#line 26612 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_first_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_first_any_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 5584 "SizeBalanced.xs"
+        SP = delete_first_any_num(aTHX_ SP, obj,key);
+#line 26634 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_last_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_last_any_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 5589 "SizeBalanced.xs"
+        SP = delete_last_any_num(aTHX_ SP, obj,key);
+#line 26656 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_first_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_first_any_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 5594 "SizeBalanced.xs"
+        SP = take_first_any_num(aTHX_ SP, obj,key);
+#line 26678 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_last_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_last_any_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 5599 "SizeBalanced.xs"
+        SP = take_last_any_num(aTHX_ SP, obj,key);
+#line 26700 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_any_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 5604 "SizeBalanced.xs"
+        SP = delete_many_any_num(aTHX_ SP, obj,keys);
+#line 26722 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_first_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_first_any_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 5609 "SizeBalanced.xs"
+        SP = delete_many_first_any_num(aTHX_ SP, obj,keys);
+#line 26744 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_last_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_last_any_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 5614 "SizeBalanced.xs"
+        SP = delete_many_last_any_num(aTHX_ SP, obj,keys);
+#line 26766 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_lt_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_lt_any_num)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 5619 "SizeBalanced.xs"
+        SP = delete_gt_lt_any_num(aTHX_ SP, obj,lower_key,upper_key);
+#line 26790 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_lt_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_lt_any_num)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 5624 "SizeBalanced.xs"
+        SP = delete_ge_lt_any_num(aTHX_ SP, obj,lower_key,upper_key);
+#line 26814 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_le_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_le_any_num)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 5629 "SizeBalanced.xs"
+        SP = delete_gt_le_any_num(aTHX_ SP, obj,lower_key,upper_key);
+#line 26838 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_le_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_le_any_num)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 5634 "SizeBalanced.xs"
+        SP = delete_ge_le_any_num(aTHX_ SP, obj,lower_key,upper_key);
+#line 26862 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_le_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_le_any_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= -1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = -1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 5639 "SizeBalanced.xs"
+        SP = drain_le_any_num(aTHX_ SP, obj,key,limit);
+#line 26892 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_ge_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_ge_any_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= -1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = -1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 5644 "SizeBalanced.xs"
+        SP = drain_ge_any_num(aTHX_ SP, obj,key,limit);
+#line 26922 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_lt_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_lt_any_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 5650 "SizeBalanced.xs"
+        SP = split_lt_any_num(aTHX_ SP, obj,key);
+#line 26944 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_le_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_le_any_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 5655 "SizeBalanced.xs"
+        SP = split_le_any_num(aTHX_ SP, obj,key);
+#line 26966 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_join_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_join_any_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 5660 "SizeBalanced.xs"
+        SP = join_any_num(aTHX_ SP, obj,other);
+#line 26988 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_union_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_union_any_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 5665 "SizeBalanced.xs"
+        SP = union_any_num(aTHX_ SP, obj,other);
+#line 27010 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_intersection_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_intersection_any_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 5670 "SizeBalanced.xs"
+        SP = intersection_any_num(aTHX_ SP, obj,other);
+#line 27032 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_difference_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_difference_any_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 5675 "SizeBalanced.xs"
+        SP = difference_any_num(aTHX_ SP, obj,other);
+#line 27054 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_any_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 5681 "SizeBalanced.xs"
+        SP = find_any_num(aTHX_ SP, obj,key,limit);
+#line 27084 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_first_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_first_any_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 5686 "SizeBalanced.xs"
+        SP = find_first_any_num(aTHX_ SP, obj,key,limit);
+#line 27114 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_last_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_last_any_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 5691 "SizeBalanced.xs"
+        SP = find_last_any_num(aTHX_ SP, obj,key,limit);
+#line 27144 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_exists_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_exists_any_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 5696 "SizeBalanced.xs"
+        SP = exists_any_num(aTHX_ SP, obj,key);
+#line 27166 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_get_many_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_get_many_any_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 5701 "SizeBalanced.xs"
+        SP = get_many_any_num(aTHX_ SP, obj,keys);
+#line 27188 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_any_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 5706 "SizeBalanced.xs"
+        SP = find_lt_any_num(aTHX_ SP, obj,key,limit);
+#line 27218 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_any_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 5711 "SizeBalanced.xs"
+        SP = find_le_any_num(aTHX_ SP, obj,key,limit);
+#line 27248 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_any_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 5716 "SizeBalanced.xs"
+        SP = find_gt_any_num(aTHX_ SP, obj,key,limit);
+#line 27278 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_any_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 5721 "SizeBalanced.xs"
+        SP = find_ge_any_num(aTHX_ SP, obj,key,limit);
+#line 27308 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_many_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_many_any_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 5727 "SizeBalanced.xs"
+        SP = find_lt_many_any_num(aTHX_ SP, obj,keys);
+#line 27330 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_many_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_many_any_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 5732 "SizeBalanced.xs"
+        SP = find_le_many_any_num(aTHX_ SP, obj,keys);
+#line 27352 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_many_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_many_any_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 5737 "SizeBalanced.xs"
+        SP = find_gt_many_any_num(aTHX_ SP, obj,keys);
+#line 27374 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_many_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_many_any_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 5742 "SizeBalanced.xs"
+        SP = find_ge_many_any_num(aTHX_ SP, obj,keys);
+#line 27396 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_lt_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_lt_any_num)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 5748 "SizeBalanced.xs"
+        SP = find_gt_lt_any_num(aTHX_ SP, obj,lower_key,upper_key);
+#line 27420 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_lt_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_lt_any_num)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 5753 "SizeBalanced.xs"
+        SP = find_ge_lt_any_num(aTHX_ SP, obj,lower_key,upper_key);
+#line 27444 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_le_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_le_any_num)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 5758 "SizeBalanced.xs"
+        SP = find_gt_le_any_num(aTHX_ SP, obj,lower_key,upper_key);
+#line 27468 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_le_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_le_any_num)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 5763 "SizeBalanced.xs"
+        SP = find_ge_le_any_num(aTHX_ SP, obj,lower_key,upper_key);
+#line 27492 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_any_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 5769 "SizeBalanced.xs"
+        SP = count_lt_any_num(aTHX_ SP, obj,key);
+#line 27514 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_any_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 5774 "SizeBalanced.xs"
+        SP = count_le_any_num(aTHX_ SP, obj,key);
+#line 27536 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_any_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 5779 "SizeBalanced.xs"
+        SP = count_gt_any_num(aTHX_ SP, obj,key);
+#line 27558 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_any_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 5784 "SizeBalanced.xs"
+        SP = count_ge_any_num(aTHX_ SP, obj,key);
+#line 27580 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_eq_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_eq_any_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 5789 "SizeBalanced.xs"
+        SP = count_eq_any_num(aTHX_ SP, obj,key);
+#line 27602 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_equal_range_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_equal_range_any_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 5794 "SizeBalanced.xs"
+        SP = equal_range_any_num(aTHX_ SP, obj,key);
+#line 27624 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_many_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_many_any_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 5800 "SizeBalanced.xs"
+        SP = count_lt_many_any_num(aTHX_ SP, obj,keys);
+#line 27646 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_many_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_many_any_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 5805 "SizeBalanced.xs"
+        SP = count_le_many_any_num(aTHX_ SP, obj,keys);
+#line 27668 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_many_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_many_any_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 5810 "SizeBalanced.xs"
+        SP = count_gt_many_any_num(aTHX_ SP, obj,keys);
+#line 27690 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_many_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_many_any_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 5815 "SizeBalanced.xs"
+        SP = count_ge_many_any_num(aTHX_ SP, obj,keys);
+#line 27712 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_apply_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_apply_any_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, ops");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	ops = ST(1)
+;
+#line 5821 "SizeBalanced.xs"
+        SP = apply_any_num(aTHX_ SP, obj,ops);
+#line 27734 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_min_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_min_any_num)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 5827 "SizeBalanced.xs"
+        SP = find_min_any_num(aTHX_ SP, obj,limit);
+#line 27762 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_max_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_max_any_num)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 5832 "SizeBalanced.xs"
+        SP = find_max_any_num(aTHX_ SP, obj,limit);
+#line 27790 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_min_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_min_any_num)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 5838 "SizeBalanced.xs"
+        SP = pop_min_any_num(aTHX_ SP, obj,limit);
+#line 27818 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_max_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_max_any_num)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 5843 "SizeBalanced.xs"
+        SP = pop_max_any_num(aTHX_ SP, obj,limit);
+#line 27846 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_l_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_l_any_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, offset, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	offset = (int)SvIV(ST(1))
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 5849 "SizeBalanced.xs"
+        SP = skip_l_any_num(aTHX_ SP, obj,offset,limit);
+#line 27876 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_g_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_g_any_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, offset, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	offset = (int)SvIV(ST(1))
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 5854 "SizeBalanced.xs"
+        SP = skip_g_any_num(aTHX_ SP, obj,offset,limit);
+#line 27906 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_at_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_at_any_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, offset");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	offset = (int)SvIV(ST(1))
+;
+#line 5859 "SizeBalanced.xs"
+        SP = delete_at_any_num(aTHX_ SP, obj,offset);
+#line 27928 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ranks_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ranks_any_num)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, from, count= -1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	from = (int)SvIV(ST(1))
+;
+	int	count;
+
+	if (items < 3)
+	    count = -1;
+	else {
+	    count = (int)SvIV(ST(2))
+;
+	}
+#line 5864 "SizeBalanced.xs"
+        SP = delete_ranks_any_num(aTHX_ SP, obj,from,count);
+#line 27958 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_clear_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_clear_any_num)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 5870 "SizeBalanced.xs"
+        SP = clear_any_num(aTHX_ SP, obj);
+#line 27978 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_reserve_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_reserve_any_num)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, n");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	IV	n = (IV)SvIV(ST(1))
+;
+#line 5875 "SizeBalanced.xs"
+        SP = reserve_any_num(aTHX_ SP, obj,n);
+#line 28000 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_compact_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_compact_any_num)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 5880 "SizeBalanced.xs"
+        SP = compact_any_num(aTHX_ SP, obj);
+#line 28020 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_dump_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_dump_any_num)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 5886 "SizeBalanced.xs"
+        SP = dump_any_num(aTHX_ SP, obj);
+#line 28040 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_check_any_num); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_check_any_num)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 5891 "SizeBalanced.xs"
+        SP = check_any_num(aTHX_ SP, obj);
+#line 28060 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_any_any)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "class, cmp= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	class = ST(0)
+;
+	SV *	cmp;
+
+	if (items < 2)
+	    cmp = &PL_sv_undef;
+	else {
+	    cmp = ST(1)
+;
+	}
+#line 5897 "SizeBalanced.xs"
+        SP = new_any_any(aTHX_ SP, class,cmp);
+#line 28088 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_from_sorted_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_new_from_sorted_any_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 4)
+       croak_xs_usage(cv,  "class, keys, values= &PL_sv_undef, cmp= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	class = ST(0)
+;
+	SV *	keys = ST(1)
+;
+	SV *	values;
+	SV *	cmp;
+
+	if (items < 3)
+	    values = &PL_sv_undef;
+	else {
+	    values = ST(2)
+;
+	}
+
+	if (items < 4)
+	    cmp = &PL_sv_undef;
+	else {
+	    cmp = ST(3)
+;
+	}
+#line 5902 "SizeBalanced.xs"
+        SP = new_from_sorted_any_any(aTHX_ SP, class,keys,values,cmp);
+#line 28126 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_DESTROY_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_DESTROY_any_any)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 5907 "SizeBalanced.xs"
+        SP = DESTROY_any_any(aTHX_ SP, obj);
+#line 28146 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_size_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_size_any_any)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 5913 "SizeBalanced.xs"
+        SP = size_any_any(aTHX_ SP, obj);
+#line 28166 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_ever_height_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_ever_height_any_any)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 5918 "SizeBalanced.xs"
+        SP = ever_height_any_any(aTHX_ SP, obj);
+#line 28186 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_cmp_count_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_cmp_count_any_any)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 5923 "SizeBalanced.xs"
+        SP = cmp_count_any_any(aTHX_ SP, obj);
+#line 28206 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_any_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 5928 "SizeBalanced.xs"
+        SP = insert_any_any(aTHX_ SP, obj,key,value);
+#line 28236 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_before_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_before_any_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 5933 "SizeBalanced.xs"
+        SP = insert_before_any_any(aTHX_ SP, obj,key,value);
+#line 28266 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_after_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_after_any_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 5938 "SizeBalanced.xs"
+        SP = insert_after_any_any(aTHX_ SP, obj,key,value);
+#line 28296 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_unique_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_unique_any_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 5943 "SizeBalanced.xs"
+        SP = insert_unique_any_any(aTHX_ SP, obj,key,value);
+#line 28326 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_set_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_set_any_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, value= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	value;
+
+	if (items < 3)
+	    value = &PL_sv_undef;
+	else {
+	    value = ST(2)
+;
+	}
+#line 5948 "SizeBalanced.xs"
+        SP = set_any_any(aTHX_ SP, obj,key,value);
+#line 28356 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_add_value_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_add_value_any_any)
+{
+    dVAR; dXSARGS;
+    if (items < 3 || items > 4)
+       croak_xs_usage(cv,  "obj, key, delta, insert= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	SV *	delta = ST(2)
+;
+	int	insert;
+
+	if (items < 4)
+	    insert = 1;
+	else {
+	    insert = (int)SvIV(ST(3))
+;
+	}
+#line 5953 "SizeBalanced.xs"
+        SP = add_value_any_any(aTHX_ SP, obj,key,delta,insert);
+#line 28388 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_incr_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_incr_any_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 5958 "SizeBalanced.xs"
+        SP = incr_any_any(aTHX_ SP, obj,key);
+#line 28410 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_many_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_insert_many_any_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, keys, values= &PL_sv_undef");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+	SV *	values;
+
+	if (items < 3)
+	    values = &PL_sv_undef;
+	else {
+	    values = ST(2)
+;
+	}
+#line 5963 "SizeBalanced.xs"
+        SP = insert_many_any_any(aTHX_ SP, obj,keys,values);
+#line 28440 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_any_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 5968 "SizeBalanced.xs"
+        SP = delete_any_any(aTHX_ SP, obj,key);
+#line 28462 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_first_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_first_any_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 5973 "SizeBalanced.xs"
+        SP = delete_first_any_any(aTHX_ SP, obj,key);
+#line 28484 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_last_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_last_any_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 5978 "SizeBalanced.xs"
+        SP = delete_last_any_any(aTHX_ SP, obj,key);
+#line 28506 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_first_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_first_any_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 5983 "SizeBalanced.xs"
+        SP = take_first_any_any(aTHX_ SP, obj,key);
+#line 28528 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_last_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_take_last_any_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 5988 "SizeBalanced.xs"
+        SP = take_last_any_any(aTHX_ SP, obj,key);
+#line 28550 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_any_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 5993 "SizeBalanced.xs"
+        SP = delete_many_any_any(aTHX_ SP, obj,keys);
+#line 28572 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_first_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_first_any_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 5998 "SizeBalanced.xs"
+        SP = delete_many_first_any_any(aTHX_ SP, obj,keys);
+#line 28594 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_last_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_many_last_any_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 6003 "SizeBalanced.xs"
+        SP = delete_many_last_any_any(aTHX_ SP, obj,keys);
+#line 28616 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_lt_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_lt_any_any)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 6008 "SizeBalanced.xs"
+        SP = delete_gt_lt_any_any(aTHX_ SP, obj,lower_key,upper_key);
+#line 28640 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_lt_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_lt_any_any)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 6013 "SizeBalanced.xs"
+        SP = delete_ge_lt_any_any(aTHX_ SP, obj,lower_key,upper_key);
+#line 28664 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_le_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_gt_le_any_any)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 6018 "SizeBalanced.xs"
+        SP = delete_gt_le_any_any(aTHX_ SP, obj,lower_key,upper_key);
+#line 28688 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_le_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ge_le_any_any)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 6023 "SizeBalanced.xs"
+        SP = delete_ge_le_any_any(aTHX_ SP, obj,lower_key,upper_key);
+#line 28712 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_le_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_le_any_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= -1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = -1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 6028 "SizeBalanced.xs"
+        SP = drain_le_any_any(aTHX_ SP, obj,key,limit);
+#line 28742 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_ge_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_drain_ge_any_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= -1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = -1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 6033 "SizeBalanced.xs"
+        SP = drain_ge_any_any(aTHX_ SP, obj,key,limit);
+#line 28772 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_lt_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_lt_any_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 6039 "SizeBalanced.xs"
+        SP = split_lt_any_any(aTHX_ SP, obj,key);
+#line 28794 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_le_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_split_le_any_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 6044 "SizeBalanced.xs"
+        SP = split_le_any_any(aTHX_ SP, obj,key);
+#line 28816 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_join_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_join_any_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 6049 "SizeBalanced.xs"
+        SP = join_any_any(aTHX_ SP, obj,other);
+#line 28838 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_union_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_union_any_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 6054 "SizeBalanced.xs"
+        SP = union_any_any(aTHX_ SP, obj,other);
+#line 28860 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_intersection_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_intersection_any_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 6059 "SizeBalanced.xs"
+        SP = intersection_any_any(aTHX_ SP, obj,other);
+#line 28882 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_difference_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_difference_any_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, other");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	other = ST(1)
+;
+#line 6064 "SizeBalanced.xs"
+        SP = difference_any_any(aTHX_ SP, obj,other);
+#line 28904 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_any_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 6070 "SizeBalanced.xs"
+        SP = find_any_any(aTHX_ SP, obj,key,limit);
+#line 28934 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_first_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_first_any_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 6075 "SizeBalanced.xs"
+        SP = find_first_any_any(aTHX_ SP, obj,key,limit);
+#line 28964 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_last_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_last_any_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 6080 "SizeBalanced.xs"
+        SP = find_last_any_any(aTHX_ SP, obj,key,limit);
+#line 28994 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_exists_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_exists_any_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 6085 "SizeBalanced.xs"
+        SP = exists_any_any(aTHX_ SP, obj,key);
+#line 29016 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_get_many_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_get_many_any_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 6090 "SizeBalanced.xs"
+        SP = get_many_any_any(aTHX_ SP, obj,keys);
+#line 29038 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_any_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 6095 "SizeBalanced.xs"
+        SP = find_lt_any_any(aTHX_ SP, obj,key,limit);
+#line 29068 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_any_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 6100 "SizeBalanced.xs"
+        SP = find_le_any_any(aTHX_ SP, obj,key,limit);
+#line 29098 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_any_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 6105 "SizeBalanced.xs"
+        SP = find_gt_any_any(aTHX_ SP, obj,key,limit);
+#line 29128 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_any_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, key, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 6110 "SizeBalanced.xs"
+        SP = find_ge_any_any(aTHX_ SP, obj,key,limit);
+#line 29158 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_many_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_lt_many_any_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 6116 "SizeBalanced.xs"
+        SP = find_lt_many_any_any(aTHX_ SP, obj,keys);
+#line 29180 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_many_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_le_many_any_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 6121 "SizeBalanced.xs"
+        SP = find_le_many_any_any(aTHX_ SP, obj,keys);
+#line 29202 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_many_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_many_any_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 6126 "SizeBalanced.xs"
+        SP = find_gt_many_any_any(aTHX_ SP, obj,keys);
+#line 29224 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_many_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_many_any_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 6131 "SizeBalanced.xs"
+        SP = find_ge_many_any_any(aTHX_ SP, obj,keys);
+#line 29246 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_lt_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_lt_any_any)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 6137 "SizeBalanced.xs"
+        SP = find_gt_lt_any_any(aTHX_ SP, obj,lower_key,upper_key);
+#line 29270 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_lt_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_lt_any_any)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 6142 "SizeBalanced.xs"
+        SP = find_ge_lt_any_any(aTHX_ SP, obj,lower_key,upper_key);
+#line 29294 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_le_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_gt_le_any_any)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 6147 "SizeBalanced.xs"
+        SP = find_gt_le_any_any(aTHX_ SP, obj,lower_key,upper_key);
+#line 29318 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_le_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_ge_le_any_any)
+{
+    dVAR; dXSARGS;
+    if (items != 3)
+       croak_xs_usage(cv,  "obj, lower_key, upper_key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	lower_key = ST(1)
+;
+	SV *	upper_key = ST(2)
+;
+#line 6152 "SizeBalanced.xs"
+        SP = find_ge_le_any_any(aTHX_ SP, obj,lower_key,upper_key);
+#line 29342 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_any_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 6158 "SizeBalanced.xs"
+        SP = count_lt_any_any(aTHX_ SP, obj,key);
+#line 29364 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_any_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 6163 "SizeBalanced.xs"
+        SP = count_le_any_any(aTHX_ SP, obj,key);
+#line 29386 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_any_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 6168 "SizeBalanced.xs"
+        SP = count_gt_any_any(aTHX_ SP, obj,key);
+#line 29408 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_any_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 6173 "SizeBalanced.xs"
+        SP = count_ge_any_any(aTHX_ SP, obj,key);
+#line 29430 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_eq_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_eq_any_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 6178 "SizeBalanced.xs"
+        SP = count_eq_any_any(aTHX_ SP, obj,key);
+#line 29452 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_equal_range_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_equal_range_any_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, key");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	key = ST(1)
+;
+#line 6183 "SizeBalanced.xs"
+        SP = equal_range_any_any(aTHX_ SP, obj,key);
+#line 29474 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_many_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_lt_many_any_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 6189 "SizeBalanced.xs"
+        SP = count_lt_many_any_any(aTHX_ SP, obj,keys);
+#line 29496 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_many_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_le_many_any_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 6194 "SizeBalanced.xs"
+        SP = count_le_many_any_any(aTHX_ SP, obj,keys);
+#line 29518 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_many_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_gt_many_any_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 6199 "SizeBalanced.xs"
+        SP = count_gt_many_any_any(aTHX_ SP, obj,keys);
+#line 29540 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_many_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_count_ge_many_any_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, keys");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	keys = ST(1)
+;
+#line 6204 "SizeBalanced.xs"
+        SP = count_ge_many_any_any(aTHX_ SP, obj,keys);
+#line 29562 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_apply_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_apply_any_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, ops");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	SV *	ops = ST(1)
+;
+#line 6210 "SizeBalanced.xs"
+        SP = apply_any_any(aTHX_ SP, obj,ops);
+#line 29584 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_min_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_min_any_any)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 6216 "SizeBalanced.xs"
+        SP = find_min_any_any(aTHX_ SP, obj,limit);
+#line 29612 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_max_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_find_max_any_any)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 6221 "SizeBalanced.xs"
+        SP = find_max_any_any(aTHX_ SP, obj,limit);
+#line 29640 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_min_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_min_any_any)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 6227 "SizeBalanced.xs"
+        SP = pop_min_any_any(aTHX_ SP, obj,limit);
+#line 29668 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_max_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_pop_max_any_any)
+{
+    dVAR; dXSARGS;
+    if (items < 1 || items > 2)
+       croak_xs_usage(cv,  "obj, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	limit;
+
+	if (items < 2)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(1))
+;
+	}
+#line 6232 "SizeBalanced.xs"
+        SP = pop_max_any_any(aTHX_ SP, obj,limit);
+#line 29696 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_l_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_l_any_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, offset, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	offset = (int)SvIV(ST(1))
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 6238 "SizeBalanced.xs"
+        SP = skip_l_any_any(aTHX_ SP, obj,offset,limit);
+#line 29726 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_g_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_skip_g_any_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, offset, limit= 1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	offset = (int)SvIV(ST(1))
+;
+	int	limit;
+
+	if (items < 3)
+	    limit = 1;
+	else {
+	    limit = (int)SvIV(ST(2))
+;
+	}
+#line 6243 "SizeBalanced.xs"
+        SP = skip_g_any_any(aTHX_ SP, obj,offset,limit);
+#line 29756 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_at_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_at_any_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, offset");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	offset = (int)SvIV(ST(1))
+;
+#line 6248 "SizeBalanced.xs"
+        SP = delete_at_any_any(aTHX_ SP, obj,offset);
+#line 29778 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ranks_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_delete_ranks_any_any)
+{
+    dVAR; dXSARGS;
+    if (items < 2 || items > 3)
+       croak_xs_usage(cv,  "obj, from, count= -1");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	int	from = (int)SvIV(ST(1))
+;
+	int	count;
+
+	if (items < 3)
+	    count = -1;
+	else {
+	    count = (int)SvIV(ST(2))
+;
+	}
+#line 6253 "SizeBalanced.xs"
+        SP = delete_ranks_any_any(aTHX_ SP, obj,from,count);
+#line 29808 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_clear_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_clear_any_any)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 6259 "SizeBalanced.xs"
+        SP = clear_any_any(aTHX_ SP, obj);
+#line 29828 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_reserve_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_reserve_any_any)
+{
+    dVAR; dXSARGS;
+    if (items != 2)
+       croak_xs_usage(cv,  "obj, n");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+	IV	n = (IV)SvIV(ST(1))
+;
+#line 6264 "SizeBalanced.xs"
+        SP = reserve_any_any(aTHX_ SP, obj,n);
+#line 29850 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_compact_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_compact_any_any)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 6269 "SizeBalanced.xs"
+        SP = compact_any_any(aTHX_ SP, obj);
+#line 29870 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_dump_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_dump_any_any)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 6275 "SizeBalanced.xs"
+        SP = dump_any_any(aTHX_ SP, obj);
+#line 29890 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+
+XS_EUPXS(XS_Tree__SizeBalanced__Core_check_any_any); /* prototype to pass -Wmissing-prototypes */
+XS_EUPXS(XS_Tree__SizeBalanced__Core_check_any_any)
+{
+    dVAR; dXSARGS;
+    if (items != 1)
+       croak_xs_usage(cv,  "obj");
+    PERL_UNUSED_VAR(ax); /* -Wall */
+    SP -= items;
+    {
+	SV *	obj = ST(0)
+;
+#line 6280 "SizeBalanced.xs"
+        SP = check_any_any(aTHX_ SP, obj);
+#line 29910 "SizeBalanced.c"
+	PUTBACK;
+	return;
+    }
+}
+
+#ifdef __cplusplus
+extern "C"
+#endif
+XS_EXTERNAL(boot_Tree__SizeBalanced); /* prototype to pass -Wmissing-prototypes */
+XS_EXTERNAL(boot_Tree__SizeBalanced)
+{
+#if PERL_VERSION_LE(5, 21, 5)
+    dVAR; dXSARGS;
+#else
+    dVAR; dXSBOOTARGSXSAPIVERCHK;
+#endif
+#if PERL_VERSION_LE(5, 8, 999) /* PERL_VERSION_LT is 5.33+ */
+    char* file = __FILE__;
+#else
+    const char* file = __FILE__;
+#endif
+
+    PERL_UNUSED_VAR(file);
+
+    PERL_UNUSED_VAR(cv); /* -W */
+    PERL_UNUSED_VAR(items); /* -W */
+#if PERL_VERSION_LE(5, 21, 5)
+    XS_VERSION_BOOTCHECK;
+#  ifdef XS_APIVERSION_BOOTCHECK
+    XS_APIVERSION_BOOTCHECK;
+#  endif
+#endif
+
+        newXS_deffile("Tree::SizeBalanced::Core::constant", XS_Tree__SizeBalanced__Core_constant);
+        newXS_deffile("Tree::SizeBalanced::Core::new_int_void", XS_Tree__SizeBalanced__Core_new_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::new_from_sorted_int_void", XS_Tree__SizeBalanced__Core_new_from_sorted_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::DESTROY_int_void", XS_Tree__SizeBalanced__Core_DESTROY_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::size_int_void", XS_Tree__SizeBalanced__Core_size_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::ever_height_int_void", XS_Tree__SizeBalanced__Core_ever_height_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::cmp_count_int_void", XS_Tree__SizeBalanced__Core_cmp_count_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_int_void", XS_Tree__SizeBalanced__Core_insert_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_before_int_void", XS_Tree__SizeBalanced__Core_insert_before_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_after_int_void", XS_Tree__SizeBalanced__Core_insert_after_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_unique_int_void", XS_Tree__SizeBalanced__Core_insert_unique_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::set_int_void", XS_Tree__SizeBalanced__Core_set_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::add_value_int_void", XS_Tree__SizeBalanced__Core_add_value_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::incr_int_void", XS_Tree__SizeBalanced__Core_incr_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_many_int_void", XS_Tree__SizeBalanced__Core_insert_many_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_int_void", XS_Tree__SizeBalanced__Core_delete_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_first_int_void", XS_Tree__SizeBalanced__Core_delete_first_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_last_int_void", XS_Tree__SizeBalanced__Core_delete_last_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::take_first_int_void", XS_Tree__SizeBalanced__Core_take_first_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::take_last_int_void", XS_Tree__SizeBalanced__Core_take_last_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_many_int_void", XS_Tree__SizeBalanced__Core_delete_many_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_many_first_int_void", XS_Tree__SizeBalanced__Core_delete_many_first_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_many_last_int_void", XS_Tree__SizeBalanced__Core_delete_many_last_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_gt_lt_int_void", XS_Tree__SizeBalanced__Core_delete_gt_lt_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_ge_lt_int_void", XS_Tree__SizeBalanced__Core_delete_ge_lt_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_gt_le_int_void", XS_Tree__SizeBalanced__Core_delete_gt_le_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_ge_le_int_void", XS_Tree__SizeBalanced__Core_delete_ge_le_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::drain_le_int_void", XS_Tree__SizeBalanced__Core_drain_le_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::drain_ge_int_void", XS_Tree__SizeBalanced__Core_drain_ge_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::split_lt_int_void", XS_Tree__SizeBalanced__Core_split_lt_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::split_le_int_void", XS_Tree__SizeBalanced__Core_split_le_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::join_int_void", XS_Tree__SizeBalanced__Core_join_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::union_int_void", XS_Tree__SizeBalanced__Core_union_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::intersection_int_void", XS_Tree__SizeBalanced__Core_intersection_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::difference_int_void", XS_Tree__SizeBalanced__Core_difference_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_int_void", XS_Tree__SizeBalanced__Core_find_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_first_int_void", XS_Tree__SizeBalanced__Core_find_first_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_last_int_void", XS_Tree__SizeBalanced__Core_find_last_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::exists_int_void", XS_Tree__SizeBalanced__Core_exists_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::get_many_int_void", XS_Tree__SizeBalanced__Core_get_many_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_lt_int_void", XS_Tree__SizeBalanced__Core_find_lt_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_le_int_void", XS_Tree__SizeBalanced__Core_find_le_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_int_void", XS_Tree__SizeBalanced__Core_find_gt_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_int_void", XS_Tree__SizeBalanced__Core_find_ge_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_lt_many_int_void", XS_Tree__SizeBalanced__Core_find_lt_many_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_le_many_int_void", XS_Tree__SizeBalanced__Core_find_le_many_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_many_int_void", XS_Tree__SizeBalanced__Core_find_gt_many_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_many_int_void", XS_Tree__SizeBalanced__Core_find_ge_many_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_lt_int_void", XS_Tree__SizeBalanced__Core_find_gt_lt_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_lt_int_void", XS_Tree__SizeBalanced__Core_find_ge_lt_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_le_int_void", XS_Tree__SizeBalanced__Core_find_gt_le_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_le_int_void", XS_Tree__SizeBalanced__Core_find_ge_le_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::count_lt_int_void", XS_Tree__SizeBalanced__Core_count_lt_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::count_le_int_void", XS_Tree__SizeBalanced__Core_count_le_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::count_gt_int_void", XS_Tree__SizeBalanced__Core_count_gt_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::count_ge_int_void", XS_Tree__SizeBalanced__Core_count_ge_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::count_eq_int_void", XS_Tree__SizeBalanced__Core_count_eq_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::equal_range_int_void", XS_Tree__SizeBalanced__Core_equal_range_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::count_lt_many_int_void", XS_Tree__SizeBalanced__Core_count_lt_many_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::count_le_many_int_void", XS_Tree__SizeBalanced__Core_count_le_many_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::count_gt_many_int_void", XS_Tree__SizeBalanced__Core_count_gt_many_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::count_ge_many_int_void", XS_Tree__SizeBalanced__Core_count_ge_many_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::apply_int_void", XS_Tree__SizeBalanced__Core_apply_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_min_int_void", XS_Tree__SizeBalanced__Core_find_min_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_max_int_void", XS_Tree__SizeBalanced__Core_find_max_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::pop_min_int_void", XS_Tree__SizeBalanced__Core_pop_min_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::pop_max_int_void", XS_Tree__SizeBalanced__Core_pop_max_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::skip_l_int_void", XS_Tree__SizeBalanced__Core_skip_l_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::skip_g_int_void", XS_Tree__SizeBalanced__Core_skip_g_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_at_int_void", XS_Tree__SizeBalanced__Core_delete_at_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_ranks_int_void", XS_Tree__SizeBalanced__Core_delete_ranks_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::clear_int_void", XS_Tree__SizeBalanced__Core_clear_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::reserve_int_void", XS_Tree__SizeBalanced__Core_reserve_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::compact_int_void", XS_Tree__SizeBalanced__Core_compact_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::dump_int_void", XS_Tree__SizeBalanced__Core_dump_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::check_int_void", XS_Tree__SizeBalanced__Core_check_int_void);
+        newXS_deffile("Tree::SizeBalanced::Core::new_int_int", XS_Tree__SizeBalanced__Core_new_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::new_from_sorted_int_int", XS_Tree__SizeBalanced__Core_new_from_sorted_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::DESTROY_int_int", XS_Tree__SizeBalanced__Core_DESTROY_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::size_int_int", XS_Tree__SizeBalanced__Core_size_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::ever_height_int_int", XS_Tree__SizeBalanced__Core_ever_height_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::cmp_count_int_int", XS_Tree__SizeBalanced__Core_cmp_count_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_int_int", XS_Tree__SizeBalanced__Core_insert_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_before_int_int", XS_Tree__SizeBalanced__Core_insert_before_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_after_int_int", XS_Tree__SizeBalanced__Core_insert_after_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_unique_int_int", XS_Tree__SizeBalanced__Core_insert_unique_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::set_int_int", XS_Tree__SizeBalanced__Core_set_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::add_value_int_int", XS_Tree__SizeBalanced__Core_add_value_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::incr_int_int", XS_Tree__SizeBalanced__Core_incr_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_many_int_int", XS_Tree__SizeBalanced__Core_insert_many_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_int_int", XS_Tree__SizeBalanced__Core_delete_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_first_int_int", XS_Tree__SizeBalanced__Core_delete_first_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_last_int_int", XS_Tree__SizeBalanced__Core_delete_last_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::take_first_int_int", XS_Tree__SizeBalanced__Core_take_first_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::take_last_int_int", XS_Tree__SizeBalanced__Core_take_last_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_many_int_int", XS_Tree__SizeBalanced__Core_delete_many_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_many_first_int_int", XS_Tree__SizeBalanced__Core_delete_many_first_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_many_last_int_int", XS_Tree__SizeBalanced__Core_delete_many_last_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_gt_lt_int_int", XS_Tree__SizeBalanced__Core_delete_gt_lt_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_ge_lt_int_int", XS_Tree__SizeBalanced__Core_delete_ge_lt_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_gt_le_int_int", XS_Tree__SizeBalanced__Core_delete_gt_le_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_ge_le_int_int", XS_Tree__SizeBalanced__Core_delete_ge_le_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::drain_le_int_int", XS_Tree__SizeBalanced__Core_drain_le_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::drain_ge_int_int", XS_Tree__SizeBalanced__Core_drain_ge_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::split_lt_int_int", XS_Tree__SizeBalanced__Core_split_lt_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::split_le_int_int", XS_Tree__SizeBalanced__Core_split_le_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::join_int_int", XS_Tree__SizeBalanced__Core_join_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::union_int_int", XS_Tree__SizeBalanced__Core_union_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::intersection_int_int", XS_Tree__SizeBalanced__Core_intersection_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::difference_int_int", XS_Tree__SizeBalanced__Core_difference_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_int_int", XS_Tree__SizeBalanced__Core_find_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_first_int_int", XS_Tree__SizeBalanced__Core_find_first_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_last_int_int", XS_Tree__SizeBalanced__Core_find_last_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::exists_int_int", XS_Tree__SizeBalanced__Core_exists_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::get_many_int_int", XS_Tree__SizeBalanced__Core_get_many_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_lt_int_int", XS_Tree__SizeBalanced__Core_find_lt_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_le_int_int", XS_Tree__SizeBalanced__Core_find_le_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_int_int", XS_Tree__SizeBalanced__Core_find_gt_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_int_int", XS_Tree__SizeBalanced__Core_find_ge_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_lt_many_int_int", XS_Tree__SizeBalanced__Core_find_lt_many_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_le_many_int_int", XS_Tree__SizeBalanced__Core_find_le_many_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_many_int_int", XS_Tree__SizeBalanced__Core_find_gt_many_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_many_int_int", XS_Tree__SizeBalanced__Core_find_ge_many_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_lt_int_int", XS_Tree__SizeBalanced__Core_find_gt_lt_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_lt_int_int", XS_Tree__SizeBalanced__Core_find_ge_lt_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_le_int_int", XS_Tree__SizeBalanced__Core_find_gt_le_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_le_int_int", XS_Tree__SizeBalanced__Core_find_ge_le_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::count_lt_int_int", XS_Tree__SizeBalanced__Core_count_lt_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::count_le_int_int", XS_Tree__SizeBalanced__Core_count_le_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::count_gt_int_int", XS_Tree__SizeBalanced__Core_count_gt_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::count_ge_int_int", XS_Tree__SizeBalanced__Core_count_ge_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::count_eq_int_int", XS_Tree__SizeBalanced__Core_count_eq_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::equal_range_int_int", XS_Tree__SizeBalanced__Core_equal_range_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::count_lt_many_int_int", XS_Tree__SizeBalanced__Core_count_lt_many_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::count_le_many_int_int", XS_Tree__SizeBalanced__Core_count_le_many_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::count_gt_many_int_int", XS_Tree__SizeBalanced__Core_count_gt_many_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::count_ge_many_int_int", XS_Tree__SizeBalanced__Core_count_ge_many_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::apply_int_int", XS_Tree__SizeBalanced__Core_apply_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_min_int_int", XS_Tree__SizeBalanced__Core_find_min_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_max_int_int", XS_Tree__SizeBalanced__Core_find_max_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::pop_min_int_int", XS_Tree__SizeBalanced__Core_pop_min_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::pop_max_int_int", XS_Tree__SizeBalanced__Core_pop_max_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::skip_l_int_int", XS_Tree__SizeBalanced__Core_skip_l_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::skip_g_int_int", XS_Tree__SizeBalanced__Core_skip_g_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_at_int_int", XS_Tree__SizeBalanced__Core_delete_at_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_ranks_int_int", XS_Tree__SizeBalanced__Core_delete_ranks_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::clear_int_int", XS_Tree__SizeBalanced__Core_clear_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::reserve_int_int", XS_Tree__SizeBalanced__Core_reserve_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::compact_int_int", XS_Tree__SizeBalanced__Core_compact_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::dump_int_int", XS_Tree__SizeBalanced__Core_dump_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::check_int_int", XS_Tree__SizeBalanced__Core_check_int_int);
+        newXS_deffile("Tree::SizeBalanced::Core::new_int_num", XS_Tree__SizeBalanced__Core_new_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::new_from_sorted_int_num", XS_Tree__SizeBalanced__Core_new_from_sorted_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::DESTROY_int_num", XS_Tree__SizeBalanced__Core_DESTROY_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::size_int_num", XS_Tree__SizeBalanced__Core_size_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::ever_height_int_num", XS_Tree__SizeBalanced__Core_ever_height_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::cmp_count_int_num", XS_Tree__SizeBalanced__Core_cmp_count_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_int_num", XS_Tree__SizeBalanced__Core_insert_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_before_int_num", XS_Tree__SizeBalanced__Core_insert_before_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_after_int_num", XS_Tree__SizeBalanced__Core_insert_after_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_unique_int_num", XS_Tree__SizeBalanced__Core_insert_unique_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::set_int_num", XS_Tree__SizeBalanced__Core_set_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::add_value_int_num", XS_Tree__SizeBalanced__Core_add_value_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::incr_int_num", XS_Tree__SizeBalanced__Core_incr_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_many_int_num", XS_Tree__SizeBalanced__Core_insert_many_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_int_num", XS_Tree__SizeBalanced__Core_delete_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_first_int_num", XS_Tree__SizeBalanced__Core_delete_first_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_last_int_num", XS_Tree__SizeBalanced__Core_delete_last_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::take_first_int_num", XS_Tree__SizeBalanced__Core_take_first_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::take_last_int_num", XS_Tree__SizeBalanced__Core_take_last_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_many_int_num", XS_Tree__SizeBalanced__Core_delete_many_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_many_first_int_num", XS_Tree__SizeBalanced__Core_delete_many_first_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_many_last_int_num", XS_Tree__SizeBalanced__Core_delete_many_last_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_gt_lt_int_num", XS_Tree__SizeBalanced__Core_delete_gt_lt_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_ge_lt_int_num", XS_Tree__SizeBalanced__Core_delete_ge_lt_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_gt_le_int_num", XS_Tree__SizeBalanced__Core_delete_gt_le_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_ge_le_int_num", XS_Tree__SizeBalanced__Core_delete_ge_le_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::drain_le_int_num", XS_Tree__SizeBalanced__Core_drain_le_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::drain_ge_int_num", XS_Tree__SizeBalanced__Core_drain_ge_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::split_lt_int_num", XS_Tree__SizeBalanced__Core_split_lt_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::split_le_int_num", XS_Tree__SizeBalanced__Core_split_le_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::join_int_num", XS_Tree__SizeBalanced__Core_join_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::union_int_num", XS_Tree__SizeBalanced__Core_union_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::intersection_int_num", XS_Tree__SizeBalanced__Core_intersection_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::difference_int_num", XS_Tree__SizeBalanced__Core_difference_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_int_num", XS_Tree__SizeBalanced__Core_find_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_first_int_num", XS_Tree__SizeBalanced__Core_find_first_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_last_int_num", XS_Tree__SizeBalanced__Core_find_last_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::exists_int_num", XS_Tree__SizeBalanced__Core_exists_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::get_many_int_num", XS_Tree__SizeBalanced__Core_get_many_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_lt_int_num", XS_Tree__SizeBalanced__Core_find_lt_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_le_int_num", XS_Tree__SizeBalanced__Core_find_le_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_int_num", XS_Tree__SizeBalanced__Core_find_gt_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_int_num", XS_Tree__SizeBalanced__Core_find_ge_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_lt_many_int_num", XS_Tree__SizeBalanced__Core_find_lt_many_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_le_many_int_num", XS_Tree__SizeBalanced__Core_find_le_many_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_many_int_num", XS_Tree__SizeBalanced__Core_find_gt_many_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_many_int_num", XS_Tree__SizeBalanced__Core_find_ge_many_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_lt_int_num", XS_Tree__SizeBalanced__Core_find_gt_lt_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_lt_int_num", XS_Tree__SizeBalanced__Core_find_ge_lt_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_le_int_num", XS_Tree__SizeBalanced__Core_find_gt_le_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_le_int_num", XS_Tree__SizeBalanced__Core_find_ge_le_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::count_lt_int_num", XS_Tree__SizeBalanced__Core_count_lt_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::count_le_int_num", XS_Tree__SizeBalanced__Core_count_le_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::count_gt_int_num", XS_Tree__SizeBalanced__Core_count_gt_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::count_ge_int_num", XS_Tree__SizeBalanced__Core_count_ge_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::count_eq_int_num", XS_Tree__SizeBalanced__Core_count_eq_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::equal_range_int_num", XS_Tree__SizeBalanced__Core_equal_range_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::count_lt_many_int_num", XS_Tree__SizeBalanced__Core_count_lt_many_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::count_le_many_int_num", XS_Tree__SizeBalanced__Core_count_le_many_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::count_gt_many_int_num", XS_Tree__SizeBalanced__Core_count_gt_many_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::count_ge_many_int_num", XS_Tree__SizeBalanced__Core_count_ge_many_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::apply_int_num", XS_Tree__SizeBalanced__Core_apply_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_min_int_num", XS_Tree__SizeBalanced__Core_find_min_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_max_int_num", XS_Tree__SizeBalanced__Core_find_max_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::pop_min_int_num", XS_Tree__SizeBalanced__Core_pop_min_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::pop_max_int_num", XS_Tree__SizeBalanced__Core_pop_max_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::skip_l_int_num", XS_Tree__SizeBalanced__Core_skip_l_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::skip_g_int_num", XS_Tree__SizeBalanced__Core_skip_g_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_at_int_num", XS_Tree__SizeBalanced__Core_delete_at_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_ranks_int_num", XS_Tree__SizeBalanced__Core_delete_ranks_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::clear_int_num", XS_Tree__SizeBalanced__Core_clear_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::reserve_int_num", XS_Tree__SizeBalanced__Core_reserve_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::compact_int_num", XS_Tree__SizeBalanced__Core_compact_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::dump_int_num", XS_Tree__SizeBalanced__Core_dump_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::check_int_num", XS_Tree__SizeBalanced__Core_check_int_num);
+        newXS_deffile("Tree::SizeBalanced::Core::new_int_any", XS_Tree__SizeBalanced__Core_new_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::new_from_sorted_int_any", XS_Tree__SizeBalanced__Core_new_from_sorted_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::DESTROY_int_any", XS_Tree__SizeBalanced__Core_DESTROY_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::size_int_any", XS_Tree__SizeBalanced__Core_size_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::ever_height_int_any", XS_Tree__SizeBalanced__Core_ever_height_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::cmp_count_int_any", XS_Tree__SizeBalanced__Core_cmp_count_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_int_any", XS_Tree__SizeBalanced__Core_insert_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_before_int_any", XS_Tree__SizeBalanced__Core_insert_before_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_after_int_any", XS_Tree__SizeBalanced__Core_insert_after_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_unique_int_any", XS_Tree__SizeBalanced__Core_insert_unique_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::set_int_any", XS_Tree__SizeBalanced__Core_set_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::add_value_int_any", XS_Tree__SizeBalanced__Core_add_value_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::incr_int_any", XS_Tree__SizeBalanced__Core_incr_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_many_int_any", XS_Tree__SizeBalanced__Core_insert_many_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_int_any", XS_Tree__SizeBalanced__Core_delete_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_first_int_any", XS_Tree__SizeBalanced__Core_delete_first_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_last_int_any", XS_Tree__SizeBalanced__Core_delete_last_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::take_first_int_any", XS_Tree__SizeBalanced__Core_take_first_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::take_last_int_any", XS_Tree__SizeBalanced__Core_take_last_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_many_int_any", XS_Tree__SizeBalanced__Core_delete_many_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_many_first_int_any", XS_Tree__SizeBalanced__Core_delete_many_first_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_many_last_int_any", XS_Tree__SizeBalanced__Core_delete_many_last_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_gt_lt_int_any", XS_Tree__SizeBalanced__Core_delete_gt_lt_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_ge_lt_int_any", XS_Tree__SizeBalanced__Core_delete_ge_lt_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_gt_le_int_any", XS_Tree__SizeBalanced__Core_delete_gt_le_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_ge_le_int_any", XS_Tree__SizeBalanced__Core_delete_ge_le_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::drain_le_int_any", XS_Tree__SizeBalanced__Core_drain_le_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::drain_ge_int_any", XS_Tree__SizeBalanced__Core_drain_ge_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::split_lt_int_any", XS_Tree__SizeBalanced__Core_split_lt_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::split_le_int_any", XS_Tree__SizeBalanced__Core_split_le_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::join_int_any", XS_Tree__SizeBalanced__Core_join_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::union_int_any", XS_Tree__SizeBalanced__Core_union_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::intersection_int_any", XS_Tree__SizeBalanced__Core_intersection_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::difference_int_any", XS_Tree__SizeBalanced__Core_difference_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_int_any", XS_Tree__SizeBalanced__Core_find_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_first_int_any", XS_Tree__SizeBalanced__Core_find_first_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_last_int_any", XS_Tree__SizeBalanced__Core_find_last_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::exists_int_any", XS_Tree__SizeBalanced__Core_exists_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::get_many_int_any", XS_Tree__SizeBalanced__Core_get_many_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_lt_int_any", XS_Tree__SizeBalanced__Core_find_lt_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_le_int_any", XS_Tree__SizeBalanced__Core_find_le_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_int_any", XS_Tree__SizeBalanced__Core_find_gt_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_int_any", XS_Tree__SizeBalanced__Core_find_ge_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_lt_many_int_any", XS_Tree__SizeBalanced__Core_find_lt_many_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_le_many_int_any", XS_Tree__SizeBalanced__Core_find_le_many_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_many_int_any", XS_Tree__SizeBalanced__Core_find_gt_many_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_many_int_any", XS_Tree__SizeBalanced__Core_find_ge_many_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_lt_int_any", XS_Tree__SizeBalanced__Core_find_gt_lt_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_lt_int_any", XS_Tree__SizeBalanced__Core_find_ge_lt_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_le_int_any", XS_Tree__SizeBalanced__Core_find_gt_le_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_le_int_any", XS_Tree__SizeBalanced__Core_find_ge_le_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::count_lt_int_any", XS_Tree__SizeBalanced__Core_count_lt_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::count_le_int_any", XS_Tree__SizeBalanced__Core_count_le_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::count_gt_int_any", XS_Tree__SizeBalanced__Core_count_gt_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::count_ge_int_any", XS_Tree__SizeBalanced__Core_count_ge_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::count_eq_int_any", XS_Tree__SizeBalanced__Core_count_eq_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::equal_range_int_any", XS_Tree__SizeBalanced__Core_equal_range_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::count_lt_many_int_any", XS_Tree__SizeBalanced__Core_count_lt_many_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::count_le_many_int_any", XS_Tree__SizeBalanced__Core_count_le_many_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::count_gt_many_int_any", XS_Tree__SizeBalanced__Core_count_gt_many_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::count_ge_many_int_any", XS_Tree__SizeBalanced__Core_count_ge_many_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::apply_int_any", XS_Tree__SizeBalanced__Core_apply_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_min_int_any", XS_Tree__SizeBalanced__Core_find_min_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_max_int_any", XS_Tree__SizeBalanced__Core_find_max_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::pop_min_int_any", XS_Tree__SizeBalanced__Core_pop_min_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::pop_max_int_any", XS_Tree__SizeBalanced__Core_pop_max_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::skip_l_int_any", XS_Tree__SizeBalanced__Core_skip_l_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::skip_g_int_any", XS_Tree__SizeBalanced__Core_skip_g_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_at_int_any", XS_Tree__SizeBalanced__Core_delete_at_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_ranks_int_any", XS_Tree__SizeBalanced__Core_delete_ranks_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::clear_int_any", XS_Tree__SizeBalanced__Core_clear_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::reserve_int_any", XS_Tree__SizeBalanced__Core_reserve_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::compact_int_any", XS_Tree__SizeBalanced__Core_compact_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::dump_int_any", XS_Tree__SizeBalanced__Core_dump_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::check_int_any", XS_Tree__SizeBalanced__Core_check_int_any);
+        newXS_deffile("Tree::SizeBalanced::Core::new_num_void", XS_Tree__SizeBalanced__Core_new_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::new_from_sorted_num_void", XS_Tree__SizeBalanced__Core_new_from_sorted_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::DESTROY_num_void", XS_Tree__SizeBalanced__Core_DESTROY_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::size_num_void", XS_Tree__SizeBalanced__Core_size_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::ever_height_num_void", XS_Tree__SizeBalanced__Core_ever_height_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::cmp_count_num_void", XS_Tree__SizeBalanced__Core_cmp_count_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_num_void", XS_Tree__SizeBalanced__Core_insert_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_before_num_void", XS_Tree__SizeBalanced__Core_insert_before_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_after_num_void", XS_Tree__SizeBalanced__Core_insert_after_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_unique_num_void", XS_Tree__SizeBalanced__Core_insert_unique_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::set_num_void", XS_Tree__SizeBalanced__Core_set_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::add_value_num_void", XS_Tree__SizeBalanced__Core_add_value_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::incr_num_void", XS_Tree__SizeBalanced__Core_incr_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_many_num_void", XS_Tree__SizeBalanced__Core_insert_many_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_num_void", XS_Tree__SizeBalanced__Core_delete_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_first_num_void", XS_Tree__SizeBalanced__Core_delete_first_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_last_num_void", XS_Tree__SizeBalanced__Core_delete_last_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::take_first_num_void", XS_Tree__SizeBalanced__Core_take_first_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::take_last_num_void", XS_Tree__SizeBalanced__Core_take_last_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_many_num_void", XS_Tree__SizeBalanced__Core_delete_many_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_many_first_num_void", XS_Tree__SizeBalanced__Core_delete_many_first_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_many_last_num_void", XS_Tree__SizeBalanced__Core_delete_many_last_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_gt_lt_num_void", XS_Tree__SizeBalanced__Core_delete_gt_lt_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_ge_lt_num_void", XS_Tree__SizeBalanced__Core_delete_ge_lt_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_gt_le_num_void", XS_Tree__SizeBalanced__Core_delete_gt_le_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_ge_le_num_void", XS_Tree__SizeBalanced__Core_delete_ge_le_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::drain_le_num_void", XS_Tree__SizeBalanced__Core_drain_le_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::drain_ge_num_void", XS_Tree__SizeBalanced__Core_drain_ge_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::split_lt_num_void", XS_Tree__SizeBalanced__Core_split_lt_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::split_le_num_void", XS_Tree__SizeBalanced__Core_split_le_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::join_num_void", XS_Tree__SizeBalanced__Core_join_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::union_num_void", XS_Tree__SizeBalanced__Core_union_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::intersection_num_void", XS_Tree__SizeBalanced__Core_intersection_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::difference_num_void", XS_Tree__SizeBalanced__Core_difference_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_num_void", XS_Tree__SizeBalanced__Core_find_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_first_num_void", XS_Tree__SizeBalanced__Core_find_first_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_last_num_void", XS_Tree__SizeBalanced__Core_find_last_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::exists_num_void", XS_Tree__SizeBalanced__Core_exists_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::get_many_num_void", XS_Tree__SizeBalanced__Core_get_many_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_lt_num_void", XS_Tree__SizeBalanced__Core_find_lt_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_le_num_void", XS_Tree__SizeBalanced__Core_find_le_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_num_void", XS_Tree__SizeBalanced__Core_find_gt_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_num_void", XS_Tree__SizeBalanced__Core_find_ge_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_lt_many_num_void", XS_Tree__SizeBalanced__Core_find_lt_many_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_le_many_num_void", XS_Tree__SizeBalanced__Core_find_le_many_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_many_num_void", XS_Tree__SizeBalanced__Core_find_gt_many_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_many_num_void", XS_Tree__SizeBalanced__Core_find_ge_many_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_lt_num_void", XS_Tree__SizeBalanced__Core_find_gt_lt_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_lt_num_void", XS_Tree__SizeBalanced__Core_find_ge_lt_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_le_num_void", XS_Tree__SizeBalanced__Core_find_gt_le_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_le_num_void", XS_Tree__SizeBalanced__Core_find_ge_le_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::count_lt_num_void", XS_Tree__SizeBalanced__Core_count_lt_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::count_le_num_void", XS_Tree__SizeBalanced__Core_count_le_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::count_gt_num_void", XS_Tree__SizeBalanced__Core_count_gt_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::count_ge_num_void", XS_Tree__SizeBalanced__Core_count_ge_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::count_eq_num_void", XS_Tree__SizeBalanced__Core_count_eq_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::equal_range_num_void", XS_Tree__SizeBalanced__Core_equal_range_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::count_lt_many_num_void", XS_Tree__SizeBalanced__Core_count_lt_many_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::count_le_many_num_void", XS_Tree__SizeBalanced__Core_count_le_many_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::count_gt_many_num_void", XS_Tree__SizeBalanced__Core_count_gt_many_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::count_ge_many_num_void", XS_Tree__SizeBalanced__Core_count_ge_many_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::apply_num_void", XS_Tree__SizeBalanced__Core_apply_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_min_num_void", XS_Tree__SizeBalanced__Core_find_min_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_max_num_void", XS_Tree__SizeBalanced__Core_find_max_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::pop_min_num_void", XS_Tree__SizeBalanced__Core_pop_min_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::pop_max_num_void", XS_Tree__SizeBalanced__Core_pop_max_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::skip_l_num_void", XS_Tree__SizeBalanced__Core_skip_l_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::skip_g_num_void", XS_Tree__SizeBalanced__Core_skip_g_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_at_num_void", XS_Tree__SizeBalanced__Core_delete_at_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_ranks_num_void", XS_Tree__SizeBalanced__Core_delete_ranks_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::clear_num_void", XS_Tree__SizeBalanced__Core_clear_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::reserve_num_void", XS_Tree__SizeBalanced__Core_reserve_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::compact_num_void", XS_Tree__SizeBalanced__Core_compact_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::dump_num_void", XS_Tree__SizeBalanced__Core_dump_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::check_num_void", XS_Tree__SizeBalanced__Core_check_num_void);
+        newXS_deffile("Tree::SizeBalanced::Core::new_num_int", XS_Tree__SizeBalanced__Core_new_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::new_from_sorted_num_int", XS_Tree__SizeBalanced__Core_new_from_sorted_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::DESTROY_num_int", XS_Tree__SizeBalanced__Core_DESTROY_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::size_num_int", XS_Tree__SizeBalanced__Core_size_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::ever_height_num_int", XS_Tree__SizeBalanced__Core_ever_height_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::cmp_count_num_int", XS_Tree__SizeBalanced__Core_cmp_count_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_num_int", XS_Tree__SizeBalanced__Core_insert_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_before_num_int", XS_Tree__SizeBalanced__Core_insert_before_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_after_num_int", XS_Tree__SizeBalanced__Core_insert_after_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_unique_num_int", XS_Tree__SizeBalanced__Core_insert_unique_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::set_num_int", XS_Tree__SizeBalanced__Core_set_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::add_value_num_int", XS_Tree__SizeBalanced__Core_add_value_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::incr_num_int", XS_Tree__SizeBalanced__Core_incr_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_many_num_int", XS_Tree__SizeBalanced__Core_insert_many_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_num_int", XS_Tree__SizeBalanced__Core_delete_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_first_num_int", XS_Tree__SizeBalanced__Core_delete_first_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_last_num_int", XS_Tree__SizeBalanced__Core_delete_last_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::take_first_num_int", XS_Tree__SizeBalanced__Core_take_first_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::take_last_num_int", XS_Tree__SizeBalanced__Core_take_last_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_many_num_int", XS_Tree__SizeBalanced__Core_delete_many_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_many_first_num_int", XS_Tree__SizeBalanced__Core_delete_many_first_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_many_last_num_int", XS_Tree__SizeBalanced__Core_delete_many_last_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_gt_lt_num_int", XS_Tree__SizeBalanced__Core_delete_gt_lt_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_ge_lt_num_int", XS_Tree__SizeBalanced__Core_delete_ge_lt_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_gt_le_num_int", XS_Tree__SizeBalanced__Core_delete_gt_le_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_ge_le_num_int", XS_Tree__SizeBalanced__Core_delete_ge_le_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::drain_le_num_int", XS_Tree__SizeBalanced__Core_drain_le_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::drain_ge_num_int", XS_Tree__SizeBalanced__Core_drain_ge_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::split_lt_num_int", XS_Tree__SizeBalanced__Core_split_lt_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::split_le_num_int", XS_Tree__SizeBalanced__Core_split_le_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::join_num_int", XS_Tree__SizeBalanced__Core_join_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::union_num_int", XS_Tree__SizeBalanced__Core_union_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::intersection_num_int", XS_Tree__SizeBalanced__Core_intersection_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::difference_num_int", XS_Tree__SizeBalanced__Core_difference_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_num_int", XS_Tree__SizeBalanced__Core_find_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_first_num_int", XS_Tree__SizeBalanced__Core_find_first_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_last_num_int", XS_Tree__SizeBalanced__Core_find_last_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::exists_num_int", XS_Tree__SizeBalanced__Core_exists_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::get_many_num_int", XS_Tree__SizeBalanced__Core_get_many_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_lt_num_int", XS_Tree__SizeBalanced__Core_find_lt_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_le_num_int", XS_Tree__SizeBalanced__Core_find_le_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_num_int", XS_Tree__SizeBalanced__Core_find_gt_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_num_int", XS_Tree__SizeBalanced__Core_find_ge_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_lt_many_num_int", XS_Tree__SizeBalanced__Core_find_lt_many_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_le_many_num_int", XS_Tree__SizeBalanced__Core_find_le_many_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_many_num_int", XS_Tree__SizeBalanced__Core_find_gt_many_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_many_num_int", XS_Tree__SizeBalanced__Core_find_ge_many_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_lt_num_int", XS_Tree__SizeBalanced__Core_find_gt_lt_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_lt_num_int", XS_Tree__SizeBalanced__Core_find_ge_lt_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_le_num_int", XS_Tree__SizeBalanced__Core_find_gt_le_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_le_num_int", XS_Tree__SizeBalanced__Core_find_ge_le_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::count_lt_num_int", XS_Tree__SizeBalanced__Core_count_lt_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::count_le_num_int", XS_Tree__SizeBalanced__Core_count_le_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::count_gt_num_int", XS_Tree__SizeBalanced__Core_count_gt_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::count_ge_num_int", XS_Tree__SizeBalanced__Core_count_ge_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::count_eq_num_int", XS_Tree__SizeBalanced__Core_count_eq_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::equal_range_num_int", XS_Tree__SizeBalanced__Core_equal_range_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::count_lt_many_num_int", XS_Tree__SizeBalanced__Core_count_lt_many_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::count_le_many_num_int", XS_Tree__SizeBalanced__Core_count_le_many_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::count_gt_many_num_int", XS_Tree__SizeBalanced__Core_count_gt_many_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::count_ge_many_num_int", XS_Tree__SizeBalanced__Core_count_ge_many_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::apply_num_int", XS_Tree__SizeBalanced__Core_apply_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_min_num_int", XS_Tree__SizeBalanced__Core_find_min_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_max_num_int", XS_Tree__SizeBalanced__Core_find_max_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::pop_min_num_int", XS_Tree__SizeBalanced__Core_pop_min_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::pop_max_num_int", XS_Tree__SizeBalanced__Core_pop_max_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::skip_l_num_int", XS_Tree__SizeBalanced__Core_skip_l_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::skip_g_num_int", XS_Tree__SizeBalanced__Core_skip_g_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_at_num_int", XS_Tree__SizeBalanced__Core_delete_at_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_ranks_num_int", XS_Tree__SizeBalanced__Core_delete_ranks_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::clear_num_int", XS_Tree__SizeBalanced__Core_clear_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::reserve_num_int", XS_Tree__SizeBalanced__Core_reserve_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::compact_num_int", XS_Tree__SizeBalanced__Core_compact_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::dump_num_int", XS_Tree__SizeBalanced__Core_dump_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::check_num_int", XS_Tree__SizeBalanced__Core_check_num_int);
+        newXS_deffile("Tree::SizeBalanced::Core::new_num_num", XS_Tree__SizeBalanced__Core_new_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::new_from_sorted_num_num", XS_Tree__SizeBalanced__Core_new_from_sorted_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::DESTROY_num_num", XS_Tree__SizeBalanced__Core_DESTROY_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::size_num_num", XS_Tree__SizeBalanced__Core_size_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::ever_height_num_num", XS_Tree__SizeBalanced__Core_ever_height_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::cmp_count_num_num", XS_Tree__SizeBalanced__Core_cmp_count_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_num_num", XS_Tree__SizeBalanced__Core_insert_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_before_num_num", XS_Tree__SizeBalanced__Core_insert_before_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_after_num_num", XS_Tree__SizeBalanced__Core_insert_after_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_unique_num_num", XS_Tree__SizeBalanced__Core_insert_unique_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::set_num_num", XS_Tree__SizeBalanced__Core_set_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::add_value_num_num", XS_Tree__SizeBalanced__Core_add_value_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::incr_num_num", XS_Tree__SizeBalanced__Core_incr_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_many_num_num", XS_Tree__SizeBalanced__Core_insert_many_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_num_num", XS_Tree__SizeBalanced__Core_delete_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_first_num_num", XS_Tree__SizeBalanced__Core_delete_first_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_last_num_num", XS_Tree__SizeBalanced__Core_delete_last_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::take_first_num_num", XS_Tree__SizeBalanced__Core_take_first_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::take_last_num_num", XS_Tree__SizeBalanced__Core_take_last_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_many_num_num", XS_Tree__SizeBalanced__Core_delete_many_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_many_first_num_num", XS_Tree__SizeBalanced__Core_delete_many_first_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_many_last_num_num", XS_Tree__SizeBalanced__Core_delete_many_last_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_gt_lt_num_num", XS_Tree__SizeBalanced__Core_delete_gt_lt_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_ge_lt_num_num", XS_Tree__SizeBalanced__Core_delete_ge_lt_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_gt_le_num_num", XS_Tree__SizeBalanced__Core_delete_gt_le_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_ge_le_num_num", XS_Tree__SizeBalanced__Core_delete_ge_le_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::drain_le_num_num", XS_Tree__SizeBalanced__Core_drain_le_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::drain_ge_num_num", XS_Tree__SizeBalanced__Core_drain_ge_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::split_lt_num_num", XS_Tree__SizeBalanced__Core_split_lt_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::split_le_num_num", XS_Tree__SizeBalanced__Core_split_le_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::join_num_num", XS_Tree__SizeBalanced__Core_join_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::union_num_num", XS_Tree__SizeBalanced__Core_union_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::intersection_num_num", XS_Tree__SizeBalanced__Core_intersection_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::difference_num_num", XS_Tree__SizeBalanced__Core_difference_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_num_num", XS_Tree__SizeBalanced__Core_find_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_first_num_num", XS_Tree__SizeBalanced__Core_find_first_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_last_num_num", XS_Tree__SizeBalanced__Core_find_last_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::exists_num_num", XS_Tree__SizeBalanced__Core_exists_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::get_many_num_num", XS_Tree__SizeBalanced__Core_get_many_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_lt_num_num", XS_Tree__SizeBalanced__Core_find_lt_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_le_num_num", XS_Tree__SizeBalanced__Core_find_le_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_num_num", XS_Tree__SizeBalanced__Core_find_gt_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_num_num", XS_Tree__SizeBalanced__Core_find_ge_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_lt_many_num_num", XS_Tree__SizeBalanced__Core_find_lt_many_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_le_many_num_num", XS_Tree__SizeBalanced__Core_find_le_many_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_many_num_num", XS_Tree__SizeBalanced__Core_find_gt_many_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_many_num_num", XS_Tree__SizeBalanced__Core_find_ge_many_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_lt_num_num", XS_Tree__SizeBalanced__Core_find_gt_lt_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_lt_num_num", XS_Tree__SizeBalanced__Core_find_ge_lt_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_le_num_num", XS_Tree__SizeBalanced__Core_find_gt_le_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_le_num_num", XS_Tree__SizeBalanced__Core_find_ge_le_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::count_lt_num_num", XS_Tree__SizeBalanced__Core_count_lt_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::count_le_num_num", XS_Tree__SizeBalanced__Core_count_le_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::count_gt_num_num", XS_Tree__SizeBalanced__Core_count_gt_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::count_ge_num_num", XS_Tree__SizeBalanced__Core_count_ge_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::count_eq_num_num", XS_Tree__SizeBalanced__Core_count_eq_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::equal_range_num_num", XS_Tree__SizeBalanced__Core_equal_range_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::count_lt_many_num_num", XS_Tree__SizeBalanced__Core_count_lt_many_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::count_le_many_num_num", XS_Tree__SizeBalanced__Core_count_le_many_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::count_gt_many_num_num", XS_Tree__SizeBalanced__Core_count_gt_many_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::count_ge_many_num_num", XS_Tree__SizeBalanced__Core_count_ge_many_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::apply_num_num", XS_Tree__SizeBalanced__Core_apply_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_min_num_num", XS_Tree__SizeBalanced__Core_find_min_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_max_num_num", XS_Tree__SizeBalanced__Core_find_max_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::pop_min_num_num", XS_Tree__SizeBalanced__Core_pop_min_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::pop_max_num_num", XS_Tree__SizeBalanced__Core_pop_max_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::skip_l_num_num", XS_Tree__SizeBalanced__Core_skip_l_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::skip_g_num_num", XS_Tree__SizeBalanced__Core_skip_g_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_at_num_num", XS_Tree__SizeBalanced__Core_delete_at_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_ranks_num_num", XS_Tree__SizeBalanced__Core_delete_ranks_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::clear_num_num", XS_Tree__SizeBalanced__Core_clear_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::reserve_num_num", XS_Tree__SizeBalanced__Core_reserve_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::compact_num_num", XS_Tree__SizeBalanced__Core_compact_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::dump_num_num", XS_Tree__SizeBalanced__Core_dump_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::check_num_num", XS_Tree__SizeBalanced__Core_check_num_num);
+        newXS_deffile("Tree::SizeBalanced::Core::new_num_any", XS_Tree__SizeBalanced__Core_new_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::new_from_sorted_num_any", XS_Tree__SizeBalanced__Core_new_from_sorted_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::DESTROY_num_any", XS_Tree__SizeBalanced__Core_DESTROY_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::size_num_any", XS_Tree__SizeBalanced__Core_size_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::ever_height_num_any", XS_Tree__SizeBalanced__Core_ever_height_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::cmp_count_num_any", XS_Tree__SizeBalanced__Core_cmp_count_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_num_any", XS_Tree__SizeBalanced__Core_insert_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_before_num_any", XS_Tree__SizeBalanced__Core_insert_before_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_after_num_any", XS_Tree__SizeBalanced__Core_insert_after_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_unique_num_any", XS_Tree__SizeBalanced__Core_insert_unique_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::set_num_any", XS_Tree__SizeBalanced__Core_set_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::add_value_num_any", XS_Tree__SizeBalanced__Core_add_value_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::incr_num_any", XS_Tree__SizeBalanced__Core_incr_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_many_num_any", XS_Tree__SizeBalanced__Core_insert_many_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_num_any", XS_Tree__SizeBalanced__Core_delete_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_first_num_any", XS_Tree__SizeBalanced__Core_delete_first_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_last_num_any", XS_Tree__SizeBalanced__Core_delete_last_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::take_first_num_any", XS_Tree__SizeBalanced__Core_take_first_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::take_last_num_any", XS_Tree__SizeBalanced__Core_take_last_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_many_num_any", XS_Tree__SizeBalanced__Core_delete_many_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_many_first_num_any", XS_Tree__SizeBalanced__Core_delete_many_first_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_many_last_num_any", XS_Tree__SizeBalanced__Core_delete_many_last_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_gt_lt_num_any", XS_Tree__SizeBalanced__Core_delete_gt_lt_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_ge_lt_num_any", XS_Tree__SizeBalanced__Core_delete_ge_lt_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_gt_le_num_any", XS_Tree__SizeBalanced__Core_delete_gt_le_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_ge_le_num_any", XS_Tree__SizeBalanced__Core_delete_ge_le_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::drain_le_num_any", XS_Tree__SizeBalanced__Core_drain_le_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::drain_ge_num_any", XS_Tree__SizeBalanced__Core_drain_ge_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::split_lt_num_any", XS_Tree__SizeBalanced__Core_split_lt_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::split_le_num_any", XS_Tree__SizeBalanced__Core_split_le_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::join_num_any", XS_Tree__SizeBalanced__Core_join_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::union_num_any", XS_Tree__SizeBalanced__Core_union_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::intersection_num_any", XS_Tree__SizeBalanced__Core_intersection_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::difference_num_any", XS_Tree__SizeBalanced__Core_difference_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_num_any", XS_Tree__SizeBalanced__Core_find_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_first_num_any", XS_Tree__SizeBalanced__Core_find_first_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_last_num_any", XS_Tree__SizeBalanced__Core_find_last_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::exists_num_any", XS_Tree__SizeBalanced__Core_exists_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::get_many_num_any", XS_Tree__SizeBalanced__Core_get_many_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_lt_num_any", XS_Tree__SizeBalanced__Core_find_lt_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_le_num_any", XS_Tree__SizeBalanced__Core_find_le_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_num_any", XS_Tree__SizeBalanced__Core_find_gt_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_num_any", XS_Tree__SizeBalanced__Core_find_ge_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_lt_many_num_any", XS_Tree__SizeBalanced__Core_find_lt_many_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_le_many_num_any", XS_Tree__SizeBalanced__Core_find_le_many_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_many_num_any", XS_Tree__SizeBalanced__Core_find_gt_many_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_many_num_any", XS_Tree__SizeBalanced__Core_find_ge_many_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_lt_num_any", XS_Tree__SizeBalanced__Core_find_gt_lt_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_lt_num_any", XS_Tree__SizeBalanced__Core_find_ge_lt_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_le_num_any", XS_Tree__SizeBalanced__Core_find_gt_le_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_le_num_any", XS_Tree__SizeBalanced__Core_find_ge_le_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::count_lt_num_any", XS_Tree__SizeBalanced__Core_count_lt_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::count_le_num_any", XS_Tree__SizeBalanced__Core_count_le_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::count_gt_num_any", XS_Tree__SizeBalanced__Core_count_gt_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::count_ge_num_any", XS_Tree__SizeBalanced__Core_count_ge_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::count_eq_num_any", XS_Tree__SizeBalanced__Core_count_eq_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::equal_range_num_any", XS_Tree__SizeBalanced__Core_equal_range_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::count_lt_many_num_any", XS_Tree__SizeBalanced__Core_count_lt_many_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::count_le_many_num_any", XS_Tree__SizeBalanced__Core_count_le_many_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::count_gt_many_num_any", XS_Tree__SizeBalanced__Core_count_gt_many_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::count_ge_many_num_any", XS_Tree__SizeBalanced__Core_count_ge_many_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::apply_num_any", XS_Tree__SizeBalanced__Core_apply_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_min_num_any", XS_Tree__SizeBalanced__Core_find_min_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_max_num_any", XS_Tree__SizeBalanced__Core_find_max_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::pop_min_num_any", XS_Tree__SizeBalanced__Core_pop_min_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::pop_max_num_any", XS_Tree__SizeBalanced__Core_pop_max_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::skip_l_num_any", XS_Tree__SizeBalanced__Core_skip_l_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::skip_g_num_any", XS_Tree__SizeBalanced__Core_skip_g_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_at_num_any", XS_Tree__SizeBalanced__Core_delete_at_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_ranks_num_any", XS_Tree__SizeBalanced__Core_delete_ranks_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::clear_num_any", XS_Tree__SizeBalanced__Core_clear_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::reserve_num_any", XS_Tree__SizeBalanced__Core_reserve_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::compact_num_any", XS_Tree__SizeBalanced__Core_compact_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::dump_num_any", XS_Tree__SizeBalanced__Core_dump_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::check_num_any", XS_Tree__SizeBalanced__Core_check_num_any);
+        newXS_deffile("Tree::SizeBalanced::Core::new_str_void", XS_Tree__SizeBalanced__Core_new_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::new_from_sorted_str_void", XS_Tree__SizeBalanced__Core_new_from_sorted_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::DESTROY_str_void", XS_Tree__SizeBalanced__Core_DESTROY_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::size_str_void", XS_Tree__SizeBalanced__Core_size_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::ever_height_str_void", XS_Tree__SizeBalanced__Core_ever_height_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::cmp_count_str_void", XS_Tree__SizeBalanced__Core_cmp_count_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_str_void", XS_Tree__SizeBalanced__Core_insert_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_before_str_void", XS_Tree__SizeBalanced__Core_insert_before_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_after_str_void", XS_Tree__SizeBalanced__Core_insert_after_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_unique_str_void", XS_Tree__SizeBalanced__Core_insert_unique_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::set_str_void", XS_Tree__SizeBalanced__Core_set_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::add_value_str_void", XS_Tree__SizeBalanced__Core_add_value_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::incr_str_void", XS_Tree__SizeBalanced__Core_incr_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_many_str_void", XS_Tree__SizeBalanced__Core_insert_many_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_str_void", XS_Tree__SizeBalanced__Core_delete_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_first_str_void", XS_Tree__SizeBalanced__Core_delete_first_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_last_str_void", XS_Tree__SizeBalanced__Core_delete_last_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::take_first_str_void", XS_Tree__SizeBalanced__Core_take_first_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::take_last_str_void", XS_Tree__SizeBalanced__Core_take_last_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_many_str_void", XS_Tree__SizeBalanced__Core_delete_many_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_many_first_str_void", XS_Tree__SizeBalanced__Core_delete_many_first_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_many_last_str_void", XS_Tree__SizeBalanced__Core_delete_many_last_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_gt_lt_str_void", XS_Tree__SizeBalanced__Core_delete_gt_lt_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_ge_lt_str_void", XS_Tree__SizeBalanced__Core_delete_ge_lt_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_gt_le_str_void", XS_Tree__SizeBalanced__Core_delete_gt_le_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_ge_le_str_void", XS_Tree__SizeBalanced__Core_delete_ge_le_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::drain_le_str_void", XS_Tree__SizeBalanced__Core_drain_le_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::drain_ge_str_void", XS_Tree__SizeBalanced__Core_drain_ge_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::split_lt_str_void", XS_Tree__SizeBalanced__Core_split_lt_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::split_le_str_void", XS_Tree__SizeBalanced__Core_split_le_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::join_str_void", XS_Tree__SizeBalanced__Core_join_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::union_str_void", XS_Tree__SizeBalanced__Core_union_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::intersection_str_void", XS_Tree__SizeBalanced__Core_intersection_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::difference_str_void", XS_Tree__SizeBalanced__Core_difference_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_str_void", XS_Tree__SizeBalanced__Core_find_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_first_str_void", XS_Tree__SizeBalanced__Core_find_first_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_last_str_void", XS_Tree__SizeBalanced__Core_find_last_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::exists_str_void", XS_Tree__SizeBalanced__Core_exists_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::get_many_str_void", XS_Tree__SizeBalanced__Core_get_many_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_lt_str_void", XS_Tree__SizeBalanced__Core_find_lt_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_le_str_void", XS_Tree__SizeBalanced__Core_find_le_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_str_void", XS_Tree__SizeBalanced__Core_find_gt_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_str_void", XS_Tree__SizeBalanced__Core_find_ge_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_lt_many_str_void", XS_Tree__SizeBalanced__Core_find_lt_many_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_le_many_str_void", XS_Tree__SizeBalanced__Core_find_le_many_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_many_str_void", XS_Tree__SizeBalanced__Core_find_gt_many_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_many_str_void", XS_Tree__SizeBalanced__Core_find_ge_many_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_lt_str_void", XS_Tree__SizeBalanced__Core_find_gt_lt_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_lt_str_void", XS_Tree__SizeBalanced__Core_find_ge_lt_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_le_str_void", XS_Tree__SizeBalanced__Core_find_gt_le_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_le_str_void", XS_Tree__SizeBalanced__Core_find_ge_le_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::count_lt_str_void", XS_Tree__SizeBalanced__Core_count_lt_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::count_le_str_void", XS_Tree__SizeBalanced__Core_count_le_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::count_gt_str_void", XS_Tree__SizeBalanced__Core_count_gt_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::count_ge_str_void", XS_Tree__SizeBalanced__Core_count_ge_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::count_eq_str_void", XS_Tree__SizeBalanced__Core_count_eq_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::equal_range_str_void", XS_Tree__SizeBalanced__Core_equal_range_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::count_lt_many_str_void", XS_Tree__SizeBalanced__Core_count_lt_many_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::count_le_many_str_void", XS_Tree__SizeBalanced__Core_count_le_many_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::count_gt_many_str_void", XS_Tree__SizeBalanced__Core_count_gt_many_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::count_ge_many_str_void", XS_Tree__SizeBalanced__Core_count_ge_many_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::apply_str_void", XS_Tree__SizeBalanced__Core_apply_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_min_str_void", XS_Tree__SizeBalanced__Core_find_min_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_max_str_void", XS_Tree__SizeBalanced__Core_find_max_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::pop_min_str_void", XS_Tree__SizeBalanced__Core_pop_min_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::pop_max_str_void", XS_Tree__SizeBalanced__Core_pop_max_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::skip_l_str_void", XS_Tree__SizeBalanced__Core_skip_l_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::skip_g_str_void", XS_Tree__SizeBalanced__Core_skip_g_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_at_str_void", XS_Tree__SizeBalanced__Core_delete_at_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_ranks_str_void", XS_Tree__SizeBalanced__Core_delete_ranks_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::clear_str_void", XS_Tree__SizeBalanced__Core_clear_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::reserve_str_void", XS_Tree__SizeBalanced__Core_reserve_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::compact_str_void", XS_Tree__SizeBalanced__Core_compact_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::dump_str_void", XS_Tree__SizeBalanced__Core_dump_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::check_str_void", XS_Tree__SizeBalanced__Core_check_str_void);
+        newXS_deffile("Tree::SizeBalanced::Core::new_str_int", XS_Tree__SizeBalanced__Core_new_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::new_from_sorted_str_int", XS_Tree__SizeBalanced__Core_new_from_sorted_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::DESTROY_str_int", XS_Tree__SizeBalanced__Core_DESTROY_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::size_str_int", XS_Tree__SizeBalanced__Core_size_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::ever_height_str_int", XS_Tree__SizeBalanced__Core_ever_height_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::cmp_count_str_int", XS_Tree__SizeBalanced__Core_cmp_count_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_str_int", XS_Tree__SizeBalanced__Core_insert_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_before_str_int", XS_Tree__SizeBalanced__Core_insert_before_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_after_str_int", XS_Tree__SizeBalanced__Core_insert_after_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_unique_str_int", XS_Tree__SizeBalanced__Core_insert_unique_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::set_str_int", XS_Tree__SizeBalanced__Core_set_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::add_value_str_int", XS_Tree__SizeBalanced__Core_add_value_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::incr_str_int", XS_Tree__SizeBalanced__Core_incr_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_many_str_int", XS_Tree__SizeBalanced__Core_insert_many_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_str_int", XS_Tree__SizeBalanced__Core_delete_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_first_str_int", XS_Tree__SizeBalanced__Core_delete_first_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_last_str_int", XS_Tree__SizeBalanced__Core_delete_last_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::take_first_str_int", XS_Tree__SizeBalanced__Core_take_first_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::take_last_str_int", XS_Tree__SizeBalanced__Core_take_last_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_many_str_int", XS_Tree__SizeBalanced__Core_delete_many_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_many_first_str_int", XS_Tree__SizeBalanced__Core_delete_many_first_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_many_last_str_int", XS_Tree__SizeBalanced__Core_delete_many_last_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_gt_lt_str_int", XS_Tree__SizeBalanced__Core_delete_gt_lt_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_ge_lt_str_int", XS_Tree__SizeBalanced__Core_delete_ge_lt_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_gt_le_str_int", XS_Tree__SizeBalanced__Core_delete_gt_le_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_ge_le_str_int", XS_Tree__SizeBalanced__Core_delete_ge_le_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::drain_le_str_int", XS_Tree__SizeBalanced__Core_drain_le_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::drain_ge_str_int", XS_Tree__SizeBalanced__Core_drain_ge_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::split_lt_str_int", XS_Tree__SizeBalanced__Core_split_lt_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::split_le_str_int", XS_Tree__SizeBalanced__Core_split_le_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::join_str_int", XS_Tree__SizeBalanced__Core_join_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::union_str_int", XS_Tree__SizeBalanced__Core_union_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::intersection_str_int", XS_Tree__SizeBalanced__Core_intersection_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::difference_str_int", XS_Tree__SizeBalanced__Core_difference_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_str_int", XS_Tree__SizeBalanced__Core_find_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_first_str_int", XS_Tree__SizeBalanced__Core_find_first_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_last_str_int", XS_Tree__SizeBalanced__Core_find_last_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::exists_str_int", XS_Tree__SizeBalanced__Core_exists_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::get_many_str_int", XS_Tree__SizeBalanced__Core_get_many_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_lt_str_int", XS_Tree__SizeBalanced__Core_find_lt_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_le_str_int", XS_Tree__SizeBalanced__Core_find_le_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_str_int", XS_Tree__SizeBalanced__Core_find_gt_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_str_int", XS_Tree__SizeBalanced__Core_find_ge_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_lt_many_str_int", XS_Tree__SizeBalanced__Core_find_lt_many_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_le_many_str_int", XS_Tree__SizeBalanced__Core_find_le_many_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_many_str_int", XS_Tree__SizeBalanced__Core_find_gt_many_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_many_str_int", XS_Tree__SizeBalanced__Core_find_ge_many_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_lt_str_int", XS_Tree__SizeBalanced__Core_find_gt_lt_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_lt_str_int", XS_Tree__SizeBalanced__Core_find_ge_lt_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_le_str_int", XS_Tree__SizeBalanced__Core_find_gt_le_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_le_str_int", XS_Tree__SizeBalanced__Core_find_ge_le_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::count_lt_str_int", XS_Tree__SizeBalanced__Core_count_lt_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::count_le_str_int", XS_Tree__SizeBalanced__Core_count_le_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::count_gt_str_int", XS_Tree__SizeBalanced__Core_count_gt_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::count_ge_str_int", XS_Tree__SizeBalanced__Core_count_ge_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::count_eq_str_int", XS_Tree__SizeBalanced__Core_count_eq_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::equal_range_str_int", XS_Tree__SizeBalanced__Core_equal_range_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::count_lt_many_str_int", XS_Tree__SizeBalanced__Core_count_lt_many_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::count_le_many_str_int", XS_Tree__SizeBalanced__Core_count_le_many_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::count_gt_many_str_int", XS_Tree__SizeBalanced__Core_count_gt_many_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::count_ge_many_str_int", XS_Tree__SizeBalanced__Core_count_ge_many_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::apply_str_int", XS_Tree__SizeBalanced__Core_apply_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_min_str_int", XS_Tree__SizeBalanced__Core_find_min_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_max_str_int", XS_Tree__SizeBalanced__Core_find_max_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::pop_min_str_int", XS_Tree__SizeBalanced__Core_pop_min_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::pop_max_str_int", XS_Tree__SizeBalanced__Core_pop_max_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::skip_l_str_int", XS_Tree__SizeBalanced__Core_skip_l_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::skip_g_str_int", XS_Tree__SizeBalanced__Core_skip_g_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_at_str_int", XS_Tree__SizeBalanced__Core_delete_at_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_ranks_str_int", XS_Tree__SizeBalanced__Core_delete_ranks_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::clear_str_int", XS_Tree__SizeBalanced__Core_clear_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::reserve_str_int", XS_Tree__SizeBalanced__Core_reserve_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::compact_str_int", XS_Tree__SizeBalanced__Core_compact_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::dump_str_int", XS_Tree__SizeBalanced__Core_dump_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::check_str_int", XS_Tree__SizeBalanced__Core_check_str_int);
+        newXS_deffile("Tree::SizeBalanced::Core::new_str_num", XS_Tree__SizeBalanced__Core_new_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::new_from_sorted_str_num", XS_Tree__SizeBalanced__Core_new_from_sorted_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::DESTROY_str_num", XS_Tree__SizeBalanced__Core_DESTROY_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::size_str_num", XS_Tree__SizeBalanced__Core_size_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::ever_height_str_num", XS_Tree__SizeBalanced__Core_ever_height_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::cmp_count_str_num", XS_Tree__SizeBalanced__Core_cmp_count_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_str_num", XS_Tree__SizeBalanced__Core_insert_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_before_str_num", XS_Tree__SizeBalanced__Core_insert_before_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_after_str_num", XS_Tree__SizeBalanced__Core_insert_after_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_unique_str_num", XS_Tree__SizeBalanced__Core_insert_unique_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::set_str_num", XS_Tree__SizeBalanced__Core_set_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::add_value_str_num", XS_Tree__SizeBalanced__Core_add_value_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::incr_str_num", XS_Tree__SizeBalanced__Core_incr_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_many_str_num", XS_Tree__SizeBalanced__Core_insert_many_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_str_num", XS_Tree__SizeBalanced__Core_delete_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_first_str_num", XS_Tree__SizeBalanced__Core_delete_first_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_last_str_num", XS_Tree__SizeBalanced__Core_delete_last_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::take_first_str_num", XS_Tree__SizeBalanced__Core_take_first_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::take_last_str_num", XS_Tree__SizeBalanced__Core_take_last_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_many_str_num", XS_Tree__SizeBalanced__Core_delete_many_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_many_first_str_num", XS_Tree__SizeBalanced__Core_delete_many_first_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_many_last_str_num", XS_Tree__SizeBalanced__Core_delete_many_last_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_gt_lt_str_num", XS_Tree__SizeBalanced__Core_delete_gt_lt_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_ge_lt_str_num", XS_Tree__SizeBalanced__Core_delete_ge_lt_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_gt_le_str_num", XS_Tree__SizeBalanced__Core_delete_gt_le_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_ge_le_str_num", XS_Tree__SizeBalanced__Core_delete_ge_le_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::drain_le_str_num", XS_Tree__SizeBalanced__Core_drain_le_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::drain_ge_str_num", XS_Tree__SizeBalanced__Core_drain_ge_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::split_lt_str_num", XS_Tree__SizeBalanced__Core_split_lt_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::split_le_str_num", XS_Tree__SizeBalanced__Core_split_le_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::join_str_num", XS_Tree__SizeBalanced__Core_join_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::union_str_num", XS_Tree__SizeBalanced__Core_union_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::intersection_str_num", XS_Tree__SizeBalanced__Core_intersection_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::difference_str_num", XS_Tree__SizeBalanced__Core_difference_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_str_num", XS_Tree__SizeBalanced__Core_find_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_first_str_num", XS_Tree__SizeBalanced__Core_find_first_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_last_str_num", XS_Tree__SizeBalanced__Core_find_last_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::exists_str_num", XS_Tree__SizeBalanced__Core_exists_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::get_many_str_num", XS_Tree__SizeBalanced__Core_get_many_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_lt_str_num", XS_Tree__SizeBalanced__Core_find_lt_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_le_str_num", XS_Tree__SizeBalanced__Core_find_le_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_str_num", XS_Tree__SizeBalanced__Core_find_gt_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_str_num", XS_Tree__SizeBalanced__Core_find_ge_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_lt_many_str_num", XS_Tree__SizeBalanced__Core_find_lt_many_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_le_many_str_num", XS_Tree__SizeBalanced__Core_find_le_many_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_many_str_num", XS_Tree__SizeBalanced__Core_find_gt_many_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_many_str_num", XS_Tree__SizeBalanced__Core_find_ge_many_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_lt_str_num", XS_Tree__SizeBalanced__Core_find_gt_lt_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_lt_str_num", XS_Tree__SizeBalanced__Core_find_ge_lt_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_le_str_num", XS_Tree__SizeBalanced__Core_find_gt_le_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_le_str_num", XS_Tree__SizeBalanced__Core_find_ge_le_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::count_lt_str_num", XS_Tree__SizeBalanced__Core_count_lt_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::count_le_str_num", XS_Tree__SizeBalanced__Core_count_le_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::count_gt_str_num", XS_Tree__SizeBalanced__Core_count_gt_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::count_ge_str_num", XS_Tree__SizeBalanced__Core_count_ge_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::count_eq_str_num", XS_Tree__SizeBalanced__Core_count_eq_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::equal_range_str_num", XS_Tree__SizeBalanced__Core_equal_range_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::count_lt_many_str_num", XS_Tree__SizeBalanced__Core_count_lt_many_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::count_le_many_str_num", XS_Tree__SizeBalanced__Core_count_le_many_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::count_gt_many_str_num", XS_Tree__SizeBalanced__Core_count_gt_many_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::count_ge_many_str_num", XS_Tree__SizeBalanced__Core_count_ge_many_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::apply_str_num", XS_Tree__SizeBalanced__Core_apply_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_min_str_num", XS_Tree__SizeBalanced__Core_find_min_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_max_str_num", XS_Tree__SizeBalanced__Core_find_max_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::pop_min_str_num", XS_Tree__SizeBalanced__Core_pop_min_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::pop_max_str_num", XS_Tree__SizeBalanced__Core_pop_max_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::skip_l_str_num", XS_Tree__SizeBalanced__Core_skip_l_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::skip_g_str_num", XS_Tree__SizeBalanced__Core_skip_g_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_at_str_num", XS_Tree__SizeBalanced__Core_delete_at_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_ranks_str_num", XS_Tree__SizeBalanced__Core_delete_ranks_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::clear_str_num", XS_Tree__SizeBalanced__Core_clear_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::reserve_str_num", XS_Tree__SizeBalanced__Core_reserve_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::compact_str_num", XS_Tree__SizeBalanced__Core_compact_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::dump_str_num", XS_Tree__SizeBalanced__Core_dump_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::check_str_num", XS_Tree__SizeBalanced__Core_check_str_num);
+        newXS_deffile("Tree::SizeBalanced::Core::new_str_any", XS_Tree__SizeBalanced__Core_new_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::new_from_sorted_str_any", XS_Tree__SizeBalanced__Core_new_from_sorted_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::DESTROY_str_any", XS_Tree__SizeBalanced__Core_DESTROY_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::size_str_any", XS_Tree__SizeBalanced__Core_size_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::ever_height_str_any", XS_Tree__SizeBalanced__Core_ever_height_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::cmp_count_str_any", XS_Tree__SizeBalanced__Core_cmp_count_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_str_any", XS_Tree__SizeBalanced__Core_insert_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_before_str_any", XS_Tree__SizeBalanced__Core_insert_before_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_after_str_any", XS_Tree__SizeBalanced__Core_insert_after_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_unique_str_any", XS_Tree__SizeBalanced__Core_insert_unique_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::set_str_any", XS_Tree__SizeBalanced__Core_set_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::add_value_str_any", XS_Tree__SizeBalanced__Core_add_value_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::incr_str_any", XS_Tree__SizeBalanced__Core_incr_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_many_str_any", XS_Tree__SizeBalanced__Core_insert_many_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_str_any", XS_Tree__SizeBalanced__Core_delete_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_first_str_any", XS_Tree__SizeBalanced__Core_delete_first_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_last_str_any", XS_Tree__SizeBalanced__Core_delete_last_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::take_first_str_any", XS_Tree__SizeBalanced__Core_take_first_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::take_last_str_any", XS_Tree__SizeBalanced__Core_take_last_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_many_str_any", XS_Tree__SizeBalanced__Core_delete_many_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_many_first_str_any", XS_Tree__SizeBalanced__Core_delete_many_first_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_many_last_str_any", XS_Tree__SizeBalanced__Core_delete_many_last_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_gt_lt_str_any", XS_Tree__SizeBalanced__Core_delete_gt_lt_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_ge_lt_str_any", XS_Tree__SizeBalanced__Core_delete_ge_lt_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_gt_le_str_any", XS_Tree__SizeBalanced__Core_delete_gt_le_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_ge_le_str_any", XS_Tree__SizeBalanced__Core_delete_ge_le_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::drain_le_str_any", XS_Tree__SizeBalanced__Core_drain_le_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::drain_ge_str_any", XS_Tree__SizeBalanced__Core_drain_ge_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::split_lt_str_any", XS_Tree__SizeBalanced__Core_split_lt_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::split_le_str_any", XS_Tree__SizeBalanced__Core_split_le_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::join_str_any", XS_Tree__SizeBalanced__Core_join_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::union_str_any", XS_Tree__SizeBalanced__Core_union_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::intersection_str_any", XS_Tree__SizeBalanced__Core_intersection_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::difference_str_any", XS_Tree__SizeBalanced__Core_difference_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_str_any", XS_Tree__SizeBalanced__Core_find_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_first_str_any", XS_Tree__SizeBalanced__Core_find_first_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_last_str_any", XS_Tree__SizeBalanced__Core_find_last_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::exists_str_any", XS_Tree__SizeBalanced__Core_exists_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::get_many_str_any", XS_Tree__SizeBalanced__Core_get_many_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_lt_str_any", XS_Tree__SizeBalanced__Core_find_lt_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_le_str_any", XS_Tree__SizeBalanced__Core_find_le_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_str_any", XS_Tree__SizeBalanced__Core_find_gt_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_str_any", XS_Tree__SizeBalanced__Core_find_ge_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_lt_many_str_any", XS_Tree__SizeBalanced__Core_find_lt_many_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_le_many_str_any", XS_Tree__SizeBalanced__Core_find_le_many_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_many_str_any", XS_Tree__SizeBalanced__Core_find_gt_many_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_many_str_any", XS_Tree__SizeBalanced__Core_find_ge_many_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_lt_str_any", XS_Tree__SizeBalanced__Core_find_gt_lt_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_lt_str_any", XS_Tree__SizeBalanced__Core_find_ge_lt_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_le_str_any", XS_Tree__SizeBalanced__Core_find_gt_le_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_le_str_any", XS_Tree__SizeBalanced__Core_find_ge_le_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::count_lt_str_any", XS_Tree__SizeBalanced__Core_count_lt_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::count_le_str_any", XS_Tree__SizeBalanced__Core_count_le_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::count_gt_str_any", XS_Tree__SizeBalanced__Core_count_gt_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::count_ge_str_any", XS_Tree__SizeBalanced__Core_count_ge_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::count_eq_str_any", XS_Tree__SizeBalanced__Core_count_eq_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::equal_range_str_any", XS_Tree__SizeBalanced__Core_equal_range_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::count_lt_many_str_any", XS_Tree__SizeBalanced__Core_count_lt_many_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::count_le_many_str_any", XS_Tree__SizeBalanced__Core_count_le_many_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::count_gt_many_str_any", XS_Tree__SizeBalanced__Core_count_gt_many_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::count_ge_many_str_any", XS_Tree__SizeBalanced__Core_count_ge_many_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::apply_str_any", XS_Tree__SizeBalanced__Core_apply_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_min_str_any", XS_Tree__SizeBalanced__Core_find_min_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_max_str_any", XS_Tree__SizeBalanced__Core_find_max_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::pop_min_str_any", XS_Tree__SizeBalanced__Core_pop_min_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::pop_max_str_any", XS_Tree__SizeBalanced__Core_pop_max_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::skip_l_str_any", XS_Tree__SizeBalanced__Core_skip_l_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::skip_g_str_any", XS_Tree__SizeBalanced__Core_skip_g_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_at_str_any", XS_Tree__SizeBalanced__Core_delete_at_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_ranks_str_any", XS_Tree__SizeBalanced__Core_delete_ranks_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::clear_str_any", XS_Tree__SizeBalanced__Core_clear_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::reserve_str_any", XS_Tree__SizeBalanced__Core_reserve_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::compact_str_any", XS_Tree__SizeBalanced__Core_compact_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::dump_str_any", XS_Tree__SizeBalanced__Core_dump_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::check_str_any", XS_Tree__SizeBalanced__Core_check_str_any);
+        newXS_deffile("Tree::SizeBalanced::Core::new_any_void", XS_Tree__SizeBalanced__Core_new_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::new_from_sorted_any_void", XS_Tree__SizeBalanced__Core_new_from_sorted_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::DESTROY_any_void", XS_Tree__SizeBalanced__Core_DESTROY_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::size_any_void", XS_Tree__SizeBalanced__Core_size_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::ever_height_any_void", XS_Tree__SizeBalanced__Core_ever_height_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::cmp_count_any_void", XS_Tree__SizeBalanced__Core_cmp_count_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_any_void", XS_Tree__SizeBalanced__Core_insert_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_before_any_void", XS_Tree__SizeBalanced__Core_insert_before_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_after_any_void", XS_Tree__SizeBalanced__Core_insert_after_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_unique_any_void", XS_Tree__SizeBalanced__Core_insert_unique_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::set_any_void", XS_Tree__SizeBalanced__Core_set_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::add_value_any_void", XS_Tree__SizeBalanced__Core_add_value_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::incr_any_void", XS_Tree__SizeBalanced__Core_incr_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_many_any_void", XS_Tree__SizeBalanced__Core_insert_many_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_any_void", XS_Tree__SizeBalanced__Core_delete_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_first_any_void", XS_Tree__SizeBalanced__Core_delete_first_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_last_any_void", XS_Tree__SizeBalanced__Core_delete_last_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::take_first_any_void", XS_Tree__SizeBalanced__Core_take_first_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::take_last_any_void", XS_Tree__SizeBalanced__Core_take_last_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_many_any_void", XS_Tree__SizeBalanced__Core_delete_many_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_many_first_any_void", XS_Tree__SizeBalanced__Core_delete_many_first_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_many_last_any_void", XS_Tree__SizeBalanced__Core_delete_many_last_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_gt_lt_any_void", XS_Tree__SizeBalanced__Core_delete_gt_lt_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_ge_lt_any_void", XS_Tree__SizeBalanced__Core_delete_ge_lt_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_gt_le_any_void", XS_Tree__SizeBalanced__Core_delete_gt_le_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_ge_le_any_void", XS_Tree__SizeBalanced__Core_delete_ge_le_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::drain_le_any_void", XS_Tree__SizeBalanced__Core_drain_le_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::drain_ge_any_void", XS_Tree__SizeBalanced__Core_drain_ge_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::split_lt_any_void", XS_Tree__SizeBalanced__Core_split_lt_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::split_le_any_void", XS_Tree__SizeBalanced__Core_split_le_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::join_any_void", XS_Tree__SizeBalanced__Core_join_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::union_any_void", XS_Tree__SizeBalanced__Core_union_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::intersection_any_void", XS_Tree__SizeBalanced__Core_intersection_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::difference_any_void", XS_Tree__SizeBalanced__Core_difference_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_any_void", XS_Tree__SizeBalanced__Core_find_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_first_any_void", XS_Tree__SizeBalanced__Core_find_first_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_last_any_void", XS_Tree__SizeBalanced__Core_find_last_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::exists_any_void", XS_Tree__SizeBalanced__Core_exists_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::get_many_any_void", XS_Tree__SizeBalanced__Core_get_many_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_lt_any_void", XS_Tree__SizeBalanced__Core_find_lt_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_le_any_void", XS_Tree__SizeBalanced__Core_find_le_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_any_void", XS_Tree__SizeBalanced__Core_find_gt_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_any_void", XS_Tree__SizeBalanced__Core_find_ge_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_lt_many_any_void", XS_Tree__SizeBalanced__Core_find_lt_many_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_le_many_any_void", XS_Tree__SizeBalanced__Core_find_le_many_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_many_any_void", XS_Tree__SizeBalanced__Core_find_gt_many_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_many_any_void", XS_Tree__SizeBalanced__Core_find_ge_many_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_lt_any_void", XS_Tree__SizeBalanced__Core_find_gt_lt_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_lt_any_void", XS_Tree__SizeBalanced__Core_find_ge_lt_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_le_any_void", XS_Tree__SizeBalanced__Core_find_gt_le_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_le_any_void", XS_Tree__SizeBalanced__Core_find_ge_le_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::count_lt_any_void", XS_Tree__SizeBalanced__Core_count_lt_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::count_le_any_void", XS_Tree__SizeBalanced__Core_count_le_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::count_gt_any_void", XS_Tree__SizeBalanced__Core_count_gt_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::count_ge_any_void", XS_Tree__SizeBalanced__Core_count_ge_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::count_eq_any_void", XS_Tree__SizeBalanced__Core_count_eq_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::equal_range_any_void", XS_Tree__SizeBalanced__Core_equal_range_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::count_lt_many_any_void", XS_Tree__SizeBalanced__Core_count_lt_many_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::count_le_many_any_void", XS_Tree__SizeBalanced__Core_count_le_many_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::count_gt_many_any_void", XS_Tree__SizeBalanced__Core_count_gt_many_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::count_ge_many_any_void", XS_Tree__SizeBalanced__Core_count_ge_many_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::apply_any_void", XS_Tree__SizeBalanced__Core_apply_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_min_any_void", XS_Tree__SizeBalanced__Core_find_min_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::find_max_any_void", XS_Tree__SizeBalanced__Core_find_max_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::pop_min_any_void", XS_Tree__SizeBalanced__Core_pop_min_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::pop_max_any_void", XS_Tree__SizeBalanced__Core_pop_max_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::skip_l_any_void", XS_Tree__SizeBalanced__Core_skip_l_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::skip_g_any_void", XS_Tree__SizeBalanced__Core_skip_g_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_at_any_void", XS_Tree__SizeBalanced__Core_delete_at_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_ranks_any_void", XS_Tree__SizeBalanced__Core_delete_ranks_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::clear_any_void", XS_Tree__SizeBalanced__Core_clear_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::reserve_any_void", XS_Tree__SizeBalanced__Core_reserve_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::compact_any_void", XS_Tree__SizeBalanced__Core_compact_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::dump_any_void", XS_Tree__SizeBalanced__Core_dump_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::check_any_void", XS_Tree__SizeBalanced__Core_check_any_void);
+        newXS_deffile("Tree::SizeBalanced::Core::new_any_int", XS_Tree__SizeBalanced__Core_new_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::new_from_sorted_any_int", XS_Tree__SizeBalanced__Core_new_from_sorted_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::DESTROY_any_int", XS_Tree__SizeBalanced__Core_DESTROY_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::size_any_int", XS_Tree__SizeBalanced__Core_size_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::ever_height_any_int", XS_Tree__SizeBalanced__Core_ever_height_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::cmp_count_any_int", XS_Tree__SizeBalanced__Core_cmp_count_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_any_int", XS_Tree__SizeBalanced__Core_insert_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_before_any_int", XS_Tree__SizeBalanced__Core_insert_before_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_after_any_int", XS_Tree__SizeBalanced__Core_insert_after_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_unique_any_int", XS_Tree__SizeBalanced__Core_insert_unique_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::set_any_int", XS_Tree__SizeBalanced__Core_set_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::add_value_any_int", XS_Tree__SizeBalanced__Core_add_value_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::incr_any_int", XS_Tree__SizeBalanced__Core_incr_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_many_any_int", XS_Tree__SizeBalanced__Core_insert_many_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_any_int", XS_Tree__SizeBalanced__Core_delete_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_first_any_int", XS_Tree__SizeBalanced__Core_delete_first_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_last_any_int", XS_Tree__SizeBalanced__Core_delete_last_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::take_first_any_int", XS_Tree__SizeBalanced__Core_take_first_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::take_last_any_int", XS_Tree__SizeBalanced__Core_take_last_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_many_any_int", XS_Tree__SizeBalanced__Core_delete_many_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_many_first_any_int", XS_Tree__SizeBalanced__Core_delete_many_first_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_many_last_any_int", XS_Tree__SizeBalanced__Core_delete_many_last_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_gt_lt_any_int", XS_Tree__SizeBalanced__Core_delete_gt_lt_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_ge_lt_any_int", XS_Tree__SizeBalanced__Core_delete_ge_lt_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_gt_le_any_int", XS_Tree__SizeBalanced__Core_delete_gt_le_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_ge_le_any_int", XS_Tree__SizeBalanced__Core_delete_ge_le_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::drain_le_any_int", XS_Tree__SizeBalanced__Core_drain_le_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::drain_ge_any_int", XS_Tree__SizeBalanced__Core_drain_ge_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::split_lt_any_int", XS_Tree__SizeBalanced__Core_split_lt_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::split_le_any_int", XS_Tree__SizeBalanced__Core_split_le_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::join_any_int", XS_Tree__SizeBalanced__Core_join_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::union_any_int", XS_Tree__SizeBalanced__Core_union_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::intersection_any_int", XS_Tree__SizeBalanced__Core_intersection_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::difference_any_int", XS_Tree__SizeBalanced__Core_difference_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_any_int", XS_Tree__SizeBalanced__Core_find_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_first_any_int", XS_Tree__SizeBalanced__Core_find_first_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_last_any_int", XS_Tree__SizeBalanced__Core_find_last_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::exists_any_int", XS_Tree__SizeBalanced__Core_exists_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::get_many_any_int", XS_Tree__SizeBalanced__Core_get_many_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_lt_any_int", XS_Tree__SizeBalanced__Core_find_lt_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_le_any_int", XS_Tree__SizeBalanced__Core_find_le_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_any_int", XS_Tree__SizeBalanced__Core_find_gt_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_any_int", XS_Tree__SizeBalanced__Core_find_ge_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_lt_many_any_int", XS_Tree__SizeBalanced__Core_find_lt_many_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_le_many_any_int", XS_Tree__SizeBalanced__Core_find_le_many_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_many_any_int", XS_Tree__SizeBalanced__Core_find_gt_many_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_many_any_int", XS_Tree__SizeBalanced__Core_find_ge_many_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_lt_any_int", XS_Tree__SizeBalanced__Core_find_gt_lt_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_lt_any_int", XS_Tree__SizeBalanced__Core_find_ge_lt_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_le_any_int", XS_Tree__SizeBalanced__Core_find_gt_le_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_le_any_int", XS_Tree__SizeBalanced__Core_find_ge_le_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::count_lt_any_int", XS_Tree__SizeBalanced__Core_count_lt_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::count_le_any_int", XS_Tree__SizeBalanced__Core_count_le_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::count_gt_any_int", XS_Tree__SizeBalanced__Core_count_gt_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::count_ge_any_int", XS_Tree__SizeBalanced__Core_count_ge_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::count_eq_any_int", XS_Tree__SizeBalanced__Core_count_eq_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::equal_range_any_int", XS_Tree__SizeBalanced__Core_equal_range_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::count_lt_many_any_int", XS_Tree__SizeBalanced__Core_count_lt_many_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::count_le_many_any_int", XS_Tree__SizeBalanced__Core_count_le_many_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::count_gt_many_any_int", XS_Tree__SizeBalanced__Core_count_gt_many_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::count_ge_many_any_int", XS_Tree__SizeBalanced__Core_count_ge_many_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::apply_any_int", XS_Tree__SizeBalanced__Core_apply_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_min_any_int", XS_Tree__SizeBalanced__Core_find_min_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::find_max_any_int", XS_Tree__SizeBalanced__Core_find_max_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::pop_min_any_int", XS_Tree__SizeBalanced__Core_pop_min_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::pop_max_any_int", XS_Tree__SizeBalanced__Core_pop_max_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::skip_l_any_int", XS_Tree__SizeBalanced__Core_skip_l_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::skip_g_any_int", XS_Tree__SizeBalanced__Core_skip_g_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_at_any_int", XS_Tree__SizeBalanced__Core_delete_at_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_ranks_any_int", XS_Tree__SizeBalanced__Core_delete_ranks_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::clear_any_int", XS_Tree__SizeBalanced__Core_clear_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::reserve_any_int", XS_Tree__SizeBalanced__Core_reserve_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::compact_any_int", XS_Tree__SizeBalanced__Core_compact_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::dump_any_int", XS_Tree__SizeBalanced__Core_dump_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::check_any_int", XS_Tree__SizeBalanced__Core_check_any_int);
+        newXS_deffile("Tree::SizeBalanced::Core::new_any_num", XS_Tree__SizeBalanced__Core_new_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::new_from_sorted_any_num", XS_Tree__SizeBalanced__Core_new_from_sorted_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::DESTROY_any_num", XS_Tree__SizeBalanced__Core_DESTROY_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::size_any_num", XS_Tree__SizeBalanced__Core_size_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::ever_height_any_num", XS_Tree__SizeBalanced__Core_ever_height_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::cmp_count_any_num", XS_Tree__SizeBalanced__Core_cmp_count_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_any_num", XS_Tree__SizeBalanced__Core_insert_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_before_any_num", XS_Tree__SizeBalanced__Core_insert_before_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_after_any_num", XS_Tree__SizeBalanced__Core_insert_after_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_unique_any_num", XS_Tree__SizeBalanced__Core_insert_unique_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::set_any_num", XS_Tree__SizeBalanced__Core_set_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::add_value_any_num", XS_Tree__SizeBalanced__Core_add_value_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::incr_any_num", XS_Tree__SizeBalanced__Core_incr_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_many_any_num", XS_Tree__SizeBalanced__Core_insert_many_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_any_num", XS_Tree__SizeBalanced__Core_delete_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_first_any_num", XS_Tree__SizeBalanced__Core_delete_first_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_last_any_num", XS_Tree__SizeBalanced__Core_delete_last_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::take_first_any_num", XS_Tree__SizeBalanced__Core_take_first_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::take_last_any_num", XS_Tree__SizeBalanced__Core_take_last_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_many_any_num", XS_Tree__SizeBalanced__Core_delete_many_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_many_first_any_num", XS_Tree__SizeBalanced__Core_delete_many_first_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_many_last_any_num", XS_Tree__SizeBalanced__Core_delete_many_last_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_gt_lt_any_num", XS_Tree__SizeBalanced__Core_delete_gt_lt_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_ge_lt_any_num", XS_Tree__SizeBalanced__Core_delete_ge_lt_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_gt_le_any_num", XS_Tree__SizeBalanced__Core_delete_gt_le_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_ge_le_any_num", XS_Tree__SizeBalanced__Core_delete_ge_le_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::drain_le_any_num", XS_Tree__SizeBalanced__Core_drain_le_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::drain_ge_any_num", XS_Tree__SizeBalanced__Core_drain_ge_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::split_lt_any_num", XS_Tree__SizeBalanced__Core_split_lt_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::split_le_any_num", XS_Tree__SizeBalanced__Core_split_le_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::join_any_num", XS_Tree__SizeBalanced__Core_join_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::union_any_num", XS_Tree__SizeBalanced__Core_union_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::intersection_any_num", XS_Tree__SizeBalanced__Core_intersection_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::difference_any_num", XS_Tree__SizeBalanced__Core_difference_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_any_num", XS_Tree__SizeBalanced__Core_find_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_first_any_num", XS_Tree__SizeBalanced__Core_find_first_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_last_any_num", XS_Tree__SizeBalanced__Core_find_last_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::exists_any_num", XS_Tree__SizeBalanced__Core_exists_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::get_many_any_num", XS_Tree__SizeBalanced__Core_get_many_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_lt_any_num", XS_Tree__SizeBalanced__Core_find_lt_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_le_any_num", XS_Tree__SizeBalanced__Core_find_le_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_any_num", XS_Tree__SizeBalanced__Core_find_gt_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_any_num", XS_Tree__SizeBalanced__Core_find_ge_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_lt_many_any_num", XS_Tree__SizeBalanced__Core_find_lt_many_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_le_many_any_num", XS_Tree__SizeBalanced__Core_find_le_many_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_many_any_num", XS_Tree__SizeBalanced__Core_find_gt_many_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_many_any_num", XS_Tree__SizeBalanced__Core_find_ge_many_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_lt_any_num", XS_Tree__SizeBalanced__Core_find_gt_lt_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_lt_any_num", XS_Tree__SizeBalanced__Core_find_ge_lt_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_le_any_num", XS_Tree__SizeBalanced__Core_find_gt_le_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_le_any_num", XS_Tree__SizeBalanced__Core_find_ge_le_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::count_lt_any_num", XS_Tree__SizeBalanced__Core_count_lt_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::count_le_any_num", XS_Tree__SizeBalanced__Core_count_le_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::count_gt_any_num", XS_Tree__SizeBalanced__Core_count_gt_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::count_ge_any_num", XS_Tree__SizeBalanced__Core_count_ge_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::count_eq_any_num", XS_Tree__SizeBalanced__Core_count_eq_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::equal_range_any_num", XS_Tree__SizeBalanced__Core_equal_range_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::count_lt_many_any_num", XS_Tree__SizeBalanced__Core_count_lt_many_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::count_le_many_any_num", XS_Tree__SizeBalanced__Core_count_le_many_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::count_gt_many_any_num", XS_Tree__SizeBalanced__Core_count_gt_many_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::count_ge_many_any_num", XS_Tree__SizeBalanced__Core_count_ge_many_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::apply_any_num", XS_Tree__SizeBalanced__Core_apply_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_min_any_num", XS_Tree__SizeBalanced__Core_find_min_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::find_max_any_num", XS_Tree__SizeBalanced__Core_find_max_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::pop_min_any_num", XS_Tree__SizeBalanced__Core_pop_min_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::pop_max_any_num", XS_Tree__SizeBalanced__Core_pop_max_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::skip_l_any_num", XS_Tree__SizeBalanced__Core_skip_l_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::skip_g_any_num", XS_Tree__SizeBalanced__Core_skip_g_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_at_any_num", XS_Tree__SizeBalanced__Core_delete_at_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_ranks_any_num", XS_Tree__SizeBalanced__Core_delete_ranks_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::clear_any_num", XS_Tree__SizeBalanced__Core_clear_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::reserve_any_num", XS_Tree__SizeBalanced__Core_reserve_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::compact_any_num", XS_Tree__SizeBalanced__Core_compact_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::dump_any_num", XS_Tree__SizeBalanced__Core_dump_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::check_any_num", XS_Tree__SizeBalanced__Core_check_any_num);
+        newXS_deffile("Tree::SizeBalanced::Core::new_any_any", XS_Tree__SizeBalanced__Core_new_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::new_from_sorted_any_any", XS_Tree__SizeBalanced__Core_new_from_sorted_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::DESTROY_any_any", XS_Tree__SizeBalanced__Core_DESTROY_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::size_any_any", XS_Tree__SizeBalanced__Core_size_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::ever_height_any_any", XS_Tree__SizeBalanced__Core_ever_height_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::cmp_count_any_any", XS_Tree__SizeBalanced__Core_cmp_count_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_any_any", XS_Tree__SizeBalanced__Core_insert_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_before_any_any", XS_Tree__SizeBalanced__Core_insert_before_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_after_any_any", XS_Tree__SizeBalanced__Core_insert_after_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_unique_any_any", XS_Tree__SizeBalanced__Core_insert_unique_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::set_any_any", XS_Tree__SizeBalanced__Core_set_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::add_value_any_any", XS_Tree__SizeBalanced__Core_add_value_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::incr_any_any", XS_Tree__SizeBalanced__Core_incr_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::insert_many_any_any", XS_Tree__SizeBalanced__Core_insert_many_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_any_any", XS_Tree__SizeBalanced__Core_delete_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_first_any_any", XS_Tree__SizeBalanced__Core_delete_first_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_last_any_any", XS_Tree__SizeBalanced__Core_delete_last_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::take_first_any_any", XS_Tree__SizeBalanced__Core_take_first_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::take_last_any_any", XS_Tree__SizeBalanced__Core_take_last_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_many_any_any", XS_Tree__SizeBalanced__Core_delete_many_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_many_first_any_any", XS_Tree__SizeBalanced__Core_delete_many_first_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_many_last_any_any", XS_Tree__SizeBalanced__Core_delete_many_last_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_gt_lt_any_any", XS_Tree__SizeBalanced__Core_delete_gt_lt_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_ge_lt_any_any", XS_Tree__SizeBalanced__Core_delete_ge_lt_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_gt_le_any_any", XS_Tree__SizeBalanced__Core_delete_gt_le_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_ge_le_any_any", XS_Tree__SizeBalanced__Core_delete_ge_le_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::drain_le_any_any", XS_Tree__SizeBalanced__Core_drain_le_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::drain_ge_any_any", XS_Tree__SizeBalanced__Core_drain_ge_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::split_lt_any_any", XS_Tree__SizeBalanced__Core_split_lt_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::split_le_any_any", XS_Tree__SizeBalanced__Core_split_le_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::join_any_any", XS_Tree__SizeBalanced__Core_join_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::union_any_any", XS_Tree__SizeBalanced__Core_union_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::intersection_any_any", XS_Tree__SizeBalanced__Core_intersection_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::difference_any_any", XS_Tree__SizeBalanced__Core_difference_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_any_any", XS_Tree__SizeBalanced__Core_find_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_first_any_any", XS_Tree__SizeBalanced__Core_find_first_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_last_any_any", XS_Tree__SizeBalanced__Core_find_last_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::exists_any_any", XS_Tree__SizeBalanced__Core_exists_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::get_many_any_any", XS_Tree__SizeBalanced__Core_get_many_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_lt_any_any", XS_Tree__SizeBalanced__Core_find_lt_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_le_any_any", XS_Tree__SizeBalanced__Core_find_le_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_any_any", XS_Tree__SizeBalanced__Core_find_gt_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_any_any", XS_Tree__SizeBalanced__Core_find_ge_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_lt_many_any_any", XS_Tree__SizeBalanced__Core_find_lt_many_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_le_many_any_any", XS_Tree__SizeBalanced__Core_find_le_many_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_many_any_any", XS_Tree__SizeBalanced__Core_find_gt_many_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_many_any_any", XS_Tree__SizeBalanced__Core_find_ge_many_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_lt_any_any", XS_Tree__SizeBalanced__Core_find_gt_lt_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_lt_any_any", XS_Tree__SizeBalanced__Core_find_ge_lt_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_gt_le_any_any", XS_Tree__SizeBalanced__Core_find_gt_le_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_ge_le_any_any", XS_Tree__SizeBalanced__Core_find_ge_le_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::count_lt_any_any", XS_Tree__SizeBalanced__Core_count_lt_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::count_le_any_any", XS_Tree__SizeBalanced__Core_count_le_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::count_gt_any_any", XS_Tree__SizeBalanced__Core_count_gt_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::count_ge_any_any", XS_Tree__SizeBalanced__Core_count_ge_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::count_eq_any_any", XS_Tree__SizeBalanced__Core_count_eq_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::equal_range_any_any", XS_Tree__SizeBalanced__Core_equal_range_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::count_lt_many_any_any", XS_Tree__SizeBalanced__Core_count_lt_many_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::count_le_many_any_any", XS_Tree__SizeBalanced__Core_count_le_many_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::count_gt_many_any_any", XS_Tree__SizeBalanced__Core_count_gt_many_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::count_ge_many_any_any", XS_Tree__SizeBalanced__Core_count_ge_many_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::apply_any_any", XS_Tree__SizeBalanced__Core_apply_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_min_any_any", XS_Tree__SizeBalanced__Core_find_min_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::find_max_any_any", XS_Tree__SizeBalanced__Core_find_max_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::pop_min_any_any", XS_Tree__SizeBalanced__Core_pop_min_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::pop_max_any_any", XS_Tree__SizeBalanced__Core_pop_max_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::skip_l_any_any", XS_Tree__SizeBalanced__Core_skip_l_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::skip_g_any_any", XS_Tree__SizeBalanced__Core_skip_g_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_at_any_any", XS_Tree__SizeBalanced__Core_delete_at_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::delete_ranks_any_any", XS_Tree__SizeBalanced__Core_delete_ranks_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::clear_any_any", XS_Tree__SizeBalanced__Core_clear_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::reserve_any_any", XS_Tree__SizeBalanced__Core_reserve_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::compact_any_any", XS_Tree__SizeBalanced__Core_compact_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::dump_any_any", XS_Tree__SizeBalanced__Core_dump_any_any);
+        newXS_deffile("Tree::SizeBalanced::Core::check_any_any", XS_Tree__SizeBalanced__Core_check_any_any);
+
+    /* Initialisation Section */
+
+#line 54 "SizeBalanced.xs"
+    a_GV = gv_fetchpvn_flags("::a", 3, 1, SVt_PV);
+    b_GV = gv_fetchpvn_flags("::b", 3, 1, SVt_PV);
+
+#line 31152 "SizeBalanced.c"
+
+    /* End of Initialisation Section */
+
+#if PERL_VERSION_LE(5, 21, 5)
+#  if PERL_VERSION_GE(5, 9, 0)
+    if (PL_unitcheckav)
+        call_list(PL_scopestack_ix, PL_unitcheckav);
+#  endif
+    XSRETURN_YES;
+#else
+    Perl_xs_boot_epilog(aTHX_ ax);
+#endif
+}
+
@@ -0,0 +1,6281 @@
+// vim: filetype=xs
+#define PERL_NO_GET_CONTEXT
+#include "EXTERN.h"
+#include "perl.h"
+#include "XSUB.h"
+
+#include "ppport.h"
+
+#include "const-c.inc"
+
+GV * a_GV, * b_GV;
+
+#include "tree_common.h"
+
+#define KV_PASTER(NAME, KEY, VALUE) NAME ## _ ## KEY ## _ ## VALUE
+#define KV_EVALUATOR(NAME, KEY, VALUE) KV_PASTER(NAME, KEY, VALUE)
+#define KV(NAME) KV_EVALUATOR(NAME, KEY, VALUE)
+
+#define K_PASTER(NAME, KEY) NAME ## _ ## KEY
+#define K_EVALUATOR(NAME, KEY) K_PASTER(NAME, KEY)
+#define K(NAME) K_EVALUATOR(NAME, KEY)
+#define V(NAME) K_EVALUATOR(NAME, VALUE)
+
+#define I_EVALUATOR(NAME) NAME ## _id
+#define I(NAME) I_EVALUATOR(NAME)
+
+#define T_EVALUATOR(NAME) NAME ## _t
+#define T(NAME) T_EVALUATOR(NAME)
+
+#define S_EVALUATOR(NAME) #NAME
+#define S(NAME) S_EVALUATOR(NAME)
+
+#include "tree_customize.h"
+
+#define KEY int
+#  include "include_tree_with_different_value_type.h"
+#undef KEY
+
+#define KEY num
+#  include "include_tree_with_different_value_type.h"
+#undef KEY
+
+#define KEY str
+#  include "include_tree_with_different_value_type.h"
+#undef KEY
+
+#define KEY any
+#  include "include_tree_with_different_value_type.h"
+#undef KEY
+
+MODULE = Tree::SizeBalanced		PACKAGE = Tree::SizeBalanced::Core		
+
+BOOT:
+    a_GV = gv_fetchpvn_flags("::a", 3, 1, SVt_PV);
+    b_GV = gv_fetchpvn_flags("::b", 3, 1, SVt_PV);
+
+INCLUDE: const-xs.inc
+
+void
+new_int_void(SV * class, SV * cmp = &PL_sv_undef)
+    PPCODE:
+        SP = new_int_void(aTHX_ SP, class,cmp);
+
+void
+new_from_sorted_int_void(SV * class, SV * keys, SV * values = &PL_sv_undef, SV * cmp = &PL_sv_undef)
+    PPCODE:
+        SP = new_from_sorted_int_void(aTHX_ SP, class,keys,values,cmp);
+
+void
+DESTROY_int_void(SV * obj)
+    PPCODE:
+        SP = DESTROY_int_void(aTHX_ SP, obj);
+
+
+void
+size_int_void(SV *obj)
+    PPCODE:
+        SP = size_int_void(aTHX_ SP, obj);
+
+void
+ever_height_int_void(SV *obj)
+    PPCODE:
+        SP = ever_height_int_void(aTHX_ SP, obj);
+
+void
+cmp_count_int_void(SV *obj)
+    PPCODE:
+        SP = cmp_count_int_void(aTHX_ SP, obj);
+
+void
+insert_int_void(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_int_void(aTHX_ SP, obj,key,value);
+
+void
+insert_before_int_void(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_before_int_void(aTHX_ SP, obj,key,value);
+
+void
+insert_after_int_void(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_after_int_void(aTHX_ SP, obj,key,value);
+
+void
+insert_unique_int_void(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_unique_int_void(aTHX_ SP, obj,key,value);
+
+void
+set_int_void(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = set_int_void(aTHX_ SP, obj,key,value);
+
+void
+add_value_int_void(SV * obj, SV * key, SV * delta, int insert = 1)
+    PPCODE:
+        SP = add_value_int_void(aTHX_ SP, obj,key,delta,insert);
+
+void
+incr_int_void(SV * obj, SV * key)
+    PPCODE:
+        SP = incr_int_void(aTHX_ SP, obj,key);
+
+void
+insert_many_int_void(SV * obj, SV * keys, SV * values = &PL_sv_undef)
+    PPCODE:
+        SP = insert_many_int_void(aTHX_ SP, obj,keys,values);
+
+void
+delete_int_void(SV * obj, SV * key)
+    PPCODE:
+        SP = delete_int_void(aTHX_ SP, obj,key);
+
+void
+delete_first_int_void(SV * obj, SV * key)
+    PPCODE:
+        SP = delete_first_int_void(aTHX_ SP, obj,key);
+
+void
+delete_last_int_void(SV * obj, SV * key)
+    PPCODE:
+        SP = delete_last_int_void(aTHX_ SP, obj,key);
+
+void
+take_first_int_void(SV * obj, SV * key)
+    PPCODE:
+        SP = take_first_int_void(aTHX_ SP, obj,key);
+
+void
+take_last_int_void(SV * obj, SV * key)
+    PPCODE:
+        SP = take_last_int_void(aTHX_ SP, obj,key);
+
+void
+delete_many_int_void(SV * obj, SV * keys)
+    PPCODE:
+        SP = delete_many_int_void(aTHX_ SP, obj,keys);
+
+void
+delete_many_first_int_void(SV * obj, SV * keys)
+    PPCODE:
+        SP = delete_many_first_int_void(aTHX_ SP, obj,keys);
+
+void
+delete_many_last_int_void(SV * obj, SV * keys)
+    PPCODE:
+        SP = delete_many_last_int_void(aTHX_ SP, obj,keys);
+
+void
+delete_gt_lt_int_void(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_gt_lt_int_void(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+delete_ge_lt_int_void(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_ge_lt_int_void(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+delete_gt_le_int_void(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_gt_le_int_void(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+delete_ge_le_int_void(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_ge_le_int_void(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+drain_le_int_void(SV * obj, SV * key, int limit = -1)
+    PPCODE:
+        SP = drain_le_int_void(aTHX_ SP, obj,key,limit);
+
+void
+drain_ge_int_void(SV * obj, SV * key, int limit = -1)
+    PPCODE:
+        SP = drain_ge_int_void(aTHX_ SP, obj,key,limit);
+
+
+void
+split_lt_int_void(SV * obj, SV * key)
+    PPCODE:
+        SP = split_lt_int_void(aTHX_ SP, obj,key);
+
+void
+split_le_int_void(SV * obj, SV * key)
+    PPCODE:
+        SP = split_le_int_void(aTHX_ SP, obj,key);
+
+void
+join_int_void(SV * obj, SV * other)
+    PPCODE:
+        SP = join_int_void(aTHX_ SP, obj,other);
+
+void
+union_int_void(SV * obj, SV * other)
+    PPCODE:
+        SP = union_int_void(aTHX_ SP, obj,other);
+
+void
+intersection_int_void(SV * obj, SV * other)
+    PPCODE:
+        SP = intersection_int_void(aTHX_ SP, obj,other);
+
+void
+difference_int_void(SV * obj, SV * other)
+    PPCODE:
+        SP = difference_int_void(aTHX_ SP, obj,other);
+
+
+void
+find_int_void(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_int_void(aTHX_ SP, obj,key,limit);
+
+void
+find_first_int_void(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_first_int_void(aTHX_ SP, obj,key,limit);
+
+void
+find_last_int_void(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_last_int_void(aTHX_ SP, obj,key,limit);
+
+void
+exists_int_void(SV * obj, SV * key)
+    PPCODE:
+        SP = exists_int_void(aTHX_ SP, obj,key);
+
+void
+get_many_int_void(SV * obj, SV * keys)
+    PPCODE:
+        SP = get_many_int_void(aTHX_ SP, obj,keys);
+
+void
+find_lt_int_void(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_lt_int_void(aTHX_ SP, obj,key,limit);
+
+void
+find_le_int_void(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_le_int_void(aTHX_ SP, obj,key,limit);
+
+void
+find_gt_int_void(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_gt_int_void(aTHX_ SP, obj,key,limit);
+
+void
+find_ge_int_void(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_ge_int_void(aTHX_ SP, obj,key,limit);
+
+
+void
+find_lt_many_int_void(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_lt_many_int_void(aTHX_ SP, obj,keys);
+
+void
+find_le_many_int_void(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_le_many_int_void(aTHX_ SP, obj,keys);
+
+void
+find_gt_many_int_void(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_gt_many_int_void(aTHX_ SP, obj,keys);
+
+void
+find_ge_many_int_void(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_ge_many_int_void(aTHX_ SP, obj,keys);
+
+
+void
+find_gt_lt_int_void(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_gt_lt_int_void(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+find_ge_lt_int_void(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_ge_lt_int_void(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+find_gt_le_int_void(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_gt_le_int_void(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+find_ge_le_int_void(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_ge_le_int_void(aTHX_ SP, obj,lower_key,upper_key);
+
+
+void
+count_lt_int_void(SV * obj, SV * key)
+    PPCODE:
+        SP = count_lt_int_void(aTHX_ SP, obj,key);
+
+void
+count_le_int_void(SV * obj, SV * key)
+    PPCODE:
+        SP = count_le_int_void(aTHX_ SP, obj,key);
+
+void
+count_gt_int_void(SV * obj, SV * key)
+    PPCODE:
+        SP = count_gt_int_void(aTHX_ SP, obj,key);
+
+void
+count_ge_int_void(SV * obj, SV * key)
+    PPCODE:
+        SP = count_ge_int_void(aTHX_ SP, obj,key);
+
+void
+count_eq_int_void(SV * obj, SV * key)
+    PPCODE:
+        SP = count_eq_int_void(aTHX_ SP, obj,key);
+
+void
+equal_range_int_void(SV * obj, SV * key)
+    PPCODE:
+        SP = equal_range_int_void(aTHX_ SP, obj,key);
+
+
+void
+count_lt_many_int_void(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_lt_many_int_void(aTHX_ SP, obj,keys);
+
+void
+count_le_many_int_void(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_le_many_int_void(aTHX_ SP, obj,keys);
+
+void
+count_gt_many_int_void(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_gt_many_int_void(aTHX_ SP, obj,keys);
+
+void
+count_ge_many_int_void(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_ge_many_int_void(aTHX_ SP, obj,keys);
+
+
+void
+apply_int_void(SV * obj, SV * ops)
+    PPCODE:
+        SP = apply_int_void(aTHX_ SP, obj,ops);
+
+
+void
+find_min_int_void(SV * obj, int limit = 1)
+    PPCODE:
+        SP = find_min_int_void(aTHX_ SP, obj,limit);
+
+void
+find_max_int_void(SV * obj, int limit = 1)
+    PPCODE:
+        SP = find_max_int_void(aTHX_ SP, obj,limit);
+
+
+void
+pop_min_int_void(SV * obj, int limit = 1)
+    PPCODE:
+        SP = pop_min_int_void(aTHX_ SP, obj,limit);
+
+void
+pop_max_int_void(SV * obj, int limit = 1)
+    PPCODE:
+        SP = pop_max_int_void(aTHX_ SP, obj,limit);
+
+
+void
+skip_l_int_void(SV * obj, int offset, int limit = 1)
+    PPCODE:
+        SP = skip_l_int_void(aTHX_ SP, obj,offset,limit);
+
+void
+skip_g_int_void(SV * obj, int offset, int limit = 1)
+    PPCODE:
+        SP = skip_g_int_void(aTHX_ SP, obj,offset,limit);
+
+void
+delete_at_int_void(SV * obj, int offset)
+    PPCODE:
+        SP = delete_at_int_void(aTHX_ SP, obj,offset);
+
+void
+delete_ranks_int_void(SV * obj, int from, int count = -1)
+    PPCODE:
+        SP = delete_ranks_int_void(aTHX_ SP, obj,from,count);
+
+
+void
+clear_int_void(SV * obj)
+    PPCODE:
+        SP = clear_int_void(aTHX_ SP, obj);
+
+void
+reserve_int_void(SV * obj, IV n)
+    PPCODE:
+        SP = reserve_int_void(aTHX_ SP, obj,n);
+
+void
+compact_int_void(SV * obj)
+    PPCODE:
+        SP = compact_int_void(aTHX_ SP, obj);
+
+
+void
+dump_int_void(SV *obj)
+    PPCODE:
+        SP = dump_int_void(aTHX_ SP, obj);
+
+void
+check_int_void(SV * obj)
+    PPCODE:
+        SP = check_int_void(aTHX_ SP, obj);
+
+
+void
+new_int_int(SV * class, SV * cmp = &PL_sv_undef)
+    PPCODE:
+        SP = new_int_int(aTHX_ SP, class,cmp);
+
+void
+new_from_sorted_int_int(SV * class, SV * keys, SV * values = &PL_sv_undef, SV * cmp = &PL_sv_undef)
+    PPCODE:
+        SP = new_from_sorted_int_int(aTHX_ SP, class,keys,values,cmp);
+
+void
+DESTROY_int_int(SV * obj)
+    PPCODE:
+        SP = DESTROY_int_int(aTHX_ SP, obj);
+
+
+void
+size_int_int(SV *obj)
+    PPCODE:
+        SP = size_int_int(aTHX_ SP, obj);
+
+void
+ever_height_int_int(SV *obj)
+    PPCODE:
+        SP = ever_height_int_int(aTHX_ SP, obj);
+
+void
+cmp_count_int_int(SV *obj)
+    PPCODE:
+        SP = cmp_count_int_int(aTHX_ SP, obj);
+
+void
+insert_int_int(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_int_int(aTHX_ SP, obj,key,value);
+
+void
+insert_before_int_int(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_before_int_int(aTHX_ SP, obj,key,value);
+
+void
+insert_after_int_int(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_after_int_int(aTHX_ SP, obj,key,value);
+
+void
+insert_unique_int_int(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_unique_int_int(aTHX_ SP, obj,key,value);
+
+void
+set_int_int(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = set_int_int(aTHX_ SP, obj,key,value);
+
+void
+add_value_int_int(SV * obj, SV * key, SV * delta, int insert = 1)
+    PPCODE:
+        SP = add_value_int_int(aTHX_ SP, obj,key,delta,insert);
+
+void
+incr_int_int(SV * obj, SV * key)
+    PPCODE:
+        SP = incr_int_int(aTHX_ SP, obj,key);
+
+void
+insert_many_int_int(SV * obj, SV * keys, SV * values = &PL_sv_undef)
+    PPCODE:
+        SP = insert_many_int_int(aTHX_ SP, obj,keys,values);
+
+void
+delete_int_int(SV * obj, SV * key)
+    PPCODE:
+        SP = delete_int_int(aTHX_ SP, obj,key);
+
+void
+delete_first_int_int(SV * obj, SV * key)
+    PPCODE:
+        SP = delete_first_int_int(aTHX_ SP, obj,key);
+
+void
+delete_last_int_int(SV * obj, SV * key)
+    PPCODE:
+        SP = delete_last_int_int(aTHX_ SP, obj,key);
+
+void
+take_first_int_int(SV * obj, SV * key)
+    PPCODE:
+        SP = take_first_int_int(aTHX_ SP, obj,key);
+
+void
+take_last_int_int(SV * obj, SV * key)
+    PPCODE:
+        SP = take_last_int_int(aTHX_ SP, obj,key);
+
+void
+delete_many_int_int(SV * obj, SV * keys)
+    PPCODE:
+        SP = delete_many_int_int(aTHX_ SP, obj,keys);
+
+void
+delete_many_first_int_int(SV * obj, SV * keys)
+    PPCODE:
+        SP = delete_many_first_int_int(aTHX_ SP, obj,keys);
+
+void
+delete_many_last_int_int(SV * obj, SV * keys)
+    PPCODE:
+        SP = delete_many_last_int_int(aTHX_ SP, obj,keys);
+
+void
+delete_gt_lt_int_int(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_gt_lt_int_int(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+delete_ge_lt_int_int(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_ge_lt_int_int(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+delete_gt_le_int_int(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_gt_le_int_int(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+delete_ge_le_int_int(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_ge_le_int_int(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+drain_le_int_int(SV * obj, SV * key, int limit = -1)
+    PPCODE:
+        SP = drain_le_int_int(aTHX_ SP, obj,key,limit);
+
+void
+drain_ge_int_int(SV * obj, SV * key, int limit = -1)
+    PPCODE:
+        SP = drain_ge_int_int(aTHX_ SP, obj,key,limit);
+
+
+void
+split_lt_int_int(SV * obj, SV * key)
+    PPCODE:
+        SP = split_lt_int_int(aTHX_ SP, obj,key);
+
+void
+split_le_int_int(SV * obj, SV * key)
+    PPCODE:
+        SP = split_le_int_int(aTHX_ SP, obj,key);
+
+void
+join_int_int(SV * obj, SV * other)
+    PPCODE:
+        SP = join_int_int(aTHX_ SP, obj,other);
+
+void
+union_int_int(SV * obj, SV * other)
+    PPCODE:
+        SP = union_int_int(aTHX_ SP, obj,other);
+
+void
+intersection_int_int(SV * obj, SV * other)
+    PPCODE:
+        SP = intersection_int_int(aTHX_ SP, obj,other);
+
+void
+difference_int_int(SV * obj, SV * other)
+    PPCODE:
+        SP = difference_int_int(aTHX_ SP, obj,other);
+
+
+void
+find_int_int(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_int_int(aTHX_ SP, obj,key,limit);
+
+void
+find_first_int_int(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_first_int_int(aTHX_ SP, obj,key,limit);
+
+void
+find_last_int_int(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_last_int_int(aTHX_ SP, obj,key,limit);
+
+void
+exists_int_int(SV * obj, SV * key)
+    PPCODE:
+        SP = exists_int_int(aTHX_ SP, obj,key);
+
+void
+get_many_int_int(SV * obj, SV * keys)
+    PPCODE:
+        SP = get_many_int_int(aTHX_ SP, obj,keys);
+
+void
+find_lt_int_int(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_lt_int_int(aTHX_ SP, obj,key,limit);
+
+void
+find_le_int_int(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_le_int_int(aTHX_ SP, obj,key,limit);
+
+void
+find_gt_int_int(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_gt_int_int(aTHX_ SP, obj,key,limit);
+
+void
+find_ge_int_int(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_ge_int_int(aTHX_ SP, obj,key,limit);
+
+
+void
+find_lt_many_int_int(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_lt_many_int_int(aTHX_ SP, obj,keys);
+
+void
+find_le_many_int_int(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_le_many_int_int(aTHX_ SP, obj,keys);
+
+void
+find_gt_many_int_int(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_gt_many_int_int(aTHX_ SP, obj,keys);
+
+void
+find_ge_many_int_int(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_ge_many_int_int(aTHX_ SP, obj,keys);
+
+
+void
+find_gt_lt_int_int(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_gt_lt_int_int(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+find_ge_lt_int_int(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_ge_lt_int_int(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+find_gt_le_int_int(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_gt_le_int_int(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+find_ge_le_int_int(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_ge_le_int_int(aTHX_ SP, obj,lower_key,upper_key);
+
+
+void
+count_lt_int_int(SV * obj, SV * key)
+    PPCODE:
+        SP = count_lt_int_int(aTHX_ SP, obj,key);
+
+void
+count_le_int_int(SV * obj, SV * key)
+    PPCODE:
+        SP = count_le_int_int(aTHX_ SP, obj,key);
+
+void
+count_gt_int_int(SV * obj, SV * key)
+    PPCODE:
+        SP = count_gt_int_int(aTHX_ SP, obj,key);
+
+void
+count_ge_int_int(SV * obj, SV * key)
+    PPCODE:
+        SP = count_ge_int_int(aTHX_ SP, obj,key);
+
+void
+count_eq_int_int(SV * obj, SV * key)
+    PPCODE:
+        SP = count_eq_int_int(aTHX_ SP, obj,key);
+
+void
+equal_range_int_int(SV * obj, SV * key)
+    PPCODE:
+        SP = equal_range_int_int(aTHX_ SP, obj,key);
+
+
+void
+count_lt_many_int_int(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_lt_many_int_int(aTHX_ SP, obj,keys);
+
+void
+count_le_many_int_int(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_le_many_int_int(aTHX_ SP, obj,keys);
+
+void
+count_gt_many_int_int(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_gt_many_int_int(aTHX_ SP, obj,keys);
+
+void
+count_ge_many_int_int(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_ge_many_int_int(aTHX_ SP, obj,keys);
+
+
+void
+apply_int_int(SV * obj, SV * ops)
+    PPCODE:
+        SP = apply_int_int(aTHX_ SP, obj,ops);
+
+
+void
+find_min_int_int(SV * obj, int limit = 1)
+    PPCODE:
+        SP = find_min_int_int(aTHX_ SP, obj,limit);
+
+void
+find_max_int_int(SV * obj, int limit = 1)
+    PPCODE:
+        SP = find_max_int_int(aTHX_ SP, obj,limit);
+
+
+void
+pop_min_int_int(SV * obj, int limit = 1)
+    PPCODE:
+        SP = pop_min_int_int(aTHX_ SP, obj,limit);
+
+void
+pop_max_int_int(SV * obj, int limit = 1)
+    PPCODE:
+        SP = pop_max_int_int(aTHX_ SP, obj,limit);
+
+
+void
+skip_l_int_int(SV * obj, int offset, int limit = 1)
+    PPCODE:
+        SP = skip_l_int_int(aTHX_ SP, obj,offset,limit);
+
+void
+skip_g_int_int(SV * obj, int offset, int limit = 1)
+    PPCODE:
+        SP = skip_g_int_int(aTHX_ SP, obj,offset,limit);
+
+void
+delete_at_int_int(SV * obj, int offset)
+    PPCODE:
+        SP = delete_at_int_int(aTHX_ SP, obj,offset);
+
+void
+delete_ranks_int_int(SV * obj, int from, int count = -1)
+    PPCODE:
+        SP = delete_ranks_int_int(aTHX_ SP, obj,from,count);
+
+
+void
+clear_int_int(SV * obj)
+    PPCODE:
+        SP = clear_int_int(aTHX_ SP, obj);
+
+void
+reserve_int_int(SV * obj, IV n)
+    PPCODE:
+        SP = reserve_int_int(aTHX_ SP, obj,n);
+
+void
+compact_int_int(SV * obj)
+    PPCODE:
+        SP = compact_int_int(aTHX_ SP, obj);
+
+
+void
+dump_int_int(SV *obj)
+    PPCODE:
+        SP = dump_int_int(aTHX_ SP, obj);
+
+void
+check_int_int(SV * obj)
+    PPCODE:
+        SP = check_int_int(aTHX_ SP, obj);
+
+
+void
+new_int_num(SV * class, SV * cmp = &PL_sv_undef)
+    PPCODE:
+        SP = new_int_num(aTHX_ SP, class,cmp);
+
+void
+new_from_sorted_int_num(SV * class, SV * keys, SV * values = &PL_sv_undef, SV * cmp = &PL_sv_undef)
+    PPCODE:
+        SP = new_from_sorted_int_num(aTHX_ SP, class,keys,values,cmp);
+
+void
+DESTROY_int_num(SV * obj)
+    PPCODE:
+        SP = DESTROY_int_num(aTHX_ SP, obj);
+
+
+void
+size_int_num(SV *obj)
+    PPCODE:
+        SP = size_int_num(aTHX_ SP, obj);
+
+void
+ever_height_int_num(SV *obj)
+    PPCODE:
+        SP = ever_height_int_num(aTHX_ SP, obj);
+
+void
+cmp_count_int_num(SV *obj)
+    PPCODE:
+        SP = cmp_count_int_num(aTHX_ SP, obj);
+
+void
+insert_int_num(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_int_num(aTHX_ SP, obj,key,value);
+
+void
+insert_before_int_num(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_before_int_num(aTHX_ SP, obj,key,value);
+
+void
+insert_after_int_num(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_after_int_num(aTHX_ SP, obj,key,value);
+
+void
+insert_unique_int_num(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_unique_int_num(aTHX_ SP, obj,key,value);
+
+void
+set_int_num(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = set_int_num(aTHX_ SP, obj,key,value);
+
+void
+add_value_int_num(SV * obj, SV * key, SV * delta, int insert = 1)
+    PPCODE:
+        SP = add_value_int_num(aTHX_ SP, obj,key,delta,insert);
+
+void
+incr_int_num(SV * obj, SV * key)
+    PPCODE:
+        SP = incr_int_num(aTHX_ SP, obj,key);
+
+void
+insert_many_int_num(SV * obj, SV * keys, SV * values = &PL_sv_undef)
+    PPCODE:
+        SP = insert_many_int_num(aTHX_ SP, obj,keys,values);
+
+void
+delete_int_num(SV * obj, SV * key)
+    PPCODE:
+        SP = delete_int_num(aTHX_ SP, obj,key);
+
+void
+delete_first_int_num(SV * obj, SV * key)
+    PPCODE:
+        SP = delete_first_int_num(aTHX_ SP, obj,key);
+
+void
+delete_last_int_num(SV * obj, SV * key)
+    PPCODE:
+        SP = delete_last_int_num(aTHX_ SP, obj,key);
+
+void
+take_first_int_num(SV * obj, SV * key)
+    PPCODE:
+        SP = take_first_int_num(aTHX_ SP, obj,key);
+
+void
+take_last_int_num(SV * obj, SV * key)
+    PPCODE:
+        SP = take_last_int_num(aTHX_ SP, obj,key);
+
+void
+delete_many_int_num(SV * obj, SV * keys)
+    PPCODE:
+        SP = delete_many_int_num(aTHX_ SP, obj,keys);
+
+void
+delete_many_first_int_num(SV * obj, SV * keys)
+    PPCODE:
+        SP = delete_many_first_int_num(aTHX_ SP, obj,keys);
+
+void
+delete_many_last_int_num(SV * obj, SV * keys)
+    PPCODE:
+        SP = delete_many_last_int_num(aTHX_ SP, obj,keys);
+
+void
+delete_gt_lt_int_num(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_gt_lt_int_num(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+delete_ge_lt_int_num(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_ge_lt_int_num(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+delete_gt_le_int_num(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_gt_le_int_num(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+delete_ge_le_int_num(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_ge_le_int_num(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+drain_le_int_num(SV * obj, SV * key, int limit = -1)
+    PPCODE:
+        SP = drain_le_int_num(aTHX_ SP, obj,key,limit);
+
+void
+drain_ge_int_num(SV * obj, SV * key, int limit = -1)
+    PPCODE:
+        SP = drain_ge_int_num(aTHX_ SP, obj,key,limit);
+
+
+void
+split_lt_int_num(SV * obj, SV * key)
+    PPCODE:
+        SP = split_lt_int_num(aTHX_ SP, obj,key);
+
+void
+split_le_int_num(SV * obj, SV * key)
+    PPCODE:
+        SP = split_le_int_num(aTHX_ SP, obj,key);
+
+void
+join_int_num(SV * obj, SV * other)
+    PPCODE:
+        SP = join_int_num(aTHX_ SP, obj,other);
+
+void
+union_int_num(SV * obj, SV * other)
+    PPCODE:
+        SP = union_int_num(aTHX_ SP, obj,other);
+
+void
+intersection_int_num(SV * obj, SV * other)
+    PPCODE:
+        SP = intersection_int_num(aTHX_ SP, obj,other);
+
+void
+difference_int_num(SV * obj, SV * other)
+    PPCODE:
+        SP = difference_int_num(aTHX_ SP, obj,other);
+
+
+void
+find_int_num(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_int_num(aTHX_ SP, obj,key,limit);
+
+void
+find_first_int_num(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_first_int_num(aTHX_ SP, obj,key,limit);
+
+void
+find_last_int_num(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_last_int_num(aTHX_ SP, obj,key,limit);
+
+void
+exists_int_num(SV * obj, SV * key)
+    PPCODE:
+        SP = exists_int_num(aTHX_ SP, obj,key);
+
+void
+get_many_int_num(SV * obj, SV * keys)
+    PPCODE:
+        SP = get_many_int_num(aTHX_ SP, obj,keys);
+
+void
+find_lt_int_num(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_lt_int_num(aTHX_ SP, obj,key,limit);
+
+void
+find_le_int_num(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_le_int_num(aTHX_ SP, obj,key,limit);
+
+void
+find_gt_int_num(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_gt_int_num(aTHX_ SP, obj,key,limit);
+
+void
+find_ge_int_num(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_ge_int_num(aTHX_ SP, obj,key,limit);
+
+
+void
+find_lt_many_int_num(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_lt_many_int_num(aTHX_ SP, obj,keys);
+
+void
+find_le_many_int_num(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_le_many_int_num(aTHX_ SP, obj,keys);
+
+void
+find_gt_many_int_num(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_gt_many_int_num(aTHX_ SP, obj,keys);
+
+void
+find_ge_many_int_num(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_ge_many_int_num(aTHX_ SP, obj,keys);
+
+
+void
+find_gt_lt_int_num(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_gt_lt_int_num(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+find_ge_lt_int_num(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_ge_lt_int_num(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+find_gt_le_int_num(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_gt_le_int_num(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+find_ge_le_int_num(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_ge_le_int_num(aTHX_ SP, obj,lower_key,upper_key);
+
+
+void
+count_lt_int_num(SV * obj, SV * key)
+    PPCODE:
+        SP = count_lt_int_num(aTHX_ SP, obj,key);
+
+void
+count_le_int_num(SV * obj, SV * key)
+    PPCODE:
+        SP = count_le_int_num(aTHX_ SP, obj,key);
+
+void
+count_gt_int_num(SV * obj, SV * key)
+    PPCODE:
+        SP = count_gt_int_num(aTHX_ SP, obj,key);
+
+void
+count_ge_int_num(SV * obj, SV * key)
+    PPCODE:
+        SP = count_ge_int_num(aTHX_ SP, obj,key);
+
+void
+count_eq_int_num(SV * obj, SV * key)
+    PPCODE:
+        SP = count_eq_int_num(aTHX_ SP, obj,key);
+
+void
+equal_range_int_num(SV * obj, SV * key)
+    PPCODE:
+        SP = equal_range_int_num(aTHX_ SP, obj,key);
+
+
+void
+count_lt_many_int_num(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_lt_many_int_num(aTHX_ SP, obj,keys);
+
+void
+count_le_many_int_num(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_le_many_int_num(aTHX_ SP, obj,keys);
+
+void
+count_gt_many_int_num(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_gt_many_int_num(aTHX_ SP, obj,keys);
+
+void
+count_ge_many_int_num(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_ge_many_int_num(aTHX_ SP, obj,keys);
+
+
+void
+apply_int_num(SV * obj, SV * ops)
+    PPCODE:
+        SP = apply_int_num(aTHX_ SP, obj,ops);
+
+
+void
+find_min_int_num(SV * obj, int limit = 1)
+    PPCODE:
+        SP = find_min_int_num(aTHX_ SP, obj,limit);
+
+void
+find_max_int_num(SV * obj, int limit = 1)
+    PPCODE:
+        SP = find_max_int_num(aTHX_ SP, obj,limit);
+
+
+void
+pop_min_int_num(SV * obj, int limit = 1)
+    PPCODE:
+        SP = pop_min_int_num(aTHX_ SP, obj,limit);
+
+void
+pop_max_int_num(SV * obj, int limit = 1)
+    PPCODE:
+        SP = pop_max_int_num(aTHX_ SP, obj,limit);
+
+
+void
+skip_l_int_num(SV * obj, int offset, int limit = 1)
+    PPCODE:
+        SP = skip_l_int_num(aTHX_ SP, obj,offset,limit);
+
+void
+skip_g_int_num(SV * obj, int offset, int limit = 1)
+    PPCODE:
+        SP = skip_g_int_num(aTHX_ SP, obj,offset,limit);
+
+void
+delete_at_int_num(SV * obj, int offset)
+    PPCODE:
+        SP = delete_at_int_num(aTHX_ SP, obj,offset);
+
+void
+delete_ranks_int_num(SV * obj, int from, int count = -1)
+    PPCODE:
+        SP = delete_ranks_int_num(aTHX_ SP, obj,from,count);
+
+
+void
+clear_int_num(SV * obj)
+    PPCODE:
+        SP = clear_int_num(aTHX_ SP, obj);
+
+void
+reserve_int_num(SV * obj, IV n)
+    PPCODE:
+        SP = reserve_int_num(aTHX_ SP, obj,n);
+
+void
+compact_int_num(SV * obj)
+    PPCODE:
+        SP = compact_int_num(aTHX_ SP, obj);
+
+
+void
+dump_int_num(SV *obj)
+    PPCODE:
+        SP = dump_int_num(aTHX_ SP, obj);
+
+void
+check_int_num(SV * obj)
+    PPCODE:
+        SP = check_int_num(aTHX_ SP, obj);
+
+
+void
+new_int_any(SV * class, SV * cmp = &PL_sv_undef)
+    PPCODE:
+        SP = new_int_any(aTHX_ SP, class,cmp);
+
+void
+new_from_sorted_int_any(SV * class, SV * keys, SV * values = &PL_sv_undef, SV * cmp = &PL_sv_undef)
+    PPCODE:
+        SP = new_from_sorted_int_any(aTHX_ SP, class,keys,values,cmp);
+
+void
+DESTROY_int_any(SV * obj)
+    PPCODE:
+        SP = DESTROY_int_any(aTHX_ SP, obj);
+
+
+void
+size_int_any(SV *obj)
+    PPCODE:
+        SP = size_int_any(aTHX_ SP, obj);
+
+void
+ever_height_int_any(SV *obj)
+    PPCODE:
+        SP = ever_height_int_any(aTHX_ SP, obj);
+
+void
+cmp_count_int_any(SV *obj)
+    PPCODE:
+        SP = cmp_count_int_any(aTHX_ SP, obj);
+
+void
+insert_int_any(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_int_any(aTHX_ SP, obj,key,value);
+
+void
+insert_before_int_any(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_before_int_any(aTHX_ SP, obj,key,value);
+
+void
+insert_after_int_any(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_after_int_any(aTHX_ SP, obj,key,value);
+
+void
+insert_unique_int_any(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_unique_int_any(aTHX_ SP, obj,key,value);
+
+void
+set_int_any(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = set_int_any(aTHX_ SP, obj,key,value);
+
+void
+add_value_int_any(SV * obj, SV * key, SV * delta, int insert = 1)
+    PPCODE:
+        SP = add_value_int_any(aTHX_ SP, obj,key,delta,insert);
+
+void
+incr_int_any(SV * obj, SV * key)
+    PPCODE:
+        SP = incr_int_any(aTHX_ SP, obj,key);
+
+void
+insert_many_int_any(SV * obj, SV * keys, SV * values = &PL_sv_undef)
+    PPCODE:
+        SP = insert_many_int_any(aTHX_ SP, obj,keys,values);
+
+void
+delete_int_any(SV * obj, SV * key)
+    PPCODE:
+        SP = delete_int_any(aTHX_ SP, obj,key);
+
+void
+delete_first_int_any(SV * obj, SV * key)
+    PPCODE:
+        SP = delete_first_int_any(aTHX_ SP, obj,key);
+
+void
+delete_last_int_any(SV * obj, SV * key)
+    PPCODE:
+        SP = delete_last_int_any(aTHX_ SP, obj,key);
+
+void
+take_first_int_any(SV * obj, SV * key)
+    PPCODE:
+        SP = take_first_int_any(aTHX_ SP, obj,key);
+
+void
+take_last_int_any(SV * obj, SV * key)
+    PPCODE:
+        SP = take_last_int_any(aTHX_ SP, obj,key);
+
+void
+delete_many_int_any(SV * obj, SV * keys)
+    PPCODE:
+        SP = delete_many_int_any(aTHX_ SP, obj,keys);
+
+void
+delete_many_first_int_any(SV * obj, SV * keys)
+    PPCODE:
+        SP = delete_many_first_int_any(aTHX_ SP, obj,keys);
+
+void
+delete_many_last_int_any(SV * obj, SV * keys)
+    PPCODE:
+        SP = delete_many_last_int_any(aTHX_ SP, obj,keys);
+
+void
+delete_gt_lt_int_any(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_gt_lt_int_any(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+delete_ge_lt_int_any(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_ge_lt_int_any(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+delete_gt_le_int_any(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_gt_le_int_any(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+delete_ge_le_int_any(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_ge_le_int_any(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+drain_le_int_any(SV * obj, SV * key, int limit = -1)
+    PPCODE:
+        SP = drain_le_int_any(aTHX_ SP, obj,key,limit);
+
+void
+drain_ge_int_any(SV * obj, SV * key, int limit = -1)
+    PPCODE:
+        SP = drain_ge_int_any(aTHX_ SP, obj,key,limit);
+
+
+void
+split_lt_int_any(SV * obj, SV * key)
+    PPCODE:
+        SP = split_lt_int_any(aTHX_ SP, obj,key);
+
+void
+split_le_int_any(SV * obj, SV * key)
+    PPCODE:
+        SP = split_le_int_any(aTHX_ SP, obj,key);
+
+void
+join_int_any(SV * obj, SV * other)
+    PPCODE:
+        SP = join_int_any(aTHX_ SP, obj,other);
+
+void
+union_int_any(SV * obj, SV * other)
+    PPCODE:
+        SP = union_int_any(aTHX_ SP, obj,other);
+
+void
+intersection_int_any(SV * obj, SV * other)
+    PPCODE:
+        SP = intersection_int_any(aTHX_ SP, obj,other);
+
+void
+difference_int_any(SV * obj, SV * other)
+    PPCODE:
+        SP = difference_int_any(aTHX_ SP, obj,other);
+
+
+void
+find_int_any(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_int_any(aTHX_ SP, obj,key,limit);
+
+void
+find_first_int_any(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_first_int_any(aTHX_ SP, obj,key,limit);
+
+void
+find_last_int_any(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_last_int_any(aTHX_ SP, obj,key,limit);
+
+void
+exists_int_any(SV * obj, SV * key)
+    PPCODE:
+        SP = exists_int_any(aTHX_ SP, obj,key);
+
+void
+get_many_int_any(SV * obj, SV * keys)
+    PPCODE:
+        SP = get_many_int_any(aTHX_ SP, obj,keys);
+
+void
+find_lt_int_any(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_lt_int_any(aTHX_ SP, obj,key,limit);
+
+void
+find_le_int_any(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_le_int_any(aTHX_ SP, obj,key,limit);
+
+void
+find_gt_int_any(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_gt_int_any(aTHX_ SP, obj,key,limit);
+
+void
+find_ge_int_any(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_ge_int_any(aTHX_ SP, obj,key,limit);
+
+
+void
+find_lt_many_int_any(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_lt_many_int_any(aTHX_ SP, obj,keys);
+
+void
+find_le_many_int_any(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_le_many_int_any(aTHX_ SP, obj,keys);
+
+void
+find_gt_many_int_any(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_gt_many_int_any(aTHX_ SP, obj,keys);
+
+void
+find_ge_many_int_any(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_ge_many_int_any(aTHX_ SP, obj,keys);
+
+
+void
+find_gt_lt_int_any(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_gt_lt_int_any(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+find_ge_lt_int_any(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_ge_lt_int_any(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+find_gt_le_int_any(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_gt_le_int_any(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+find_ge_le_int_any(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_ge_le_int_any(aTHX_ SP, obj,lower_key,upper_key);
+
+
+void
+count_lt_int_any(SV * obj, SV * key)
+    PPCODE:
+        SP = count_lt_int_any(aTHX_ SP, obj,key);
+
+void
+count_le_int_any(SV * obj, SV * key)
+    PPCODE:
+        SP = count_le_int_any(aTHX_ SP, obj,key);
+
+void
+count_gt_int_any(SV * obj, SV * key)
+    PPCODE:
+        SP = count_gt_int_any(aTHX_ SP, obj,key);
+
+void
+count_ge_int_any(SV * obj, SV * key)
+    PPCODE:
+        SP = count_ge_int_any(aTHX_ SP, obj,key);
+
+void
+count_eq_int_any(SV * obj, SV * key)
+    PPCODE:
+        SP = count_eq_int_any(aTHX_ SP, obj,key);
+
+void
+equal_range_int_any(SV * obj, SV * key)
+    PPCODE:
+        SP = equal_range_int_any(aTHX_ SP, obj,key);
+
+
+void
+count_lt_many_int_any(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_lt_many_int_any(aTHX_ SP, obj,keys);
+
+void
+count_le_many_int_any(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_le_many_int_any(aTHX_ SP, obj,keys);
+
+void
+count_gt_many_int_any(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_gt_many_int_any(aTHX_ SP, obj,keys);
+
+void
+count_ge_many_int_any(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_ge_many_int_any(aTHX_ SP, obj,keys);
+
+
+void
+apply_int_any(SV * obj, SV * ops)
+    PPCODE:
+        SP = apply_int_any(aTHX_ SP, obj,ops);
+
+
+void
+find_min_int_any(SV * obj, int limit = 1)
+    PPCODE:
+        SP = find_min_int_any(aTHX_ SP, obj,limit);
+
+void
+find_max_int_any(SV * obj, int limit = 1)
+    PPCODE:
+        SP = find_max_int_any(aTHX_ SP, obj,limit);
+
+
+void
+pop_min_int_any(SV * obj, int limit = 1)
+    PPCODE:
+        SP = pop_min_int_any(aTHX_ SP, obj,limit);
+
+void
+pop_max_int_any(SV * obj, int limit = 1)
+    PPCODE:
+        SP = pop_max_int_any(aTHX_ SP, obj,limit);
+
+
+void
+skip_l_int_any(SV * obj, int offset, int limit = 1)
+    PPCODE:
+        SP = skip_l_int_any(aTHX_ SP, obj,offset,limit);
+
+void
+skip_g_int_any(SV * obj, int offset, int limit = 1)
+    PPCODE:
+        SP = skip_g_int_any(aTHX_ SP, obj,offset,limit);
+
+void
+delete_at_int_any(SV * obj, int offset)
+    PPCODE:
+        SP = delete_at_int_any(aTHX_ SP, obj,offset);
+
+void
+delete_ranks_int_any(SV * obj, int from, int count = -1)
+    PPCODE:
+        SP = delete_ranks_int_any(aTHX_ SP, obj,from,count);
+
+
+void
+clear_int_any(SV * obj)
+    PPCODE:
+        SP = clear_int_any(aTHX_ SP, obj);
+
+void
+reserve_int_any(SV * obj, IV n)
+    PPCODE:
+        SP = reserve_int_any(aTHX_ SP, obj,n);
+
+void
+compact_int_any(SV * obj)
+    PPCODE:
+        SP = compact_int_any(aTHX_ SP, obj);
+
+
+void
+dump_int_any(SV *obj)
+    PPCODE:
+        SP = dump_int_any(aTHX_ SP, obj);
+
+void
+check_int_any(SV * obj)
+    PPCODE:
+        SP = check_int_any(aTHX_ SP, obj);
+
+
+void
+new_num_void(SV * class, SV * cmp = &PL_sv_undef)
+    PPCODE:
+        SP = new_num_void(aTHX_ SP, class,cmp);
+
+void
+new_from_sorted_num_void(SV * class, SV * keys, SV * values = &PL_sv_undef, SV * cmp = &PL_sv_undef)
+    PPCODE:
+        SP = new_from_sorted_num_void(aTHX_ SP, class,keys,values,cmp);
+
+void
+DESTROY_num_void(SV * obj)
+    PPCODE:
+        SP = DESTROY_num_void(aTHX_ SP, obj);
+
+
+void
+size_num_void(SV *obj)
+    PPCODE:
+        SP = size_num_void(aTHX_ SP, obj);
+
+void
+ever_height_num_void(SV *obj)
+    PPCODE:
+        SP = ever_height_num_void(aTHX_ SP, obj);
+
+void
+cmp_count_num_void(SV *obj)
+    PPCODE:
+        SP = cmp_count_num_void(aTHX_ SP, obj);
+
+void
+insert_num_void(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_num_void(aTHX_ SP, obj,key,value);
+
+void
+insert_before_num_void(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_before_num_void(aTHX_ SP, obj,key,value);
+
+void
+insert_after_num_void(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_after_num_void(aTHX_ SP, obj,key,value);
+
+void
+insert_unique_num_void(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_unique_num_void(aTHX_ SP, obj,key,value);
+
+void
+set_num_void(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = set_num_void(aTHX_ SP, obj,key,value);
+
+void
+add_value_num_void(SV * obj, SV * key, SV * delta, int insert = 1)
+    PPCODE:
+        SP = add_value_num_void(aTHX_ SP, obj,key,delta,insert);
+
+void
+incr_num_void(SV * obj, SV * key)
+    PPCODE:
+        SP = incr_num_void(aTHX_ SP, obj,key);
+
+void
+insert_many_num_void(SV * obj, SV * keys, SV * values = &PL_sv_undef)
+    PPCODE:
+        SP = insert_many_num_void(aTHX_ SP, obj,keys,values);
+
+void
+delete_num_void(SV * obj, SV * key)
+    PPCODE:
+        SP = delete_num_void(aTHX_ SP, obj,key);
+
+void
+delete_first_num_void(SV * obj, SV * key)
+    PPCODE:
+        SP = delete_first_num_void(aTHX_ SP, obj,key);
+
+void
+delete_last_num_void(SV * obj, SV * key)
+    PPCODE:
+        SP = delete_last_num_void(aTHX_ SP, obj,key);
+
+void
+take_first_num_void(SV * obj, SV * key)
+    PPCODE:
+        SP = take_first_num_void(aTHX_ SP, obj,key);
+
+void
+take_last_num_void(SV * obj, SV * key)
+    PPCODE:
+        SP = take_last_num_void(aTHX_ SP, obj,key);
+
+void
+delete_many_num_void(SV * obj, SV * keys)
+    PPCODE:
+        SP = delete_many_num_void(aTHX_ SP, obj,keys);
+
+void
+delete_many_first_num_void(SV * obj, SV * keys)
+    PPCODE:
+        SP = delete_many_first_num_void(aTHX_ SP, obj,keys);
+
+void
+delete_many_last_num_void(SV * obj, SV * keys)
+    PPCODE:
+        SP = delete_many_last_num_void(aTHX_ SP, obj,keys);
+
+void
+delete_gt_lt_num_void(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_gt_lt_num_void(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+delete_ge_lt_num_void(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_ge_lt_num_void(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+delete_gt_le_num_void(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_gt_le_num_void(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+delete_ge_le_num_void(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_ge_le_num_void(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+drain_le_num_void(SV * obj, SV * key, int limit = -1)
+    PPCODE:
+        SP = drain_le_num_void(aTHX_ SP, obj,key,limit);
+
+void
+drain_ge_num_void(SV * obj, SV * key, int limit = -1)
+    PPCODE:
+        SP = drain_ge_num_void(aTHX_ SP, obj,key,limit);
+
+
+void
+split_lt_num_void(SV * obj, SV * key)
+    PPCODE:
+        SP = split_lt_num_void(aTHX_ SP, obj,key);
+
+void
+split_le_num_void(SV * obj, SV * key)
+    PPCODE:
+        SP = split_le_num_void(aTHX_ SP, obj,key);
+
+void
+join_num_void(SV * obj, SV * other)
+    PPCODE:
+        SP = join_num_void(aTHX_ SP, obj,other);
+
+void
+union_num_void(SV * obj, SV * other)
+    PPCODE:
+        SP = union_num_void(aTHX_ SP, obj,other);
+
+void
+intersection_num_void(SV * obj, SV * other)
+    PPCODE:
+        SP = intersection_num_void(aTHX_ SP, obj,other);
+
+void
+difference_num_void(SV * obj, SV * other)
+    PPCODE:
+        SP = difference_num_void(aTHX_ SP, obj,other);
+
+
+void
+find_num_void(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_num_void(aTHX_ SP, obj,key,limit);
+
+void
+find_first_num_void(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_first_num_void(aTHX_ SP, obj,key,limit);
+
+void
+find_last_num_void(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_last_num_void(aTHX_ SP, obj,key,limit);
+
+void
+exists_num_void(SV * obj, SV * key)
+    PPCODE:
+        SP = exists_num_void(aTHX_ SP, obj,key);
+
+void
+get_many_num_void(SV * obj, SV * keys)
+    PPCODE:
+        SP = get_many_num_void(aTHX_ SP, obj,keys);
+
+void
+find_lt_num_void(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_lt_num_void(aTHX_ SP, obj,key,limit);
+
+void
+find_le_num_void(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_le_num_void(aTHX_ SP, obj,key,limit);
+
+void
+find_gt_num_void(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_gt_num_void(aTHX_ SP, obj,key,limit);
+
+void
+find_ge_num_void(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_ge_num_void(aTHX_ SP, obj,key,limit);
+
+
+void
+find_lt_many_num_void(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_lt_many_num_void(aTHX_ SP, obj,keys);
+
+void
+find_le_many_num_void(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_le_many_num_void(aTHX_ SP, obj,keys);
+
+void
+find_gt_many_num_void(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_gt_many_num_void(aTHX_ SP, obj,keys);
+
+void
+find_ge_many_num_void(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_ge_many_num_void(aTHX_ SP, obj,keys);
+
+
+void
+find_gt_lt_num_void(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_gt_lt_num_void(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+find_ge_lt_num_void(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_ge_lt_num_void(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+find_gt_le_num_void(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_gt_le_num_void(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+find_ge_le_num_void(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_ge_le_num_void(aTHX_ SP, obj,lower_key,upper_key);
+
+
+void
+count_lt_num_void(SV * obj, SV * key)
+    PPCODE:
+        SP = count_lt_num_void(aTHX_ SP, obj,key);
+
+void
+count_le_num_void(SV * obj, SV * key)
+    PPCODE:
+        SP = count_le_num_void(aTHX_ SP, obj,key);
+
+void
+count_gt_num_void(SV * obj, SV * key)
+    PPCODE:
+        SP = count_gt_num_void(aTHX_ SP, obj,key);
+
+void
+count_ge_num_void(SV * obj, SV * key)
+    PPCODE:
+        SP = count_ge_num_void(aTHX_ SP, obj,key);
+
+void
+count_eq_num_void(SV * obj, SV * key)
+    PPCODE:
+        SP = count_eq_num_void(aTHX_ SP, obj,key);
+
+void
+equal_range_num_void(SV * obj, SV * key)
+    PPCODE:
+        SP = equal_range_num_void(aTHX_ SP, obj,key);
+
+
+void
+count_lt_many_num_void(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_lt_many_num_void(aTHX_ SP, obj,keys);
+
+void
+count_le_many_num_void(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_le_many_num_void(aTHX_ SP, obj,keys);
+
+void
+count_gt_many_num_void(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_gt_many_num_void(aTHX_ SP, obj,keys);
+
+void
+count_ge_many_num_void(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_ge_many_num_void(aTHX_ SP, obj,keys);
+
+
+void
+apply_num_void(SV * obj, SV * ops)
+    PPCODE:
+        SP = apply_num_void(aTHX_ SP, obj,ops);
+
+
+void
+find_min_num_void(SV * obj, int limit = 1)
+    PPCODE:
+        SP = find_min_num_void(aTHX_ SP, obj,limit);
+
+void
+find_max_num_void(SV * obj, int limit = 1)
+    PPCODE:
+        SP = find_max_num_void(aTHX_ SP, obj,limit);
+
+
+void
+pop_min_num_void(SV * obj, int limit = 1)
+    PPCODE:
+        SP = pop_min_num_void(aTHX_ SP, obj,limit);
+
+void
+pop_max_num_void(SV * obj, int limit = 1)
+    PPCODE:
+        SP = pop_max_num_void(aTHX_ SP, obj,limit);
+
+
+void
+skip_l_num_void(SV * obj, int offset, int limit = 1)
+    PPCODE:
+        SP = skip_l_num_void(aTHX_ SP, obj,offset,limit);
+
+void
+skip_g_num_void(SV * obj, int offset, int limit = 1)
+    PPCODE:
+        SP = skip_g_num_void(aTHX_ SP, obj,offset,limit);
+
+void
+delete_at_num_void(SV * obj, int offset)
+    PPCODE:
+        SP = delete_at_num_void(aTHX_ SP, obj,offset);
+
+void
+delete_ranks_num_void(SV * obj, int from, int count = -1)
+    PPCODE:
+        SP = delete_ranks_num_void(aTHX_ SP, obj,from,count);
+
+
+void
+clear_num_void(SV * obj)
+    PPCODE:
+        SP = clear_num_void(aTHX_ SP, obj);
+
+void
+reserve_num_void(SV * obj, IV n)
+    PPCODE:
+        SP = reserve_num_void(aTHX_ SP, obj,n);
+
+void
+compact_num_void(SV * obj)
+    PPCODE:
+        SP = compact_num_void(aTHX_ SP, obj);
+
+
+void
+dump_num_void(SV *obj)
+    PPCODE:
+        SP = dump_num_void(aTHX_ SP, obj);
+
+void
+check_num_void(SV * obj)
+    PPCODE:
+        SP = check_num_void(aTHX_ SP, obj);
+
+
+void
+new_num_int(SV * class, SV * cmp = &PL_sv_undef)
+    PPCODE:
+        SP = new_num_int(aTHX_ SP, class,cmp);
+
+void
+new_from_sorted_num_int(SV * class, SV * keys, SV * values = &PL_sv_undef, SV * cmp = &PL_sv_undef)
+    PPCODE:
+        SP = new_from_sorted_num_int(aTHX_ SP, class,keys,values,cmp);
+
+void
+DESTROY_num_int(SV * obj)
+    PPCODE:
+        SP = DESTROY_num_int(aTHX_ SP, obj);
+
+
+void
+size_num_int(SV *obj)
+    PPCODE:
+        SP = size_num_int(aTHX_ SP, obj);
+
+void
+ever_height_num_int(SV *obj)
+    PPCODE:
+        SP = ever_height_num_int(aTHX_ SP, obj);
+
+void
+cmp_count_num_int(SV *obj)
+    PPCODE:
+        SP = cmp_count_num_int(aTHX_ SP, obj);
+
+void
+insert_num_int(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_num_int(aTHX_ SP, obj,key,value);
+
+void
+insert_before_num_int(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_before_num_int(aTHX_ SP, obj,key,value);
+
+void
+insert_after_num_int(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_after_num_int(aTHX_ SP, obj,key,value);
+
+void
+insert_unique_num_int(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_unique_num_int(aTHX_ SP, obj,key,value);
+
+void
+set_num_int(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = set_num_int(aTHX_ SP, obj,key,value);
+
+void
+add_value_num_int(SV * obj, SV * key, SV * delta, int insert = 1)
+    PPCODE:
+        SP = add_value_num_int(aTHX_ SP, obj,key,delta,insert);
+
+void
+incr_num_int(SV * obj, SV * key)
+    PPCODE:
+        SP = incr_num_int(aTHX_ SP, obj,key);
+
+void
+insert_many_num_int(SV * obj, SV * keys, SV * values = &PL_sv_undef)
+    PPCODE:
+        SP = insert_many_num_int(aTHX_ SP, obj,keys,values);
+
+void
+delete_num_int(SV * obj, SV * key)
+    PPCODE:
+        SP = delete_num_int(aTHX_ SP, obj,key);
+
+void
+delete_first_num_int(SV * obj, SV * key)
+    PPCODE:
+        SP = delete_first_num_int(aTHX_ SP, obj,key);
+
+void
+delete_last_num_int(SV * obj, SV * key)
+    PPCODE:
+        SP = delete_last_num_int(aTHX_ SP, obj,key);
+
+void
+take_first_num_int(SV * obj, SV * key)
+    PPCODE:
+        SP = take_first_num_int(aTHX_ SP, obj,key);
+
+void
+take_last_num_int(SV * obj, SV * key)
+    PPCODE:
+        SP = take_last_num_int(aTHX_ SP, obj,key);
+
+void
+delete_many_num_int(SV * obj, SV * keys)
+    PPCODE:
+        SP = delete_many_num_int(aTHX_ SP, obj,keys);
+
+void
+delete_many_first_num_int(SV * obj, SV * keys)
+    PPCODE:
+        SP = delete_many_first_num_int(aTHX_ SP, obj,keys);
+
+void
+delete_many_last_num_int(SV * obj, SV * keys)
+    PPCODE:
+        SP = delete_many_last_num_int(aTHX_ SP, obj,keys);
+
+void
+delete_gt_lt_num_int(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_gt_lt_num_int(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+delete_ge_lt_num_int(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_ge_lt_num_int(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+delete_gt_le_num_int(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_gt_le_num_int(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+delete_ge_le_num_int(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_ge_le_num_int(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+drain_le_num_int(SV * obj, SV * key, int limit = -1)
+    PPCODE:
+        SP = drain_le_num_int(aTHX_ SP, obj,key,limit);
+
+void
+drain_ge_num_int(SV * obj, SV * key, int limit = -1)
+    PPCODE:
+        SP = drain_ge_num_int(aTHX_ SP, obj,key,limit);
+
+
+void
+split_lt_num_int(SV * obj, SV * key)
+    PPCODE:
+        SP = split_lt_num_int(aTHX_ SP, obj,key);
+
+void
+split_le_num_int(SV * obj, SV * key)
+    PPCODE:
+        SP = split_le_num_int(aTHX_ SP, obj,key);
+
+void
+join_num_int(SV * obj, SV * other)
+    PPCODE:
+        SP = join_num_int(aTHX_ SP, obj,other);
+
+void
+union_num_int(SV * obj, SV * other)
+    PPCODE:
+        SP = union_num_int(aTHX_ SP, obj,other);
+
+void
+intersection_num_int(SV * obj, SV * other)
+    PPCODE:
+        SP = intersection_num_int(aTHX_ SP, obj,other);
+
+void
+difference_num_int(SV * obj, SV * other)
+    PPCODE:
+        SP = difference_num_int(aTHX_ SP, obj,other);
+
+
+void
+find_num_int(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_num_int(aTHX_ SP, obj,key,limit);
+
+void
+find_first_num_int(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_first_num_int(aTHX_ SP, obj,key,limit);
+
+void
+find_last_num_int(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_last_num_int(aTHX_ SP, obj,key,limit);
+
+void
+exists_num_int(SV * obj, SV * key)
+    PPCODE:
+        SP = exists_num_int(aTHX_ SP, obj,key);
+
+void
+get_many_num_int(SV * obj, SV * keys)
+    PPCODE:
+        SP = get_many_num_int(aTHX_ SP, obj,keys);
+
+void
+find_lt_num_int(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_lt_num_int(aTHX_ SP, obj,key,limit);
+
+void
+find_le_num_int(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_le_num_int(aTHX_ SP, obj,key,limit);
+
+void
+find_gt_num_int(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_gt_num_int(aTHX_ SP, obj,key,limit);
+
+void
+find_ge_num_int(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_ge_num_int(aTHX_ SP, obj,key,limit);
+
+
+void
+find_lt_many_num_int(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_lt_many_num_int(aTHX_ SP, obj,keys);
+
+void
+find_le_many_num_int(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_le_many_num_int(aTHX_ SP, obj,keys);
+
+void
+find_gt_many_num_int(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_gt_many_num_int(aTHX_ SP, obj,keys);
+
+void
+find_ge_many_num_int(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_ge_many_num_int(aTHX_ SP, obj,keys);
+
+
+void
+find_gt_lt_num_int(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_gt_lt_num_int(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+find_ge_lt_num_int(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_ge_lt_num_int(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+find_gt_le_num_int(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_gt_le_num_int(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+find_ge_le_num_int(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_ge_le_num_int(aTHX_ SP, obj,lower_key,upper_key);
+
+
+void
+count_lt_num_int(SV * obj, SV * key)
+    PPCODE:
+        SP = count_lt_num_int(aTHX_ SP, obj,key);
+
+void
+count_le_num_int(SV * obj, SV * key)
+    PPCODE:
+        SP = count_le_num_int(aTHX_ SP, obj,key);
+
+void
+count_gt_num_int(SV * obj, SV * key)
+    PPCODE:
+        SP = count_gt_num_int(aTHX_ SP, obj,key);
+
+void
+count_ge_num_int(SV * obj, SV * key)
+    PPCODE:
+        SP = count_ge_num_int(aTHX_ SP, obj,key);
+
+void
+count_eq_num_int(SV * obj, SV * key)
+    PPCODE:
+        SP = count_eq_num_int(aTHX_ SP, obj,key);
+
+void
+equal_range_num_int(SV * obj, SV * key)
+    PPCODE:
+        SP = equal_range_num_int(aTHX_ SP, obj,key);
+
+
+void
+count_lt_many_num_int(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_lt_many_num_int(aTHX_ SP, obj,keys);
+
+void
+count_le_many_num_int(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_le_many_num_int(aTHX_ SP, obj,keys);
+
+void
+count_gt_many_num_int(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_gt_many_num_int(aTHX_ SP, obj,keys);
+
+void
+count_ge_many_num_int(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_ge_many_num_int(aTHX_ SP, obj,keys);
+
+
+void
+apply_num_int(SV * obj, SV * ops)
+    PPCODE:
+        SP = apply_num_int(aTHX_ SP, obj,ops);
+
+
+void
+find_min_num_int(SV * obj, int limit = 1)
+    PPCODE:
+        SP = find_min_num_int(aTHX_ SP, obj,limit);
+
+void
+find_max_num_int(SV * obj, int limit = 1)
+    PPCODE:
+        SP = find_max_num_int(aTHX_ SP, obj,limit);
+
+
+void
+pop_min_num_int(SV * obj, int limit = 1)
+    PPCODE:
+        SP = pop_min_num_int(aTHX_ SP, obj,limit);
+
+void
+pop_max_num_int(SV * obj, int limit = 1)
+    PPCODE:
+        SP = pop_max_num_int(aTHX_ SP, obj,limit);
+
+
+void
+skip_l_num_int(SV * obj, int offset, int limit = 1)
+    PPCODE:
+        SP = skip_l_num_int(aTHX_ SP, obj,offset,limit);
+
+void
+skip_g_num_int(SV * obj, int offset, int limit = 1)
+    PPCODE:
+        SP = skip_g_num_int(aTHX_ SP, obj,offset,limit);
+
+void
+delete_at_num_int(SV * obj, int offset)
+    PPCODE:
+        SP = delete_at_num_int(aTHX_ SP, obj,offset);
+
+void
+delete_ranks_num_int(SV * obj, int from, int count = -1)
+    PPCODE:
+        SP = delete_ranks_num_int(aTHX_ SP, obj,from,count);
+
+
+void
+clear_num_int(SV * obj)
+    PPCODE:
+        SP = clear_num_int(aTHX_ SP, obj);
+
+void
+reserve_num_int(SV * obj, IV n)
+    PPCODE:
+        SP = reserve_num_int(aTHX_ SP, obj,n);
+
+void
+compact_num_int(SV * obj)
+    PPCODE:
+        SP = compact_num_int(aTHX_ SP, obj);
+
+
+void
+dump_num_int(SV *obj)
+    PPCODE:
+        SP = dump_num_int(aTHX_ SP, obj);
+
+void
+check_num_int(SV * obj)
+    PPCODE:
+        SP = check_num_int(aTHX_ SP, obj);
+
+
+void
+new_num_num(SV * class, SV * cmp = &PL_sv_undef)
+    PPCODE:
+        SP = new_num_num(aTHX_ SP, class,cmp);
+
+void
+new_from_sorted_num_num(SV * class, SV * keys, SV * values = &PL_sv_undef, SV * cmp = &PL_sv_undef)
+    PPCODE:
+        SP = new_from_sorted_num_num(aTHX_ SP, class,keys,values,cmp);
+
+void
+DESTROY_num_num(SV * obj)
+    PPCODE:
+        SP = DESTROY_num_num(aTHX_ SP, obj);
+
+
+void
+size_num_num(SV *obj)
+    PPCODE:
+        SP = size_num_num(aTHX_ SP, obj);
+
+void
+ever_height_num_num(SV *obj)
+    PPCODE:
+        SP = ever_height_num_num(aTHX_ SP, obj);
+
+void
+cmp_count_num_num(SV *obj)
+    PPCODE:
+        SP = cmp_count_num_num(aTHX_ SP, obj);
+
+void
+insert_num_num(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_num_num(aTHX_ SP, obj,key,value);
+
+void
+insert_before_num_num(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_before_num_num(aTHX_ SP, obj,key,value);
+
+void
+insert_after_num_num(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_after_num_num(aTHX_ SP, obj,key,value);
+
+void
+insert_unique_num_num(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_unique_num_num(aTHX_ SP, obj,key,value);
+
+void
+set_num_num(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = set_num_num(aTHX_ SP, obj,key,value);
+
+void
+add_value_num_num(SV * obj, SV * key, SV * delta, int insert = 1)
+    PPCODE:
+        SP = add_value_num_num(aTHX_ SP, obj,key,delta,insert);
+
+void
+incr_num_num(SV * obj, SV * key)
+    PPCODE:
+        SP = incr_num_num(aTHX_ SP, obj,key);
+
+void
+insert_many_num_num(SV * obj, SV * keys, SV * values = &PL_sv_undef)
+    PPCODE:
+        SP = insert_many_num_num(aTHX_ SP, obj,keys,values);
+
+void
+delete_num_num(SV * obj, SV * key)
+    PPCODE:
+        SP = delete_num_num(aTHX_ SP, obj,key);
+
+void
+delete_first_num_num(SV * obj, SV * key)
+    PPCODE:
+        SP = delete_first_num_num(aTHX_ SP, obj,key);
+
+void
+delete_last_num_num(SV * obj, SV * key)
+    PPCODE:
+        SP = delete_last_num_num(aTHX_ SP, obj,key);
+
+void
+take_first_num_num(SV * obj, SV * key)
+    PPCODE:
+        SP = take_first_num_num(aTHX_ SP, obj,key);
+
+void
+take_last_num_num(SV * obj, SV * key)
+    PPCODE:
+        SP = take_last_num_num(aTHX_ SP, obj,key);
+
+void
+delete_many_num_num(SV * obj, SV * keys)
+    PPCODE:
+        SP = delete_many_num_num(aTHX_ SP, obj,keys);
+
+void
+delete_many_first_num_num(SV * obj, SV * keys)
+    PPCODE:
+        SP = delete_many_first_num_num(aTHX_ SP, obj,keys);
+
+void
+delete_many_last_num_num(SV * obj, SV * keys)
+    PPCODE:
+        SP = delete_many_last_num_num(aTHX_ SP, obj,keys);
+
+void
+delete_gt_lt_num_num(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_gt_lt_num_num(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+delete_ge_lt_num_num(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_ge_lt_num_num(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+delete_gt_le_num_num(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_gt_le_num_num(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+delete_ge_le_num_num(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_ge_le_num_num(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+drain_le_num_num(SV * obj, SV * key, int limit = -1)
+    PPCODE:
+        SP = drain_le_num_num(aTHX_ SP, obj,key,limit);
+
+void
+drain_ge_num_num(SV * obj, SV * key, int limit = -1)
+    PPCODE:
+        SP = drain_ge_num_num(aTHX_ SP, obj,key,limit);
+
+
+void
+split_lt_num_num(SV * obj, SV * key)
+    PPCODE:
+        SP = split_lt_num_num(aTHX_ SP, obj,key);
+
+void
+split_le_num_num(SV * obj, SV * key)
+    PPCODE:
+        SP = split_le_num_num(aTHX_ SP, obj,key);
+
+void
+join_num_num(SV * obj, SV * other)
+    PPCODE:
+        SP = join_num_num(aTHX_ SP, obj,other);
+
+void
+union_num_num(SV * obj, SV * other)
+    PPCODE:
+        SP = union_num_num(aTHX_ SP, obj,other);
+
+void
+intersection_num_num(SV * obj, SV * other)
+    PPCODE:
+        SP = intersection_num_num(aTHX_ SP, obj,other);
+
+void
+difference_num_num(SV * obj, SV * other)
+    PPCODE:
+        SP = difference_num_num(aTHX_ SP, obj,other);
+
+
+void
+find_num_num(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_num_num(aTHX_ SP, obj,key,limit);
+
+void
+find_first_num_num(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_first_num_num(aTHX_ SP, obj,key,limit);
+
+void
+find_last_num_num(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_last_num_num(aTHX_ SP, obj,key,limit);
+
+void
+exists_num_num(SV * obj, SV * key)
+    PPCODE:
+        SP = exists_num_num(aTHX_ SP, obj,key);
+
+void
+get_many_num_num(SV * obj, SV * keys)
+    PPCODE:
+        SP = get_many_num_num(aTHX_ SP, obj,keys);
+
+void
+find_lt_num_num(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_lt_num_num(aTHX_ SP, obj,key,limit);
+
+void
+find_le_num_num(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_le_num_num(aTHX_ SP, obj,key,limit);
+
+void
+find_gt_num_num(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_gt_num_num(aTHX_ SP, obj,key,limit);
+
+void
+find_ge_num_num(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_ge_num_num(aTHX_ SP, obj,key,limit);
+
+
+void
+find_lt_many_num_num(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_lt_many_num_num(aTHX_ SP, obj,keys);
+
+void
+find_le_many_num_num(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_le_many_num_num(aTHX_ SP, obj,keys);
+
+void
+find_gt_many_num_num(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_gt_many_num_num(aTHX_ SP, obj,keys);
+
+void
+find_ge_many_num_num(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_ge_many_num_num(aTHX_ SP, obj,keys);
+
+
+void
+find_gt_lt_num_num(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_gt_lt_num_num(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+find_ge_lt_num_num(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_ge_lt_num_num(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+find_gt_le_num_num(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_gt_le_num_num(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+find_ge_le_num_num(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_ge_le_num_num(aTHX_ SP, obj,lower_key,upper_key);
+
+
+void
+count_lt_num_num(SV * obj, SV * key)
+    PPCODE:
+        SP = count_lt_num_num(aTHX_ SP, obj,key);
+
+void
+count_le_num_num(SV * obj, SV * key)
+    PPCODE:
+        SP = count_le_num_num(aTHX_ SP, obj,key);
+
+void
+count_gt_num_num(SV * obj, SV * key)
+    PPCODE:
+        SP = count_gt_num_num(aTHX_ SP, obj,key);
+
+void
+count_ge_num_num(SV * obj, SV * key)
+    PPCODE:
+        SP = count_ge_num_num(aTHX_ SP, obj,key);
+
+void
+count_eq_num_num(SV * obj, SV * key)
+    PPCODE:
+        SP = count_eq_num_num(aTHX_ SP, obj,key);
+
+void
+equal_range_num_num(SV * obj, SV * key)
+    PPCODE:
+        SP = equal_range_num_num(aTHX_ SP, obj,key);
+
+
+void
+count_lt_many_num_num(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_lt_many_num_num(aTHX_ SP, obj,keys);
+
+void
+count_le_many_num_num(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_le_many_num_num(aTHX_ SP, obj,keys);
+
+void
+count_gt_many_num_num(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_gt_many_num_num(aTHX_ SP, obj,keys);
+
+void
+count_ge_many_num_num(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_ge_many_num_num(aTHX_ SP, obj,keys);
+
+
+void
+apply_num_num(SV * obj, SV * ops)
+    PPCODE:
+        SP = apply_num_num(aTHX_ SP, obj,ops);
+
+
+void
+find_min_num_num(SV * obj, int limit = 1)
+    PPCODE:
+        SP = find_min_num_num(aTHX_ SP, obj,limit);
+
+void
+find_max_num_num(SV * obj, int limit = 1)
+    PPCODE:
+        SP = find_max_num_num(aTHX_ SP, obj,limit);
+
+
+void
+pop_min_num_num(SV * obj, int limit = 1)
+    PPCODE:
+        SP = pop_min_num_num(aTHX_ SP, obj,limit);
+
+void
+pop_max_num_num(SV * obj, int limit = 1)
+    PPCODE:
+        SP = pop_max_num_num(aTHX_ SP, obj,limit);
+
+
+void
+skip_l_num_num(SV * obj, int offset, int limit = 1)
+    PPCODE:
+        SP = skip_l_num_num(aTHX_ SP, obj,offset,limit);
+
+void
+skip_g_num_num(SV * obj, int offset, int limit = 1)
+    PPCODE:
+        SP = skip_g_num_num(aTHX_ SP, obj,offset,limit);
+
+void
+delete_at_num_num(SV * obj, int offset)
+    PPCODE:
+        SP = delete_at_num_num(aTHX_ SP, obj,offset);
+
+void
+delete_ranks_num_num(SV * obj, int from, int count = -1)
+    PPCODE:
+        SP = delete_ranks_num_num(aTHX_ SP, obj,from,count);
+
+
+void
+clear_num_num(SV * obj)
+    PPCODE:
+        SP = clear_num_num(aTHX_ SP, obj);
+
+void
+reserve_num_num(SV * obj, IV n)
+    PPCODE:
+        SP = reserve_num_num(aTHX_ SP, obj,n);
+
+void
+compact_num_num(SV * obj)
+    PPCODE:
+        SP = compact_num_num(aTHX_ SP, obj);
+
+
+void
+dump_num_num(SV *obj)
+    PPCODE:
+        SP = dump_num_num(aTHX_ SP, obj);
+
+void
+check_num_num(SV * obj)
+    PPCODE:
+        SP = check_num_num(aTHX_ SP, obj);
+
+
+void
+new_num_any(SV * class, SV * cmp = &PL_sv_undef)
+    PPCODE:
+        SP = new_num_any(aTHX_ SP, class,cmp);
+
+void
+new_from_sorted_num_any(SV * class, SV * keys, SV * values = &PL_sv_undef, SV * cmp = &PL_sv_undef)
+    PPCODE:
+        SP = new_from_sorted_num_any(aTHX_ SP, class,keys,values,cmp);
+
+void
+DESTROY_num_any(SV * obj)
+    PPCODE:
+        SP = DESTROY_num_any(aTHX_ SP, obj);
+
+
+void
+size_num_any(SV *obj)
+    PPCODE:
+        SP = size_num_any(aTHX_ SP, obj);
+
+void
+ever_height_num_any(SV *obj)
+    PPCODE:
+        SP = ever_height_num_any(aTHX_ SP, obj);
+
+void
+cmp_count_num_any(SV *obj)
+    PPCODE:
+        SP = cmp_count_num_any(aTHX_ SP, obj);
+
+void
+insert_num_any(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_num_any(aTHX_ SP, obj,key,value);
+
+void
+insert_before_num_any(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_before_num_any(aTHX_ SP, obj,key,value);
+
+void
+insert_after_num_any(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_after_num_any(aTHX_ SP, obj,key,value);
+
+void
+insert_unique_num_any(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_unique_num_any(aTHX_ SP, obj,key,value);
+
+void
+set_num_any(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = set_num_any(aTHX_ SP, obj,key,value);
+
+void
+add_value_num_any(SV * obj, SV * key, SV * delta, int insert = 1)
+    PPCODE:
+        SP = add_value_num_any(aTHX_ SP, obj,key,delta,insert);
+
+void
+incr_num_any(SV * obj, SV * key)
+    PPCODE:
+        SP = incr_num_any(aTHX_ SP, obj,key);
+
+void
+insert_many_num_any(SV * obj, SV * keys, SV * values = &PL_sv_undef)
+    PPCODE:
+        SP = insert_many_num_any(aTHX_ SP, obj,keys,values);
+
+void
+delete_num_any(SV * obj, SV * key)
+    PPCODE:
+        SP = delete_num_any(aTHX_ SP, obj,key);
+
+void
+delete_first_num_any(SV * obj, SV * key)
+    PPCODE:
+        SP = delete_first_num_any(aTHX_ SP, obj,key);
+
+void
+delete_last_num_any(SV * obj, SV * key)
+    PPCODE:
+        SP = delete_last_num_any(aTHX_ SP, obj,key);
+
+void
+take_first_num_any(SV * obj, SV * key)
+    PPCODE:
+        SP = take_first_num_any(aTHX_ SP, obj,key);
+
+void
+take_last_num_any(SV * obj, SV * key)
+    PPCODE:
+        SP = take_last_num_any(aTHX_ SP, obj,key);
+
+void
+delete_many_num_any(SV * obj, SV * keys)
+    PPCODE:
+        SP = delete_many_num_any(aTHX_ SP, obj,keys);
+
+void
+delete_many_first_num_any(SV * obj, SV * keys)
+    PPCODE:
+        SP = delete_many_first_num_any(aTHX_ SP, obj,keys);
+
+void
+delete_many_last_num_any(SV * obj, SV * keys)
+    PPCODE:
+        SP = delete_many_last_num_any(aTHX_ SP, obj,keys);
+
+void
+delete_gt_lt_num_any(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_gt_lt_num_any(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+delete_ge_lt_num_any(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_ge_lt_num_any(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+delete_gt_le_num_any(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_gt_le_num_any(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+delete_ge_le_num_any(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_ge_le_num_any(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+drain_le_num_any(SV * obj, SV * key, int limit = -1)
+    PPCODE:
+        SP = drain_le_num_any(aTHX_ SP, obj,key,limit);
+
+void
+drain_ge_num_any(SV * obj, SV * key, int limit = -1)
+    PPCODE:
+        SP = drain_ge_num_any(aTHX_ SP, obj,key,limit);
+
+
+void
+split_lt_num_any(SV * obj, SV * key)
+    PPCODE:
+        SP = split_lt_num_any(aTHX_ SP, obj,key);
+
+void
+split_le_num_any(SV * obj, SV * key)
+    PPCODE:
+        SP = split_le_num_any(aTHX_ SP, obj,key);
+
+void
+join_num_any(SV * obj, SV * other)
+    PPCODE:
+        SP = join_num_any(aTHX_ SP, obj,other);
+
+void
+union_num_any(SV * obj, SV * other)
+    PPCODE:
+        SP = union_num_any(aTHX_ SP, obj,other);
+
+void
+intersection_num_any(SV * obj, SV * other)
+    PPCODE:
+        SP = intersection_num_any(aTHX_ SP, obj,other);
+
+void
+difference_num_any(SV * obj, SV * other)
+    PPCODE:
+        SP = difference_num_any(aTHX_ SP, obj,other);
+
+
+void
+find_num_any(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_num_any(aTHX_ SP, obj,key,limit);
+
+void
+find_first_num_any(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_first_num_any(aTHX_ SP, obj,key,limit);
+
+void
+find_last_num_any(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_last_num_any(aTHX_ SP, obj,key,limit);
+
+void
+exists_num_any(SV * obj, SV * key)
+    PPCODE:
+        SP = exists_num_any(aTHX_ SP, obj,key);
+
+void
+get_many_num_any(SV * obj, SV * keys)
+    PPCODE:
+        SP = get_many_num_any(aTHX_ SP, obj,keys);
+
+void
+find_lt_num_any(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_lt_num_any(aTHX_ SP, obj,key,limit);
+
+void
+find_le_num_any(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_le_num_any(aTHX_ SP, obj,key,limit);
+
+void
+find_gt_num_any(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_gt_num_any(aTHX_ SP, obj,key,limit);
+
+void
+find_ge_num_any(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_ge_num_any(aTHX_ SP, obj,key,limit);
+
+
+void
+find_lt_many_num_any(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_lt_many_num_any(aTHX_ SP, obj,keys);
+
+void
+find_le_many_num_any(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_le_many_num_any(aTHX_ SP, obj,keys);
+
+void
+find_gt_many_num_any(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_gt_many_num_any(aTHX_ SP, obj,keys);
+
+void
+find_ge_many_num_any(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_ge_many_num_any(aTHX_ SP, obj,keys);
+
+
+void
+find_gt_lt_num_any(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_gt_lt_num_any(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+find_ge_lt_num_any(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_ge_lt_num_any(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+find_gt_le_num_any(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_gt_le_num_any(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+find_ge_le_num_any(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_ge_le_num_any(aTHX_ SP, obj,lower_key,upper_key);
+
+
+void
+count_lt_num_any(SV * obj, SV * key)
+    PPCODE:
+        SP = count_lt_num_any(aTHX_ SP, obj,key);
+
+void
+count_le_num_any(SV * obj, SV * key)
+    PPCODE:
+        SP = count_le_num_any(aTHX_ SP, obj,key);
+
+void
+count_gt_num_any(SV * obj, SV * key)
+    PPCODE:
+        SP = count_gt_num_any(aTHX_ SP, obj,key);
+
+void
+count_ge_num_any(SV * obj, SV * key)
+    PPCODE:
+        SP = count_ge_num_any(aTHX_ SP, obj,key);
+
+void
+count_eq_num_any(SV * obj, SV * key)
+    PPCODE:
+        SP = count_eq_num_any(aTHX_ SP, obj,key);
+
+void
+equal_range_num_any(SV * obj, SV * key)
+    PPCODE:
+        SP = equal_range_num_any(aTHX_ SP, obj,key);
+
+
+void
+count_lt_many_num_any(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_lt_many_num_any(aTHX_ SP, obj,keys);
+
+void
+count_le_many_num_any(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_le_many_num_any(aTHX_ SP, obj,keys);
+
+void
+count_gt_many_num_any(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_gt_many_num_any(aTHX_ SP, obj,keys);
+
+void
+count_ge_many_num_any(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_ge_many_num_any(aTHX_ SP, obj,keys);
+
+
+void
+apply_num_any(SV * obj, SV * ops)
+    PPCODE:
+        SP = apply_num_any(aTHX_ SP, obj,ops);
+
+
+void
+find_min_num_any(SV * obj, int limit = 1)
+    PPCODE:
+        SP = find_min_num_any(aTHX_ SP, obj,limit);
+
+void
+find_max_num_any(SV * obj, int limit = 1)
+    PPCODE:
+        SP = find_max_num_any(aTHX_ SP, obj,limit);
+
+
+void
+pop_min_num_any(SV * obj, int limit = 1)
+    PPCODE:
+        SP = pop_min_num_any(aTHX_ SP, obj,limit);
+
+void
+pop_max_num_any(SV * obj, int limit = 1)
+    PPCODE:
+        SP = pop_max_num_any(aTHX_ SP, obj,limit);
+
+
+void
+skip_l_num_any(SV * obj, int offset, int limit = 1)
+    PPCODE:
+        SP = skip_l_num_any(aTHX_ SP, obj,offset,limit);
+
+void
+skip_g_num_any(SV * obj, int offset, int limit = 1)
+    PPCODE:
+        SP = skip_g_num_any(aTHX_ SP, obj,offset,limit);
+
+void
+delete_at_num_any(SV * obj, int offset)
+    PPCODE:
+        SP = delete_at_num_any(aTHX_ SP, obj,offset);
+
+void
+delete_ranks_num_any(SV * obj, int from, int count = -1)
+    PPCODE:
+        SP = delete_ranks_num_any(aTHX_ SP, obj,from,count);
+
+
+void
+clear_num_any(SV * obj)
+    PPCODE:
+        SP = clear_num_any(aTHX_ SP, obj);
+
+void
+reserve_num_any(SV * obj, IV n)
+    PPCODE:
+        SP = reserve_num_any(aTHX_ SP, obj,n);
+
+void
+compact_num_any(SV * obj)
+    PPCODE:
+        SP = compact_num_any(aTHX_ SP, obj);
+
+
+void
+dump_num_any(SV *obj)
+    PPCODE:
+        SP = dump_num_any(aTHX_ SP, obj);
+
+void
+check_num_any(SV * obj)
+    PPCODE:
+        SP = check_num_any(aTHX_ SP, obj);
+
+
+void
+new_str_void(SV * class, SV * cmp = &PL_sv_undef)
+    PPCODE:
+        SP = new_str_void(aTHX_ SP, class,cmp);
+
+void
+new_from_sorted_str_void(SV * class, SV * keys, SV * values = &PL_sv_undef, SV * cmp = &PL_sv_undef)
+    PPCODE:
+        SP = new_from_sorted_str_void(aTHX_ SP, class,keys,values,cmp);
+
+void
+DESTROY_str_void(SV * obj)
+    PPCODE:
+        SP = DESTROY_str_void(aTHX_ SP, obj);
+
+
+void
+size_str_void(SV *obj)
+    PPCODE:
+        SP = size_str_void(aTHX_ SP, obj);
+
+void
+ever_height_str_void(SV *obj)
+    PPCODE:
+        SP = ever_height_str_void(aTHX_ SP, obj);
+
+void
+cmp_count_str_void(SV *obj)
+    PPCODE:
+        SP = cmp_count_str_void(aTHX_ SP, obj);
+
+void
+insert_str_void(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_str_void(aTHX_ SP, obj,key,value);
+
+void
+insert_before_str_void(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_before_str_void(aTHX_ SP, obj,key,value);
+
+void
+insert_after_str_void(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_after_str_void(aTHX_ SP, obj,key,value);
+
+void
+insert_unique_str_void(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_unique_str_void(aTHX_ SP, obj,key,value);
+
+void
+set_str_void(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = set_str_void(aTHX_ SP, obj,key,value);
+
+void
+add_value_str_void(SV * obj, SV * key, SV * delta, int insert = 1)
+    PPCODE:
+        SP = add_value_str_void(aTHX_ SP, obj,key,delta,insert);
+
+void
+incr_str_void(SV * obj, SV * key)
+    PPCODE:
+        SP = incr_str_void(aTHX_ SP, obj,key);
+
+void
+insert_many_str_void(SV * obj, SV * keys, SV * values = &PL_sv_undef)
+    PPCODE:
+        SP = insert_many_str_void(aTHX_ SP, obj,keys,values);
+
+void
+delete_str_void(SV * obj, SV * key)
+    PPCODE:
+        SP = delete_str_void(aTHX_ SP, obj,key);
+
+void
+delete_first_str_void(SV * obj, SV * key)
+    PPCODE:
+        SP = delete_first_str_void(aTHX_ SP, obj,key);
+
+void
+delete_last_str_void(SV * obj, SV * key)
+    PPCODE:
+        SP = delete_last_str_void(aTHX_ SP, obj,key);
+
+void
+take_first_str_void(SV * obj, SV * key)
+    PPCODE:
+        SP = take_first_str_void(aTHX_ SP, obj,key);
+
+void
+take_last_str_void(SV * obj, SV * key)
+    PPCODE:
+        SP = take_last_str_void(aTHX_ SP, obj,key);
+
+void
+delete_many_str_void(SV * obj, SV * keys)
+    PPCODE:
+        SP = delete_many_str_void(aTHX_ SP, obj,keys);
+
+void
+delete_many_first_str_void(SV * obj, SV * keys)
+    PPCODE:
+        SP = delete_many_first_str_void(aTHX_ SP, obj,keys);
+
+void
+delete_many_last_str_void(SV * obj, SV * keys)
+    PPCODE:
+        SP = delete_many_last_str_void(aTHX_ SP, obj,keys);
+
+void
+delete_gt_lt_str_void(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_gt_lt_str_void(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+delete_ge_lt_str_void(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_ge_lt_str_void(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+delete_gt_le_str_void(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_gt_le_str_void(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+delete_ge_le_str_void(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_ge_le_str_void(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+drain_le_str_void(SV * obj, SV * key, int limit = -1)
+    PPCODE:
+        SP = drain_le_str_void(aTHX_ SP, obj,key,limit);
+
+void
+drain_ge_str_void(SV * obj, SV * key, int limit = -1)
+    PPCODE:
+        SP = drain_ge_str_void(aTHX_ SP, obj,key,limit);
+
+
+void
+split_lt_str_void(SV * obj, SV * key)
+    PPCODE:
+        SP = split_lt_str_void(aTHX_ SP, obj,key);
+
+void
+split_le_str_void(SV * obj, SV * key)
+    PPCODE:
+        SP = split_le_str_void(aTHX_ SP, obj,key);
+
+void
+join_str_void(SV * obj, SV * other)
+    PPCODE:
+        SP = join_str_void(aTHX_ SP, obj,other);
+
+void
+union_str_void(SV * obj, SV * other)
+    PPCODE:
+        SP = union_str_void(aTHX_ SP, obj,other);
+
+void
+intersection_str_void(SV * obj, SV * other)
+    PPCODE:
+        SP = intersection_str_void(aTHX_ SP, obj,other);
+
+void
+difference_str_void(SV * obj, SV * other)
+    PPCODE:
+        SP = difference_str_void(aTHX_ SP, obj,other);
+
+
+void
+find_str_void(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_str_void(aTHX_ SP, obj,key,limit);
+
+void
+find_first_str_void(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_first_str_void(aTHX_ SP, obj,key,limit);
+
+void
+find_last_str_void(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_last_str_void(aTHX_ SP, obj,key,limit);
+
+void
+exists_str_void(SV * obj, SV * key)
+    PPCODE:
+        SP = exists_str_void(aTHX_ SP, obj,key);
+
+void
+get_many_str_void(SV * obj, SV * keys)
+    PPCODE:
+        SP = get_many_str_void(aTHX_ SP, obj,keys);
+
+void
+find_lt_str_void(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_lt_str_void(aTHX_ SP, obj,key,limit);
+
+void
+find_le_str_void(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_le_str_void(aTHX_ SP, obj,key,limit);
+
+void
+find_gt_str_void(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_gt_str_void(aTHX_ SP, obj,key,limit);
+
+void
+find_ge_str_void(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_ge_str_void(aTHX_ SP, obj,key,limit);
+
+
+void
+find_lt_many_str_void(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_lt_many_str_void(aTHX_ SP, obj,keys);
+
+void
+find_le_many_str_void(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_le_many_str_void(aTHX_ SP, obj,keys);
+
+void
+find_gt_many_str_void(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_gt_many_str_void(aTHX_ SP, obj,keys);
+
+void
+find_ge_many_str_void(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_ge_many_str_void(aTHX_ SP, obj,keys);
+
+
+void
+find_gt_lt_str_void(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_gt_lt_str_void(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+find_ge_lt_str_void(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_ge_lt_str_void(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+find_gt_le_str_void(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_gt_le_str_void(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+find_ge_le_str_void(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_ge_le_str_void(aTHX_ SP, obj,lower_key,upper_key);
+
+
+void
+count_lt_str_void(SV * obj, SV * key)
+    PPCODE:
+        SP = count_lt_str_void(aTHX_ SP, obj,key);
+
+void
+count_le_str_void(SV * obj, SV * key)
+    PPCODE:
+        SP = count_le_str_void(aTHX_ SP, obj,key);
+
+void
+count_gt_str_void(SV * obj, SV * key)
+    PPCODE:
+        SP = count_gt_str_void(aTHX_ SP, obj,key);
+
+void
+count_ge_str_void(SV * obj, SV * key)
+    PPCODE:
+        SP = count_ge_str_void(aTHX_ SP, obj,key);
+
+void
+count_eq_str_void(SV * obj, SV * key)
+    PPCODE:
+        SP = count_eq_str_void(aTHX_ SP, obj,key);
+
+void
+equal_range_str_void(SV * obj, SV * key)
+    PPCODE:
+        SP = equal_range_str_void(aTHX_ SP, obj,key);
+
+
+void
+count_lt_many_str_void(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_lt_many_str_void(aTHX_ SP, obj,keys);
+
+void
+count_le_many_str_void(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_le_many_str_void(aTHX_ SP, obj,keys);
+
+void
+count_gt_many_str_void(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_gt_many_str_void(aTHX_ SP, obj,keys);
+
+void
+count_ge_many_str_void(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_ge_many_str_void(aTHX_ SP, obj,keys);
+
+
+void
+apply_str_void(SV * obj, SV * ops)
+    PPCODE:
+        SP = apply_str_void(aTHX_ SP, obj,ops);
+
+
+void
+find_min_str_void(SV * obj, int limit = 1)
+    PPCODE:
+        SP = find_min_str_void(aTHX_ SP, obj,limit);
+
+void
+find_max_str_void(SV * obj, int limit = 1)
+    PPCODE:
+        SP = find_max_str_void(aTHX_ SP, obj,limit);
+
+
+void
+pop_min_str_void(SV * obj, int limit = 1)
+    PPCODE:
+        SP = pop_min_str_void(aTHX_ SP, obj,limit);
+
+void
+pop_max_str_void(SV * obj, int limit = 1)
+    PPCODE:
+        SP = pop_max_str_void(aTHX_ SP, obj,limit);
+
+
+void
+skip_l_str_void(SV * obj, int offset, int limit = 1)
+    PPCODE:
+        SP = skip_l_str_void(aTHX_ SP, obj,offset,limit);
+
+void
+skip_g_str_void(SV * obj, int offset, int limit = 1)
+    PPCODE:
+        SP = skip_g_str_void(aTHX_ SP, obj,offset,limit);
+
+void
+delete_at_str_void(SV * obj, int offset)
+    PPCODE:
+        SP = delete_at_str_void(aTHX_ SP, obj,offset);
+
+void
+delete_ranks_str_void(SV * obj, int from, int count = -1)
+    PPCODE:
+        SP = delete_ranks_str_void(aTHX_ SP, obj,from,count);
+
+
+void
+clear_str_void(SV * obj)
+    PPCODE:
+        SP = clear_str_void(aTHX_ SP, obj);
+
+void
+reserve_str_void(SV * obj, IV n)
+    PPCODE:
+        SP = reserve_str_void(aTHX_ SP, obj,n);
+
+void
+compact_str_void(SV * obj)
+    PPCODE:
+        SP = compact_str_void(aTHX_ SP, obj);
+
+
+void
+dump_str_void(SV *obj)
+    PPCODE:
+        SP = dump_str_void(aTHX_ SP, obj);
+
+void
+check_str_void(SV * obj)
+    PPCODE:
+        SP = check_str_void(aTHX_ SP, obj);
+
+
+void
+new_str_int(SV * class, SV * cmp = &PL_sv_undef)
+    PPCODE:
+        SP = new_str_int(aTHX_ SP, class,cmp);
+
+void
+new_from_sorted_str_int(SV * class, SV * keys, SV * values = &PL_sv_undef, SV * cmp = &PL_sv_undef)
+    PPCODE:
+        SP = new_from_sorted_str_int(aTHX_ SP, class,keys,values,cmp);
+
+void
+DESTROY_str_int(SV * obj)
+    PPCODE:
+        SP = DESTROY_str_int(aTHX_ SP, obj);
+
+
+void
+size_str_int(SV *obj)
+    PPCODE:
+        SP = size_str_int(aTHX_ SP, obj);
+
+void
+ever_height_str_int(SV *obj)
+    PPCODE:
+        SP = ever_height_str_int(aTHX_ SP, obj);
+
+void
+cmp_count_str_int(SV *obj)
+    PPCODE:
+        SP = cmp_count_str_int(aTHX_ SP, obj);
+
+void
+insert_str_int(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_str_int(aTHX_ SP, obj,key,value);
+
+void
+insert_before_str_int(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_before_str_int(aTHX_ SP, obj,key,value);
+
+void
+insert_after_str_int(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_after_str_int(aTHX_ SP, obj,key,value);
+
+void
+insert_unique_str_int(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_unique_str_int(aTHX_ SP, obj,key,value);
+
+void
+set_str_int(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = set_str_int(aTHX_ SP, obj,key,value);
+
+void
+add_value_str_int(SV * obj, SV * key, SV * delta, int insert = 1)
+    PPCODE:
+        SP = add_value_str_int(aTHX_ SP, obj,key,delta,insert);
+
+void
+incr_str_int(SV * obj, SV * key)
+    PPCODE:
+        SP = incr_str_int(aTHX_ SP, obj,key);
+
+void
+insert_many_str_int(SV * obj, SV * keys, SV * values = &PL_sv_undef)
+    PPCODE:
+        SP = insert_many_str_int(aTHX_ SP, obj,keys,values);
+
+void
+delete_str_int(SV * obj, SV * key)
+    PPCODE:
+        SP = delete_str_int(aTHX_ SP, obj,key);
+
+void
+delete_first_str_int(SV * obj, SV * key)
+    PPCODE:
+        SP = delete_first_str_int(aTHX_ SP, obj,key);
+
+void
+delete_last_str_int(SV * obj, SV * key)
+    PPCODE:
+        SP = delete_last_str_int(aTHX_ SP, obj,key);
+
+void
+take_first_str_int(SV * obj, SV * key)
+    PPCODE:
+        SP = take_first_str_int(aTHX_ SP, obj,key);
+
+void
+take_last_str_int(SV * obj, SV * key)
+    PPCODE:
+        SP = take_last_str_int(aTHX_ SP, obj,key);
+
+void
+delete_many_str_int(SV * obj, SV * keys)
+    PPCODE:
+        SP = delete_many_str_int(aTHX_ SP, obj,keys);
+
+void
+delete_many_first_str_int(SV * obj, SV * keys)
+    PPCODE:
+        SP = delete_many_first_str_int(aTHX_ SP, obj,keys);
+
+void
+delete_many_last_str_int(SV * obj, SV * keys)
+    PPCODE:
+        SP = delete_many_last_str_int(aTHX_ SP, obj,keys);
+
+void
+delete_gt_lt_str_int(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_gt_lt_str_int(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+delete_ge_lt_str_int(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_ge_lt_str_int(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+delete_gt_le_str_int(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_gt_le_str_int(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+delete_ge_le_str_int(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_ge_le_str_int(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+drain_le_str_int(SV * obj, SV * key, int limit = -1)
+    PPCODE:
+        SP = drain_le_str_int(aTHX_ SP, obj,key,limit);
+
+void
+drain_ge_str_int(SV * obj, SV * key, int limit = -1)
+    PPCODE:
+        SP = drain_ge_str_int(aTHX_ SP, obj,key,limit);
+
+
+void
+split_lt_str_int(SV * obj, SV * key)
+    PPCODE:
+        SP = split_lt_str_int(aTHX_ SP, obj,key);
+
+void
+split_le_str_int(SV * obj, SV * key)
+    PPCODE:
+        SP = split_le_str_int(aTHX_ SP, obj,key);
+
+void
+join_str_int(SV * obj, SV * other)
+    PPCODE:
+        SP = join_str_int(aTHX_ SP, obj,other);
+
+void
+union_str_int(SV * obj, SV * other)
+    PPCODE:
+        SP = union_str_int(aTHX_ SP, obj,other);
+
+void
+intersection_str_int(SV * obj, SV * other)
+    PPCODE:
+        SP = intersection_str_int(aTHX_ SP, obj,other);
+
+void
+difference_str_int(SV * obj, SV * other)
+    PPCODE:
+        SP = difference_str_int(aTHX_ SP, obj,other);
+
+
+void
+find_str_int(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_str_int(aTHX_ SP, obj,key,limit);
+
+void
+find_first_str_int(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_first_str_int(aTHX_ SP, obj,key,limit);
+
+void
+find_last_str_int(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_last_str_int(aTHX_ SP, obj,key,limit);
+
+void
+exists_str_int(SV * obj, SV * key)
+    PPCODE:
+        SP = exists_str_int(aTHX_ SP, obj,key);
+
+void
+get_many_str_int(SV * obj, SV * keys)
+    PPCODE:
+        SP = get_many_str_int(aTHX_ SP, obj,keys);
+
+void
+find_lt_str_int(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_lt_str_int(aTHX_ SP, obj,key,limit);
+
+void
+find_le_str_int(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_le_str_int(aTHX_ SP, obj,key,limit);
+
+void
+find_gt_str_int(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_gt_str_int(aTHX_ SP, obj,key,limit);
+
+void
+find_ge_str_int(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_ge_str_int(aTHX_ SP, obj,key,limit);
+
+
+void
+find_lt_many_str_int(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_lt_many_str_int(aTHX_ SP, obj,keys);
+
+void
+find_le_many_str_int(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_le_many_str_int(aTHX_ SP, obj,keys);
+
+void
+find_gt_many_str_int(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_gt_many_str_int(aTHX_ SP, obj,keys);
+
+void
+find_ge_many_str_int(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_ge_many_str_int(aTHX_ SP, obj,keys);
+
+
+void
+find_gt_lt_str_int(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_gt_lt_str_int(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+find_ge_lt_str_int(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_ge_lt_str_int(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+find_gt_le_str_int(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_gt_le_str_int(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+find_ge_le_str_int(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_ge_le_str_int(aTHX_ SP, obj,lower_key,upper_key);
+
+
+void
+count_lt_str_int(SV * obj, SV * key)
+    PPCODE:
+        SP = count_lt_str_int(aTHX_ SP, obj,key);
+
+void
+count_le_str_int(SV * obj, SV * key)
+    PPCODE:
+        SP = count_le_str_int(aTHX_ SP, obj,key);
+
+void
+count_gt_str_int(SV * obj, SV * key)
+    PPCODE:
+        SP = count_gt_str_int(aTHX_ SP, obj,key);
+
+void
+count_ge_str_int(SV * obj, SV * key)
+    PPCODE:
+        SP = count_ge_str_int(aTHX_ SP, obj,key);
+
+void
+count_eq_str_int(SV * obj, SV * key)
+    PPCODE:
+        SP = count_eq_str_int(aTHX_ SP, obj,key);
+
+void
+equal_range_str_int(SV * obj, SV * key)
+    PPCODE:
+        SP = equal_range_str_int(aTHX_ SP, obj,key);
+
+
+void
+count_lt_many_str_int(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_lt_many_str_int(aTHX_ SP, obj,keys);
+
+void
+count_le_many_str_int(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_le_many_str_int(aTHX_ SP, obj,keys);
+
+void
+count_gt_many_str_int(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_gt_many_str_int(aTHX_ SP, obj,keys);
+
+void
+count_ge_many_str_int(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_ge_many_str_int(aTHX_ SP, obj,keys);
+
+
+void
+apply_str_int(SV * obj, SV * ops)
+    PPCODE:
+        SP = apply_str_int(aTHX_ SP, obj,ops);
+
+
+void
+find_min_str_int(SV * obj, int limit = 1)
+    PPCODE:
+        SP = find_min_str_int(aTHX_ SP, obj,limit);
+
+void
+find_max_str_int(SV * obj, int limit = 1)
+    PPCODE:
+        SP = find_max_str_int(aTHX_ SP, obj,limit);
+
+
+void
+pop_min_str_int(SV * obj, int limit = 1)
+    PPCODE:
+        SP = pop_min_str_int(aTHX_ SP, obj,limit);
+
+void
+pop_max_str_int(SV * obj, int limit = 1)
+    PPCODE:
+        SP = pop_max_str_int(aTHX_ SP, obj,limit);
+
+
+void
+skip_l_str_int(SV * obj, int offset, int limit = 1)
+    PPCODE:
+        SP = skip_l_str_int(aTHX_ SP, obj,offset,limit);
+
+void
+skip_g_str_int(SV * obj, int offset, int limit = 1)
+    PPCODE:
+        SP = skip_g_str_int(aTHX_ SP, obj,offset,limit);
+
+void
+delete_at_str_int(SV * obj, int offset)
+    PPCODE:
+        SP = delete_at_str_int(aTHX_ SP, obj,offset);
+
+void
+delete_ranks_str_int(SV * obj, int from, int count = -1)
+    PPCODE:
+        SP = delete_ranks_str_int(aTHX_ SP, obj,from,count);
+
+
+void
+clear_str_int(SV * obj)
+    PPCODE:
+        SP = clear_str_int(aTHX_ SP, obj);
+
+void
+reserve_str_int(SV * obj, IV n)
+    PPCODE:
+        SP = reserve_str_int(aTHX_ SP, obj,n);
+
+void
+compact_str_int(SV * obj)
+    PPCODE:
+        SP = compact_str_int(aTHX_ SP, obj);
+
+
+void
+dump_str_int(SV *obj)
+    PPCODE:
+        SP = dump_str_int(aTHX_ SP, obj);
+
+void
+check_str_int(SV * obj)
+    PPCODE:
+        SP = check_str_int(aTHX_ SP, obj);
+
+
+void
+new_str_num(SV * class, SV * cmp = &PL_sv_undef)
+    PPCODE:
+        SP = new_str_num(aTHX_ SP, class,cmp);
+
+void
+new_from_sorted_str_num(SV * class, SV * keys, SV * values = &PL_sv_undef, SV * cmp = &PL_sv_undef)
+    PPCODE:
+        SP = new_from_sorted_str_num(aTHX_ SP, class,keys,values,cmp);
+
+void
+DESTROY_str_num(SV * obj)
+    PPCODE:
+        SP = DESTROY_str_num(aTHX_ SP, obj);
+
+
+void
+size_str_num(SV *obj)
+    PPCODE:
+        SP = size_str_num(aTHX_ SP, obj);
+
+void
+ever_height_str_num(SV *obj)
+    PPCODE:
+        SP = ever_height_str_num(aTHX_ SP, obj);
+
+void
+cmp_count_str_num(SV *obj)
+    PPCODE:
+        SP = cmp_count_str_num(aTHX_ SP, obj);
+
+void
+insert_str_num(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_str_num(aTHX_ SP, obj,key,value);
+
+void
+insert_before_str_num(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_before_str_num(aTHX_ SP, obj,key,value);
+
+void
+insert_after_str_num(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_after_str_num(aTHX_ SP, obj,key,value);
+
+void
+insert_unique_str_num(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_unique_str_num(aTHX_ SP, obj,key,value);
+
+void
+set_str_num(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = set_str_num(aTHX_ SP, obj,key,value);
+
+void
+add_value_str_num(SV * obj, SV * key, SV * delta, int insert = 1)
+    PPCODE:
+        SP = add_value_str_num(aTHX_ SP, obj,key,delta,insert);
+
+void
+incr_str_num(SV * obj, SV * key)
+    PPCODE:
+        SP = incr_str_num(aTHX_ SP, obj,key);
+
+void
+insert_many_str_num(SV * obj, SV * keys, SV * values = &PL_sv_undef)
+    PPCODE:
+        SP = insert_many_str_num(aTHX_ SP, obj,keys,values);
+
+void
+delete_str_num(SV * obj, SV * key)
+    PPCODE:
+        SP = delete_str_num(aTHX_ SP, obj,key);
+
+void
+delete_first_str_num(SV * obj, SV * key)
+    PPCODE:
+        SP = delete_first_str_num(aTHX_ SP, obj,key);
+
+void
+delete_last_str_num(SV * obj, SV * key)
+    PPCODE:
+        SP = delete_last_str_num(aTHX_ SP, obj,key);
+
+void
+take_first_str_num(SV * obj, SV * key)
+    PPCODE:
+        SP = take_first_str_num(aTHX_ SP, obj,key);
+
+void
+take_last_str_num(SV * obj, SV * key)
+    PPCODE:
+        SP = take_last_str_num(aTHX_ SP, obj,key);
+
+void
+delete_many_str_num(SV * obj, SV * keys)
+    PPCODE:
+        SP = delete_many_str_num(aTHX_ SP, obj,keys);
+
+void
+delete_many_first_str_num(SV * obj, SV * keys)
+    PPCODE:
+        SP = delete_many_first_str_num(aTHX_ SP, obj,keys);
+
+void
+delete_many_last_str_num(SV * obj, SV * keys)
+    PPCODE:
+        SP = delete_many_last_str_num(aTHX_ SP, obj,keys);
+
+void
+delete_gt_lt_str_num(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_gt_lt_str_num(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+delete_ge_lt_str_num(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_ge_lt_str_num(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+delete_gt_le_str_num(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_gt_le_str_num(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+delete_ge_le_str_num(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_ge_le_str_num(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+drain_le_str_num(SV * obj, SV * key, int limit = -1)
+    PPCODE:
+        SP = drain_le_str_num(aTHX_ SP, obj,key,limit);
+
+void
+drain_ge_str_num(SV * obj, SV * key, int limit = -1)
+    PPCODE:
+        SP = drain_ge_str_num(aTHX_ SP, obj,key,limit);
+
+
+void
+split_lt_str_num(SV * obj, SV * key)
+    PPCODE:
+        SP = split_lt_str_num(aTHX_ SP, obj,key);
+
+void
+split_le_str_num(SV * obj, SV * key)
+    PPCODE:
+        SP = split_le_str_num(aTHX_ SP, obj,key);
+
+void
+join_str_num(SV * obj, SV * other)
+    PPCODE:
+        SP = join_str_num(aTHX_ SP, obj,other);
+
+void
+union_str_num(SV * obj, SV * other)
+    PPCODE:
+        SP = union_str_num(aTHX_ SP, obj,other);
+
+void
+intersection_str_num(SV * obj, SV * other)
+    PPCODE:
+        SP = intersection_str_num(aTHX_ SP, obj,other);
+
+void
+difference_str_num(SV * obj, SV * other)
+    PPCODE:
+        SP = difference_str_num(aTHX_ SP, obj,other);
+
+
+void
+find_str_num(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_str_num(aTHX_ SP, obj,key,limit);
+
+void
+find_first_str_num(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_first_str_num(aTHX_ SP, obj,key,limit);
+
+void
+find_last_str_num(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_last_str_num(aTHX_ SP, obj,key,limit);
+
+void
+exists_str_num(SV * obj, SV * key)
+    PPCODE:
+        SP = exists_str_num(aTHX_ SP, obj,key);
+
+void
+get_many_str_num(SV * obj, SV * keys)
+    PPCODE:
+        SP = get_many_str_num(aTHX_ SP, obj,keys);
+
+void
+find_lt_str_num(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_lt_str_num(aTHX_ SP, obj,key,limit);
+
+void
+find_le_str_num(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_le_str_num(aTHX_ SP, obj,key,limit);
+
+void
+find_gt_str_num(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_gt_str_num(aTHX_ SP, obj,key,limit);
+
+void
+find_ge_str_num(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_ge_str_num(aTHX_ SP, obj,key,limit);
+
+
+void
+find_lt_many_str_num(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_lt_many_str_num(aTHX_ SP, obj,keys);
+
+void
+find_le_many_str_num(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_le_many_str_num(aTHX_ SP, obj,keys);
+
+void
+find_gt_many_str_num(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_gt_many_str_num(aTHX_ SP, obj,keys);
+
+void
+find_ge_many_str_num(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_ge_many_str_num(aTHX_ SP, obj,keys);
+
+
+void
+find_gt_lt_str_num(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_gt_lt_str_num(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+find_ge_lt_str_num(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_ge_lt_str_num(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+find_gt_le_str_num(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_gt_le_str_num(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+find_ge_le_str_num(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_ge_le_str_num(aTHX_ SP, obj,lower_key,upper_key);
+
+
+void
+count_lt_str_num(SV * obj, SV * key)
+    PPCODE:
+        SP = count_lt_str_num(aTHX_ SP, obj,key);
+
+void
+count_le_str_num(SV * obj, SV * key)
+    PPCODE:
+        SP = count_le_str_num(aTHX_ SP, obj,key);
+
+void
+count_gt_str_num(SV * obj, SV * key)
+    PPCODE:
+        SP = count_gt_str_num(aTHX_ SP, obj,key);
+
+void
+count_ge_str_num(SV * obj, SV * key)
+    PPCODE:
+        SP = count_ge_str_num(aTHX_ SP, obj,key);
+
+void
+count_eq_str_num(SV * obj, SV * key)
+    PPCODE:
+        SP = count_eq_str_num(aTHX_ SP, obj,key);
+
+void
+equal_range_str_num(SV * obj, SV * key)
+    PPCODE:
+        SP = equal_range_str_num(aTHX_ SP, obj,key);
+
+
+void
+count_lt_many_str_num(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_lt_many_str_num(aTHX_ SP, obj,keys);
+
+void
+count_le_many_str_num(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_le_many_str_num(aTHX_ SP, obj,keys);
+
+void
+count_gt_many_str_num(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_gt_many_str_num(aTHX_ SP, obj,keys);
+
+void
+count_ge_many_str_num(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_ge_many_str_num(aTHX_ SP, obj,keys);
+
+
+void
+apply_str_num(SV * obj, SV * ops)
+    PPCODE:
+        SP = apply_str_num(aTHX_ SP, obj,ops);
+
+
+void
+find_min_str_num(SV * obj, int limit = 1)
+    PPCODE:
+        SP = find_min_str_num(aTHX_ SP, obj,limit);
+
+void
+find_max_str_num(SV * obj, int limit = 1)
+    PPCODE:
+        SP = find_max_str_num(aTHX_ SP, obj,limit);
+
+
+void
+pop_min_str_num(SV * obj, int limit = 1)
+    PPCODE:
+        SP = pop_min_str_num(aTHX_ SP, obj,limit);
+
+void
+pop_max_str_num(SV * obj, int limit = 1)
+    PPCODE:
+        SP = pop_max_str_num(aTHX_ SP, obj,limit);
+
+
+void
+skip_l_str_num(SV * obj, int offset, int limit = 1)
+    PPCODE:
+        SP = skip_l_str_num(aTHX_ SP, obj,offset,limit);
+
+void
+skip_g_str_num(SV * obj, int offset, int limit = 1)
+    PPCODE:
+        SP = skip_g_str_num(aTHX_ SP, obj,offset,limit);
+
+void
+delete_at_str_num(SV * obj, int offset)
+    PPCODE:
+        SP = delete_at_str_num(aTHX_ SP, obj,offset);
+
+void
+delete_ranks_str_num(SV * obj, int from, int count = -1)
+    PPCODE:
+        SP = delete_ranks_str_num(aTHX_ SP, obj,from,count);
+
+
+void
+clear_str_num(SV * obj)
+    PPCODE:
+        SP = clear_str_num(aTHX_ SP, obj);
+
+void
+reserve_str_num(SV * obj, IV n)
+    PPCODE:
+        SP = reserve_str_num(aTHX_ SP, obj,n);
+
+void
+compact_str_num(SV * obj)
+    PPCODE:
+        SP = compact_str_num(aTHX_ SP, obj);
+
+
+void
+dump_str_num(SV *obj)
+    PPCODE:
+        SP = dump_str_num(aTHX_ SP, obj);
+
+void
+check_str_num(SV * obj)
+    PPCODE:
+        SP = check_str_num(aTHX_ SP, obj);
+
+
+void
+new_str_any(SV * class, SV * cmp = &PL_sv_undef)
+    PPCODE:
+        SP = new_str_any(aTHX_ SP, class,cmp);
+
+void
+new_from_sorted_str_any(SV * class, SV * keys, SV * values = &PL_sv_undef, SV * cmp = &PL_sv_undef)
+    PPCODE:
+        SP = new_from_sorted_str_any(aTHX_ SP, class,keys,values,cmp);
+
+void
+DESTROY_str_any(SV * obj)
+    PPCODE:
+        SP = DESTROY_str_any(aTHX_ SP, obj);
+
+
+void
+size_str_any(SV *obj)
+    PPCODE:
+        SP = size_str_any(aTHX_ SP, obj);
+
+void
+ever_height_str_any(SV *obj)
+    PPCODE:
+        SP = ever_height_str_any(aTHX_ SP, obj);
+
+void
+cmp_count_str_any(SV *obj)
+    PPCODE:
+        SP = cmp_count_str_any(aTHX_ SP, obj);
+
+void
+insert_str_any(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_str_any(aTHX_ SP, obj,key,value);
+
+void
+insert_before_str_any(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_before_str_any(aTHX_ SP, obj,key,value);
+
+void
+insert_after_str_any(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_after_str_any(aTHX_ SP, obj,key,value);
+
+void
+insert_unique_str_any(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_unique_str_any(aTHX_ SP, obj,key,value);
+
+void
+set_str_any(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = set_str_any(aTHX_ SP, obj,key,value);
+
+void
+add_value_str_any(SV * obj, SV * key, SV * delta, int insert = 1)
+    PPCODE:
+        SP = add_value_str_any(aTHX_ SP, obj,key,delta,insert);
+
+void
+incr_str_any(SV * obj, SV * key)
+    PPCODE:
+        SP = incr_str_any(aTHX_ SP, obj,key);
+
+void
+insert_many_str_any(SV * obj, SV * keys, SV * values = &PL_sv_undef)
+    PPCODE:
+        SP = insert_many_str_any(aTHX_ SP, obj,keys,values);
+
+void
+delete_str_any(SV * obj, SV * key)
+    PPCODE:
+        SP = delete_str_any(aTHX_ SP, obj,key);
+
+void
+delete_first_str_any(SV * obj, SV * key)
+    PPCODE:
+        SP = delete_first_str_any(aTHX_ SP, obj,key);
+
+void
+delete_last_str_any(SV * obj, SV * key)
+    PPCODE:
+        SP = delete_last_str_any(aTHX_ SP, obj,key);
+
+void
+take_first_str_any(SV * obj, SV * key)
+    PPCODE:
+        SP = take_first_str_any(aTHX_ SP, obj,key);
+
+void
+take_last_str_any(SV * obj, SV * key)
+    PPCODE:
+        SP = take_last_str_any(aTHX_ SP, obj,key);
+
+void
+delete_many_str_any(SV * obj, SV * keys)
+    PPCODE:
+        SP = delete_many_str_any(aTHX_ SP, obj,keys);
+
+void
+delete_many_first_str_any(SV * obj, SV * keys)
+    PPCODE:
+        SP = delete_many_first_str_any(aTHX_ SP, obj,keys);
+
+void
+delete_many_last_str_any(SV * obj, SV * keys)
+    PPCODE:
+        SP = delete_many_last_str_any(aTHX_ SP, obj,keys);
+
+void
+delete_gt_lt_str_any(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_gt_lt_str_any(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+delete_ge_lt_str_any(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_ge_lt_str_any(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+delete_gt_le_str_any(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_gt_le_str_any(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+delete_ge_le_str_any(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_ge_le_str_any(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+drain_le_str_any(SV * obj, SV * key, int limit = -1)
+    PPCODE:
+        SP = drain_le_str_any(aTHX_ SP, obj,key,limit);
+
+void
+drain_ge_str_any(SV * obj, SV * key, int limit = -1)
+    PPCODE:
+        SP = drain_ge_str_any(aTHX_ SP, obj,key,limit);
+
+
+void
+split_lt_str_any(SV * obj, SV * key)
+    PPCODE:
+        SP = split_lt_str_any(aTHX_ SP, obj,key);
+
+void
+split_le_str_any(SV * obj, SV * key)
+    PPCODE:
+        SP = split_le_str_any(aTHX_ SP, obj,key);
+
+void
+join_str_any(SV * obj, SV * other)
+    PPCODE:
+        SP = join_str_any(aTHX_ SP, obj,other);
+
+void
+union_str_any(SV * obj, SV * other)
+    PPCODE:
+        SP = union_str_any(aTHX_ SP, obj,other);
+
+void
+intersection_str_any(SV * obj, SV * other)
+    PPCODE:
+        SP = intersection_str_any(aTHX_ SP, obj,other);
+
+void
+difference_str_any(SV * obj, SV * other)
+    PPCODE:
+        SP = difference_str_any(aTHX_ SP, obj,other);
+
+
+void
+find_str_any(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_str_any(aTHX_ SP, obj,key,limit);
+
+void
+find_first_str_any(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_first_str_any(aTHX_ SP, obj,key,limit);
+
+void
+find_last_str_any(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_last_str_any(aTHX_ SP, obj,key,limit);
+
+void
+exists_str_any(SV * obj, SV * key)
+    PPCODE:
+        SP = exists_str_any(aTHX_ SP, obj,key);
+
+void
+get_many_str_any(SV * obj, SV * keys)
+    PPCODE:
+        SP = get_many_str_any(aTHX_ SP, obj,keys);
+
+void
+find_lt_str_any(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_lt_str_any(aTHX_ SP, obj,key,limit);
+
+void
+find_le_str_any(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_le_str_any(aTHX_ SP, obj,key,limit);
+
+void
+find_gt_str_any(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_gt_str_any(aTHX_ SP, obj,key,limit);
+
+void
+find_ge_str_any(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_ge_str_any(aTHX_ SP, obj,key,limit);
+
+
+void
+find_lt_many_str_any(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_lt_many_str_any(aTHX_ SP, obj,keys);
+
+void
+find_le_many_str_any(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_le_many_str_any(aTHX_ SP, obj,keys);
+
+void
+find_gt_many_str_any(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_gt_many_str_any(aTHX_ SP, obj,keys);
+
+void
+find_ge_many_str_any(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_ge_many_str_any(aTHX_ SP, obj,keys);
+
+
+void
+find_gt_lt_str_any(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_gt_lt_str_any(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+find_ge_lt_str_any(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_ge_lt_str_any(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+find_gt_le_str_any(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_gt_le_str_any(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+find_ge_le_str_any(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_ge_le_str_any(aTHX_ SP, obj,lower_key,upper_key);
+
+
+void
+count_lt_str_any(SV * obj, SV * key)
+    PPCODE:
+        SP = count_lt_str_any(aTHX_ SP, obj,key);
+
+void
+count_le_str_any(SV * obj, SV * key)
+    PPCODE:
+        SP = count_le_str_any(aTHX_ SP, obj,key);
+
+void
+count_gt_str_any(SV * obj, SV * key)
+    PPCODE:
+        SP = count_gt_str_any(aTHX_ SP, obj,key);
+
+void
+count_ge_str_any(SV * obj, SV * key)
+    PPCODE:
+        SP = count_ge_str_any(aTHX_ SP, obj,key);
+
+void
+count_eq_str_any(SV * obj, SV * key)
+    PPCODE:
+        SP = count_eq_str_any(aTHX_ SP, obj,key);
+
+void
+equal_range_str_any(SV * obj, SV * key)
+    PPCODE:
+        SP = equal_range_str_any(aTHX_ SP, obj,key);
+
+
+void
+count_lt_many_str_any(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_lt_many_str_any(aTHX_ SP, obj,keys);
+
+void
+count_le_many_str_any(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_le_many_str_any(aTHX_ SP, obj,keys);
+
+void
+count_gt_many_str_any(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_gt_many_str_any(aTHX_ SP, obj,keys);
+
+void
+count_ge_many_str_any(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_ge_many_str_any(aTHX_ SP, obj,keys);
+
+
+void
+apply_str_any(SV * obj, SV * ops)
+    PPCODE:
+        SP = apply_str_any(aTHX_ SP, obj,ops);
+
+
+void
+find_min_str_any(SV * obj, int limit = 1)
+    PPCODE:
+        SP = find_min_str_any(aTHX_ SP, obj,limit);
+
+void
+find_max_str_any(SV * obj, int limit = 1)
+    PPCODE:
+        SP = find_max_str_any(aTHX_ SP, obj,limit);
+
+
+void
+pop_min_str_any(SV * obj, int limit = 1)
+    PPCODE:
+        SP = pop_min_str_any(aTHX_ SP, obj,limit);
+
+void
+pop_max_str_any(SV * obj, int limit = 1)
+    PPCODE:
+        SP = pop_max_str_any(aTHX_ SP, obj,limit);
+
+
+void
+skip_l_str_any(SV * obj, int offset, int limit = 1)
+    PPCODE:
+        SP = skip_l_str_any(aTHX_ SP, obj,offset,limit);
+
+void
+skip_g_str_any(SV * obj, int offset, int limit = 1)
+    PPCODE:
+        SP = skip_g_str_any(aTHX_ SP, obj,offset,limit);
+
+void
+delete_at_str_any(SV * obj, int offset)
+    PPCODE:
+        SP = delete_at_str_any(aTHX_ SP, obj,offset);
+
+void
+delete_ranks_str_any(SV * obj, int from, int count = -1)
+    PPCODE:
+        SP = delete_ranks_str_any(aTHX_ SP, obj,from,count);
+
+
+void
+clear_str_any(SV * obj)
+    PPCODE:
+        SP = clear_str_any(aTHX_ SP, obj);
+
+void
+reserve_str_any(SV * obj, IV n)
+    PPCODE:
+        SP = reserve_str_any(aTHX_ SP, obj,n);
+
+void
+compact_str_any(SV * obj)
+    PPCODE:
+        SP = compact_str_any(aTHX_ SP, obj);
+
+
+void
+dump_str_any(SV *obj)
+    PPCODE:
+        SP = dump_str_any(aTHX_ SP, obj);
+
+void
+check_str_any(SV * obj)
+    PPCODE:
+        SP = check_str_any(aTHX_ SP, obj);
+
+
+void
+new_any_void(SV * class, SV * cmp = &PL_sv_undef)
+    PPCODE:
+        SP = new_any_void(aTHX_ SP, class,cmp);
+
+void
+new_from_sorted_any_void(SV * class, SV * keys, SV * values = &PL_sv_undef, SV * cmp = &PL_sv_undef)
+    PPCODE:
+        SP = new_from_sorted_any_void(aTHX_ SP, class,keys,values,cmp);
+
+void
+DESTROY_any_void(SV * obj)
+    PPCODE:
+        SP = DESTROY_any_void(aTHX_ SP, obj);
+
+
+void
+size_any_void(SV *obj)
+    PPCODE:
+        SP = size_any_void(aTHX_ SP, obj);
+
+void
+ever_height_any_void(SV *obj)
+    PPCODE:
+        SP = ever_height_any_void(aTHX_ SP, obj);
+
+void
+cmp_count_any_void(SV *obj)
+    PPCODE:
+        SP = cmp_count_any_void(aTHX_ SP, obj);
+
+void
+insert_any_void(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_any_void(aTHX_ SP, obj,key,value);
+
+void
+insert_before_any_void(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_before_any_void(aTHX_ SP, obj,key,value);
+
+void
+insert_after_any_void(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_after_any_void(aTHX_ SP, obj,key,value);
+
+void
+insert_unique_any_void(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_unique_any_void(aTHX_ SP, obj,key,value);
+
+void
+set_any_void(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = set_any_void(aTHX_ SP, obj,key,value);
+
+void
+add_value_any_void(SV * obj, SV * key, SV * delta, int insert = 1)
+    PPCODE:
+        SP = add_value_any_void(aTHX_ SP, obj,key,delta,insert);
+
+void
+incr_any_void(SV * obj, SV * key)
+    PPCODE:
+        SP = incr_any_void(aTHX_ SP, obj,key);
+
+void
+insert_many_any_void(SV * obj, SV * keys, SV * values = &PL_sv_undef)
+    PPCODE:
+        SP = insert_many_any_void(aTHX_ SP, obj,keys,values);
+
+void
+delete_any_void(SV * obj, SV * key)
+    PPCODE:
+        SP = delete_any_void(aTHX_ SP, obj,key);
+
+void
+delete_first_any_void(SV * obj, SV * key)
+    PPCODE:
+        SP = delete_first_any_void(aTHX_ SP, obj,key);
+
+void
+delete_last_any_void(SV * obj, SV * key)
+    PPCODE:
+        SP = delete_last_any_void(aTHX_ SP, obj,key);
+
+void
+take_first_any_void(SV * obj, SV * key)
+    PPCODE:
+        SP = take_first_any_void(aTHX_ SP, obj,key);
+
+void
+take_last_any_void(SV * obj, SV * key)
+    PPCODE:
+        SP = take_last_any_void(aTHX_ SP, obj,key);
+
+void
+delete_many_any_void(SV * obj, SV * keys)
+    PPCODE:
+        SP = delete_many_any_void(aTHX_ SP, obj,keys);
+
+void
+delete_many_first_any_void(SV * obj, SV * keys)
+    PPCODE:
+        SP = delete_many_first_any_void(aTHX_ SP, obj,keys);
+
+void
+delete_many_last_any_void(SV * obj, SV * keys)
+    PPCODE:
+        SP = delete_many_last_any_void(aTHX_ SP, obj,keys);
+
+void
+delete_gt_lt_any_void(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_gt_lt_any_void(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+delete_ge_lt_any_void(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_ge_lt_any_void(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+delete_gt_le_any_void(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_gt_le_any_void(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+delete_ge_le_any_void(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_ge_le_any_void(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+drain_le_any_void(SV * obj, SV * key, int limit = -1)
+    PPCODE:
+        SP = drain_le_any_void(aTHX_ SP, obj,key,limit);
+
+void
+drain_ge_any_void(SV * obj, SV * key, int limit = -1)
+    PPCODE:
+        SP = drain_ge_any_void(aTHX_ SP, obj,key,limit);
+
+
+void
+split_lt_any_void(SV * obj, SV * key)
+    PPCODE:
+        SP = split_lt_any_void(aTHX_ SP, obj,key);
+
+void
+split_le_any_void(SV * obj, SV * key)
+    PPCODE:
+        SP = split_le_any_void(aTHX_ SP, obj,key);
+
+void
+join_any_void(SV * obj, SV * other)
+    PPCODE:
+        SP = join_any_void(aTHX_ SP, obj,other);
+
+void
+union_any_void(SV * obj, SV * other)
+    PPCODE:
+        SP = union_any_void(aTHX_ SP, obj,other);
+
+void
+intersection_any_void(SV * obj, SV * other)
+    PPCODE:
+        SP = intersection_any_void(aTHX_ SP, obj,other);
+
+void
+difference_any_void(SV * obj, SV * other)
+    PPCODE:
+        SP = difference_any_void(aTHX_ SP, obj,other);
+
+
+void
+find_any_void(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_any_void(aTHX_ SP, obj,key,limit);
+
+void
+find_first_any_void(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_first_any_void(aTHX_ SP, obj,key,limit);
+
+void
+find_last_any_void(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_last_any_void(aTHX_ SP, obj,key,limit);
+
+void
+exists_any_void(SV * obj, SV * key)
+    PPCODE:
+        SP = exists_any_void(aTHX_ SP, obj,key);
+
+void
+get_many_any_void(SV * obj, SV * keys)
+    PPCODE:
+        SP = get_many_any_void(aTHX_ SP, obj,keys);
+
+void
+find_lt_any_void(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_lt_any_void(aTHX_ SP, obj,key,limit);
+
+void
+find_le_any_void(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_le_any_void(aTHX_ SP, obj,key,limit);
+
+void
+find_gt_any_void(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_gt_any_void(aTHX_ SP, obj,key,limit);
+
+void
+find_ge_any_void(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_ge_any_void(aTHX_ SP, obj,key,limit);
+
+
+void
+find_lt_many_any_void(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_lt_many_any_void(aTHX_ SP, obj,keys);
+
+void
+find_le_many_any_void(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_le_many_any_void(aTHX_ SP, obj,keys);
+
+void
+find_gt_many_any_void(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_gt_many_any_void(aTHX_ SP, obj,keys);
+
+void
+find_ge_many_any_void(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_ge_many_any_void(aTHX_ SP, obj,keys);
+
+
+void
+find_gt_lt_any_void(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_gt_lt_any_void(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+find_ge_lt_any_void(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_ge_lt_any_void(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+find_gt_le_any_void(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_gt_le_any_void(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+find_ge_le_any_void(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_ge_le_any_void(aTHX_ SP, obj,lower_key,upper_key);
+
+
+void
+count_lt_any_void(SV * obj, SV * key)
+    PPCODE:
+        SP = count_lt_any_void(aTHX_ SP, obj,key);
+
+void
+count_le_any_void(SV * obj, SV * key)
+    PPCODE:
+        SP = count_le_any_void(aTHX_ SP, obj,key);
+
+void
+count_gt_any_void(SV * obj, SV * key)
+    PPCODE:
+        SP = count_gt_any_void(aTHX_ SP, obj,key);
+
+void
+count_ge_any_void(SV * obj, SV * key)
+    PPCODE:
+        SP = count_ge_any_void(aTHX_ SP, obj,key);
+
+void
+count_eq_any_void(SV * obj, SV * key)
+    PPCODE:
+        SP = count_eq_any_void(aTHX_ SP, obj,key);
+
+void
+equal_range_any_void(SV * obj, SV * key)
+    PPCODE:
+        SP = equal_range_any_void(aTHX_ SP, obj,key);
+
+
+void
+count_lt_many_any_void(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_lt_many_any_void(aTHX_ SP, obj,keys);
+
+void
+count_le_many_any_void(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_le_many_any_void(aTHX_ SP, obj,keys);
+
+void
+count_gt_many_any_void(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_gt_many_any_void(aTHX_ SP, obj,keys);
+
+void
+count_ge_many_any_void(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_ge_many_any_void(aTHX_ SP, obj,keys);
+
+
+void
+apply_any_void(SV * obj, SV * ops)
+    PPCODE:
+        SP = apply_any_void(aTHX_ SP, obj,ops);
+
+
+void
+find_min_any_void(SV * obj, int limit = 1)
+    PPCODE:
+        SP = find_min_any_void(aTHX_ SP, obj,limit);
+
+void
+find_max_any_void(SV * obj, int limit = 1)
+    PPCODE:
+        SP = find_max_any_void(aTHX_ SP, obj,limit);
+
+
+void
+pop_min_any_void(SV * obj, int limit = 1)
+    PPCODE:
+        SP = pop_min_any_void(aTHX_ SP, obj,limit);
+
+void
+pop_max_any_void(SV * obj, int limit = 1)
+    PPCODE:
+        SP = pop_max_any_void(aTHX_ SP, obj,limit);
+
+
+void
+skip_l_any_void(SV * obj, int offset, int limit = 1)
+    PPCODE:
+        SP = skip_l_any_void(aTHX_ SP, obj,offset,limit);
+
+void
+skip_g_any_void(SV * obj, int offset, int limit = 1)
+    PPCODE:
+        SP = skip_g_any_void(aTHX_ SP, obj,offset,limit);
+
+void
+delete_at_any_void(SV * obj, int offset)
+    PPCODE:
+        SP = delete_at_any_void(aTHX_ SP, obj,offset);
+
+void
+delete_ranks_any_void(SV * obj, int from, int count = -1)
+    PPCODE:
+        SP = delete_ranks_any_void(aTHX_ SP, obj,from,count);
+
+
+void
+clear_any_void(SV * obj)
+    PPCODE:
+        SP = clear_any_void(aTHX_ SP, obj);
+
+void
+reserve_any_void(SV * obj, IV n)
+    PPCODE:
+        SP = reserve_any_void(aTHX_ SP, obj,n);
+
+void
+compact_any_void(SV * obj)
+    PPCODE:
+        SP = compact_any_void(aTHX_ SP, obj);
+
+
+void
+dump_any_void(SV *obj)
+    PPCODE:
+        SP = dump_any_void(aTHX_ SP, obj);
+
+void
+check_any_void(SV * obj)
+    PPCODE:
+        SP = check_any_void(aTHX_ SP, obj);
+
+
+void
+new_any_int(SV * class, SV * cmp = &PL_sv_undef)
+    PPCODE:
+        SP = new_any_int(aTHX_ SP, class,cmp);
+
+void
+new_from_sorted_any_int(SV * class, SV * keys, SV * values = &PL_sv_undef, SV * cmp = &PL_sv_undef)
+    PPCODE:
+        SP = new_from_sorted_any_int(aTHX_ SP, class,keys,values,cmp);
+
+void
+DESTROY_any_int(SV * obj)
+    PPCODE:
+        SP = DESTROY_any_int(aTHX_ SP, obj);
+
+
+void
+size_any_int(SV *obj)
+    PPCODE:
+        SP = size_any_int(aTHX_ SP, obj);
+
+void
+ever_height_any_int(SV *obj)
+    PPCODE:
+        SP = ever_height_any_int(aTHX_ SP, obj);
+
+void
+cmp_count_any_int(SV *obj)
+    PPCODE:
+        SP = cmp_count_any_int(aTHX_ SP, obj);
+
+void
+insert_any_int(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_any_int(aTHX_ SP, obj,key,value);
+
+void
+insert_before_any_int(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_before_any_int(aTHX_ SP, obj,key,value);
+
+void
+insert_after_any_int(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_after_any_int(aTHX_ SP, obj,key,value);
+
+void
+insert_unique_any_int(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_unique_any_int(aTHX_ SP, obj,key,value);
+
+void
+set_any_int(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = set_any_int(aTHX_ SP, obj,key,value);
+
+void
+add_value_any_int(SV * obj, SV * key, SV * delta, int insert = 1)
+    PPCODE:
+        SP = add_value_any_int(aTHX_ SP, obj,key,delta,insert);
+
+void
+incr_any_int(SV * obj, SV * key)
+    PPCODE:
+        SP = incr_any_int(aTHX_ SP, obj,key);
+
+void
+insert_many_any_int(SV * obj, SV * keys, SV * values = &PL_sv_undef)
+    PPCODE:
+        SP = insert_many_any_int(aTHX_ SP, obj,keys,values);
+
+void
+delete_any_int(SV * obj, SV * key)
+    PPCODE:
+        SP = delete_any_int(aTHX_ SP, obj,key);
+
+void
+delete_first_any_int(SV * obj, SV * key)
+    PPCODE:
+        SP = delete_first_any_int(aTHX_ SP, obj,key);
+
+void
+delete_last_any_int(SV * obj, SV * key)
+    PPCODE:
+        SP = delete_last_any_int(aTHX_ SP, obj,key);
+
+void
+take_first_any_int(SV * obj, SV * key)
+    PPCODE:
+        SP = take_first_any_int(aTHX_ SP, obj,key);
+
+void
+take_last_any_int(SV * obj, SV * key)
+    PPCODE:
+        SP = take_last_any_int(aTHX_ SP, obj,key);
+
+void
+delete_many_any_int(SV * obj, SV * keys)
+    PPCODE:
+        SP = delete_many_any_int(aTHX_ SP, obj,keys);
+
+void
+delete_many_first_any_int(SV * obj, SV * keys)
+    PPCODE:
+        SP = delete_many_first_any_int(aTHX_ SP, obj,keys);
+
+void
+delete_many_last_any_int(SV * obj, SV * keys)
+    PPCODE:
+        SP = delete_many_last_any_int(aTHX_ SP, obj,keys);
+
+void
+delete_gt_lt_any_int(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_gt_lt_any_int(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+delete_ge_lt_any_int(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_ge_lt_any_int(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+delete_gt_le_any_int(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_gt_le_any_int(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+delete_ge_le_any_int(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_ge_le_any_int(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+drain_le_any_int(SV * obj, SV * key, int limit = -1)
+    PPCODE:
+        SP = drain_le_any_int(aTHX_ SP, obj,key,limit);
+
+void
+drain_ge_any_int(SV * obj, SV * key, int limit = -1)
+    PPCODE:
+        SP = drain_ge_any_int(aTHX_ SP, obj,key,limit);
+
+
+void
+split_lt_any_int(SV * obj, SV * key)
+    PPCODE:
+        SP = split_lt_any_int(aTHX_ SP, obj,key);
+
+void
+split_le_any_int(SV * obj, SV * key)
+    PPCODE:
+        SP = split_le_any_int(aTHX_ SP, obj,key);
+
+void
+join_any_int(SV * obj, SV * other)
+    PPCODE:
+        SP = join_any_int(aTHX_ SP, obj,other);
+
+void
+union_any_int(SV * obj, SV * other)
+    PPCODE:
+        SP = union_any_int(aTHX_ SP, obj,other);
+
+void
+intersection_any_int(SV * obj, SV * other)
+    PPCODE:
+        SP = intersection_any_int(aTHX_ SP, obj,other);
+
+void
+difference_any_int(SV * obj, SV * other)
+    PPCODE:
+        SP = difference_any_int(aTHX_ SP, obj,other);
+
+
+void
+find_any_int(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_any_int(aTHX_ SP, obj,key,limit);
+
+void
+find_first_any_int(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_first_any_int(aTHX_ SP, obj,key,limit);
+
+void
+find_last_any_int(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_last_any_int(aTHX_ SP, obj,key,limit);
+
+void
+exists_any_int(SV * obj, SV * key)
+    PPCODE:
+        SP = exists_any_int(aTHX_ SP, obj,key);
+
+void
+get_many_any_int(SV * obj, SV * keys)
+    PPCODE:
+        SP = get_many_any_int(aTHX_ SP, obj,keys);
+
+void
+find_lt_any_int(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_lt_any_int(aTHX_ SP, obj,key,limit);
+
+void
+find_le_any_int(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_le_any_int(aTHX_ SP, obj,key,limit);
+
+void
+find_gt_any_int(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_gt_any_int(aTHX_ SP, obj,key,limit);
+
+void
+find_ge_any_int(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_ge_any_int(aTHX_ SP, obj,key,limit);
+
+
+void
+find_lt_many_any_int(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_lt_many_any_int(aTHX_ SP, obj,keys);
+
+void
+find_le_many_any_int(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_le_many_any_int(aTHX_ SP, obj,keys);
+
+void
+find_gt_many_any_int(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_gt_many_any_int(aTHX_ SP, obj,keys);
+
+void
+find_ge_many_any_int(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_ge_many_any_int(aTHX_ SP, obj,keys);
+
+
+void
+find_gt_lt_any_int(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_gt_lt_any_int(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+find_ge_lt_any_int(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_ge_lt_any_int(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+find_gt_le_any_int(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_gt_le_any_int(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+find_ge_le_any_int(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_ge_le_any_int(aTHX_ SP, obj,lower_key,upper_key);
+
+
+void
+count_lt_any_int(SV * obj, SV * key)
+    PPCODE:
+        SP = count_lt_any_int(aTHX_ SP, obj,key);
+
+void
+count_le_any_int(SV * obj, SV * key)
+    PPCODE:
+        SP = count_le_any_int(aTHX_ SP, obj,key);
+
+void
+count_gt_any_int(SV * obj, SV * key)
+    PPCODE:
+        SP = count_gt_any_int(aTHX_ SP, obj,key);
+
+void
+count_ge_any_int(SV * obj, SV * key)
+    PPCODE:
+        SP = count_ge_any_int(aTHX_ SP, obj,key);
+
+void
+count_eq_any_int(SV * obj, SV * key)
+    PPCODE:
+        SP = count_eq_any_int(aTHX_ SP, obj,key);
+
+void
+equal_range_any_int(SV * obj, SV * key)
+    PPCODE:
+        SP = equal_range_any_int(aTHX_ SP, obj,key);
+
+
+void
+count_lt_many_any_int(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_lt_many_any_int(aTHX_ SP, obj,keys);
+
+void
+count_le_many_any_int(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_le_many_any_int(aTHX_ SP, obj,keys);
+
+void
+count_gt_many_any_int(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_gt_many_any_int(aTHX_ SP, obj,keys);
+
+void
+count_ge_many_any_int(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_ge_many_any_int(aTHX_ SP, obj,keys);
+
+
+void
+apply_any_int(SV * obj, SV * ops)
+    PPCODE:
+        SP = apply_any_int(aTHX_ SP, obj,ops);
+
+
+void
+find_min_any_int(SV * obj, int limit = 1)
+    PPCODE:
+        SP = find_min_any_int(aTHX_ SP, obj,limit);
+
+void
+find_max_any_int(SV * obj, int limit = 1)
+    PPCODE:
+        SP = find_max_any_int(aTHX_ SP, obj,limit);
+
+
+void
+pop_min_any_int(SV * obj, int limit = 1)
+    PPCODE:
+        SP = pop_min_any_int(aTHX_ SP, obj,limit);
+
+void
+pop_max_any_int(SV * obj, int limit = 1)
+    PPCODE:
+        SP = pop_max_any_int(aTHX_ SP, obj,limit);
+
+
+void
+skip_l_any_int(SV * obj, int offset, int limit = 1)
+    PPCODE:
+        SP = skip_l_any_int(aTHX_ SP, obj,offset,limit);
+
+void
+skip_g_any_int(SV * obj, int offset, int limit = 1)
+    PPCODE:
+        SP = skip_g_any_int(aTHX_ SP, obj,offset,limit);
+
+void
+delete_at_any_int(SV * obj, int offset)
+    PPCODE:
+        SP = delete_at_any_int(aTHX_ SP, obj,offset);
+
+void
+delete_ranks_any_int(SV * obj, int from, int count = -1)
+    PPCODE:
+        SP = delete_ranks_any_int(aTHX_ SP, obj,from,count);
+
+
+void
+clear_any_int(SV * obj)
+    PPCODE:
+        SP = clear_any_int(aTHX_ SP, obj);
+
+void
+reserve_any_int(SV * obj, IV n)
+    PPCODE:
+        SP = reserve_any_int(aTHX_ SP, obj,n);
+
+void
+compact_any_int(SV * obj)
+    PPCODE:
+        SP = compact_any_int(aTHX_ SP, obj);
+
+
+void
+dump_any_int(SV *obj)
+    PPCODE:
+        SP = dump_any_int(aTHX_ SP, obj);
+
+void
+check_any_int(SV * obj)
+    PPCODE:
+        SP = check_any_int(aTHX_ SP, obj);
+
+
+void
+new_any_num(SV * class, SV * cmp = &PL_sv_undef)
+    PPCODE:
+        SP = new_any_num(aTHX_ SP, class,cmp);
+
+void
+new_from_sorted_any_num(SV * class, SV * keys, SV * values = &PL_sv_undef, SV * cmp = &PL_sv_undef)
+    PPCODE:
+        SP = new_from_sorted_any_num(aTHX_ SP, class,keys,values,cmp);
+
+void
+DESTROY_any_num(SV * obj)
+    PPCODE:
+        SP = DESTROY_any_num(aTHX_ SP, obj);
+
+
+void
+size_any_num(SV *obj)
+    PPCODE:
+        SP = size_any_num(aTHX_ SP, obj);
+
+void
+ever_height_any_num(SV *obj)
+    PPCODE:
+        SP = ever_height_any_num(aTHX_ SP, obj);
+
+void
+cmp_count_any_num(SV *obj)
+    PPCODE:
+        SP = cmp_count_any_num(aTHX_ SP, obj);
+
+void
+insert_any_num(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_any_num(aTHX_ SP, obj,key,value);
+
+void
+insert_before_any_num(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_before_any_num(aTHX_ SP, obj,key,value);
+
+void
+insert_after_any_num(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_after_any_num(aTHX_ SP, obj,key,value);
+
+void
+insert_unique_any_num(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_unique_any_num(aTHX_ SP, obj,key,value);
+
+void
+set_any_num(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = set_any_num(aTHX_ SP, obj,key,value);
+
+void
+add_value_any_num(SV * obj, SV * key, SV * delta, int insert = 1)
+    PPCODE:
+        SP = add_value_any_num(aTHX_ SP, obj,key,delta,insert);
+
+void
+incr_any_num(SV * obj, SV * key)
+    PPCODE:
+        SP = incr_any_num(aTHX_ SP, obj,key);
+
+void
+insert_many_any_num(SV * obj, SV * keys, SV * values = &PL_sv_undef)
+    PPCODE:
+        SP = insert_many_any_num(aTHX_ SP, obj,keys,values);
+
+void
+delete_any_num(SV * obj, SV * key)
+    PPCODE:
+        SP = delete_any_num(aTHX_ SP, obj,key);
+
+void
+delete_first_any_num(SV * obj, SV * key)
+    PPCODE:
+        SP = delete_first_any_num(aTHX_ SP, obj,key);
+
+void
+delete_last_any_num(SV * obj, SV * key)
+    PPCODE:
+        SP = delete_last_any_num(aTHX_ SP, obj,key);
+
+void
+take_first_any_num(SV * obj, SV * key)
+    PPCODE:
+        SP = take_first_any_num(aTHX_ SP, obj,key);
+
+void
+take_last_any_num(SV * obj, SV * key)
+    PPCODE:
+        SP = take_last_any_num(aTHX_ SP, obj,key);
+
+void
+delete_many_any_num(SV * obj, SV * keys)
+    PPCODE:
+        SP = delete_many_any_num(aTHX_ SP, obj,keys);
+
+void
+delete_many_first_any_num(SV * obj, SV * keys)
+    PPCODE:
+        SP = delete_many_first_any_num(aTHX_ SP, obj,keys);
+
+void
+delete_many_last_any_num(SV * obj, SV * keys)
+    PPCODE:
+        SP = delete_many_last_any_num(aTHX_ SP, obj,keys);
+
+void
+delete_gt_lt_any_num(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_gt_lt_any_num(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+delete_ge_lt_any_num(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_ge_lt_any_num(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+delete_gt_le_any_num(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_gt_le_any_num(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+delete_ge_le_any_num(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_ge_le_any_num(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+drain_le_any_num(SV * obj, SV * key, int limit = -1)
+    PPCODE:
+        SP = drain_le_any_num(aTHX_ SP, obj,key,limit);
+
+void
+drain_ge_any_num(SV * obj, SV * key, int limit = -1)
+    PPCODE:
+        SP = drain_ge_any_num(aTHX_ SP, obj,key,limit);
+
+
+void
+split_lt_any_num(SV * obj, SV * key)
+    PPCODE:
+        SP = split_lt_any_num(aTHX_ SP, obj,key);
+
+void
+split_le_any_num(SV * obj, SV * key)
+    PPCODE:
+        SP = split_le_any_num(aTHX_ SP, obj,key);
+
+void
+join_any_num(SV * obj, SV * other)
+    PPCODE:
+        SP = join_any_num(aTHX_ SP, obj,other);
+
+void
+union_any_num(SV * obj, SV * other)
+    PPCODE:
+        SP = union_any_num(aTHX_ SP, obj,other);
+
+void
+intersection_any_num(SV * obj, SV * other)
+    PPCODE:
+        SP = intersection_any_num(aTHX_ SP, obj,other);
+
+void
+difference_any_num(SV * obj, SV * other)
+    PPCODE:
+        SP = difference_any_num(aTHX_ SP, obj,other);
+
+
+void
+find_any_num(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_any_num(aTHX_ SP, obj,key,limit);
+
+void
+find_first_any_num(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_first_any_num(aTHX_ SP, obj,key,limit);
+
+void
+find_last_any_num(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_last_any_num(aTHX_ SP, obj,key,limit);
+
+void
+exists_any_num(SV * obj, SV * key)
+    PPCODE:
+        SP = exists_any_num(aTHX_ SP, obj,key);
+
+void
+get_many_any_num(SV * obj, SV * keys)
+    PPCODE:
+        SP = get_many_any_num(aTHX_ SP, obj,keys);
+
+void
+find_lt_any_num(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_lt_any_num(aTHX_ SP, obj,key,limit);
+
+void
+find_le_any_num(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_le_any_num(aTHX_ SP, obj,key,limit);
+
+void
+find_gt_any_num(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_gt_any_num(aTHX_ SP, obj,key,limit);
+
+void
+find_ge_any_num(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_ge_any_num(aTHX_ SP, obj,key,limit);
+
+
+void
+find_lt_many_any_num(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_lt_many_any_num(aTHX_ SP, obj,keys);
+
+void
+find_le_many_any_num(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_le_many_any_num(aTHX_ SP, obj,keys);
+
+void
+find_gt_many_any_num(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_gt_many_any_num(aTHX_ SP, obj,keys);
+
+void
+find_ge_many_any_num(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_ge_many_any_num(aTHX_ SP, obj,keys);
+
+
+void
+find_gt_lt_any_num(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_gt_lt_any_num(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+find_ge_lt_any_num(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_ge_lt_any_num(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+find_gt_le_any_num(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_gt_le_any_num(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+find_ge_le_any_num(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_ge_le_any_num(aTHX_ SP, obj,lower_key,upper_key);
+
+
+void
+count_lt_any_num(SV * obj, SV * key)
+    PPCODE:
+        SP = count_lt_any_num(aTHX_ SP, obj,key);
+
+void
+count_le_any_num(SV * obj, SV * key)
+    PPCODE:
+        SP = count_le_any_num(aTHX_ SP, obj,key);
+
+void
+count_gt_any_num(SV * obj, SV * key)
+    PPCODE:
+        SP = count_gt_any_num(aTHX_ SP, obj,key);
+
+void
+count_ge_any_num(SV * obj, SV * key)
+    PPCODE:
+        SP = count_ge_any_num(aTHX_ SP, obj,key);
+
+void
+count_eq_any_num(SV * obj, SV * key)
+    PPCODE:
+        SP = count_eq_any_num(aTHX_ SP, obj,key);
+
+void
+equal_range_any_num(SV * obj, SV * key)
+    PPCODE:
+        SP = equal_range_any_num(aTHX_ SP, obj,key);
+
+
+void
+count_lt_many_any_num(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_lt_many_any_num(aTHX_ SP, obj,keys);
+
+void
+count_le_many_any_num(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_le_many_any_num(aTHX_ SP, obj,keys);
+
+void
+count_gt_many_any_num(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_gt_many_any_num(aTHX_ SP, obj,keys);
+
+void
+count_ge_many_any_num(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_ge_many_any_num(aTHX_ SP, obj,keys);
+
+
+void
+apply_any_num(SV * obj, SV * ops)
+    PPCODE:
+        SP = apply_any_num(aTHX_ SP, obj,ops);
+
+
+void
+find_min_any_num(SV * obj, int limit = 1)
+    PPCODE:
+        SP = find_min_any_num(aTHX_ SP, obj,limit);
+
+void
+find_max_any_num(SV * obj, int limit = 1)
+    PPCODE:
+        SP = find_max_any_num(aTHX_ SP, obj,limit);
+
+
+void
+pop_min_any_num(SV * obj, int limit = 1)
+    PPCODE:
+        SP = pop_min_any_num(aTHX_ SP, obj,limit);
+
+void
+pop_max_any_num(SV * obj, int limit = 1)
+    PPCODE:
+        SP = pop_max_any_num(aTHX_ SP, obj,limit);
+
+
+void
+skip_l_any_num(SV * obj, int offset, int limit = 1)
+    PPCODE:
+        SP = skip_l_any_num(aTHX_ SP, obj,offset,limit);
+
+void
+skip_g_any_num(SV * obj, int offset, int limit = 1)
+    PPCODE:
+        SP = skip_g_any_num(aTHX_ SP, obj,offset,limit);
+
+void
+delete_at_any_num(SV * obj, int offset)
+    PPCODE:
+        SP = delete_at_any_num(aTHX_ SP, obj,offset);
+
+void
+delete_ranks_any_num(SV * obj, int from, int count = -1)
+    PPCODE:
+        SP = delete_ranks_any_num(aTHX_ SP, obj,from,count);
+
+
+void
+clear_any_num(SV * obj)
+    PPCODE:
+        SP = clear_any_num(aTHX_ SP, obj);
+
+void
+reserve_any_num(SV * obj, IV n)
+    PPCODE:
+        SP = reserve_any_num(aTHX_ SP, obj,n);
+
+void
+compact_any_num(SV * obj)
+    PPCODE:
+        SP = compact_any_num(aTHX_ SP, obj);
+
+
+void
+dump_any_num(SV *obj)
+    PPCODE:
+        SP = dump_any_num(aTHX_ SP, obj);
+
+void
+check_any_num(SV * obj)
+    PPCODE:
+        SP = check_any_num(aTHX_ SP, obj);
+
+
+void
+new_any_any(SV * class, SV * cmp = &PL_sv_undef)
+    PPCODE:
+        SP = new_any_any(aTHX_ SP, class,cmp);
+
+void
+new_from_sorted_any_any(SV * class, SV * keys, SV * values = &PL_sv_undef, SV * cmp = &PL_sv_undef)
+    PPCODE:
+        SP = new_from_sorted_any_any(aTHX_ SP, class,keys,values,cmp);
+
+void
+DESTROY_any_any(SV * obj)
+    PPCODE:
+        SP = DESTROY_any_any(aTHX_ SP, obj);
+
+
+void
+size_any_any(SV *obj)
+    PPCODE:
+        SP = size_any_any(aTHX_ SP, obj);
+
+void
+ever_height_any_any(SV *obj)
+    PPCODE:
+        SP = ever_height_any_any(aTHX_ SP, obj);
+
+void
+cmp_count_any_any(SV *obj)
+    PPCODE:
+        SP = cmp_count_any_any(aTHX_ SP, obj);
+
+void
+insert_any_any(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_any_any(aTHX_ SP, obj,key,value);
+
+void
+insert_before_any_any(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_before_any_any(aTHX_ SP, obj,key,value);
+
+void
+insert_after_any_any(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_after_any_any(aTHX_ SP, obj,key,value);
+
+void
+insert_unique_any_any(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = insert_unique_any_any(aTHX_ SP, obj,key,value);
+
+void
+set_any_any(SV * obj, SV * key, SV * value = &PL_sv_undef)
+    PPCODE:
+        SP = set_any_any(aTHX_ SP, obj,key,value);
+
+void
+add_value_any_any(SV * obj, SV * key, SV * delta, int insert = 1)
+    PPCODE:
+        SP = add_value_any_any(aTHX_ SP, obj,key,delta,insert);
+
+void
+incr_any_any(SV * obj, SV * key)
+    PPCODE:
+        SP = incr_any_any(aTHX_ SP, obj,key);
+
+void
+insert_many_any_any(SV * obj, SV * keys, SV * values = &PL_sv_undef)
+    PPCODE:
+        SP = insert_many_any_any(aTHX_ SP, obj,keys,values);
+
+void
+delete_any_any(SV * obj, SV * key)
+    PPCODE:
+        SP = delete_any_any(aTHX_ SP, obj,key);
+
+void
+delete_first_any_any(SV * obj, SV * key)
+    PPCODE:
+        SP = delete_first_any_any(aTHX_ SP, obj,key);
+
+void
+delete_last_any_any(SV * obj, SV * key)
+    PPCODE:
+        SP = delete_last_any_any(aTHX_ SP, obj,key);
+
+void
+take_first_any_any(SV * obj, SV * key)
+    PPCODE:
+        SP = take_first_any_any(aTHX_ SP, obj,key);
+
+void
+take_last_any_any(SV * obj, SV * key)
+    PPCODE:
+        SP = take_last_any_any(aTHX_ SP, obj,key);
+
+void
+delete_many_any_any(SV * obj, SV * keys)
+    PPCODE:
+        SP = delete_many_any_any(aTHX_ SP, obj,keys);
+
+void
+delete_many_first_any_any(SV * obj, SV * keys)
+    PPCODE:
+        SP = delete_many_first_any_any(aTHX_ SP, obj,keys);
+
+void
+delete_many_last_any_any(SV * obj, SV * keys)
+    PPCODE:
+        SP = delete_many_last_any_any(aTHX_ SP, obj,keys);
+
+void
+delete_gt_lt_any_any(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_gt_lt_any_any(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+delete_ge_lt_any_any(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_ge_lt_any_any(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+delete_gt_le_any_any(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_gt_le_any_any(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+delete_ge_le_any_any(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = delete_ge_le_any_any(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+drain_le_any_any(SV * obj, SV * key, int limit = -1)
+    PPCODE:
+        SP = drain_le_any_any(aTHX_ SP, obj,key,limit);
+
+void
+drain_ge_any_any(SV * obj, SV * key, int limit = -1)
+    PPCODE:
+        SP = drain_ge_any_any(aTHX_ SP, obj,key,limit);
+
+
+void
+split_lt_any_any(SV * obj, SV * key)
+    PPCODE:
+        SP = split_lt_any_any(aTHX_ SP, obj,key);
+
+void
+split_le_any_any(SV * obj, SV * key)
+    PPCODE:
+        SP = split_le_any_any(aTHX_ SP, obj,key);
+
+void
+join_any_any(SV * obj, SV * other)
+    PPCODE:
+        SP = join_any_any(aTHX_ SP, obj,other);
+
+void
+union_any_any(SV * obj, SV * other)
+    PPCODE:
+        SP = union_any_any(aTHX_ SP, obj,other);
+
+void
+intersection_any_any(SV * obj, SV * other)
+    PPCODE:
+        SP = intersection_any_any(aTHX_ SP, obj,other);
+
+void
+difference_any_any(SV * obj, SV * other)
+    PPCODE:
+        SP = difference_any_any(aTHX_ SP, obj,other);
+
+
+void
+find_any_any(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_any_any(aTHX_ SP, obj,key,limit);
+
+void
+find_first_any_any(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_first_any_any(aTHX_ SP, obj,key,limit);
+
+void
+find_last_any_any(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_last_any_any(aTHX_ SP, obj,key,limit);
+
+void
+exists_any_any(SV * obj, SV * key)
+    PPCODE:
+        SP = exists_any_any(aTHX_ SP, obj,key);
+
+void
+get_many_any_any(SV * obj, SV * keys)
+    PPCODE:
+        SP = get_many_any_any(aTHX_ SP, obj,keys);
+
+void
+find_lt_any_any(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_lt_any_any(aTHX_ SP, obj,key,limit);
+
+void
+find_le_any_any(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_le_any_any(aTHX_ SP, obj,key,limit);
+
+void
+find_gt_any_any(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_gt_any_any(aTHX_ SP, obj,key,limit);
+
+void
+find_ge_any_any(SV * obj, SV * key, int limit = 1)
+    PPCODE:
+        SP = find_ge_any_any(aTHX_ SP, obj,key,limit);
+
+
+void
+find_lt_many_any_any(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_lt_many_any_any(aTHX_ SP, obj,keys);
+
+void
+find_le_many_any_any(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_le_many_any_any(aTHX_ SP, obj,keys);
+
+void
+find_gt_many_any_any(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_gt_many_any_any(aTHX_ SP, obj,keys);
+
+void
+find_ge_many_any_any(SV * obj, SV * keys)
+    PPCODE:
+        SP = find_ge_many_any_any(aTHX_ SP, obj,keys);
+
+
+void
+find_gt_lt_any_any(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_gt_lt_any_any(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+find_ge_lt_any_any(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_ge_lt_any_any(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+find_gt_le_any_any(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_gt_le_any_any(aTHX_ SP, obj,lower_key,upper_key);
+
+void
+find_ge_le_any_any(SV * obj, SV * lower_key, SV * upper_key)
+    PPCODE:
+        SP = find_ge_le_any_any(aTHX_ SP, obj,lower_key,upper_key);
+
+
+void
+count_lt_any_any(SV * obj, SV * key)
+    PPCODE:
+        SP = count_lt_any_any(aTHX_ SP, obj,key);
+
+void
+count_le_any_any(SV * obj, SV * key)
+    PPCODE:
+        SP = count_le_any_any(aTHX_ SP, obj,key);
+
+void
+count_gt_any_any(SV * obj, SV * key)
+    PPCODE:
+        SP = count_gt_any_any(aTHX_ SP, obj,key);
+
+void
+count_ge_any_any(SV * obj, SV * key)
+    PPCODE:
+        SP = count_ge_any_any(aTHX_ SP, obj,key);
+
+void
+count_eq_any_any(SV * obj, SV * key)
+    PPCODE:
+        SP = count_eq_any_any(aTHX_ SP, obj,key);
+
+void
+equal_range_any_any(SV * obj, SV * key)
+    PPCODE:
+        SP = equal_range_any_any(aTHX_ SP, obj,key);
+
+
+void
+count_lt_many_any_any(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_lt_many_any_any(aTHX_ SP, obj,keys);
+
+void
+count_le_many_any_any(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_le_many_any_any(aTHX_ SP, obj,keys);
+
+void
+count_gt_many_any_any(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_gt_many_any_any(aTHX_ SP, obj,keys);
+
+void
+count_ge_many_any_any(SV * obj, SV * keys)
+    PPCODE:
+        SP = count_ge_many_any_any(aTHX_ SP, obj,keys);
+
+
+void
+apply_any_any(SV * obj, SV * ops)
+    PPCODE:
+        SP = apply_any_any(aTHX_ SP, obj,ops);
+
+
+void
+find_min_any_any(SV * obj, int limit = 1)
+    PPCODE:
+        SP = find_min_any_any(aTHX_ SP, obj,limit);
+
+void
+find_max_any_any(SV * obj, int limit = 1)
+    PPCODE:
+        SP = find_max_any_any(aTHX_ SP, obj,limit);
+
+
+void
+pop_min_any_any(SV * obj, int limit = 1)
+    PPCODE:
+        SP = pop_min_any_any(aTHX_ SP, obj,limit);
+
+void
+pop_max_any_any(SV * obj, int limit = 1)
+    PPCODE:
+        SP = pop_max_any_any(aTHX_ SP, obj,limit);
+
+
+void
+skip_l_any_any(SV * obj, int offset, int limit = 1)
+    PPCODE:
+        SP = skip_l_any_any(aTHX_ SP, obj,offset,limit);
+
+void
+skip_g_any_any(SV * obj, int offset, int limit = 1)
+    PPCODE:
+        SP = skip_g_any_any(aTHX_ SP, obj,offset,limit);
+
+void
+delete_at_any_any(SV * obj, int offset)
+    PPCODE:
+        SP = delete_at_any_any(aTHX_ SP, obj,offset);
+
+void
+delete_ranks_any_any(SV * obj, int from, int count = -1)
+    PPCODE:
+        SP = delete_ranks_any_any(aTHX_ SP, obj,from,count);
+
+
+void
+clear_any_any(SV * obj)
+    PPCODE:
+        SP = clear_any_any(aTHX_ SP, obj);
+
+void
+reserve_any_any(SV * obj, IV n)
+    PPCODE:
+        SP = reserve_any_any(aTHX_ SP, obj,n);
+
+void
+compact_any_any(SV * obj)
+    PPCODE:
+        SP = compact_any_any(aTHX_ SP, obj);
+
+
+void
+dump_any_any(SV *obj)
+    PPCODE:
+        SP = dump_any_any(aTHX_ SP, obj);
+
+void
+check_any_any(SV * obj)
+    PPCODE:
+        SP = check_any_any(aTHX_ SP, obj);
+
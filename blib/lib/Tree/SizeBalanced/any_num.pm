@@ -0,0 +1,84 @@
+package Tree::SizeBalanced::any_num;
+
+use strict;
+use warnings;
+
+use Tree::SizeBalanced;
+
+*new = \&Tree::SizeBalanced::Core::new_any_num;
+*new_from_sorted = \&Tree::SizeBalanced::Core::new_from_sorted_any_num;
+*DESTROY = \&Tree::SizeBalanced::Core::DESTROY_any_num;
+*size = \&Tree::SizeBalanced::Core::size_any_num;
+*ever_height = \&Tree::SizeBalanced::Core::ever_height_any_num;
+*cmp_count = \&Tree::SizeBalanced::Core::cmp_count_any_num;
+*insert = \&Tree::SizeBalanced::Core::insert_any_num;
+*insert_before = \&Tree::SizeBalanced::Core::insert_before_any_num;
+*insert_after = \&Tree::SizeBalanced::Core::insert_after_any_num;
+*insert_unique = \&Tree::SizeBalanced::Core::insert_unique_any_num;
+*set = \&Tree::SizeBalanced::Core::set_any_num;
+*add_value = \&Tree::SizeBalanced::Core::add_value_any_num;
+*incr = \&Tree::SizeBalanced::Core::incr_any_num;
+*insert_many = \&Tree::SizeBalanced::Core::insert_many_any_num;
+*delete = \&Tree::SizeBalanced::Core::delete_any_num;
+*delete_first = \&Tree::SizeBalanced::Core::delete_first_any_num;
+*delete_last = \&Tree::SizeBalanced::Core::delete_last_any_num;
+*take_first = \&Tree::SizeBalanced::Core::take_first_any_num;
+*take_last = \&Tree::SizeBalanced::Core::take_last_any_num;
+*delete_many = \&Tree::SizeBalanced::Core::delete_many_any_num;
+*delete_many_first = \&Tree::SizeBalanced::Core::delete_many_first_any_num;
+*delete_many_last = \&Tree::SizeBalanced::Core::delete_many_last_any_num;
+*delete_gt_lt = \&Tree::SizeBalanced::Core::delete_gt_lt_any_num;
+*delete_ge_lt = \&Tree::SizeBalanced::Core::delete_ge_lt_any_num;
+*delete_gt_le = \&Tree::SizeBalanced::Core::delete_gt_le_any_num;
+*delete_ge_le = \&Tree::SizeBalanced::Core::delete_ge_le_any_num;
+*drain_le = \&Tree::SizeBalanced::Core::drain_le_any_num;
+*drain_ge = \&Tree::SizeBalanced::Core::drain_ge_any_num;
+*split_lt = \&Tree::SizeBalanced::Core::split_lt_any_num;
+*split_le = \&Tree::SizeBalanced::Core::split_le_any_num;
+*join = \&Tree::SizeBalanced::Core::join_any_num;
+*union = \&Tree::SizeBalanced::Core::union_any_num;
+*intersection = \&Tree::SizeBalanced::Core::intersection_any_num;
+*difference = \&Tree::SizeBalanced::Core::difference_any_num;
+*find = \&Tree::SizeBalanced::Core::find_any_num;
+*find_first = \&Tree::SizeBalanced::Core::find_first_any_num;
+*find_last = \&Tree::SizeBalanced::Core::find_last_any_num;
+*exists = \&Tree::SizeBalanced::Core::exists_any_num;
+*get_many = \&Tree::SizeBalanced::Core::get_many_any_num;
+*find_lt = \&Tree::SizeBalanced::Core::find_lt_any_num;
+*find_le = \&Tree::SizeBalanced::Core::find_le_any_num;
+*find_gt = \&Tree::SizeBalanced::Core::find_gt_any_num;
+*find_ge = \&Tree::SizeBalanced::Core::find_ge_any_num;
+*find_lt_many = \&Tree::SizeBalanced::Core::find_lt_many_any_num;
+*find_le_many = \&Tree::SizeBalanced::Core::find_le_many_any_num;
+*find_gt_many = \&Tree::SizeBalanced::Core::find_gt_many_any_num;
+*find_ge_many = \&Tree::SizeBalanced::Core::find_ge_many_any_num;
+*find_gt_lt = \&Tree::SizeBalanced::Core::find_gt_lt_any_num;
+*find_ge_lt = \&Tree::SizeBalanced::Core::find_ge_lt_any_num;
+*find_gt_le = \&Tree::SizeBalanced::Core::find_gt_le_any_num;
+*find_ge_le = \&Tree::SizeBalanced::Core::find_ge_le_any_num;
+*count_lt = \&Tree::SizeBalanced::Core::count_lt_any_num;
+*count_le = \&Tree::SizeBalanced::Core::count_le_any_num;
+*count_gt = \&Tree::SizeBalanced::Core::count_gt_any_num;
+*count_ge = \&Tree::SizeBalanced::Core::count_ge_any_num;
+*count_eq = \&Tree::SizeBalanced::Core::count_eq_any_num;
+*equal_range = \&Tree::SizeBalanced::Core::equal_range_any_num;
+*count_lt_many = \&Tree::SizeBalanced::Core::count_lt_many_any_num;
+*count_le_many = \&Tree::SizeBalanced::Core::count_le_many_any_num;
+*count_gt_many = \&Tree::SizeBalanced::Core::count_gt_many_any_num;
+*count_ge_many = \&Tree::SizeBalanced::Core::count_ge_many_any_num;
+*apply = \&Tree::SizeBalanced::Core::apply_any_num;
+*find_min = \&Tree::SizeBalanced::Core::find_min_any_num;
+*find_max = \&Tree::SizeBalanced::Core::find_max_any_num;
+*pop_min = \&Tree::SizeBalanced::Core::pop_min_any_num;
+*pop_max = \&Tree::SizeBalanced::Core::pop_max_any_num;
+*skip_l = \&Tree::SizeBalanced::Core::skip_l_any_num;
+*skip_g = \&Tree::SizeBalanced::Core::skip_g_any_num;
+*delete_at = \&Tree::SizeBalanced::Core::delete_at_any_num;
+*delete_ranks = \&Tree::SizeBalanced::Core::delete_ranks_any_num;
+*clear = \&Tree::SizeBalanced::Core::clear_any_num;
+*reserve = \&Tree::SizeBalanced::Core::reserve_any_num;
+*compact = \&Tree::SizeBalanced::Core::compact_any_num;
+*dump = \&Tree::SizeBalanced::Core::dump_any_num;
+*check = \&Tree::SizeBalanced::Core::check_any_num;
+
+1;
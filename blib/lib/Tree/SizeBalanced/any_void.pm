@@ -0,0 +1,84 @@
+package Tree::SizeBalanced::any_void;
+
+use strict;
+use warnings;
+
+use Tree::SizeBalanced;
+
+*new = \&Tree::SizeBalanced::Core::new_any_void;
+*new_from_sorted = \&Tree::SizeBalanced::Core::new_from_sorted_any_void;
+*DESTROY = \&Tree::SizeBalanced::Core::DESTROY_any_void;
+*size = \&Tree::SizeBalanced::Core::size_any_void;
+*ever_height = \&Tree::SizeBalanced::Core::ever_height_any_void;
+*cmp_count = \&Tree::SizeBalanced::Core::cmp_count_any_void;
+*insert = \&Tree::SizeBalanced::Core::insert_any_void;
+*insert_before = \&Tree::SizeBalanced::Core::insert_before_any_void;
+*insert_after = \&Tree::SizeBalanced::Core::insert_after_any_void;
+*insert_unique = \&Tree::SizeBalanced::Core::insert_unique_any_void;
+*set = \&Tree::SizeBalanced::Core::set_any_void;
+*add_value = \&Tree::SizeBalanced::Core::add_value_any_void;
+*incr = \&Tree::SizeBalanced::Core::incr_any_void;
+*insert_many = \&Tree::SizeBalanced::Core::insert_many_any_void;
+*delete = \&Tree::SizeBalanced::Core::delete_any_void;
+*delete_first = \&Tree::SizeBalanced::Core::delete_first_any_void;
+*delete_last = \&Tree::SizeBalanced::Core::delete_last_any_void;
+*take_first = \&Tree::SizeBalanced::Core::take_first_any_void;
+*take_last = \&Tree::SizeBalanced::Core::take_last_any_void;
+*delete_many = \&Tree::SizeBalanced::Core::delete_many_any_void;
+*delete_many_first = \&Tree::SizeBalanced::Core::delete_many_first_any_void;
+*delete_many_last = \&Tree::SizeBalanced::Core::delete_many_last_any_void;
+*delete_gt_lt = \&Tree::SizeBalanced::Core::delete_gt_lt_any_void;
+*delete_ge_lt = \&Tree::SizeBalanced::Core::delete_ge_lt_any_void;
+*delete_gt_le = \&Tree::SizeBalanced::Core::delete_gt_le_any_void;
+*delete_ge_le = \&Tree::SizeBalanced::Core::delete_ge_le_any_void;
+*drain_le = \&Tree::SizeBalanced::Core::drain_le_any_void;
+*drain_ge = \&Tree::SizeBalanced::Core::drain_ge_any_void;
+*split_lt = \&Tree::SizeBalanced::Core::split_lt_any_void;
+*split_le = \&Tree::SizeBalanced::Core::split_le_any_void;
+*join = \&Tree::SizeBalanced::Core::join_any_void;
+*union = \&Tree::SizeBalanced::Core::union_any_void;
+*intersection = \&Tree::SizeBalanced::Core::intersection_any_void;
+*difference = \&Tree::SizeBalanced::Core::difference_any_void;
+*find = \&Tree::SizeBalanced::Core::find_any_void;
+*find_first = \&Tree::SizeBalanced::Core::find_first_any_void;
+*find_last = \&Tree::SizeBalanced::Core::find_last_any_void;
+*exists = \&Tree::SizeBalanced::Core::exists_any_void;
+*get_many = \&Tree::SizeBalanced::Core::get_many_any_void;
+*find_lt = \&Tree::SizeBalanced::Core::find_lt_any_void;
+*find_le = \&Tree::SizeBalanced::Core::find_le_any_void;
+*find_gt = \&Tree::SizeBalanced::Core::find_gt_any_void;
+*find_ge = \&Tree::SizeBalanced::Core::find_ge_any_void;
+*find_lt_many = \&Tree::SizeBalanced::Core::find_lt_many_any_void;
+*find_le_many = \&Tree::SizeBalanced::Core::find_le_many_any_void;
+*find_gt_many = \&Tree::SizeBalanced::Core::find_gt_many_any_void;
+*find_ge_many = \&Tree::SizeBalanced::Core::find_ge_many_any_void;
+*find_gt_lt = \&Tree::SizeBalanced::Core::find_gt_lt_any_void;
+*find_ge_lt = \&Tree::SizeBalanced::Core::find_ge_lt_any_void;
+*find_gt_le = \&Tree::SizeBalanced::Core::find_gt_le_any_void;
+*find_ge_le = \&Tree::SizeBalanced::Core::find_ge_le_any_void;
+*count_lt = \&Tree::SizeBalanced::Core::count_lt_any_void;
+*count_le = \&Tree::SizeBalanced::Core::count_le_any_void;
+*count_gt = \&Tree::SizeBalanced::Core::count_gt_any_void;
+*count_ge = \&Tree::SizeBalanced::Core::count_ge_any_void;
+*count_eq = \&Tree::SizeBalanced::Core::count_eq_any_void;
+*equal_range = \&Tree::SizeBalanced::Core::equal_range_any_void;
+*count_lt_many = \&Tree::SizeBalanced::Core::count_lt_many_any_void;
+*count_le_many = \&Tree::SizeBalanced::Core::count_le_many_any_void;
+*count_gt_many = \&Tree::SizeBalanced::Core::count_gt_many_any_void;
+*count_ge_many = \&Tree::SizeBalanced::Core::count_ge_many_any_void;
+*apply = \&Tree::SizeBalanced::Core::apply_any_void;
+*find_min = \&Tree::SizeBalanced::Core::find_min_any_void;
+*find_max = \&Tree::SizeBalanced::Core::find_max_any_void;
+*pop_min = \&Tree::SizeBalanced::Core::pop_min_any_void;
+*pop_max = \&Tree::SizeBalanced::Core::pop_max_any_void;
+*skip_l = \&Tree::SizeBalanced::Core::skip_l_any_void;
+*skip_g = \&Tree::SizeBalanced::Core::skip_g_any_void;
+*delete_at = \&Tree::SizeBalanced::Core::delete_at_any_void;
+*delete_ranks = \&Tree::SizeBalanced::Core::delete_ranks_any_void;
+*clear = \&Tree::SizeBalanced::Core::clear_any_void;
+*reserve = \&Tree::SizeBalanced::Core::reserve_any_void;
+*compact = \&Tree::SizeBalanced::Core::compact_any_void;
+*dump = \&Tree::SizeBalanced::Core::dump_any_void;
+*check = \&Tree::SizeBalanced::Core::check_any_void;
+
+1;
@@ -0,0 +1,84 @@
+package Tree::SizeBalanced::int_num;
+
+use strict;
+use warnings;
+
+use Tree::SizeBalanced;
+
+*new = \&Tree::SizeBalanced::Core::new_int_num;
+*new_from_sorted = \&Tree::SizeBalanced::Core::new_from_sorted_int_num;
+*DESTROY = \&Tree::SizeBalanced::Core::DESTROY_int_num;
+*size = \&Tree::SizeBalanced::Core::size_int_num;
+*ever_height = \&Tree::SizeBalanced::Core::ever_height_int_num;
+*cmp_count = \&Tree::SizeBalanced::Core::cmp_count_int_num;
+*insert = \&Tree::SizeBalanced::Core::insert_int_num;
+*insert_before = \&Tree::SizeBalanced::Core::insert_before_int_num;
+*insert_after = \&Tree::SizeBalanced::Core::insert_after_int_num;
+*insert_unique = \&Tree::SizeBalanced::Core::insert_unique_int_num;
+*set = \&Tree::SizeBalanced::Core::set_int_num;
+*add_value = \&Tree::SizeBalanced::Core::add_value_int_num;
+*incr = \&Tree::SizeBalanced::Core::incr_int_num;
+*insert_many = \&Tree::SizeBalanced::Core::insert_many_int_num;
+*delete = \&Tree::SizeBalanced::Core::delete_int_num;
+*delete_first = \&Tree::SizeBalanced::Core::delete_first_int_num;
+*delete_last = \&Tree::SizeBalanced::Core::delete_last_int_num;
+*take_first = \&Tree::SizeBalanced::Core::take_first_int_num;
+*take_last = \&Tree::SizeBalanced::Core::take_last_int_num;
+*delete_many = \&Tree::SizeBalanced::Core::delete_many_int_num;
+*delete_many_first = \&Tree::SizeBalanced::Core::delete_many_first_int_num;
+*delete_many_last = \&Tree::SizeBalanced::Core::delete_many_last_int_num;
+*delete_gt_lt = \&Tree::SizeBalanced::Core::delete_gt_lt_int_num;
+*delete_ge_lt = \&Tree::SizeBalanced::Core::delete_ge_lt_int_num;
+*delete_gt_le = \&Tree::SizeBalanced::Core::delete_gt_le_int_num;
+*delete_ge_le = \&Tree::SizeBalanced::Core::delete_ge_le_int_num;
+*drain_le = \&Tree::SizeBalanced::Core::drain_le_int_num;
+*drain_ge = \&Tree::SizeBalanced::Core::drain_ge_int_num;
+*split_lt = \&Tree::SizeBalanced::Core::split_lt_int_num;
+*split_le = \&Tree::SizeBalanced::Core::split_le_int_num;
+*join = \&Tree::SizeBalanced::Core::join_int_num;
+*union = \&Tree::SizeBalanced::Core::union_int_num;
+*intersection = \&Tree::SizeBalanced::Core::intersection_int_num;
+*difference = \&Tree::SizeBalanced::Core::difference_int_num;
+*find = \&Tree::SizeBalanced::Core::find_int_num;
+*find_first = \&Tree::SizeBalanced::Core::find_first_int_num;
+*find_last = \&Tree::SizeBalanced::Core::find_last_int_num;
+*exists = \&Tree::SizeBalanced::Core::exists_int_num;
+*get_many = \&Tree::SizeBalanced::Core::get_many_int_num;
+*find_lt = \&Tree::SizeBalanced::Core::find_lt_int_num;
+*find_le = \&Tree::SizeBalanced::Core::find_le_int_num;
+*find_gt = \&Tree::SizeBalanced::Core::find_gt_int_num;
+*find_ge = \&Tree::SizeBalanced::Core::find_ge_int_num;
+*find_lt_many = \&Tree::SizeBalanced::Core::find_lt_many_int_num;
+*find_le_many = \&Tree::SizeBalanced::Core::find_le_many_int_num;
+*find_gt_many = \&Tree::SizeBalanced::Core::find_gt_many_int_num;
+*find_ge_many = \&Tree::SizeBalanced::Core::find_ge_many_int_num;
+*find_gt_lt = \&Tree::SizeBalanced::Core::find_gt_lt_int_num;
+*find_ge_lt = \&Tree::SizeBalanced::Core::find_ge_lt_int_num;
+*find_gt_le = \&Tree::SizeBalanced::Core::find_gt_le_int_num;
+*find_ge_le = \&Tree::SizeBalanced::Core::find_ge_le_int_num;
+*count_lt = \&Tree::SizeBalanced::Core::count_lt_int_num;
+*count_le = \&Tree::SizeBalanced::Core::count_le_int_num;
+*count_gt = \&Tree::SizeBalanced::Core::count_gt_int_num;
+*count_ge = \&Tree::SizeBalanced::Core::count_ge_int_num;
+*count_eq = \&Tree::SizeBalanced::Core::count_eq_int_num;
+*equal_range = \&Tree::SizeBalanced::Core::equal_range_int_num;
+*count_lt_many = \&Tree::SizeBalanced::Core::count_lt_many_int_num;
+*count_le_many = \&Tree::SizeBalanced::Core::count_le_many_int_num;
+*count_gt_many = \&Tree::SizeBalanced::Core::count_gt_many_int_num;
+*count_ge_many = \&Tree::SizeBalanced::Core::count_ge_many_int_num;
+*apply = \&Tree::SizeBalanced::Core::apply_int_num;
+*find_min = \&Tree::SizeBalanced::Core::find_min_int_num;
+*find_max = \&Tree::SizeBalanced::Core::find_max_int_num;
+*pop_min = \&Tree::SizeBalanced::Core::pop_min_int_num;
+*pop_max = \&Tree::SizeBalanced::Core::pop_max_int_num;
+*skip_l = \&Tree::SizeBalanced::Core::skip_l_int_num;
+*skip_g = \&Tree::SizeBalanced::Core::skip_g_int_num;
+*delete_at = \&Tree::SizeBalanced::Core::delete_at_int_num;
+*delete_ranks = \&Tree::SizeBalanced::Core::delete_ranks_int_num;
+*clear = \&Tree::SizeBalanced::Core::clear_int_num;
+*reserve = \&Tree::SizeBalanced::Core::reserve_int_num;
+*compact = \&Tree::SizeBalanced::Core::compact_int_num;
+*dump = \&Tree::SizeBalanced::Core::dump_int_num;
+*check = \&Tree::SizeBalanced::Core::check_int_num;
+
+1;
@@ -0,0 +1,84 @@
+package Tree::SizeBalanced::num_any;
+
+use strict;
+use warnings;
+
+use Tree::SizeBalanced;
+
+*new = \&Tree::SizeBalanced::Core::new_num_any;
+*new_from_sorted = \&Tree::SizeBalanced::Core::new_from_sorted_num_any;
+*DESTROY = \&Tree::SizeBalanced::Core::DESTROY_num_any;
+*size = \&Tree::SizeBalanced::Core::size_num_any;
+*ever_height = \&Tree::SizeBalanced::Core::ever_height_num_any;
+*cmp_count = \&Tree::SizeBalanced::Core::cmp_count_num_any;
+*insert = \&Tree::SizeBalanced::Core::insert_num_any;
+*insert_before = \&Tree::SizeBalanced::Core::insert_before_num_any;
+*insert_after = \&Tree::SizeBalanced::Core::insert_after_num_any;
+*insert_unique = \&Tree::SizeBalanced::Core::insert_unique_num_any;
+*set = \&Tree::SizeBalanced::Core::set_num_any;
+*add_value = \&Tree::SizeBalanced::Core::add_value_num_any;
+*incr = \&Tree::SizeBalanced::Core::incr_num_any;
+*insert_many = \&Tree::SizeBalanced::Core::insert_many_num_any;
+*delete = \&Tree::SizeBalanced::Core::delete_num_any;
+*delete_first = \&Tree::SizeBalanced::Core::delete_first_num_any;
+*delete_last = \&Tree::SizeBalanced::Core::delete_last_num_any;
+*take_first = \&Tree::SizeBalanced::Core::take_first_num_any;
+*take_last = \&Tree::SizeBalanced::Core::take_last_num_any;
+*delete_many = \&Tree::SizeBalanced::Core::delete_many_num_any;
+*delete_many_first = \&Tree::SizeBalanced::Core::delete_many_first_num_any;
+*delete_many_last = \&Tree::SizeBalanced::Core::delete_many_last_num_any;
+*delete_gt_lt = \&Tree::SizeBalanced::Core::delete_gt_lt_num_any;
+*delete_ge_lt = \&Tree::SizeBalanced::Core::delete_ge_lt_num_any;
+*delete_gt_le = \&Tree::SizeBalanced::Core::delete_gt_le_num_any;
+*delete_ge_le = \&Tree::SizeBalanced::Core::delete_ge_le_num_any;
+*drain_le = \&Tree::SizeBalanced::Core::drain_le_num_any;
+*drain_ge = \&Tree::SizeBalanced::Core::drain_ge_num_any;
+*split_lt = \&Tree::SizeBalanced::Core::split_lt_num_any;
+*split_le = \&Tree::SizeBalanced::Core::split_le_num_any;
+*join = \&Tree::SizeBalanced::Core::join_num_any;
+*union = \&Tree::SizeBalanced::Core::union_num_any;
+*intersection = \&Tree::SizeBalanced::Core::intersection_num_any;
+*difference = \&Tree::SizeBalanced::Core::difference_num_any;
+*find = \&Tree::SizeBalanced::Core::find_num_any;
+*find_first = \&Tree::SizeBalanced::Core::find_first_num_any;
+*find_last = \&Tree::SizeBalanced::Core::find_last_num_any;
+*exists = \&Tree::SizeBalanced::Core::exists_num_any;
+*get_many = \&Tree::SizeBalanced::Core::get_many_num_any;
+*find_lt = \&Tree::SizeBalanced::Core::find_lt_num_any;
+*find_le = \&Tree::SizeBalanced::Core::find_le_num_any;
+*find_gt = \&Tree::SizeBalanced::Core::find_gt_num_any;
+*find_ge = \&Tree::SizeBalanced::Core::find_ge_num_any;
+*find_lt_many = \&Tree::SizeBalanced::Core::find_lt_many_num_any;
+*find_le_many = \&Tree::SizeBalanced::Core::find_le_many_num_any;
+*find_gt_many = \&Tree::SizeBalanced::Core::find_gt_many_num_any;
+*find_ge_many = \&Tree::SizeBalanced::Core::find_ge_many_num_any;
+*find_gt_lt = \&Tree::SizeBalanced::Core::find_gt_lt_num_any;
+*find_ge_lt = \&Tree::SizeBalanced::Core::find_ge_lt_num_any;
+*find_gt_le = \&Tree::SizeBalanced::Core::find_gt_le_num_any;
+*find_ge_le = \&Tree::SizeBalanced::Core::find_ge_le_num_any;
+*count_lt = \&Tree::SizeBalanced::Core::count_lt_num_any;
+*count_le = \&Tree::SizeBalanced::Core::count_le_num_any;
+*count_gt = \&Tree::SizeBalanced::Core::count_gt_num_any;
+*count_ge = \&Tree::SizeBalanced::Core::count_ge_num_any;
+*count_eq = \&Tree::SizeBalanced::Core::count_eq_num_any;
+*equal_range = \&Tree::SizeBalanced::Core::equal_range_num_any;
+*count_lt_many = \&Tree::SizeBalanced::Core::count_lt_many_num_any;
+*count_le_many = \&Tree::SizeBalanced::Core::count_le_many_num_any;
+*count_gt_many = \&Tree::SizeBalanced::Core::count_gt_many_num_any;
+*count_ge_many = \&Tree::SizeBalanced::Core::count_ge_many_num_any;
+*apply = \&Tree::SizeBalanced::Core::apply_num_any;
+*find_min = \&Tree::SizeBalanced::Core::find_min_num_any;
+*find_max = \&Tree::SizeBalanced::Core::find_max_num_any;
+*pop_min = \&Tree::SizeBalanced::Core::pop_min_num_any;
+*pop_max = \&Tree::SizeBalanced::Core::pop_max_num_any;
+*skip_l = \&Tree::SizeBalanced::Core::skip_l_num_any;
+*skip_g = \&Tree::SizeBalanced::Core::skip_g_num_any;
+*delete_at = \&Tree::SizeBalanced::Core::delete_at_num_any;
+*delete_ranks = \&Tree::SizeBalanced::Core::delete_ranks_num_any;
+*clear = \&Tree::SizeBalanced::Core::clear_num_any;
+*reserve = \&Tree::SizeBalanced::Core::reserve_num_any;
+*compact = \&Tree::SizeBalanced::Core::compact_num_any;
+*dump = \&Tree::SizeBalanced::Core::dump_num_any;
+*check = \&Tree::SizeBalanced::Core::check_num_any;
+
+1;
@@ -0,0 +1,84 @@
+package Tree::SizeBalanced::num_int;
+
+use strict;
+use warnings;
+
+use Tree::SizeBalanced;
+
+*new = \&Tree::SizeBalanced::Core::new_num_int;
+*new_from_sorted = \&Tree::SizeBalanced::Core::new_from_sorted_num_int;
+*DESTROY = \&Tree::SizeBalanced::Core::DESTROY_num_int;
+*size = \&Tree::SizeBalanced::Core::size_num_int;
+*ever_height = \&Tree::SizeBalanced::Core::ever_height_num_int;
+*cmp_count = \&Tree::SizeBalanced::Core::cmp_count_num_int;
+*insert = \&Tree::SizeBalanced::Core::insert_num_int;
+*insert_before = \&Tree::SizeBalanced::Core::insert_before_num_int;
+*insert_after = \&Tree::SizeBalanced::Core::insert_after_num_int;
+*insert_unique = \&Tree::SizeBalanced::Core::insert_unique_num_int;
+*set = \&Tree::SizeBalanced::Core::set_num_int;
+*add_value = \&Tree::SizeBalanced::Core::add_value_num_int;
+*incr = \&Tree::SizeBalanced::Core::incr_num_int;
+*insert_many = \&Tree::SizeBalanced::Core::insert_many_num_int;
+*delete = \&Tree::SizeBalanced::Core::delete_num_int;
+*delete_first = \&Tree::SizeBalanced::Core::delete_first_num_int;
+*delete_last = \&Tree::SizeBalanced::Core::delete_last_num_int;
+*take_first = \&Tree::SizeBalanced::Core::take_first_num_int;
+*take_last = \&Tree::SizeBalanced::Core::take_last_num_int;
+*delete_many = \&Tree::SizeBalanced::Core::delete_many_num_int;
+*delete_many_first = \&Tree::SizeBalanced::Core::delete_many_first_num_int;
+*delete_many_last = \&Tree::SizeBalanced::Core::delete_many_last_num_int;
+*delete_gt_lt = \&Tree::SizeBalanced::Core::delete_gt_lt_num_int;
+*delete_ge_lt = \&Tree::SizeBalanced::Core::delete_ge_lt_num_int;
+*delete_gt_le = \&Tree::SizeBalanced::Core::delete_gt_le_num_int;
+*delete_ge_le = \&Tree::SizeBalanced::Core::delete_ge_le_num_int;
+*drain_le = \&Tree::SizeBalanced::Core::drain_le_num_int;
+*drain_ge = \&Tree::SizeBalanced::Core::drain_ge_num_int;
+*split_lt = \&Tree::SizeBalanced::Core::split_lt_num_int;
+*split_le = \&Tree::SizeBalanced::Core::split_le_num_int;
+*join = \&Tree::SizeBalanced::Core::join_num_int;
+*union = \&Tree::SizeBalanced::Core::union_num_int;
+*intersection = \&Tree::SizeBalanced::Core::intersection_num_int;
+*difference = \&Tree::SizeBalanced::Core::difference_num_int;
+*find = \&Tree::SizeBalanced::Core::find_num_int;
+*find_first = \&Tree::SizeBalanced::Core::find_first_num_int;
+*find_last = \&Tree::SizeBalanced::Core::find_last_num_int;
+*exists = \&Tree::SizeBalanced::Core::exists_num_int;
+*get_many = \&Tree::SizeBalanced::Core::get_many_num_int;
+*find_lt = \&Tree::SizeBalanced::Core::find_lt_num_int;
+*find_le = \&Tree::SizeBalanced::Core::find_le_num_int;
+*find_gt = \&Tree::SizeBalanced::Core::find_gt_num_int;
+*find_ge = \&Tree::SizeBalanced::Core::find_ge_num_int;
+*find_lt_many = \&Tree::SizeBalanced::Core::find_lt_many_num_int;
+*find_le_many = \&Tree::SizeBalanced::Core::find_le_many_num_int;
+*find_gt_many = \&Tree::SizeBalanced::Core::find_gt_many_num_int;
+*find_ge_many = \&Tree::SizeBalanced::Core::find_ge_many_num_int;
+*find_gt_lt = \&Tree::SizeBalanced::Core::find_gt_lt_num_int;
+*find_ge_lt = \&Tree::SizeBalanced::Core::find_ge_lt_num_int;
+*find_gt_le = \&Tree::SizeBalanced::Core::find_gt_le_num_int;
+*find_ge_le = \&Tree::SizeBalanced::Core::find_ge_le_num_int;
+*count_lt = \&Tree::SizeBalanced::Core::count_lt_num_int;
+*count_le = \&Tree::SizeBalanced::Core::count_le_num_int;
+*count_gt = \&Tree::SizeBalanced::Core::count_gt_num_int;
+*count_ge = \&Tree::SizeBalanced::Core::count_ge_num_int;
+*count_eq = \&Tree::SizeBalanced::Core::count_eq_num_int;
+*equal_range = \&Tree::SizeBalanced::Core::equal_range_num_int;
+*count_lt_many = \&Tree::SizeBalanced::Core::count_lt_many_num_int;
+*count_le_many = \&Tree::SizeBalanced::Core::count_le_many_num_int;
+*count_gt_many = \&Tree::SizeBalanced::Core::count_gt_many_num_int;
+*count_ge_many = \&Tree::SizeBalanced::Core::count_ge_many_num_int;
+*apply = \&Tree::SizeBalanced::Core::apply_num_int;
+*find_min = \&Tree::SizeBalanced::Core::find_min_num_int;
+*find_max = \&Tree::SizeBalanced::Core::find_max_num_int;
+*pop_min = \&Tree::SizeBalanced::Core::pop_min_num_int;
+*pop_max = \&Tree::SizeBalanced::Core::pop_max_num_int;
+*skip_l = \&Tree::SizeBalanced::Core::skip_l_num_int;
+*skip_g = \&Tree::SizeBalanced::Core::skip_g_num_int;
+*delete_at = \&Tree::SizeBalanced::Core::delete_at_num_int;
+*delete_ranks = \&Tree::SizeBalanced::Core::delete_ranks_num_int;
+*clear = \&Tree::SizeBalanced::Core::clear_num_int;
+*reserve = \&Tree::SizeBalanced::Core::reserve_num_int;
+*compact = \&Tree::SizeBalanced::Core::compact_num_int;
+*dump = \&Tree::SizeBalanced::Core::dump_num_int;
+*check = \&Tree::SizeBalanced::Core::check_num_int;
+
+1;
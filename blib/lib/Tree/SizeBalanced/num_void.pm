@@ -0,0 +1,84 @@
+package Tree::SizeBalanced::num_void;
+
+use strict;
+use warnings;
+
+use Tree::SizeBalanced;
+
+*new = \&Tree::SizeBalanced::Core::new_num_void;
+*new_from_sorted = \&Tree::SizeBalanced::Core::new_from_sorted_num_void;
+*DESTROY = \&Tree::SizeBalanced::Core::DESTROY_num_void;
+*size = \&Tree::SizeBalanced::Core::size_num_void;
+*ever_height = \&Tree::SizeBalanced::Core::ever_height_num_void;
+*cmp_count = \&Tree::SizeBalanced::Core::cmp_count_num_void;
+*insert = \&Tree::SizeBalanced::Core::insert_num_void;
+*insert_before = \&Tree::SizeBalanced::Core::insert_before_num_void;
+*insert_after = \&Tree::SizeBalanced::Core::insert_after_num_void;
+*insert_unique = \&Tree::SizeBalanced::Core::insert_unique_num_void;
+*set = \&Tree::SizeBalanced::Core::set_num_void;
+*add_value = \&Tree::SizeBalanced::Core::add_value_num_void;
+*incr = \&Tree::SizeBalanced::Core::incr_num_void;
+*insert_many = \&Tree::SizeBalanced::Core::insert_many_num_void;
+*delete = \&Tree::SizeBalanced::Core::delete_num_void;
+*delete_first = \&Tree::SizeBalanced::Core::delete_first_num_void;
+*delete_last = \&Tree::SizeBalanced::Core::delete_last_num_void;
+*take_first = \&Tree::SizeBalanced::Core::take_first_num_void;
+*take_last = \&Tree::SizeBalanced::Core::take_last_num_void;
+*delete_many = \&Tree::SizeBalanced::Core::delete_many_num_void;
+*delete_many_first = \&Tree::SizeBalanced::Core::delete_many_first_num_void;
+*delete_many_last = \&Tree::SizeBalanced::Core::delete_many_last_num_void;
+*delete_gt_lt = \&Tree::SizeBalanced::Core::delete_gt_lt_num_void;
+*delete_ge_lt = \&Tree::SizeBalanced::Core::delete_ge_lt_num_void;
+*delete_gt_le = \&Tree::SizeBalanced::Core::delete_gt_le_num_void;
+*delete_ge_le = \&Tree::SizeBalanced::Core::delete_ge_le_num_void;
+*drain_le = \&Tree::SizeBalanced::Core::drain_le_num_void;
+*drain_ge = \&Tree::SizeBalanced::Core::drain_ge_num_void;
+*split_lt = \&Tree::SizeBalanced::Core::split_lt_num_void;
+*split_le = \&Tree::SizeBalanced::Core::split_le_num_void;
+*join = \&Tree::SizeBalanced::Core::join_num_void;
+*union = \&Tree::SizeBalanced::Core::union_num_void;
+*intersection = \&Tree::SizeBalanced::Core::intersection_num_void;
+*difference = \&Tree::SizeBalanced::Core::difference_num_void;
+*find = \&Tree::SizeBalanced::Core::find_num_void;
+*find_first = \&Tree::SizeBalanced::Core::find_first_num_void;
+*find_last = \&Tree::SizeBalanced::Core::find_last_num_void;
+*exists = \&Tree::SizeBalanced::Core::exists_num_void;
+*get_many = \&Tree::SizeBalanced::Core::get_many_num_void;
+*find_lt = \&Tree::SizeBalanced::Core::find_lt_num_void;
+*find_le = \&Tree::SizeBalanced::Core::find_le_num_void;
+*find_gt = \&Tree::SizeBalanced::Core::find_gt_num_void;
+*find_ge = \&Tree::SizeBalanced::Core::find_ge_num_void;
+*find_lt_many = \&Tree::SizeBalanced::Core::find_lt_many_num_void;
+*find_le_many = \&Tree::SizeBalanced::Core::find_le_many_num_void;
+*find_gt_many = \&Tree::SizeBalanced::Core::find_gt_many_num_void;
+*find_ge_many = \&Tree::SizeBalanced::Core::find_ge_many_num_void;
+*find_gt_lt = \&Tree::SizeBalanced::Core::find_gt_lt_num_void;
+*find_ge_lt = \&Tree::SizeBalanced::Core::find_ge_lt_num_void;
+*find_gt_le = \&Tree::SizeBalanced::Core::find_gt_le_num_void;
+*find_ge_le = \&Tree::SizeBalanced::Core::find_ge_le_num_void;
+*count_lt = \&Tree::SizeBalanced::Core::count_lt_num_void;
+*count_le = \&Tree::SizeBalanced::Core::count_le_num_void;
+*count_gt = \&Tree::SizeBalanced::Core::count_gt_num_void;
+*count_ge = \&Tree::SizeBalanced::Core::count_ge_num_void;
+*count_eq = \&Tree::SizeBalanced::Core::count_eq_num_void;
+*equal_range = \&Tree::SizeBalanced::Core::equal_range_num_void;
+*count_lt_many = \&Tree::SizeBalanced::Core::count_lt_many_num_void;
+*count_le_many = \&Tree::SizeBalanced::Core::count_le_many_num_void;
+*count_gt_many = \&Tree::SizeBalanced::Core::count_gt_many_num_void;
+*count_ge_many = \&Tree::SizeBalanced::Core::count_ge_many_num_void;
+*apply = \&Tree::SizeBalanced::Core::apply_num_void;
+*find_min = \&Tree::SizeBalanced::Core::find_min_num_void;
+*find_max = \&Tree::SizeBalanced::Core::find_max_num_void;
+*pop_min = \&Tree::SizeBalanced::Core::pop_min_num_void;
+*pop_max = \&Tree::SizeBalanced::Core::pop_max_num_void;
+*skip_l = \&Tree::SizeBalanced::Core::skip_l_num_void;
+*skip_g = \&Tree::SizeBalanced::Core::skip_g_num_void;
+*delete_at = \&Tree::SizeBalanced::Core::delete_at_num_void;
+*delete_ranks = \&Tree::SizeBalanced::Core::delete_ranks_num_void;
+*clear = \&Tree::SizeBalanced::Core::clear_num_void;
+*reserve = \&Tree::SizeBalanced::Core::reserve_num_void;
+*compact = \&Tree::SizeBalanced::Core::compact_num_void;
+*dump = \&Tree::SizeBalanced::Core::dump_num_void;
+*check = \&Tree::SizeBalanced::Core::check_num_void;
+
+1;
@@ -0,0 +1,84 @@
+package Tree::SizeBalanced::str_int;
+
+use strict;
+use warnings;
+
+use Tree::SizeBalanced;
+
+*new = \&Tree::SizeBalanced::Core::new_str_int;
+*new_from_sorted = \&Tree::SizeBalanced::Core::new_from_sorted_str_int;
+*DESTROY = \&Tree::SizeBalanced::Core::DESTROY_str_int;
+*size = \&Tree::SizeBalanced::Core::size_str_int;
+*ever_height = \&Tree::SizeBalanced::Core::ever_height_str_int;
+*cmp_count = \&Tree::SizeBalanced::Core::cmp_count_str_int;
+*insert = \&Tree::SizeBalanced::Core::insert_str_int;
+*insert_before = \&Tree::SizeBalanced::Core::insert_before_str_int;
+*insert_after = \&Tree::SizeBalanced::Core::insert_after_str_int;
+*insert_unique = \&Tree::SizeBalanced::Core::insert_unique_str_int;
+*set = \&Tree::SizeBalanced::Core::set_str_int;
+*add_value = \&Tree::SizeBalanced::Core::add_value_str_int;
+*incr = \&Tree::SizeBalanced::Core::incr_str_int;
+*insert_many = \&Tree::SizeBalanced::Core::insert_many_str_int;
+*delete = \&Tree::SizeBalanced::Core::delete_str_int;
+*delete_first = \&Tree::SizeBalanced::Core::delete_first_str_int;
+*delete_last = \&Tree::SizeBalanced::Core::delete_last_str_int;
+*take_first = \&Tree::SizeBalanced::Core::take_first_str_int;
+*take_last = \&Tree::SizeBalanced::Core::take_last_str_int;
+*delete_many = \&Tree::SizeBalanced::Core::delete_many_str_int;
+*delete_many_first = \&Tree::SizeBalanced::Core::delete_many_first_str_int;
+*delete_many_last = \&Tree::SizeBalanced::Core::delete_many_last_str_int;
+*delete_gt_lt = \&Tree::SizeBalanced::Core::delete_gt_lt_str_int;
+*delete_ge_lt = \&Tree::SizeBalanced::Core::delete_ge_lt_str_int;
+*delete_gt_le = \&Tree::SizeBalanced::Core::delete_gt_le_str_int;
+*delete_ge_le = \&Tree::SizeBalanced::Core::delete_ge_le_str_int;
+*drain_le = \&Tree::SizeBalanced::Core::drain_le_str_int;
+*drain_ge = \&Tree::SizeBalanced::Core::drain_ge_str_int;
+*split_lt = \&Tree::SizeBalanced::Core::split_lt_str_int;
+*split_le = \&Tree::SizeBalanced::Core::split_le_str_int;
+*join = \&Tree::SizeBalanced::Core::join_str_int;
+*union = \&Tree::SizeBalanced::Core::union_str_int;
+*intersection = \&Tree::SizeBalanced::Core::intersection_str_int;
+*difference = \&Tree::SizeBalanced::Core::difference_str_int;
+*find = \&Tree::SizeBalanced::Core::find_str_int;
+*find_first = \&Tree::SizeBalanced::Core::find_first_str_int;
+*find_last = \&Tree::SizeBalanced::Core::find_last_str_int;
+*exists = \&Tree::SizeBalanced::Core::exists_str_int;
+*get_many = \&Tree::SizeBalanced::Core::get_many_str_int;
+*find_lt = \&Tree::SizeBalanced::Core::find_lt_str_int;
+*find_le = \&Tree::SizeBalanced::Core::find_le_str_int;
+*find_gt = \&Tree::SizeBalanced::Core::find_gt_str_int;
+*find_ge = \&Tree::SizeBalanced::Core::find_ge_str_int;
+*find_lt_many = \&Tree::SizeBalanced::Core::find_lt_many_str_int;
+*find_le_many = \&Tree::SizeBalanced::Core::find_le_many_str_int;
+*find_gt_many = \&Tree::SizeBalanced::Core::find_gt_many_str_int;
+*find_ge_many = \&Tree::SizeBalanced::Core::find_ge_many_str_int;
+*find_gt_lt = \&Tree::SizeBalanced::Core::find_gt_lt_str_int;
+*find_ge_lt = \&Tree::SizeBalanced::Core::find_ge_lt_str_int;
+*find_gt_le = \&Tree::SizeBalanced::Core::find_gt_le_str_int;
+*find_ge_le = \&Tree::SizeBalanced::Core::find_ge_le_str_int;
+*count_lt = \&Tree::SizeBalanced::Core::count_lt_str_int;
+*count_le = \&Tree::SizeBalanced::Core::count_le_str_int;
+*count_gt = \&Tree::SizeBalanced::Core::count_gt_str_int;
+*count_ge = \&Tree::SizeBalanced::Core::count_ge_str_int;
+*count_eq = \&Tree::SizeBalanced::Core::count_eq_str_int;
+*equal_range = \&Tree::SizeBalanced::Core::equal_range_str_int;
+*count_lt_many = \&Tree::SizeBalanced::Core::count_lt_many_str_int;
+*count_le_many = \&Tree::SizeBalanced::Core::count_le_many_str_int;
+*count_gt_many = \&Tree::SizeBalanced::Core::count_gt_many_str_int;
+*count_ge_many = \&Tree::SizeBalanced::Core::count_ge_many_str_int;
+*apply = \&Tree::SizeBalanced::Core::apply_str_int;
+*find_min = \&Tree::SizeBalanced::Core::find_min_str_int;
+*find_max = \&Tree::SizeBalanced::Core::find_max_str_int;
+*pop_min = \&Tree::SizeBalanced::Core::pop_min_str_int;
+*pop_max = \&Tree::SizeBalanced::Core::pop_max_str_int;
+*skip_l = \&Tree::SizeBalanced::Core::skip_l_str_int;
+*skip_g = \&Tree::SizeBalanced::Core::skip_g_str_int;
+*delete_at = \&Tree::SizeBalanced::Core::delete_at_str_int;
+*delete_ranks = \&Tree::SizeBalanced::Core::delete_ranks_str_int;
+*clear = \&Tree::SizeBalanced::Core::clear_str_int;
+*reserve = \&Tree::SizeBalanced::Core::reserve_str_int;
+*compact = \&Tree::SizeBalanced::Core::compact_str_int;
+*dump = \&Tree::SizeBalanced::Core::dump_str_int;
+*check = \&Tree::SizeBalanced::Core::check_str_int;
+
+1;
@@ -0,0 +1,84 @@
+package Tree::SizeBalanced::str_void;
+
+use strict;
+use warnings;
+
+use Tree::SizeBalanced;
+
+*new = \&Tree::SizeBalanced::Core::new_str_void;
+*new_from_sorted = \&Tree::SizeBalanced::Core::new_from_sorted_str_void;
+*DESTROY = \&Tree::SizeBalanced::Core::DESTROY_str_void;
+*size = \&Tree::SizeBalanced::Core::size_str_void;
+*ever_height = \&Tree::SizeBalanced::Core::ever_height_str_void;
+*cmp_count = \&Tree::SizeBalanced::Core::cmp_count_str_void;
+*insert = \&Tree::SizeBalanced::Core::insert_str_void;
+*insert_before = \&Tree::SizeBalanced::Core::insert_before_str_void;
+*insert_after = \&Tree::SizeBalanced::Core::insert_after_str_void;
+*insert_unique = \&Tree::SizeBalanced::Core::insert_unique_str_void;
+*set = \&Tree::SizeBalanced::Core::set_str_void;
+*add_value = \&Tree::SizeBalanced::Core::add_value_str_void;
+*incr = \&Tree::SizeBalanced::Core::incr_str_void;
+*insert_many = \&Tree::SizeBalanced::Core::insert_many_str_void;
+*delete = \&Tree::SizeBalanced::Core::delete_str_void;
+*delete_first = \&Tree::SizeBalanced::Core::delete_first_str_void;
+*delete_last = \&Tree::SizeBalanced::Core::delete_last_str_void;
+*take_first = \&Tree::SizeBalanced::Core::take_first_str_void;
+*take_last = \&Tree::SizeBalanced::Core::take_last_str_void;
+*delete_many = \&Tree::SizeBalanced::Core::delete_many_str_void;
+*delete_many_first = \&Tree::SizeBalanced::Core::delete_many_first_str_void;
+*delete_many_last = \&Tree::SizeBalanced::Core::delete_many_last_str_void;
+*delete_gt_lt = \&Tree::SizeBalanced::Core::delete_gt_lt_str_void;
+*delete_ge_lt = \&Tree::SizeBalanced::Core::delete_ge_lt_str_void;
+*delete_gt_le = \&Tree::SizeBalanced::Core::delete_gt_le_str_void;
+*delete_ge_le = \&Tree::SizeBalanced::Core::delete_ge_le_str_void;
+*drain_le = \&Tree::SizeBalanced::Core::drain_le_str_void;
+*drain_ge = \&Tree::SizeBalanced::Core::drain_ge_str_void;
+*split_lt = \&Tree::SizeBalanced::Core::split_lt_str_void;
+*split_le = \&Tree::SizeBalanced::Core::split_le_str_void;
+*join = \&Tree::SizeBalanced::Core::join_str_void;
+*union = \&Tree::SizeBalanced::Core::union_str_void;
+*intersection = \&Tree::SizeBalanced::Core::intersection_str_void;
+*difference = \&Tree::SizeBalanced::Core::difference_str_void;
+*find = \&Tree::SizeBalanced::Core::find_str_void;
+*find_first = \&Tree::SizeBalanced::Core::find_first_str_void;
+*find_last = \&Tree::SizeBalanced::Core::find_last_str_void;
+*exists = \&Tree::SizeBalanced::Core::exists_str_void;
+*get_many = \&Tree::SizeBalanced::Core::get_many_str_void;
+*find_lt = \&Tree::SizeBalanced::Core::find_lt_str_void;
+*find_le = \&Tree::SizeBalanced::Core::find_le_str_void;
+*find_gt = \&Tree::SizeBalanced::Core::find_gt_str_void;
+*find_ge = \&Tree::SizeBalanced::Core::find_ge_str_void;
+*find_lt_many = \&Tree::SizeBalanced::Core::find_lt_many_str_void;
+*find_le_many = \&Tree::SizeBalanced::Core::find_le_many_str_void;
+*find_gt_many = \&Tree::SizeBalanced::Core::find_gt_many_str_void;
+*find_ge_many = \&Tree::SizeBalanced::Core::find_ge_many_str_void;
+*find_gt_lt = \&Tree::SizeBalanced::Core::find_gt_lt_str_void;
+*find_ge_lt = \&Tree::SizeBalanced::Core::find_ge_lt_str_void;
+*find_gt_le = \&Tree::SizeBalanced::Core::find_gt_le_str_void;
+*find_ge_le = \&Tree::SizeBalanced::Core::find_ge_le_str_void;
+*count_lt = \&Tree::SizeBalanced::Core::count_lt_str_void;
+*count_le = \&Tree::SizeBalanced::Core::count_le_str_void;
+*count_gt = \&Tree::SizeBalanced::Core::count_gt_str_void;
+*count_ge = \&Tree::SizeBalanced::Core::count_ge_str_void;
+*count_eq = \&Tree::SizeBalanced::Core::count_eq_str_void;
+*equal_range = \&Tree::SizeBalanced::Core::equal_range_str_void;
+*count_lt_many = \&Tree::SizeBalanced::Core::count_lt_many_str_void;
+*count_le_many = \&Tree::SizeBalanced::Core::count_le_many_str_void;
+*count_gt_many = \&Tree::SizeBalanced::Core::count_gt_many_str_void;
+*count_ge_many = \&Tree::SizeBalanced::Core::count_ge_many_str_void;
+*apply = \&Tree::SizeBalanced::Core::apply_str_void;
+*find_min = \&Tree::SizeBalanced::Core::find_min_str_void;
+*find_max = \&Tree::SizeBalanced::Core::find_max_str_void;
+*pop_min = \&Tree::SizeBalanced::Core::pop_min_str_void;
+*pop_max = \&Tree::SizeBalanced::Core::pop_max_str_void;
+*skip_l = \&Tree::SizeBalanced::Core::skip_l_str_void;
+*skip_g = \&Tree::SizeBalanced::Core::skip_g_str_void;
+*delete_at = \&Tree::SizeBalanced::Core::delete_at_str_void;
+*delete_ranks = \&Tree::SizeBalanced::Core::delete_ranks_str_void;
+*clear = \&Tree::SizeBalanced::Core::clear_str_void;
+*reserve = \&Tree::SizeBalanced::Core::reserve_str_void;
+*compact = \&Tree::SizeBalanced::Core::compact_str_void;
+*dump = \&Tree::SizeBalanced::Core::dump_str_void;
+*check = \&Tree::SizeBalanced::Core::check_str_void;
+
+1;
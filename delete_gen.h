@@ -1,36 +1,66 @@
 // vim: filetype=xs
 
-KV(tree_t) * KV(DELETE_SUBTREE_FUNC)(pTHX_ SV**SP, KV(tree_cntr_t) * cntr, KV(tree_t) * tree, T(KEY) key){
-    if( LIKELY(tree != (KV(tree_t)*) &nil) ){
-        KV(tree_t) * c;
-        if( K(cmp)(aTHX_ SP, tree->key, key, cntr->cmp) DELETE_CMP_OP 0 ){
-            c = KV(DELETE_SUBTREE_FUNC)(aTHX_ SP, cntr, tree->DELETE_GOOD_DIR, key);
-            if( c ){
-                tree->DELETE_GOOD_DIR = c;
-                --tree->size;
-                return (KV(tree_t)*) DELETE_MAINTAIN_BAD_DIR(tree);
-            }
+// 把一個 key 相等的 entry 移出樹外, return 它的 cell, 由呼叫者負責釋放
+// 沒找到的話 return NULL
+// 一路往下走到底並記下路徑, 路徑上最後一個 key 相等的節點就是要移出的
+// 再由它往上把路徑上的節點接回去, 每個節點只比較一次
+static inline KV(tree_t) * KV(DELETE_TAKE_FUNC)(pTHX_ SV**SP, KV(tree_cntr_t) * cntr, T(KEY) key){
+    KV(tree_t) * path[cntr->ever_height+1];
+    bool went_good[cntr->ever_height+1];
+    int depth = 0, target = -1;
 
-            if( K(cmp)(aTHX_ SP, tree->key, key, cntr->cmp) == 0 )
-                return KV(tree_delete_root)(cntr, tree);
+    for(KV(tree_t) * t = cntr->root; t != (KV(tree_t)*) &nil; ++depth){
+        IV c = KV(tree_cmp)(aTHX_ SP, cntr, t->key, key);
+        path[depth] = t;
+        if( c DELETE_CMP_OP 0 ){
+            if( c == 0 )
+                target = depth;
+            went_good[depth] = TRUE;
+            t = t->DELETE_GOOD_DIR;
         }
         else{
-            c = KV(DELETE_SUBTREE_FUNC)(aTHX_ SP, cntr, tree->DELETE_BAD_DIR, key);
-            if( c ){
-                tree->DELETE_BAD_DIR = c;
-                --tree->size;
-                return (KV(tree_t)*) DELETE_MAINTAIN_GOOD_DIR(tree);
-            }
+            went_good[depth] = FALSE;
+            t = t->DELETE_BAD_DIR;
         }
     }
-    return NULL;
+
+    if( target < 0 )
+        return NULL;
+
+    KV(tree_t) * removed = path[target];
+    KV(tree_t) * t = KV(tree_unlink_root)(removed);
+    for(int i=target-1; i>=0; --i){
+        --path[i]->size;
+        if( went_good[i] ){
+            path[i]->DELETE_GOOD_DIR = t;
+            t = (KV(tree_t)*) DELETE_MAINTAIN_BAD_DIR(path[i]);
+        }
+        else{
+            path[i]->DELETE_BAD_DIR = t;
+            t = (KV(tree_t)*) DELETE_MAINTAIN_GOOD_DIR(path[i]);
+        }
+    }
+    cntr->root = t;
+    return removed;
 }
 
 static inline bool KV(DELETE_FUNC)(pTHX_ SV**SP, KV(tree_cntr_t) * cntr, T(KEY) key){
-    KV(tree_t) * new_root = KV(DELETE_SUBTREE_FUNC)(aTHX_ SP, cntr, cntr->root, key);
-    if( new_root ){
-        cntr->root = new_root;
+    KV(tree_t) * removed = KV(DELETE_TAKE_FUNC)(aTHX_ SP, cntr, key);
+    if( removed ){
+        KV(release_cell)(aTHX_ cntr, removed);
         return TRUE;
     }
     return FALSE;
 }
+
+// 對排好序的 batch 裡的每個 key 各刪掉一個 entry, return 刪掉的數量
+static inline IV KV(DELETE_BATCH_FUNC)(pTHX_ SV**SP, KV(tree_cntr_t) * cntr, KV(tree_batch_t) * batch, SSize_t m){
+    if( KV(tree_prefer_rebuild)(cntr, m) )
+        return KV(tree_delete_batch_rebuild)(aTHX_ SP, cntr, batch, m, DELETE_FROM_LAST);
+
+    IV removed = 0;
+    for(SSize_t i=0; i<m; ++i)
+        if( KV(DELETE_FUNC)(aTHX_ SP, cntr, batch[i].key) )
+            ++removed;
+    return removed;
+}
@@ -1,63 +1,65 @@
 // vim: filetype=xs
 
+// 先往下找到第一個 (或最後一個) key 不小於 (或不大於) 給定 key 的 entry
+// 沿路把往 GOOD 方向走的節點存進 stack, 同時記下它們是不是相等
+// 之後依序從 stack 取出, 只有新放進 stack 的節點才需要比較, 每個節點只比較一次
 static inline SV** KV(FIND_FUNC)(pTHX_ SV** SP, KV(tree_cntr_t) * cntr, T(KEY) key, int limit){
-    KV(tree_t) * t = cntr->root;
+    KV(tree_t)* stack[cntr->ever_height+1];
+    signed char eq[cntr->ever_height+1]; // 1: 相等, 0: 不相等, -1: 還沒比較
+    int p = 0;
 
     if( limit != 1 && GIMME_V != G_ARRAY )
         limit = 1;
 
-    while( t != (KV(tree_t)*) &nil ){
-        if( K(cmp)(aTHX_ SP, t->key, key, cntr->cmp) == 0 ){
-            KV(tree_t)* stack[cntr->ever_height+1];
-            int p = 0;
-            stack[0] = NULL;
-
-            while( limit != 0 && p >= 0 ){
-                if( stack[p] == NULL ){ // from parent, current = t
-                    if( t == (KV(tree_t)*) &nil )
-                        --p;
-                    else{
-                        if( K(cmp)(aTHX_ SP, t->key, key, cntr->cmp) FIND_CMP_OP 0 ){
-                            stack[p] = t; // attempt GOOD child
-                            stack[++p] = NULL;
-                            t = t->FIND_GOOD_DIR;
-                        }
-                        else{
-                            stack[p] = (KV(tree_t)*) &nil; // attempt BAD child
-                            stack[++p] = NULL;
-                            t = t->FIND_BAD_DIR;
-                        }
-                    }
-                }
-                else if( stack[p] == (KV(tree_t)*) &nil ) // from BAD child, current is useless
-                    --p;
-                else{ // from GOOD child, current = stack[p], current->key >= key
-                    t = stack[p];
-                    if( K(cmp)(aTHX_ SP, t->key, key, cntr->cmp) == 0 ){
-                        SP = K(mxret)(aTHX_ SP, t->key);
+    for(KV(tree_t) * t = cntr->root; t != (KV(tree_t)*) &nil; ){
+        IV c = KV(tree_cmp)(aTHX_ SP, cntr, t->key, key);
+        if( c FIND_CMP_OP 0 ){
+            stack[p] = t;
+            eq[p++] = c == 0;
+            t = t->FIND_GOOD_DIR;
+        }
+        else
+            t = t->FIND_BAD_DIR;
+    }
+
+    while( limit != 0 && p > 0 ){
+        KV(tree_t) * t = stack[--p];
+        if( eq[p] < 0 ? KV(tree_cmp)(aTHX_ SP, cntr, t->key, key) != 0 : !eq[p] )
+            break;
+
+        SP = K(mxret)(aTHX_ SP, t->key);
 #if I(VALUE) != I(void)
-                        SP = V(mxret)(aTHX_ SP, t->value);
+        SP = V(mxret)(aTHX_ SP, t->value);
 #endif
-                        --limit;
-
-                        stack[p] = (KV(tree_t)*) &nil; // attempt BAD child
-                        stack[++p] = NULL;
-                        t = t->FIND_BAD_DIR;
-                    }
-                    else
-                        --p;
-                }
-            }
+        --limit;
+
+        for(t = t->FIND_BAD_DIR; t != (KV(tree_t)*) &nil; t = t->FIND_GOOD_DIR){
+            stack[p] = t;
+            eq[p++] = -1;
+        }
+    }
+
 #if I(VALUE) != I(void)
-            if( GIMME_V != G_ARRAY )
-                --SP;
+    if( limit == 0 && GIMME_V != G_ARRAY ) // 純量 context 的 limit 是 1, 所以有找到
+        --SP;
 #endif
-            return SP;
-        }
-        if( K(cmp)(aTHX_ SP, t->key, key, cntr->cmp) FIND_CMP_OP 0 )
+    return SP;
+}
+
+// 只往下走一次, 每個節點只比較一次
+// return 第一個 (或最後一個) key 一樣大的 cell, 找不到的話 return NULL
+static inline KV(tree_t) * KV(FIND_CELL_FUNC)(pTHX_ SV** SP, KV(tree_cntr_t) * cntr, T(KEY) key){
+    KV(tree_t) * t = cntr->root;
+    KV(tree_t) * found = NULL;
+    while( t != (KV(tree_t)*) &nil ){
+        IV c = KV(tree_cmp)(aTHX_ SP, cntr, t->key, key);
+        if( c FIND_CMP_OP 0 ){
+            if( c == 0 )
+                found = t;
             t = t->FIND_GOOD_DIR;
+        }
         else
             t = t->FIND_BAD_DIR;
     }
-    return SP;
+    return found;
 }
@@ -1,52 +1,36 @@
 // vim: filetype=xs
 
+// 往下找到最接近給定 key 的 entry, 沿路把符合條件的節點存進 stack
+// 之後從 stack 取出的節點一定符合條件, 不必再比較
 static inline SV** KV(FUZZY_FIND_FUNC)(pTHX_ SV** SP, KV(tree_cntr_t) * cntr, T(KEY) key, int limit){
-    KV(tree_t) * t = cntr->root;
+    KV(tree_t)* stack[cntr->ever_height+1];
+    int p = 0;
 
     if( limit != 1 && GIMME_V != G_ARRAY )
         limit = 1;
 
-    KV(tree_t)* stack[cntr->ever_height+1];
-    int p = 0;
-    stack[0] = NULL;
-
-    while( limit != 0 && p >= 0 ){
-        if( stack[p] == NULL ){ // from parent, current = t
-            if( t == (KV(tree_t)*) &nil )
-                --p;
-            else{
-                if( K(cmp)(aTHX_ SP, t->key, key, cntr->cmp) FUZZY_FIND_CMP_OP 0 ){
-                    stack[p] = t; // attempt GOOD child
-                    stack[++p] = NULL;
-                    t = t->FUZZY_FIND_GOOD_DIR;
-                }
-                else{
-                    stack[p] = (KV(tree_t)*) &nil; // attempt BAD child
-                    stack[++p] = NULL;
-                    t = t->FUZZY_FIND_BAD_DIR;
-                }
-            }
+    for(KV(tree_t) * t = cntr->root; t != (KV(tree_t)*) &nil; )
+        if( KV(tree_cmp)(aTHX_ SP, cntr, t->key, key) FUZZY_FIND_CMP_OP 0 ){
+            stack[p++] = t;
+            t = t->FUZZY_FIND_GOOD_DIR;
         }
-        else if( stack[p] == (KV(tree_t)*) &nil ) // from BAD child, current is useless
-            --p;
-        else{ // from GOOD child, current = stack[p]
-            t = stack[p];
-            if( K(cmp)(aTHX_ SP, t->key, key, cntr->cmp) FUZZY_FIND_CMP_OP 0 ){
-                SP = K(mxret)(aTHX_ SP, t->key);
+        else
+            t = t->FUZZY_FIND_BAD_DIR;
+
+    while( limit != 0 && p > 0 ){
+        KV(tree_t) * t = stack[--p];
+        SP = K(mxret)(aTHX_ SP, t->key);
 #if I(VALUE) != I(void)
-                SP = V(mxret)(aTHX_ SP, t->value);
+        SP = V(mxret)(aTHX_ SP, t->value);
 #endif
-                --limit;
-            }
+        --limit;
 
-            stack[p] = (KV(tree_t)*) &nil; // attempt BAD child
-            stack[++p] = NULL;
-            t = t->FUZZY_FIND_BAD_DIR;
-        }
+        for(t = t->FUZZY_FIND_BAD_DIR; t != (KV(tree_t)*) &nil; t = t->FUZZY_FIND_GOOD_DIR)
+            stack[p++] = t;
     }
 
 #if I(VALUE) != I(void)
-    if( p >= 0 && GIMME_V != G_ARRAY )
+    if( limit == 0 && GIMME_V != G_ARRAY ) // 純量 context 的 limit 是 1, 所以有找到
         --SP;
 #endif
     return SP;
@@ -56,12 +40,97 @@ static inline UV KV(FUZZY_COUNT_FUNC)(pTHX_ SV**SP, KV(tree_cntr_t) * cntr, T(KE
     KV(tree_t) * t = cntr->root;
     int count = 0;
     while( t != (KV(tree_t)*) &nil ){
-        if( K(cmp)(aTHX_ SP, t->key, key, cntr->cmp) FUZZY_FIND_CMP_OP 0 ){
+        if( KV(tree_cmp)(aTHX_ SP, cntr, t->key, key) FUZZY_FIND_CMP_OP 0 ){
+            count += t->FUZZY_FIND_BAD_DIR->size + 1;
+            t = t->FUZZY_FIND_GOOD_DIR;
+        }
+        else
+            t = t->FUZZY_FIND_BAD_DIR;
+    }
+    return count;
+}
+
+// finger 是上一次查詢留下的路徑, finger[0 .. *depth-1] 是走過的節點, finger[*depth] 是走到的 nil
+// 第一次查詢前 *depth = -1
+// 先從路徑最深處往上找到 key 還在範圍內的位置, 再從那裡往下走
+// 連續的 key 排好序的時候, 大部分的比較都省下來了
+// shared 可以是 NULL; 不是的話, 傳入 *shared < 0 表示不用 finger 往上找, 直接從 root 往下走,
+// 傳回時 *shared 設為新的路徑開頭有幾個節點和舊的路徑一樣 (連走的方向也一樣)
+static inline UV KV(FUZZY_FINGER_FUNC)(pTHX_ SV**SP, KV(tree_cntr_t) * cntr, KV(tree_finger_t) * finger, int * depth, int * shared, T(KEY) key){
+    KV(tree_t) * t;
+    UV count;
+    int d = *depth;
+    int old_depth = d;
+    int same = 0;
+
+    if( d < 0 || (shared && *shared < 0) ){
+        t = cntr->root;
+        count = 0;
+        d = 0;
+    }
+    else{
+        // 只有 key 移動的那一邊的決定會改變, 先各試最深的一個
+        int flip = -1;
+        bool tested[2] = { FALSE, FALSE };
+        for(int i=d-1; i>=0 && !(tested[0] && tested[1]); --i){
+            bool good = finger[i].good;
+            if( tested[good] )
+                continue;
+            tested[good] = TRUE;
+            if( (KV(tree_cmp)(aTHX_ SP, cntr, finger[i].tree->key, key) FUZZY_FIND_CMP_OP 0) != good ){
+                flip = i;
+                break;
+            }
+        }
+        if( flip < 0 ){ // 還在同一個空隙裡
+            if( shared )
+                *shared = d;
+            return finger[d].count;
+        }
+
+        // 同一邊的決定越往上越不會改變, 找出最上面改變的那一個
+        bool good = finger[flip].good;
+        for(int i=flip-1; i>=0; --i){
+            if( finger[i].good != good )
+                continue;
+            if( (KV(tree_cmp)(aTHX_ SP, cntr, finger[i].tree->key, key) FUZZY_FIND_CMP_OP 0) == good )
+                break;
+            flip = i;
+        }
+
+        t = finger[flip].tree;
+        count = finger[flip].count;
+        same = flip;
+        d = flip;
+        finger[d].good = !good;
+        ++d;
+        if( !good ){
+            count += t->FUZZY_FIND_BAD_DIR->size + 1;
+            t = t->FUZZY_FIND_GOOD_DIR;
+        }
+        else
+            t = t->FUZZY_FIND_BAD_DIR;
+    }
+
+    while( t != (KV(tree_t)*) &nil ){
+        bool good = KV(tree_cmp)(aTHX_ SP, cntr, t->key, key) FUZZY_FIND_CMP_OP 0;
+        if( d == same && d < old_depth && finger[d].tree == t && finger[d].good == good )
+            ++same;
+        finger[d].tree = t;
+        finger[d].count = count;
+        finger[d].good = good;
+        if( good ){
             count += t->FUZZY_FIND_BAD_DIR->size + 1;
             t = t->FUZZY_FIND_GOOD_DIR;
         }
         else
             t = t->FUZZY_FIND_BAD_DIR;
+        ++d;
     }
+    finger[d].tree = t;
+    finger[d].count = count;
+    *depth = d;
+    if( shared )
+        *shared = same;
     return count;
 }
@@ -1,40 +1,22 @@
 // vim: filetype=xs
 
-KV(tree_t) * KV(INSERT_SUBTREE_FUNC)(pTHX_ SV**SP, KV(tree_cntr_t) * cntr, KV(tree_t) * p, T(KEY) key, KV(tree_t) * new_tree, T(VALUE) value, int height){
-    ++p->size;
-    if( K(cmp)(aTHX_ SP, p->key, key, cntr->cmp) INSERT_CMP_OP 0 ){
-        if( p->right == (KV(tree_t)*) &nil ){
-            p->right = new_tree;
-            if( height > cntr->ever_height )
-                cntr->ever_height = height;
-        }
-        else{
-            p->right = KV(INSERT_SUBTREE_FUNC)(aTHX_ SP, cntr, p->right, key, new_tree, value, height+1);
-            p = (KV(tree_t)*) maintain_larger_right(p);
-        }
-    }
-    else{
-        if( p->left == (KV(tree_t)*) &nil ){
-            p->left = new_tree;
-            if( height > cntr->ever_height )
-                cntr->ever_height = height;
+// 沿路記下經過的節點, 接上新的 cell 以後由 tree_commit_insert 由下往上調整
+static inline void KV(INSERT_FUNC)(pTHX_ SV**SP, KV(tree_cntr_t) * cntr, T(KEY) key, T(VALUE) value){
+    KV(tree_t) * path[cntr->ever_height+1];
+    bool went_right[cntr->ever_height+1];
+    int depth = 0;
+
+    for(KV(tree_t) * t = cntr->root; t != (KV(tree_t)*) &nil; ++depth){
+        path[depth] = t;
+        if( KV(tree_cmp)(aTHX_ SP, cntr, t->key, key) INSERT_CMP_OP 0 ){
+            went_right[depth] = TRUE;
+            t = t->right;
         }
         else{
-            p->left = KV(INSERT_SUBTREE_FUNC)(aTHX_ SP, cntr, p->left, key, new_tree, value, height+1);
-            p = (KV(tree_t)*) maintain_larger_left(p);
+            went_right[depth] = FALSE;
+            t = t->left;
         }
     }
-    return p;
-}
-static inline void KV(INSERT_FUNC)(pTHX_ SV**SP, KV(tree_cntr_t) * cntr, T(KEY) key, T(VALUE) value){
-    KV(tree_t) * new_tree = KV(allocate_cell)(cntr, key, value);
-
-    if( UNLIKELY(cntr->root == (KV(tree_t)*) &nil) ){
-        cntr->root = new_tree;
-        if( cntr->ever_height < 1 )
-            cntr->ever_height = 1;
-        return;
-    }
 
-    cntr->root = KV(INSERT_SUBTREE_FUNC)(aTHX_ SP, cntr, cntr->root, key, new_tree, value, 2);
+    KV(tree_commit_insert)(cntr, path, went_right, depth, KV(allocate_cell)(cntr, key, value));
 }
@@ -0,0 +1,84 @@
+package Tree::SizeBalanced::any_any;
+
+use strict;
+use warnings;
+
+use Tree::SizeBalanced;
+
+*new = \&Tree::SizeBalanced::Core::new_any_any;
+*new_from_sorted = \&Tree::SizeBalanced::Core::new_from_sorted_any_any;
+*DESTROY = \&Tree::SizeBalanced::Core::DESTROY_any_any;
+*size = \&Tree::SizeBalanced::Core::size_any_any;
+*ever_height = \&Tree::SizeBalanced::Core::ever_height_any_any;
+*cmp_count = \&Tree::SizeBalanced::Core::cmp_count_any_any;
+*insert = \&Tree::SizeBalanced::Core::insert_any_any;
+*insert_before = \&Tree::SizeBalanced::Core::insert_before_any_any;
+*insert_after = \&Tree::SizeBalanced::Core::insert_after_any_any;
+*insert_unique = \&Tree::SizeBalanced::Core::insert_unique_any_any;
+*set = \&Tree::SizeBalanced::Core::set_any_any;
+*add_value = \&Tree::SizeBalanced::Core::add_value_any_any;
+*incr = \&Tree::SizeBalanced::Core::incr_any_any;
+*insert_many = \&Tree::SizeBalanced::Core::insert_many_any_any;
+*delete = \&Tree::SizeBalanced::Core::delete_any_any;
+*delete_first = \&Tree::SizeBalanced::Core::delete_first_any_any;
+*delete_last = \&Tree::SizeBalanced::Core::delete_last_any_any;
+*take_first = \&Tree::SizeBalanced::Core::take_first_any_any;
+*take_last = \&Tree::SizeBalanced::Core::take_last_any_any;
+*delete_many = \&Tree::SizeBalanced::Core::delete_many_any_any;
+*delete_many_first = \&Tree::SizeBalanced::Core::delete_many_first_any_any;
+*delete_many_last = \&Tree::SizeBalanced::Core::delete_many_last_any_any;
+*delete_gt_lt = \&Tree::SizeBalanced::Core::delete_gt_lt_any_any;
+*delete_ge_lt = \&Tree::SizeBalanced::Core::delete_ge_lt_any_any;
+*delete_gt_le = \&Tree::SizeBalanced::Core::delete_gt_le_any_any;
+*delete_ge_le = \&Tree::SizeBalanced::Core::delete_ge_le_any_any;
+*drain_le = \&Tree::SizeBalanced::Core::drain_le_any_any;
+*drain_ge = \&Tree::SizeBalanced::Core::drain_ge_any_any;
+*split_lt = \&Tree::SizeBalanced::Core::split_lt_any_any;
+*split_le = \&Tree::SizeBalanced::Core::split_le_any_any;
+*join = \&Tree::SizeBalanced::Core::join_any_any;
+*union = \&Tree::SizeBalanced::Core::union_any_any;
+*intersection = \&Tree::SizeBalanced::Core::intersection_any_any;
+*difference = \&Tree::SizeBalanced::Core::difference_any_any;
+*find = \&Tree::SizeBalanced::Core::find_any_any;
+*find_first = \&Tree::SizeBalanced::Core::find_first_any_any;
+*find_last = \&Tree::SizeBalanced::Core::find_last_any_any;
+*exists = \&Tree::SizeBalanced::Core::exists_any_any;
+*get_many = \&Tree::SizeBalanced::Core::get_many_any_any;
+*find_lt = \&Tree::SizeBalanced::Core::find_lt_any_any;
+*find_le = \&Tree::SizeBalanced::Core::find_le_any_any;
+*find_gt = \&Tree::SizeBalanced::Core::find_gt_any_any;
+*find_ge = \&Tree::SizeBalanced::Core::find_ge_any_any;
+*find_lt_many = \&Tree::SizeBalanced::Core::find_lt_many_any_any;
+*find_le_many = \&Tree::SizeBalanced::Core::find_le_many_any_any;
+*find_gt_many = \&Tree::SizeBalanced::Core::find_gt_many_any_any;
+*find_ge_many = \&Tree::SizeBalanced::Core::find_ge_many_any_any;
+*find_gt_lt = \&Tree::SizeBalanced::Core::find_gt_lt_any_any;
+*find_ge_lt = \&Tree::SizeBalanced::Core::find_ge_lt_any_any;
+*find_gt_le = \&Tree::SizeBalanced::Core::find_gt_le_any_any;
+*find_ge_le = \&Tree::SizeBalanced::Core::find_ge_le_any_any;
+*count_lt = \&Tree::SizeBalanced::Core::count_lt_any_any;
+*count_le = \&Tree::SizeBalanced::Core::count_le_any_any;
+*count_gt = \&Tree::SizeBalanced::Core::count_gt_any_any;
+*count_ge = \&Tree::SizeBalanced::Core::count_ge_any_any;
+*count_eq = \&Tree::SizeBalanced::Core::count_eq_any_any;
+*equal_range = \&Tree::SizeBalanced::Core::equal_range_any_any;
+*count_lt_many = \&Tree::SizeBalanced::Core::count_lt_many_any_any;
+*count_le_many = \&Tree::SizeBalanced::Core::count_le_many_any_any;
+*count_gt_many = \&Tree::SizeBalanced::Core::count_gt_many_any_any;
+*count_ge_many = \&Tree::SizeBalanced::Core::count_ge_many_any_any;
+*apply = \&Tree::SizeBalanced::Core::apply_any_any;
+*find_min = \&Tree::SizeBalanced::Core::find_min_any_any;
+*find_max = \&Tree::SizeBalanced::Core::find_max_any_any;
+*pop_min = \&Tree::SizeBalanced::Core::pop_min_any_any;
+*pop_max = \&Tree::SizeBalanced::Core::pop_max_any_any;
+*skip_l = \&Tree::SizeBalanced::Core::skip_l_any_any;
+*skip_g = \&Tree::SizeBalanced::Core::skip_g_any_any;
+*delete_at = \&Tree::SizeBalanced::Core::delete_at_any_any;
+*delete_ranks = \&Tree::SizeBalanced::Core::delete_ranks_any_any;
+*clear = \&Tree::SizeBalanced::Core::clear_any_any;
+*reserve = \&Tree::SizeBalanced::Core::reserve_any_any;
+*compact = \&Tree::SizeBalanced::Core::compact_any_any;
+*dump = \&Tree::SizeBalanced::Core::dump_any_any;
+*check = \&Tree::SizeBalanced::Core::check_any_any;
+
+1;
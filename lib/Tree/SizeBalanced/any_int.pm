@@ -0,0 +1,84 @@
+package Tree::SizeBalanced::any_int;
+
+use strict;
+use warnings;
+
+use Tree::SizeBalanced;
+
+*new = \&Tree::SizeBalanced::Core::new_any_int;
+*new_from_sorted = \&Tree::SizeBalanced::Core::new_from_sorted_any_int;
+*DESTROY = \&Tree::SizeBalanced::Core::DESTROY_any_int;
+*size = \&Tree::SizeBalanced::Core::size_any_int;
+*ever_height = \&Tree::SizeBalanced::Core::ever_height_any_int;
+*cmp_count = \&Tree::SizeBalanced::Core::cmp_count_any_int;
+*insert = \&Tree::SizeBalanced::Core::insert_any_int;
+*insert_before = \&Tree::SizeBalanced::Core::insert_before_any_int;
+*insert_after = \&Tree::SizeBalanced::Core::insert_after_any_int;
+*insert_unique = \&Tree::SizeBalanced::Core::insert_unique_any_int;
+*set = \&Tree::SizeBalanced::Core::set_any_int;
+*add_value = \&Tree::SizeBalanced::Core::add_value_any_int;
+*incr = \&Tree::SizeBalanced::Core::incr_any_int;
+*insert_many = \&Tree::SizeBalanced::Core::insert_many_any_int;
+*delete = \&Tree::SizeBalanced::Core::delete_any_int;
+*delete_first = \&Tree::SizeBalanced::Core::delete_first_any_int;
+*delete_last = \&Tree::SizeBalanced::Core::delete_last_any_int;
+*take_first = \&Tree::SizeBalanced::Core::take_first_any_int;
+*take_last = \&Tree::SizeBalanced::Core::take_last_any_int;
+*delete_many = \&Tree::SizeBalanced::Core::delete_many_any_int;
+*delete_many_first = \&Tree::SizeBalanced::Core::delete_many_first_any_int;
+*delete_many_last = \&Tree::SizeBalanced::Core::delete_many_last_any_int;
+*delete_gt_lt = \&Tree::SizeBalanced::Core::delete_gt_lt_any_int;
+*delete_ge_lt = \&Tree::SizeBalanced::Core::delete_ge_lt_any_int;
+*delete_gt_le = \&Tree::SizeBalanced::Core::delete_gt_le_any_int;
+*delete_ge_le = \&Tree::SizeBalanced::Core::delete_ge_le_any_int;
+*drain_le = \&Tree::SizeBalanced::Core::drain_le_any_int;
+*drain_ge = \&Tree::SizeBalanced::Core::drain_ge_any_int;
+*split_lt = \&Tree::SizeBalanced::Core::split_lt_any_int;
+*split_le = \&Tree::SizeBalanced::Core::split_le_any_int;
+*join = \&Tree::SizeBalanced::Core::join_any_int;
+*union = \&Tree::SizeBalanced::Core::union_any_int;
+*intersection = \&Tree::SizeBalanced::Core::intersection_any_int;
+*difference = \&Tree::SizeBalanced::Core::difference_any_int;
+*find = \&Tree::SizeBalanced::Core::find_any_int;
+*find_first = \&Tree::SizeBalanced::Core::find_first_any_int;
+*find_last = \&Tree::SizeBalanced::Core::find_last_any_int;
+*exists = \&Tree::SizeBalanced::Core::exists_any_int;
+*get_many = \&Tree::SizeBalanced::Core::get_many_any_int;
+*find_lt = \&Tree::SizeBalanced::Core::find_lt_any_int;
+*find_le = \&Tree::SizeBalanced::Core::find_le_any_int;
+*find_gt = \&Tree::SizeBalanced::Core::find_gt_any_int;
+*find_ge = \&Tree::SizeBalanced::Core::find_ge_any_int;
+*find_lt_many = \&Tree::SizeBalanced::Core::find_lt_many_any_int;
+*find_le_many = \&Tree::SizeBalanced::Core::find_le_many_any_int;
+*find_gt_many = \&Tree::SizeBalanced::Core::find_gt_many_any_int;
+*find_ge_many = \&Tree::SizeBalanced::Core::find_ge_many_any_int;
+*find_gt_lt = \&Tree::SizeBalanced::Core::find_gt_lt_any_int;
+*find_ge_lt = \&Tree::SizeBalanced::Core::find_ge_lt_any_int;
+*find_gt_le = \&Tree::SizeBalanced::Core::find_gt_le_any_int;
+*find_ge_le = \&Tree::SizeBalanced::Core::find_ge_le_any_int;
+*count_lt = \&Tree::SizeBalanced::Core::count_lt_any_int;
+*count_le = \&Tree::SizeBalanced::Core::count_le_any_int;
+*count_gt = \&Tree::SizeBalanced::Core::count_gt_any_int;
+*count_ge = \&Tree::SizeBalanced::Core::count_ge_any_int;
+*count_eq = \&Tree::SizeBalanced::Core::count_eq_any_int;
+*equal_range = \&Tree::SizeBalanced::Core::equal_range_any_int;
+*count_lt_many = \&Tree::SizeBalanced::Core::count_lt_many_any_int;
+*count_le_many = \&Tree::SizeBalanced::Core::count_le_many_any_int;
+*count_gt_many = \&Tree::SizeBalanced::Core::count_gt_many_any_int;
+*count_ge_many = \&Tree::SizeBalanced::Core::count_ge_many_any_int;
+*apply = \&Tree::SizeBalanced::Core::apply_any_int;
+*find_min = \&Tree::SizeBalanced::Core::find_min_any_int;
+*find_max = \&Tree::SizeBalanced::Core::find_max_any_int;
+*pop_min = \&Tree::SizeBalanced::Core::pop_min_any_int;
+*pop_max = \&Tree::SizeBalanced::Core::pop_max_any_int;
+*skip_l = \&Tree::SizeBalanced::Core::skip_l_any_int;
+*skip_g = \&Tree::SizeBalanced::Core::skip_g_any_int;
+*delete_at = \&Tree::SizeBalanced::Core::delete_at_any_int;
+*delete_ranks = \&Tree::SizeBalanced::Core::delete_ranks_any_int;
+*clear = \&Tree::SizeBalanced::Core::clear_any_int;
+*reserve = \&Tree::SizeBalanced::Core::reserve_any_int;
+*compact = \&Tree::SizeBalanced::Core::compact_any_int;
+*dump = \&Tree::SizeBalanced::Core::dump_any_int;
+*check = \&Tree::SizeBalanced::Core::check_any_int;
+
+1;
@@ -0,0 +1,84 @@
+package Tree::SizeBalanced::int_any;
+
+use strict;
+use warnings;
+
+use Tree::SizeBalanced;
+
+*new = \&Tree::SizeBalanced::Core::new_int_any;
+*new_from_sorted = \&Tree::SizeBalanced::Core::new_from_sorted_int_any;
+*DESTROY = \&Tree::SizeBalanced::Core::DESTROY_int_any;
+*size = \&Tree::SizeBalanced::Core::size_int_any;
+*ever_height = \&Tree::SizeBalanced::Core::ever_height_int_any;
+*cmp_count = \&Tree::SizeBalanced::Core::cmp_count_int_any;
+*insert = \&Tree::SizeBalanced::Core::insert_int_any;
+*insert_before = \&Tree::SizeBalanced::Core::insert_before_int_any;
+*insert_after = \&Tree::SizeBalanced::Core::insert_after_int_any;
+*insert_unique = \&Tree::SizeBalanced::Core::insert_unique_int_any;
+*set = \&Tree::SizeBalanced::Core::set_int_any;
+*add_value = \&Tree::SizeBalanced::Core::add_value_int_any;
+*incr = \&Tree::SizeBalanced::Core::incr_int_any;
+*insert_many = \&Tree::SizeBalanced::Core::insert_many_int_any;
+*delete = \&Tree::SizeBalanced::Core::delete_int_any;
+*delete_first = \&Tree::SizeBalanced::Core::delete_first_int_any;
+*delete_last = \&Tree::SizeBalanced::Core::delete_last_int_any;
+*take_first = \&Tree::SizeBalanced::Core::take_first_int_any;
+*take_last = \&Tree::SizeBalanced::Core::take_last_int_any;
+*delete_many = \&Tree::SizeBalanced::Core::delete_many_int_any;
+*delete_many_first = \&Tree::SizeBalanced::Core::delete_many_first_int_any;
+*delete_many_last = \&Tree::SizeBalanced::Core::delete_many_last_int_any;
+*delete_gt_lt = \&Tree::SizeBalanced::Core::delete_gt_lt_int_any;
+*delete_ge_lt = \&Tree::SizeBalanced::Core::delete_ge_lt_int_any;
+*delete_gt_le = \&Tree::SizeBalanced::Core::delete_gt_le_int_any;
+*delete_ge_le = \&Tree::SizeBalanced::Core::delete_ge_le_int_any;
+*drain_le = \&Tree::SizeBalanced::Core::drain_le_int_any;
+*drain_ge = \&Tree::SizeBalanced::Core::drain_ge_int_any;
+*split_lt = \&Tree::SizeBalanced::Core::split_lt_int_any;
+*split_le = \&Tree::SizeBalanced::Core::split_le_int_any;
+*join = \&Tree::SizeBalanced::Core::join_int_any;
+*union = \&Tree::SizeBalanced::Core::union_int_any;
+*intersection = \&Tree::SizeBalanced::Core::intersection_int_any;
+*difference = \&Tree::SizeBalanced::Core::difference_int_any;
+*find = \&Tree::SizeBalanced::Core::find_int_any;
+*find_first = \&Tree::SizeBalanced::Core::find_first_int_any;
+*find_last = \&Tree::SizeBalanced::Core::find_last_int_any;
+*exists = \&Tree::SizeBalanced::Core::exists_int_any;
+*get_many = \&Tree::SizeBalanced::Core::get_many_int_any;
+*find_lt = \&Tree::SizeBalanced::Core::find_lt_int_any;
+*find_le = \&Tree::SizeBalanced::Core::find_le_int_any;
+*find_gt = \&Tree::SizeBalanced::Core::find_gt_int_any;
+*find_ge = \&Tree::SizeBalanced::Core::find_ge_int_any;
+*find_lt_many = \&Tree::SizeBalanced::Core::find_lt_many_int_any;
+*find_le_many = \&Tree::SizeBalanced::Core::find_le_many_int_any;
+*find_gt_many = \&Tree::SizeBalanced::Core::find_gt_many_int_any;
+*find_ge_many = \&Tree::SizeBalanced::Core::find_ge_many_int_any;
+*find_gt_lt = \&Tree::SizeBalanced::Core::find_gt_lt_int_any;
+*find_ge_lt = \&Tree::SizeBalanced::Core::find_ge_lt_int_any;
+*find_gt_le = \&Tree::SizeBalanced::Core::find_gt_le_int_any;
+*find_ge_le = \&Tree::SizeBalanced::Core::find_ge_le_int_any;
+*count_lt = \&Tree::SizeBalanced::Core::count_lt_int_any;
+*count_le = \&Tree::SizeBalanced::Core::count_le_int_any;
+*count_gt = \&Tree::SizeBalanced::Core::count_gt_int_any;
+*count_ge = \&Tree::SizeBalanced::Core::count_ge_int_any;
+*count_eq = \&Tree::SizeBalanced::Core::count_eq_int_any;
+*equal_range = \&Tree::SizeBalanced::Core::equal_range_int_any;
+*count_lt_many = \&Tree::SizeBalanced::Core::count_lt_many_int_any;
+*count_le_many = \&Tree::SizeBalanced::Core::count_le_many_int_any;
+*count_gt_many = \&Tree::SizeBalanced::Core::count_gt_many_int_any;
+*count_ge_many = \&Tree::SizeBalanced::Core::count_ge_many_int_any;
+*apply = \&Tree::SizeBalanced::Core::apply_int_any;
+*find_min = \&Tree::SizeBalanced::Core::find_min_int_any;
+*find_max = \&Tree::SizeBalanced::Core::find_max_int_any;
+*pop_min = \&Tree::SizeBalanced::Core::pop_min_int_any;
+*pop_max = \&Tree::SizeBalanced::Core::pop_max_int_any;
+*skip_l = \&Tree::SizeBalanced::Core::skip_l_int_any;
+*skip_g = \&Tree::SizeBalanced::Core::skip_g_int_any;
+*delete_at = \&Tree::SizeBalanced::Core::delete_at_int_any;
+*delete_ranks = \&Tree::SizeBalanced::Core::delete_ranks_int_any;
+*clear = \&Tree::SizeBalanced::Core::clear_int_any;
+*reserve = \&Tree::SizeBalanced::Core::reserve_int_any;
+*compact = \&Tree::SizeBalanced::Core::compact_int_any;
+*dump = \&Tree::SizeBalanced::Core::dump_int_any;
+*check = \&Tree::SizeBalanced::Core::check_int_any;
+
+1;
@@ -0,0 +1,84 @@
+package Tree::SizeBalanced::int_int;
+
+use strict;
+use warnings;
+
+use Tree::SizeBalanced;
+
+*new = \&Tree::SizeBalanced::Core::new_int_int;
+*new_from_sorted = \&Tree::SizeBalanced::Core::new_from_sorted_int_int;
+*DESTROY = \&Tree::SizeBalanced::Core::DESTROY_int_int;
+*size = \&Tree::SizeBalanced::Core::size_int_int;
+*ever_height = \&Tree::SizeBalanced::Core::ever_height_int_int;
+*cmp_count = \&Tree::SizeBalanced::Core::cmp_count_int_int;
+*insert = \&Tree::SizeBalanced::Core::insert_int_int;
+*insert_before = \&Tree::SizeBalanced::Core::insert_before_int_int;
+*insert_after = \&Tree::SizeBalanced::Core::insert_after_int_int;
+*insert_unique = \&Tree::SizeBalanced::Core::insert_unique_int_int;
+*set = \&Tree::SizeBalanced::Core::set_int_int;
+*add_value = \&Tree::SizeBalanced::Core::add_value_int_int;
+*incr = \&Tree::SizeBalanced::Core::incr_int_int;
+*insert_many = \&Tree::SizeBalanced::Core::insert_many_int_int;
+*delete = \&Tree::SizeBalanced::Core::delete_int_int;
+*delete_first = \&Tree::SizeBalanced::Core::delete_first_int_int;
+*delete_last = \&Tree::SizeBalanced::Core::delete_last_int_int;
+*take_first = \&Tree::SizeBalanced::Core::take_first_int_int;
+*take_last = \&Tree::SizeBalanced::Core::take_last_int_int;
+*delete_many = \&Tree::SizeBalanced::Core::delete_many_int_int;
+*delete_many_first = \&Tree::SizeBalanced::Core::delete_many_first_int_int;
+*delete_many_last = \&Tree::SizeBalanced::Core::delete_many_last_int_int;
+*delete_gt_lt = \&Tree::SizeBalanced::Core::delete_gt_lt_int_int;
+*delete_ge_lt = \&Tree::SizeBalanced::Core::delete_ge_lt_int_int;
+*delete_gt_le = \&Tree::SizeBalanced::Core::delete_gt_le_int_int;
+*delete_ge_le = \&Tree::SizeBalanced::Core::delete_ge_le_int_int;
+*drain_le = \&Tree::SizeBalanced::Core::drain_le_int_int;
+*drain_ge = \&Tree::SizeBalanced::Core::drain_ge_int_int;
+*split_lt = \&Tree::SizeBalanced::Core::split_lt_int_int;
+*split_le = \&Tree::SizeBalanced::Core::split_le_int_int;
+*join = \&Tree::SizeBalanced::Core::join_int_int;
+*union = \&Tree::SizeBalanced::Core::union_int_int;
+*intersection = \&Tree::SizeBalanced::Core::intersection_int_int;
+*difference = \&Tree::SizeBalanced::Core::difference_int_int;
+*find = \&Tree::SizeBalanced::Core::find_int_int;
+*find_first = \&Tree::SizeBalanced::Core::find_first_int_int;
+*find_last = \&Tree::SizeBalanced::Core::find_last_int_int;
+*exists = \&Tree::SizeBalanced::Core::exists_int_int;
+*get_many = \&Tree::SizeBalanced::Core::get_many_int_int;
+*find_lt = \&Tree::SizeBalanced::Core::find_lt_int_int;
+*find_le = \&Tree::SizeBalanced::Core::find_le_int_int;
+*find_gt = \&Tree::SizeBalanced::Core::find_gt_int_int;
+*find_ge = \&Tree::SizeBalanced::Core::find_ge_int_int;
+*find_lt_many = \&Tree::SizeBalanced::Core::find_lt_many_int_int;
+*find_le_many = \&Tree::SizeBalanced::Core::find_le_many_int_int;
+*find_gt_many = \&Tree::SizeBalanced::Core::find_gt_many_int_int;
+*find_ge_many = \&Tree::SizeBalanced::Core::find_ge_many_int_int;
+*find_gt_lt = \&Tree::SizeBalanced::Core::find_gt_lt_int_int;
+*find_ge_lt = \&Tree::SizeBalanced::Core::find_ge_lt_int_int;
+*find_gt_le = \&Tree::SizeBalanced::Core::find_gt_le_int_int;
+*find_ge_le = \&Tree::SizeBalanced::Core::find_ge_le_int_int;
+*count_lt = \&Tree::SizeBalanced::Core::count_lt_int_int;
+*count_le = \&Tree::SizeBalanced::Core::count_le_int_int;
+*count_gt = \&Tree::SizeBalanced::Core::count_gt_int_int;
+*count_ge = \&Tree::SizeBalanced::Core::count_ge_int_int;
+*count_eq = \&Tree::SizeBalanced::Core::count_eq_int_int;
+*equal_range = \&Tree::SizeBalanced::Core::equal_range_int_int;
+*count_lt_many = \&Tree::SizeBalanced::Core::count_lt_many_int_int;
+*count_le_many = \&Tree::SizeBalanced::Core::count_le_many_int_int;
+*count_gt_many = \&Tree::SizeBalanced::Core::count_gt_many_int_int;
+*count_ge_many = \&Tree::SizeBalanced::Core::count_ge_many_int_int;
+*apply = \&Tree::SizeBalanced::Core::apply_int_int;
+*find_min = \&Tree::SizeBalanced::Core::find_min_int_int;
+*find_max = \&Tree::SizeBalanced::Core::find_max_int_int;
+*pop_min = \&Tree::SizeBalanced::Core::pop_min_int_int;
+*pop_max = \&Tree::SizeBalanced::Core::pop_max_int_int;
+*skip_l = \&Tree::SizeBalanced::Core::skip_l_int_int;
+*skip_g = \&Tree::SizeBalanced::Core::skip_g_int_int;
+*delete_at = \&Tree::SizeBalanced::Core::delete_at_int_int;
+*delete_ranks = \&Tree::SizeBalanced::Core::delete_ranks_int_int;
+*clear = \&Tree::SizeBalanced::Core::clear_int_int;
+*reserve = \&Tree::SizeBalanced::Core::reserve_int_int;
+*compact = \&Tree::SizeBalanced::Core::compact_int_int;
+*dump = \&Tree::SizeBalanced::Core::dump_int_int;
+*check = \&Tree::SizeBalanced::Core::check_int_int;
+
+1;
@@ -0,0 +1,84 @@
+package Tree::SizeBalanced::int_void;
+
+use strict;
+use warnings;
+
+use Tree::SizeBalanced;
+
+*new = \&Tree::SizeBalanced::Core::new_int_void;
+*new_from_sorted = \&Tree::SizeBalanced::Core::new_from_sorted_int_void;
+*DESTROY = \&Tree::SizeBalanced::Core::DESTROY_int_void;
+*size = \&Tree::SizeBalanced::Core::size_int_void;
+*ever_height = \&Tree::SizeBalanced::Core::ever_height_int_void;
+*cmp_count = \&Tree::SizeBalanced::Core::cmp_count_int_void;
+*insert = \&Tree::SizeBalanced::Core::insert_int_void;
+*insert_before = \&Tree::SizeBalanced::Core::insert_before_int_void;
+*insert_after = \&Tree::SizeBalanced::Core::insert_after_int_void;
+*insert_unique = \&Tree::SizeBalanced::Core::insert_unique_int_void;
+*set = \&Tree::SizeBalanced::Core::set_int_void;
+*add_value = \&Tree::SizeBalanced::Core::add_value_int_void;
+*incr = \&Tree::SizeBalanced::Core::incr_int_void;
+*insert_many = \&Tree::SizeBalanced::Core::insert_many_int_void;
+*delete = \&Tree::SizeBalanced::Core::delete_int_void;
+*delete_first = \&Tree::SizeBalanced::Core::delete_first_int_void;
+*delete_last = \&Tree::SizeBalanced::Core::delete_last_int_void;
+*take_first = \&Tree::SizeBalanced::Core::take_first_int_void;
+*take_last = \&Tree::SizeBalanced::Core::take_last_int_void;
+*delete_many = \&Tree::SizeBalanced::Core::delete_many_int_void;
+*delete_many_first = \&Tree::SizeBalanced::Core::delete_many_first_int_void;
+*delete_many_last = \&Tree::SizeBalanced::Core::delete_many_last_int_void;
+*delete_gt_lt = \&Tree::SizeBalanced::Core::delete_gt_lt_int_void;
+*delete_ge_lt = \&Tree::SizeBalanced::Core::delete_ge_lt_int_void;
+*delete_gt_le = \&Tree::SizeBalanced::Core::delete_gt_le_int_void;
+*delete_ge_le = \&Tree::SizeBalanced::Core::delete_ge_le_int_void;
+*drain_le = \&Tree::SizeBalanced::Core::drain_le_int_void;
+*drain_ge = \&Tree::SizeBalanced::Core::drain_ge_int_void;
+*split_lt = \&Tree::SizeBalanced::Core::split_lt_int_void;
+*split_le = \&Tree::SizeBalanced::Core::split_le_int_void;
+*join = \&Tree::SizeBalanced::Core::join_int_void;
+*union = \&Tree::SizeBalanced::Core::union_int_void;
+*intersection = \&Tree::SizeBalanced::Core::intersection_int_void;
+*difference = \&Tree::SizeBalanced::Core::difference_int_void;
+*find = \&Tree::SizeBalanced::Core::find_int_void;
+*find_first = \&Tree::SizeBalanced::Core::find_first_int_void;
+*find_last = \&Tree::SizeBalanced::Core::find_last_int_void;
+*exists = \&Tree::SizeBalanced::Core::exists_int_void;
+*get_many = \&Tree::SizeBalanced::Core::get_many_int_void;
+*find_lt = \&Tree::SizeBalanced::Core::find_lt_int_void;
+*find_le = \&Tree::SizeBalanced::Core::find_le_int_void;
+*find_gt = \&Tree::SizeBalanced::Core::find_gt_int_void;
+*find_ge = \&Tree::SizeBalanced::Core::find_ge_int_void;
+*find_lt_many = \&Tree::SizeBalanced::Core::find_lt_many_int_void;
+*find_le_many = \&Tree::SizeBalanced::Core::find_le_many_int_void;
+*find_gt_many = \&Tree::SizeBalanced::Core::find_gt_many_int_void;
+*find_ge_many = \&Tree::SizeBalanced::Core::find_ge_many_int_void;
+*find_gt_lt = \&Tree::SizeBalanced::Core::find_gt_lt_int_void;
+*find_ge_lt = \&Tree::SizeBalanced::Core::find_ge_lt_int_void;
+*find_gt_le = \&Tree::SizeBalanced::Core::find_gt_le_int_void;
+*find_ge_le = \&Tree::SizeBalanced::Core::find_ge_le_int_void;
+*count_lt = \&Tree::SizeBalanced::Core::count_lt_int_void;
+*count_le = \&Tree::SizeBalanced::Core::count_le_int_void;
+*count_gt = \&Tree::SizeBalanced::Core::count_gt_int_void;
+*count_ge = \&Tree::SizeBalanced::Core::count_ge_int_void;
+*count_eq = \&Tree::SizeBalanced::Core::count_eq_int_void;
+*equal_range = \&Tree::SizeBalanced::Core::equal_range_int_void;
+*count_lt_many = \&Tree::SizeBalanced::Core::count_lt_many_int_void;
+*count_le_many = \&Tree::SizeBalanced::Core::count_le_many_int_void;
+*count_gt_many = \&Tree::SizeBalanced::Core::count_gt_many_int_void;
+*count_ge_many = \&Tree::SizeBalanced::Core::count_ge_many_int_void;
+*apply = \&Tree::SizeBalanced::Core::apply_int_void;
+*find_min = \&Tree::SizeBalanced::Core::find_min_int_void;
+*find_max = \&Tree::SizeBalanced::Core::find_max_int_void;
+*pop_min = \&Tree::SizeBalanced::Core::pop_min_int_void;
+*pop_max = \&Tree::SizeBalanced::Core::pop_max_int_void;
+*skip_l = \&Tree::SizeBalanced::Core::skip_l_int_void;
+*skip_g = \&Tree::SizeBalanced::Core::skip_g_int_void;
+*delete_at = \&Tree::SizeBalanced::Core::delete_at_int_void;
+*delete_ranks = \&Tree::SizeBalanced::Core::delete_ranks_int_void;
+*clear = \&Tree::SizeBalanced::Core::clear_int_void;
+*reserve = \&Tree::SizeBalanced::Core::reserve_int_void;
+*compact = \&Tree::SizeBalanced::Core::compact_int_void;
+*dump = \&Tree::SizeBalanced::Core::dump_int_void;
+*check = \&Tree::SizeBalanced::Core::check_int_void;
+
+1;
@@ -0,0 +1,84 @@
+package Tree::SizeBalanced::num_num;
+
+use strict;
+use warnings;
+
+use Tree::SizeBalanced;
+
+*new = \&Tree::SizeBalanced::Core::new_num_num;
+*new_from_sorted = \&Tree::SizeBalanced::Core::new_from_sorted_num_num;
+*DESTROY = \&Tree::SizeBalanced::Core::DESTROY_num_num;
+*size = \&Tree::SizeBalanced::Core::size_num_num;
+*ever_height = \&Tree::SizeBalanced::Core::ever_height_num_num;
+*cmp_count = \&Tree::SizeBalanced::Core::cmp_count_num_num;
+*insert = \&Tree::SizeBalanced::Core::insert_num_num;
+*insert_before = \&Tree::SizeBalanced::Core::insert_before_num_num;
+*insert_after = \&Tree::SizeBalanced::Core::insert_after_num_num;
+*insert_unique = \&Tree::SizeBalanced::Core::insert_unique_num_num;
+*set = \&Tree::SizeBalanced::Core::set_num_num;
+*add_value = \&Tree::SizeBalanced::Core::add_value_num_num;
+*incr = \&Tree::SizeBalanced::Core::incr_num_num;
+*insert_many = \&Tree::SizeBalanced::Core::insert_many_num_num;
+*delete = \&Tree::SizeBalanced::Core::delete_num_num;
+*delete_first = \&Tree::SizeBalanced::Core::delete_first_num_num;
+*delete_last = \&Tree::SizeBalanced::Core::delete_last_num_num;
+*take_first = \&Tree::SizeBalanced::Core::take_first_num_num;
+*take_last = \&Tree::SizeBalanced::Core::take_last_num_num;
+*delete_many = \&Tree::SizeBalanced::Core::delete_many_num_num;
+*delete_many_first = \&Tree::SizeBalanced::Core::delete_many_first_num_num;
+*delete_many_last = \&Tree::SizeBalanced::Core::delete_many_last_num_num;
+*delete_gt_lt = \&Tree::SizeBalanced::Core::delete_gt_lt_num_num;
+*delete_ge_lt = \&Tree::SizeBalanced::Core::delete_ge_lt_num_num;
+*delete_gt_le = \&Tree::SizeBalanced::Core::delete_gt_le_num_num;
+*delete_ge_le = \&Tree::SizeBalanced::Core::delete_ge_le_num_num;
+*drain_le = \&Tree::SizeBalanced::Core::drain_le_num_num;
+*drain_ge = \&Tree::SizeBalanced::Core::drain_ge_num_num;
+*split_lt = \&Tree::SizeBalanced::Core::split_lt_num_num;
+*split_le = \&Tree::SizeBalanced::Core::split_le_num_num;
+*join = \&Tree::SizeBalanced::Core::join_num_num;
+*union = \&Tree::SizeBalanced::Core::union_num_num;
+*intersection = \&Tree::SizeBalanced::Core::intersection_num_num;
+*difference = \&Tree::SizeBalanced::Core::difference_num_num;
+*find = \&Tree::SizeBalanced::Core::find_num_num;
+*find_first = \&Tree::SizeBalanced::Core::find_first_num_num;
+*find_last = \&Tree::SizeBalanced::Core::find_last_num_num;
+*exists = \&Tree::SizeBalanced::Core::exists_num_num;
+*get_many = \&Tree::SizeBalanced::Core::get_many_num_num;
+*find_lt = \&Tree::SizeBalanced::Core::find_lt_num_num;
+*find_le = \&Tree::SizeBalanced::Core::find_le_num_num;
+*find_gt = \&Tree::SizeBalanced::Core::find_gt_num_num;
+*find_ge = \&Tree::SizeBalanced::Core::find_ge_num_num;
+*find_lt_many = \&Tree::SizeBalanced::Core::find_lt_many_num_num;
+*find_le_many = \&Tree::SizeBalanced::Core::find_le_many_num_num;
+*find_gt_many = \&Tree::SizeBalanced::Core::find_gt_many_num_num;
+*find_ge_many = \&Tree::SizeBalanced::Core::find_ge_many_num_num;
+*find_gt_lt = \&Tree::SizeBalanced::Core::find_gt_lt_num_num;
+*find_ge_lt = \&Tree::SizeBalanced::Core::find_ge_lt_num_num;
+*find_gt_le = \&Tree::SizeBalanced::Core::find_gt_le_num_num;
+*find_ge_le = \&Tree::SizeBalanced::Core::find_ge_le_num_num;
+*count_lt = \&Tree::SizeBalanced::Core::count_lt_num_num;
+*count_le = \&Tree::SizeBalanced::Core::count_le_num_num;
+*count_gt = \&Tree::SizeBalanced::Core::count_gt_num_num;
+*count_ge = \&Tree::SizeBalanced::Core::count_ge_num_num;
+*count_eq = \&Tree::SizeBalanced::Core::count_eq_num_num;
+*equal_range = \&Tree::SizeBalanced::Core::equal_range_num_num;
+*count_lt_many = \&Tree::SizeBalanced::Core::count_lt_many_num_num;
+*count_le_many = \&Tree::SizeBalanced::Core::count_le_many_num_num;
+*count_gt_many = \&Tree::SizeBalanced::Core::count_gt_many_num_num;
+*count_ge_many = \&Tree::SizeBalanced::Core::count_ge_many_num_num;
+*apply = \&Tree::SizeBalanced::Core::apply_num_num;
+*find_min = \&Tree::SizeBalanced::Core::find_min_num_num;
+*find_max = \&Tree::SizeBalanced::Core::find_max_num_num;
+*pop_min = \&Tree::SizeBalanced::Core::pop_min_num_num;
+*pop_max = \&Tree::SizeBalanced::Core::pop_max_num_num;
+*skip_l = \&Tree::SizeBalanced::Core::skip_l_num_num;
+*skip_g = \&Tree::SizeBalanced::Core::skip_g_num_num;
+*delete_at = \&Tree::SizeBalanced::Core::delete_at_num_num;
+*delete_ranks = \&Tree::SizeBalanced::Core::delete_ranks_num_num;
+*clear = \&Tree::SizeBalanced::Core::clear_num_num;
+*reserve = \&Tree::SizeBalanced::Core::reserve_num_num;
+*compact = \&Tree::SizeBalanced::Core::compact_num_num;
+*dump = \&Tree::SizeBalanced::Core::dump_num_num;
+*check = \&Tree::SizeBalanced::Core::check_num_num;
+
+1;
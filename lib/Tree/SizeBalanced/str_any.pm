@@ -0,0 +1,84 @@
+package Tree::SizeBalanced::str_any;
+
+use strict;
+use warnings;
+
+use Tree::SizeBalanced;
+
+*new = \&Tree::SizeBalanced::Core::new_str_any;
+*new_from_sorted = \&Tree::SizeBalanced::Core::new_from_sorted_str_any;
+*DESTROY = \&Tree::SizeBalanced::Core::DESTROY_str_any;
+*size = \&Tree::SizeBalanced::Core::size_str_any;
+*ever_height = \&Tree::SizeBalanced::Core::ever_height_str_any;
+*cmp_count = \&Tree::SizeBalanced::Core::cmp_count_str_any;
+*insert = \&Tree::SizeBalanced::Core::insert_str_any;
+*insert_before = \&Tree::SizeBalanced::Core::insert_before_str_any;
+*insert_after = \&Tree::SizeBalanced::Core::insert_after_str_any;
+*insert_unique = \&Tree::SizeBalanced::Core::insert_unique_str_any;
+*set = \&Tree::SizeBalanced::Core::set_str_any;
+*add_value = \&Tree::SizeBalanced::Core::add_value_str_any;
+*incr = \&Tree::SizeBalanced::Core::incr_str_any;
+*insert_many = \&Tree::SizeBalanced::Core::insert_many_str_any;
+*delete = \&Tree::SizeBalanced::Core::delete_str_any;
+*delete_first = \&Tree::SizeBalanced::Core::delete_first_str_any;
+*delete_last = \&Tree::SizeBalanced::Core::delete_last_str_any;
+*take_first = \&Tree::SizeBalanced::Core::take_first_str_any;
+*take_last = \&Tree::SizeBalanced::Core::take_last_str_any;
+*delete_many = \&Tree::SizeBalanced::Core::delete_many_str_any;
+*delete_many_first = \&Tree::SizeBalanced::Core::delete_many_first_str_any;
+*delete_many_last = \&Tree::SizeBalanced::Core::delete_many_last_str_any;
+*delete_gt_lt = \&Tree::SizeBalanced::Core::delete_gt_lt_str_any;
+*delete_ge_lt = \&Tree::SizeBalanced::Core::delete_ge_lt_str_any;
+*delete_gt_le = \&Tree::SizeBalanced::Core::delete_gt_le_str_any;
+*delete_ge_le = \&Tree::SizeBalanced::Core::delete_ge_le_str_any;
+*drain_le = \&Tree::SizeBalanced::Core::drain_le_str_any;
+*drain_ge = \&Tree::SizeBalanced::Core::drain_ge_str_any;
+*split_lt = \&Tree::SizeBalanced::Core::split_lt_str_any;
+*split_le = \&Tree::SizeBalanced::Core::split_le_str_any;
+*join = \&Tree::SizeBalanced::Core::join_str_any;
+*union = \&Tree::SizeBalanced::Core::union_str_any;
+*intersection = \&Tree::SizeBalanced::Core::intersection_str_any;
+*difference = \&Tree::SizeBalanced::Core::difference_str_any;
+*find = \&Tree::SizeBalanced::Core::find_str_any;
+*find_first = \&Tree::SizeBalanced::Core::find_first_str_any;
+*find_last = \&Tree::SizeBalanced::Core::find_last_str_any;
+*exists = \&Tree::SizeBalanced::Core::exists_str_any;
+*get_many = \&Tree::SizeBalanced::Core::get_many_str_any;
+*find_lt = \&Tree::SizeBalanced::Core::find_lt_str_any;
+*find_le = \&Tree::SizeBalanced::Core::find_le_str_any;
+*find_gt = \&Tree::SizeBalanced::Core::find_gt_str_any;
+*find_ge = \&Tree::SizeBalanced::Core::find_ge_str_any;
+*find_lt_many = \&Tree::SizeBalanced::Core::find_lt_many_str_any;
+*find_le_many = \&Tree::SizeBalanced::Core::find_le_many_str_any;
+*find_gt_many = \&Tree::SizeBalanced::Core::find_gt_many_str_any;
+*find_ge_many = \&Tree::SizeBalanced::Core::find_ge_many_str_any;
+*find_gt_lt = \&Tree::SizeBalanced::Core::find_gt_lt_str_any;
+*find_ge_lt = \&Tree::SizeBalanced::Core::find_ge_lt_str_any;
+*find_gt_le = \&Tree::SizeBalanced::Core::find_gt_le_str_any;
+*find_ge_le = \&Tree::SizeBalanced::Core::find_ge_le_str_any;
+*count_lt = \&Tree::SizeBalanced::Core::count_lt_str_any;
+*count_le = \&Tree::SizeBalanced::Core::count_le_str_any;
+*count_gt = \&Tree::SizeBalanced::Core::count_gt_str_any;
+*count_ge = \&Tree::SizeBalanced::Core::count_ge_str_any;
+*count_eq = \&Tree::SizeBalanced::Core::count_eq_str_any;
+*equal_range = \&Tree::SizeBalanced::Core::equal_range_str_any;
+*count_lt_many = \&Tree::SizeBalanced::Core::count_lt_many_str_any;
+*count_le_many = \&Tree::SizeBalanced::Core::count_le_many_str_any;
+*count_gt_many = \&Tree::SizeBalanced::Core::count_gt_many_str_any;
+*count_ge_many = \&Tree::SizeBalanced::Core::count_ge_many_str_any;
+*apply = \&Tree::SizeBalanced::Core::apply_str_any;
+*find_min = \&Tree::SizeBalanced::Core::find_min_str_any;
+*find_max = \&Tree::SizeBalanced::Core::find_max_str_any;
+*pop_min = \&Tree::SizeBalanced::Core::pop_min_str_any;
+*pop_max = \&Tree::SizeBalanced::Core::pop_max_str_any;
+*skip_l = \&Tree::SizeBalanced::Core::skip_l_str_any;
+*skip_g = \&Tree::SizeBalanced::Core::skip_g_str_any;
+*delete_at = \&Tree::SizeBalanced::Core::delete_at_str_any;
+*delete_ranks = \&Tree::SizeBalanced::Core::delete_ranks_str_any;
+*clear = \&Tree::SizeBalanced::Core::clear_str_any;
+*reserve = \&Tree::SizeBalanced::Core::reserve_str_any;
+*compact = \&Tree::SizeBalanced::Core::compact_str_any;
+*dump = \&Tree::SizeBalanced::Core::dump_str_any;
+*check = \&Tree::SizeBalanced::Core::check_str_any;
+
+1;
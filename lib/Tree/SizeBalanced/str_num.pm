@@ -0,0 +1,84 @@
+package Tree::SizeBalanced::str_num;
+
+use strict;
+use warnings;
+
+use Tree::SizeBalanced;
+
+*new = \&Tree::SizeBalanced::Core::new_str_num;
+*new_from_sorted = \&Tree::SizeBalanced::Core::new_from_sorted_str_num;
+*DESTROY = \&Tree::SizeBalanced::Core::DESTROY_str_num;
+*size = \&Tree::SizeBalanced::Core::size_str_num;
+*ever_height = \&Tree::SizeBalanced::Core::ever_height_str_num;
+*cmp_count = \&Tree::SizeBalanced::Core::cmp_count_str_num;
+*insert = \&Tree::SizeBalanced::Core::insert_str_num;
+*insert_before = \&Tree::SizeBalanced::Core::insert_before_str_num;
+*insert_after = \&Tree::SizeBalanced::Core::insert_after_str_num;
+*insert_unique = \&Tree::SizeBalanced::Core::insert_unique_str_num;
+*set = \&Tree::SizeBalanced::Core::set_str_num;
+*add_value = \&Tree::SizeBalanced::Core::add_value_str_num;
+*incr = \&Tree::SizeBalanced::Core::incr_str_num;
+*insert_many = \&Tree::SizeBalanced::Core::insert_many_str_num;
+*delete = \&Tree::SizeBalanced::Core::delete_str_num;
+*delete_first = \&Tree::SizeBalanced::Core::delete_first_str_num;
+*delete_last = \&Tree::SizeBalanced::Core::delete_last_str_num;
+*take_first = \&Tree::SizeBalanced::Core::take_first_str_num;
+*take_last = \&Tree::SizeBalanced::Core::take_last_str_num;
+*delete_many = \&Tree::SizeBalanced::Core::delete_many_str_num;
+*delete_many_first = \&Tree::SizeBalanced::Core::delete_many_first_str_num;
+*delete_many_last = \&Tree::SizeBalanced::Core::delete_many_last_str_num;
+*delete_gt_lt = \&Tree::SizeBalanced::Core::delete_gt_lt_str_num;
+*delete_ge_lt = \&Tree::SizeBalanced::Core::delete_ge_lt_str_num;
+*delete_gt_le = \&Tree::SizeBalanced::Core::delete_gt_le_str_num;
+*delete_ge_le = \&Tree::SizeBalanced::Core::delete_ge_le_str_num;
+*drain_le = \&Tree::SizeBalanced::Core::drain_le_str_num;
+*drain_ge = \&Tree::SizeBalanced::Core::drain_ge_str_num;
+*split_lt = \&Tree::SizeBalanced::Core::split_lt_str_num;
+*split_le = \&Tree::SizeBalanced::Core::split_le_str_num;
+*join = \&Tree::SizeBalanced::Core::join_str_num;
+*union = \&Tree::SizeBalanced::Core::union_str_num;
+*intersection = \&Tree::SizeBalanced::Core::intersection_str_num;
+*difference = \&Tree::SizeBalanced::Core::difference_str_num;
+*find = \&Tree::SizeBalanced::Core::find_str_num;
+*find_first = \&Tree::SizeBalanced::Core::find_first_str_num;
+*find_last = \&Tree::SizeBalanced::Core::find_last_str_num;
+*exists = \&Tree::SizeBalanced::Core::exists_str_num;
+*get_many = \&Tree::SizeBalanced::Core::get_many_str_num;
+*find_lt = \&Tree::SizeBalanced::Core::find_lt_str_num;
+*find_le = \&Tree::SizeBalanced::Core::find_le_str_num;
+*find_gt = \&Tree::SizeBalanced::Core::find_gt_str_num;
+*find_ge = \&Tree::SizeBalanced::Core::find_ge_str_num;
+*find_lt_many = \&Tree::SizeBalanced::Core::find_lt_many_str_num;
+*find_le_many = \&Tree::SizeBalanced::Core::find_le_many_str_num;
+*find_gt_many = \&Tree::SizeBalanced::Core::find_gt_many_str_num;
+*find_ge_many = \&Tree::SizeBalanced::Core::find_ge_many_str_num;
+*find_gt_lt = \&Tree::SizeBalanced::Core::find_gt_lt_str_num;
+*find_ge_lt = \&Tree::SizeBalanced::Core::find_ge_lt_str_num;
+*find_gt_le = \&Tree::SizeBalanced::Core::find_gt_le_str_num;
+*find_ge_le = \&Tree::SizeBalanced::Core::find_ge_le_str_num;
+*count_lt = \&Tree::SizeBalanced::Core::count_lt_str_num;
+*count_le = \&Tree::SizeBalanced::Core::count_le_str_num;
+*count_gt = \&Tree::SizeBalanced::Core::count_gt_str_num;
+*count_ge = \&Tree::SizeBalanced::Core::count_ge_str_num;
+*count_eq = \&Tree::SizeBalanced::Core::count_eq_str_num;
+*equal_range = \&Tree::SizeBalanced::Core::equal_range_str_num;
+*count_lt_many = \&Tree::SizeBalanced::Core::count_lt_many_str_num;
+*count_le_many = \&Tree::SizeBalanced::Core::count_le_many_str_num;
+*count_gt_many = \&Tree::SizeBalanced::Core::count_gt_many_str_num;
+*count_ge_many = \&Tree::SizeBalanced::Core::count_ge_many_str_num;
+*apply = \&Tree::SizeBalanced::Core::apply_str_num;
+*find_min = \&Tree::SizeBalanced::Core::find_min_str_num;
+*find_max = \&Tree::SizeBalanced::Core::find_max_str_num;
+*pop_min = \&Tree::SizeBalanced::Core::pop_min_str_num;
+*pop_max = \&Tree::SizeBalanced::Core::pop_max_str_num;
+*skip_l = \&Tree::SizeBalanced::Core::skip_l_str_num;
+*skip_g = \&Tree::SizeBalanced::Core::skip_g_str_num;
+*delete_at = \&Tree::SizeBalanced::Core::delete_at_str_num;
+*delete_ranks = \&Tree::SizeBalanced::Core::delete_ranks_str_num;
+*clear = \&Tree::SizeBalanced::Core::clear_str_num;
+*reserve = \&Tree::SizeBalanced::Core::reserve_str_num;
+*compact = \&Tree::SizeBalanced::Core::compact_str_num;
+*dump = \&Tree::SizeBalanced::Core::dump_str_num;
+*check = \&Tree::SizeBalanced::Core::check_str_num;
+
+1;
@@ -0,0 +1,11 @@
+// vim: filetype=xs
+
+// 把 cntr 裡 key 在 lower_key 和 upper_key 之間的 entry 切出來, 其餘的接回 cntr
+// return 切下來的子樹, 它的 cell 仍屬於 cntr 的 segment
+static inline KV(tree_t) * KV(RANGE_DELETE_FUNC)(pTHX_ SV**SP, KV(tree_cntr_t) * cntr, T(KEY) lower_key, T(KEY) upper_key){
+    KV(tree_t) * lower = KV(RANGE_DELETE_L_SPLIT_FUNC)(aTHX_ SP, cntr, lower_key);
+    KV(tree_t) * middle = KV(RANGE_DELETE_R_SPLIT_FUNC)(aTHX_ SP, cntr, upper_key);
+    cntr->root = KV(tree_join2)(lower, cntr->root);
+    KV(tree_fit_height)(cntr);
+    return middle;
+}
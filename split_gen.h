@@ -0,0 +1,30 @@
+// vim: filetype=xs
+
+// 把子樹 tree 切成兩棵: key SPLIT_CMP_OP 給定 key 的 entry 放進 *lower, 其餘放進 *upper
+static void KV(SPLIT_SUBTREE_FUNC)(pTHX_ SV**SP, KV(tree_cntr_t) * cntr, KV(tree_t) * tree, T(KEY) key, KV(tree_t) ** lower, KV(tree_t) ** upper){
+    if( tree == (KV(tree_t)*) &nil ){
+        *lower = *upper = (KV(tree_t)*) &nil;
+        return;
+    }
+
+    if( KV(tree_cmp)(aTHX_ SP, cntr, tree->key, key) SPLIT_CMP_OP 0 ){
+        KV(tree_t) * right_lower;
+        KV(SPLIT_SUBTREE_FUNC)(aTHX_ SP, cntr, tree->right, key, &right_lower, upper);
+        *lower = (KV(tree_t)*) tree_join3(tree->left, tree, right_lower);
+    }
+    else{
+        KV(tree_t) * left_upper;
+        KV(SPLIT_SUBTREE_FUNC)(aTHX_ SP, cntr, tree->left, key, lower, &left_upper);
+        *upper = (KV(tree_t)*) tree_join3(left_upper, tree, tree->right);
+    }
+}
+
+// 把 cntr 裡 key SPLIT_CMP_OP 給定 key 的 entry 切下來, 其餘的留在 cntr
+// return 切下來的子樹, 它的 cell 仍屬於 cntr 的 segment
+static inline KV(tree_t) * KV(SPLIT_FUNC)(pTHX_ SV**SP, KV(tree_cntr_t) * cntr, T(KEY) key){
+    KV(tree_t) * lower, * upper;
+    KV(SPLIT_SUBTREE_FUNC)(aTHX_ SP, cntr, cntr->root, key, &lower, &upper);
+    cntr->root = upper;
+    KV(tree_fit_height)(cntr);
+    return lower;
+}
@@ -8,7 +8,7 @@
 use strict;
 use warnings;
 
-use Test::More tests => 978;
+use Test::More tests => 1686;
 BEGIN { use_ok('Tree::SizeBalanced', ':all') };
 
 #########################
@@ -268,3 +268,880 @@ BEGIN { use_ok('Tree::SizeBalanced', ':all') };
     is(join(' ', $tree->find_ge_lt(3, 5)), '3 24 3 y');
     is(join(' ', $tree->find_ge_le(3, 5)), '3 24 3 y 5 x');
 }
+
+{
+    for my $n (0..40, 100, 1000) {
+        my $tree = Tree::SizeBalanced::int_int->new_from_sorted([1..$n], [map { -$_ } 1..$n]);
+        is_deeply([$tree->check], [1,1,1], "new_from_sorted $n check");
+        is($tree->size, $n, "new_from_sorted $n size");
+        is_deeply([$tree->find_min(-1)], [map { ($_, -$_) } 1..$n], "new_from_sorted $n content");
+    }
+
+    my $tree = Tree::SizeBalanced::int_void->new_from_sorted([1, 2, 2, 3]);
+    is(join(' ', $tree->find_min(-1)), '1 2 2 3');
+    $tree->insert(2);
+    is($tree->count_le(2), 4);
+    is_deeply([$tree->check], [1,1,1]);
+
+    $tree = Tree::SizeBalanced::str_any->new_from_sorted(['a'..'e'], [1..3]);
+    is_deeply([$tree->find_min(-1)], [a => 1, b => 2, c => 3, d => undef, e => undef]);
+
+    $tree = Tree::SizeBalanced::any_void->new_from_sorted([qw(bb c a)], undef, sub { length($b) <=> length($a) });
+    is_deeply([$tree->check], [1,1,1]);
+    is($tree->find_gt('xx'), 'c');
+    $tree->insert('dddd');
+    is(join(' ', $tree->find_min(-1)), 'dddd bb c a');
+}
+
+{
+    srand(7);
+    for my $case ([0, 300], [1000, 20], [50, 50], [200, 1000]) {
+        my($n, $m) = @$case;
+        my @old = map { int(rand(200)) - 100 } 1..$n;
+        my @new = map { int(rand(200)) - 100 } 1..$m;
+
+        my $tree = sbtreeii;
+        my $expect = sbtreeii;
+        $tree->insert($_, 1) for @old;
+        $expect->insert($_, 1) for @old;
+        $tree->insert_many(\@new, [1..$m]);
+        $expect->insert($new[$_-1], $_) for 1..$m;
+        is_deeply([$tree->check], [1,1,1], "insert_many $n+$m check");
+        is_deeply([$tree->find_min(-1)], [$expect->find_min(-1)], "insert_many $n+$m content");
+    }
+
+    my $tree = sbtreen;
+    my @num = map { (rand() - .5) * 1e6 } 1..500;
+    push @num, 0, -0.0, 1e300, -1e300, 1, -1;
+    $tree->insert_many(\@num);
+    is_deeply([$tree->check], [1,1,1]);
+    is_deeply([$tree->find_min(-1)], [sort { $a <=> $b } @num]);
+
+    $tree = sbtreesi;
+    $tree->insert_many([qw(b d a c a)], [1..5]);
+    $tree->insert_many([qw(a e)], [6, 7]);
+    is(join(' ', $tree->find_min(-1)), 'a 3 a 5 a 6 b 1 c 4 d 2 e 7');
+
+    $tree = sbtreea { length($a) <=> length($b) };
+    $tree->insert('yy');
+    $tree->insert_many([qw(bb a ccc dd e)]);
+    is(join(' ', $tree->find_min(-1)), 'a e yy bb dd ccc');
+    is_deeply([$tree->check], [1,1,1]);
+}
+
+{
+    our $released = 0;
+    sub Tree::SizeBalanced::Test::Released::DESTROY { ++$released }
+    my $tree = sbtreeia;
+    $tree->insert($_, bless [], 'Tree::SizeBalanced::Test::Released') for 1..10;
+    $tree->delete($_) for 1..4;
+    is($released, 4);
+    my $any = sbtreea { $a->[0] <=> $b->[0] };
+    $any->insert(bless [$_], 'Tree::SizeBalanced::Test::Released') for 1..10;
+    $any->delete([$_]) for 3..5;
+    is($released, 7);
+}
+
+SKIP: {
+    skip 'IV is not 64-bit', 1 if length(pack 'j', 0) < 8;
+    my $tree = sbtreei;
+    $tree->insert($_) for 4611686018427387904, -4611686018427387904, 0, 9223372036854775807, -9223372036854775807;
+    is_deeply([$tree->find_min(-1)], [-9223372036854775807, -4611686018427387904, 0, 4611686018427387904, 9223372036854775807]);
+}
+
+{
+    srand(11);
+    for my $case ([300, 1000], [1000, 20], [50, 50]) {
+        my($n, $m) = @$case;
+        my @old = map { int(rand(100)) } 1..$n;
+        my @victim = map { int(rand(120)) } 1..$m;
+
+        for my $method (qw(delete_many_first delete_many_last)) {
+            my $single = $method =~ /first/ ? 'delete_first' : 'delete_last';
+            my $tree = sbtreeii;
+            my $expect = sbtreeii;
+            $tree->insert($old[$_], $_) for 0..$#old;
+            $expect->insert($old[$_], $_) for 0..$#old;
+            my $count = grep { $expect->$single($_) } @victim;
+            is($tree->$method(\@victim), $count, "$method $n-$m count");
+            is_deeply([$tree->check], [1,1,1], "$method $n-$m check");
+            is_deeply([$tree->find_min(-1)], [$expect->find_min(-1)], "$method $n-$m content");
+        }
+    }
+
+    my $tree = sbtreea { length($a) <=> length($b) };
+    $tree->insert($_) for qw(a b c dd ee fff);
+    is($tree->delete_many([qw(x yy x zzzz)]), 3);
+    is(join(' ', $tree->find_min(-1)), 'a dd fff');
+    is($tree->delete_many_first([qw(x x)]), 1);
+    is(join(' ', $tree->find_min(-1)), 'dd fff');
+}
+
+{
+    srand(13);
+    my $tree = sbtreei;
+    $tree->insert_many([map { int(rand(500)) } 1..1000]);
+    my @sorted = map { int(rand(520)) - 10 } 1..300;
+    @sorted = sort { $a <=> $b } @sorted;
+    my @random = map { int(rand(520)) - 10 } 1..300;
+    for my $keys (\@sorted, [reverse @sorted], \@random, []) {
+        for my $op (qw(lt le gt ge)) {
+            my $single = "count_$op";
+            my $many = "count_${op}_many";
+            is_deeply([$tree->$many($keys)], [map { $tree->$single($_) } @$keys], "$many");
+        }
+    }
+
+    my $any = sbtreea { $a <=> $b };
+    $any->insert($_) for 1, 3, 3, 5;
+    is_deeply([$any->count_le_many([0..6])], [0, 1, 1, 3, 3, 4, 4]);
+    is_deeply([sbtreei->count_lt_many([1, 2])], [0, 0]);
+}
+
+{
+    my $tree = sbtreeii;
+    $tree->insert_many([map { $_ * 2 } 1..100], [1..100]);
+    $tree->insert(20, -1);
+    $tree->insert_before(40, -2);
+    is_deeply([$tree->get_many([2, 3, 20, 40, 200, 201, -5])], [1, undef, 10, -2, 100, undef, undef]);
+    is_deeply([$tree->get_many([])], []);
+
+    $tree = sbtreesa;
+    $tree->insert(a => [1]);
+    $tree->insert(b => 'x');
+    $tree->insert(a => 'y');
+    is_deeply([$tree->get_many([qw(b a c)])], ['x', [1], undef]);
+
+    $tree = sbtreea { lc($a) cmp lc($b) };
+    $tree->insert($_) for qw(B a A b);
+    is_deeply([$tree->get_many([qw(a b c)])], ['a', 'B', undef]);
+}
+
+{
+    srand(17);
+    my $tree = sbtreeii;
+    my @keys = map { int(rand(300)) } 1..500;
+    $tree->insert($keys[$_], $_) for 0..$#keys;
+    my @probe = sort { $a <=> $b } map { int(rand(320)) - 10 } 1..200;
+    for my $probe (\@probe, [reverse @probe], [map { int(rand(320)) - 10 } 1..200]) {
+        for my $op (qw(lt le gt ge)) {
+            my $single = "find_$op";
+            my $many = "find_${op}_many";
+            is_deeply([$tree->$many($probe)], [map { my @r = $tree->$single($_); @r ? @r : (undef, undef) } @$probe], $many);
+        }
+    }
+
+    my $set = sbtreen;
+    $set->insert($_) for 1.5, 2.5, 3.5;
+    is_deeply([$set->find_le_many([1, 1.5, 2, 3, 4])], [undef, 1.5, 1.5, 2.5, 3.5]);
+    is_deeply([$set->find_gt_many([1, 1.5, 2, 3, 4])], [1.5, 2.5, 2.5, 3.5, undef]);
+}
+
+{
+    srand(19);
+    my $tree = sbtreeii;
+    my $twin = sbtreeii;
+    my(@ops, @expect);
+    for my $i (1..2000) {
+        my $key = int(rand(100));
+        my $op = (qw(insert insert_before delete delete_first find find_last find_lt find_le find_gt find_ge count_lt count_le count_gt count_ge size))[int(rand(15))];
+        if( $op =~ /^insert/ ) {
+            push @ops, $op, $key, $i;
+            $twin->$op($key, $i);
+        } elsif( $op =~ /^delete/ ) {
+            push @ops, $op, $key;
+            push @expect, $twin->$op($key) ? 1 : '';
+        } elsif( $op =~ /^find/ ) {
+            push @ops, $op, $key;
+            my @r = $twin->$op($key);
+            push @expect, @r ? @r : (undef, undef);
+        } elsif( $op eq 'size' ) {
+            push @ops, $op;
+            push @expect, $twin->size;
+        } else {
+            push @ops, $op, $key;
+            push @expect, $twin->$op($key);
+        }
+    }
+    is_deeply([$tree->apply(\@ops)], \@expect);
+    is($tree->dump, $twin->dump);
+    is_deeply([$tree->check], [1, 1, 1]);
+
+    my $set = sbtrees;
+    is_deeply([$set->apply([insert => 'b', insert => 'a', find_gt => 'a', count_le => 'b', delete => 'c', delete => 'a', find_lt => 'b', size =>])], ['b', 2, '', 1, undef, 1]);
+
+    eval { $set->apply([qw(insert a push b)]) };
+    like($@, qr/unknown operation/);
+    eval { sbtreeii->apply([insert => 1]) };
+    like($@, qr/missing value/);
+}
+
+{
+    my $tree = sbtreesa;
+    $tree->insert(ax => ['val']);
+    is_deeply([$tree->apply([find_ge => 'a', delete => 'ax', find => 'ax'])], ['ax', ['val'], 1, undef, undef]);
+
+    our $freed = 0;
+    sub Tree::SizeBalanced::Test::Freed::DESTROY { ++$freed }
+    eval { sbtreeaa(sub { $a->[0] <=> $b->[0] })->apply([insert => bless([1], 'Tree::SizeBalanced::Test::Freed')]) };
+    like($@, qr/missing value/);
+    is($freed, 1);
+}
+
+{
+    srand(23);
+    for my $round (1..20) {
+        my $tree = sbtreeii;
+        my @keys = map { int(rand(200)) } 1..int(rand(600));
+        $tree->insert($keys[$_], $_) for 0..$#keys;
+        my @all = $tree->find_min(-1);
+        my $key = int(rand(220)) - 10;
+        my $method = $round % 2 ? 'split_lt' : 'split_le';
+        my $lower = $tree->$method($key);
+        my $lower_size = grep { $round % 2 ? $_ < $key : $_ <= $key } @keys;
+        is_deeply([$lower->find_min(-1), $tree->find_min(-1)], [@all], "$method($key)");
+        is_deeply([$lower->size, $lower->check, $tree->check], [$lower_size, 1, 1, 1, 1, 1, 1]);
+        if( $round % 4 < 2 ) {
+            $lower->join($tree);
+            $tree = $lower;
+        }
+        else {
+            $tree->join($lower);
+            is($lower->size, 0);
+        }
+        is_deeply([$tree->find_min(-1)], [@all], 'join');
+    }
+
+    my $tree = sbtrees;
+    $tree->insert($_) for qw(d b a c e);
+    my $lower = $tree->split_le('b');
+    isa_ok($lower, 'Tree::SizeBalanced::str_void');
+    is_deeply([$lower->find_min(-1)], [qw(a b)]);
+    eval { $tree->join($tree) };
+    like($@, qr/itself/);
+    $lower->insert('z');
+    eval { $tree->join($lower) };
+    like($@, qr/overlap/);
+    is_deeply([$tree->find_min(-1)], [qw(c d e)]);
+    $lower->delete('z');
+    $tree->join(sbtrees);
+    $tree->join($lower);
+    is_deeply([$tree->find_min(-1)], [qw(a b c d e)]);
+
+    $tree = sbtreea { $b <=> $a };
+    $tree->insert($_) for 1..10;
+    $lower = $tree->split_lt(6);
+    $lower->insert(8);
+    is_deeply([$lower->find_min(-1)], [10, 9, 8, 8, 7]);
+    is_deeply([$tree->find_min(-1)], [6, 5, 4, 3, 2, 1]);
+}
+
+{
+    srand(29);
+    for my $round (1..10) {
+        my $range = $round % 2 ? 20 : 300;
+        my @a = map { [int(rand($range)), "a$_"] } 1..int(rand(400));
+        my @b = map { [int(rand($range)), "b$_"] } 1..int(rand(400));
+        my %in_a = map { ($_->[0] => 1) } @a;
+        my %in_b = map { ($_->[0] => 1) } @b;
+        my $other = sbtreeia;
+        $other->insert(@$_) for @b;
+
+        my $expect = sbtreeia;
+        $expect->insert(@$_) for @a, grep { !$in_a{$_->[0]} } @b;
+        my $tree = sbtreeia;
+        $tree->insert(@$_) for @a;
+        $tree->union($other);
+        is_deeply([$tree->find_min(-1)], [$expect->find_min(-1)], 'union');
+        is_deeply([$tree->check], [1, 1, 1]);
+
+        $expect = sbtreeia;
+        $expect->insert(@$_) for grep { $in_b{$_->[0]} } @a;
+        $tree = sbtreeia;
+        $tree->insert(@$_) for @a;
+        $tree->intersection($other);
+        is_deeply([$tree->find_min(-1)], [$expect->find_min(-1)], 'intersection');
+        is_deeply([$tree->check], [1, 1, 1]);
+
+        $expect = sbtreeia;
+        $expect->insert(@$_) for grep { !$in_b{$_->[0]} } @a;
+        $tree = sbtreeia;
+        $tree->insert(@$_) for @a;
+        $tree->difference($other);
+        is_deeply([$tree->find_min(-1)], [$expect->find_min(-1)], 'difference');
+        is_deeply([$tree->check, $other->size], [1, 1, 1, scalar @b]);
+    }
+
+    my $tree = sbtreea { lc($a) cmp lc($b) };
+    $tree->insert($_) for qw(a B c);
+    my $other = sbtreea { lc($a) cmp lc($b) };
+    $other->insert($_) for qw(A b D);
+    $tree->union($other);
+    is_deeply([$tree->find_min(-1)], [qw(a B c D)]);
+    $tree->union($tree);
+    $tree->intersection($tree);
+    is($tree->size, 4);
+    $tree->difference($tree);
+    is($tree->size, 0);
+    eval { $tree->union(sbtreei) };
+    like($@, qr/unmatched secret/);
+}
+
+{
+    srand(31);
+    for my $op (qw(gt_lt ge_lt gt_le ge_le)) {
+        my($lower_op, $upper_op) = split /_/, $op;
+        my %in = (
+            gt => sub { $_[0] > $_[1] },
+            ge => sub { $_[0] >= $_[1] },
+            lt => sub { $_[0] < $_[1] },
+            le => sub { $_[0] <= $_[1] },
+        );
+        for my $round (1..5) {
+            my @entries = map { [int(rand(100)), $_] } 1..int(rand(500));
+            my $tree = sbtreeii;
+            $tree->insert(@$_) for @entries;
+            my @all = $tree->find_min(-1);
+            my($lower, $upper) = sort { $a <=> $b } map { int(rand(110)) - 5 } 1..2;
+            my(@removed, @kept);
+            while( my($k, $v) = splice @all, 0, 2 ) {
+                if( $in{$lower_op}($k, $lower) && $in{$upper_op}($k, $upper) ) {
+                    push @removed, $k, $v;
+                }
+                else {
+                    push @kept, $k, $v;
+                }
+            }
+
+            my $method = "delete_$op";
+            if( $round % 2 ) {
+                is_deeply([$tree->$method($lower, $upper)], \@removed, "$method($lower, $upper)");
+            }
+            else {
+                is(scalar $tree->$method($lower, $upper), @removed / 2, "$method($lower, $upper)");
+            }
+            is_deeply([$tree->find_min(-1)], \@kept);
+            is_deeply([$tree->check], [1, 1, 1]);
+        }
+    }
+
+    my $tree = sbtreesa;
+    $tree->insert($_, [$_]) for qw(a b c d e);
+    is_deeply([$tree->delete_ge_le('b', 'd')], [b => ['b'], c => ['c'], d => ['d']]);
+    is_deeply([$tree->delete_gt_lt('e', 'a')], []);
+    is_deeply([$tree->find_min(-1)], [a => ['a'], e => ['e']]);
+}
+
+{
+    srand(37);
+    for my $round (1..10) {
+        my $tree = sbtreeii;
+        $tree->insert(int(rand(100)), $_) for 1..int(rand(400));
+        my @all = $tree->find_min(-1);
+        my $key = int(rand(110)) - 5;
+        my $limit = $round % 3 ? int(rand(50)) : -1;
+        my @le = $tree->find_le($key, -1);
+        my @le_pairs;
+        unshift @le_pairs, [splice @le, 0, 2] while @le;
+        my @ge = $tree->find_ge($key, -1);
+        my @ge_pairs;
+        unshift @ge_pairs, [splice @ge, 0, 2] while @ge;
+        splice @le_pairs, $limit if $limit >= 0 && $limit < @le_pairs;
+        splice @ge_pairs, $limit if $limit >= 0 && $limit < @ge_pairs;
+
+        my $other = sbtreeii;
+        $other->insert(@$_) for map { [splice @all, 0, 2] } 1..@all/2;
+
+        is_deeply([$tree->drain_le($key, $limit)], [map { @$_ } @le_pairs], "drain_le($key, $limit)");
+        is_deeply([$tree->size, $tree->check], [$other->size - @le_pairs, 1, 1, 1]);
+        is(scalar $other->drain_ge($key, $limit), scalar @ge_pairs, "drain_ge($key, $limit)");
+        is_deeply([$other->check], [1, 1, 1]);
+    }
+
+    my $tree = sbtreea { $a <=> $b };
+    $tree->insert($_) for 5, 1, 3, 3, 9, 7;
+    is_deeply([$tree->drain_ge(3, 3)], [9, 7, 5]);
+    is_deeply([$tree->drain_le(3)], [1, 3, 3]);
+    is($tree->size, 0);
+}
+
+{
+    srand(41);
+    my $tree = sbtreeii;
+    my $twin = sbtreeii;
+    for my $round (1..30) {
+        for( 1..int(rand(30)) ) {
+            my($k, $v) = (int(rand(50)), $_);
+            $tree->insert($k, $v);
+            $twin->insert($k, $v);
+        }
+        my $limit = int(rand(8)) - 1;
+        my $method = $round % 2 ? 'pop_min' : 'pop_max';
+        my $find = $round % 2 ? 'find_min' : 'find_max';
+        my @expect = $twin->$find($limit);
+        my $delete = $round % 2 ? 'delete_first' : 'delete_last';
+        $twin->$delete($expect[2 * $_]) for 0..@expect/2-1;
+        is_deeply([$tree->$method($limit)], \@expect, "$method($limit)");
+        is_deeply([$tree->find_min(-1), $tree->check], [$twin->find_min(-1), 1, 1, 1]);
+    }
+
+    $tree = sbtreea { $a cmp $b };
+    $tree->insert($_) for qw(b d a c);
+    my $pop_min = $tree->pop_min(3);
+    is($pop_min, 'a');
+    is_deeply([$tree->pop_max(-1)], [qw(d c b)]);
+    is_deeply([$tree->pop_min], []);
+
+    $tree = sbtreeia;
+    $tree->insert(1 => 'x');
+    my $key = $tree->pop_max;
+    is($key, 1);
+    is($tree->size, 0);
+}
+
+{
+    srand(43);
+    my $tree = sbtreeii;
+    my %expect;
+    for my $i (1..2000) {
+        my $key = int(rand(300));
+        $tree->set($key, $i);
+        $expect{$key} = $i;
+    }
+    is_deeply([$tree->find_min(-1)], [map { ($_, $expect{$_}) } sort { $a <=> $b } keys %expect]);
+    is_deeply([$tree->check], [1, 1, 1]);
+
+    $tree = sbtreesa;
+    $tree->insert(a => 1);
+    $tree->insert(a => 2);
+    $tree->insert(b => 3);
+    my $value = [4];
+    $tree->set(a => $value);
+    $tree->set(c => 5);
+    is_deeply([$tree->find_first('a', -1)], [a => 1, a => [4]]);
+    is_deeply([$tree->find_min(-1)], [a => 1, a => [4], b => 3, c => 5]);
+    my @old = $tree->find('b');
+    $tree->set(b => 6);
+    is_deeply([@old, $tree->find('b')], [b => 3, b => 6]);
+
+    my $set = sbtreen;
+    $set->set($_) for 1.5, 2.5, 1.5, 0.5;
+    is_deeply([$set->find_min(-1)], [0.5, 1.5, 2.5]);
+}
+
+{
+    srand(47);
+    my $tree = sbtreeii;
+    my %expect;
+    for my $i (1..1000) {
+        my $key = int(rand(100));
+        my $delta = int(rand(21)) - 10;
+        $expect{$key} += $delta;
+        is($tree->add_value($key, $delta), $expect{$key}) if $i % 100 == 0;
+        $tree->add_value($key, $delta) unless $i % 100 == 0;
+    }
+    is_deeply([$tree->find_min(-1)], [map { ($_, $expect{$_}) } sort { $a <=> $b } keys %expect]);
+    is_deeply([$tree->check], [1, 1, 1]);
+
+    $tree = sbtreesn;
+    is($tree->incr('a'), 1);
+    is($tree->incr('a'), 2);
+    is($tree->add_value('a', 0.5), 2.5);
+    is($tree->add_value('b', 1, 0), undef);
+    is($tree->size, 1);
+    $tree->insert(a => 10);
+    is($tree->add_value('a', -1), 9);
+    is_deeply([$tree->find_first('a', -1)], [a => 2.5, a => 9]);
+
+    eval { sbtreei->incr(1) };
+    like($@, qr/not numbers/);
+    eval { sbtreeia->add_value(1, 1) };
+    like($@, qr/not numbers/);
+}
+
+{
+    my $tree = sbtreeia;
+    $tree->insert(1 => 'a');
+    $tree->insert(2 => ['b']);
+    $tree->insert(1 => 'c');
+    $tree->insert(1 => 'd');
+    my $value = $tree->take_first(1);
+    is($value, 'a');
+    is_deeply([$tree->take_last(1)], [1 => 'd']);
+    is_deeply([$tree->take_last(2)], [2 => ['b']]);
+    is(scalar $tree->take_first(2), undef);
+    is_deeply([$tree->take_first(3)], []);
+    is_deeply([$tree->find_min(-1), $tree->check], [1 => 'c', 1, 1, 1]);
+
+    $tree = sbtreea { lc($a) cmp lc($b) };
+    $tree->insert($_) for qw(b A a);
+    is_deeply([$tree->take_first('a')], ['A']);
+    my $key = $tree->take_last('B');
+    is($key, 'b');
+    is_deeply([$tree->find_min(-1)], ['a']);
+
+    srand(53);
+    $tree = sbtreesn;
+    my $twin = sbtreesn;
+    for( 1..300 ) {
+        my($k, $v) = (int(rand(50)), rand);
+        $tree->insert($k, $v);
+        $twin->insert($k, $v);
+    }
+    my(@got, @expect);
+    for( 1..200 ) {
+        my $k = int(rand(60));
+        if( $_ % 2 ) {
+            push @got, [$tree->take_first($k)];
+            push @expect, [$twin->find_first($k)];
+            $twin->delete_first($k);
+        }
+        else {
+            push @got, [$tree->take_last($k)];
+            push @expect, [$twin->find_last($k)];
+            $twin->delete_last($k);
+        }
+    }
+    is_deeply(\@got, \@expect);
+    is_deeply([$tree->find_min(-1), $tree->check], [$twin->find_min(-1), 1, 1, 1]);
+}
+
+{
+    srand(59);
+    my $tree = sbtreeii;
+    my @model;
+    for my $i (1..600) {
+        my $k = int(rand(40));
+        $tree->insert($k, $i);
+        my $pos = grep { $_->[0] <= $k } @model;
+        splice @model, $pos, 0, [$k, $i];
+    }
+    for my $round (1..20) {
+        my $offset = int(rand(@model + 5));
+        my @expect = $offset < @model ? @{splice @model, $offset, 1} : ();
+        is_deeply([$tree->delete_at($offset)], \@expect, "delete_at($offset)");
+    }
+    for my $round (1..10) {
+        my $from = int(rand(@model + 5));
+        my $count = int(rand(60)) - 1;
+        my @expect = $from < @model ? map { @$_ } $count < 0 ? splice(@model, $from) : splice(@model, $from, $count) : ();
+        if( $round % 2 ) {
+            is_deeply([$tree->delete_ranks($from, $count)], \@expect, "delete_ranks($from, $count)");
+        }
+        else {
+            is(scalar $tree->delete_ranks($from, $count), @expect / 2, "delete_ranks($from, $count)");
+        }
+        is_deeply([$tree->find_min(-1)], [map { @$_ } @model]);
+        is_deeply([$tree->check], [1, 1, 1]);
+    }
+
+    my $set = sbtrees;
+    $set->insert($_) for qw(c a b d);
+    my $key = $set->delete_at(1);
+    is($key, 'b');
+    is(scalar $set->delete_at(-1), undef);
+    is_deeply([$set->delete_ranks(1)], [qw(c d)]);
+    is_deeply([$set->find_min(-1)], ['a']);
+}
+
+{
+    srand(61);
+    my $tree = sbtreei;
+    my %seen;
+    my(@got, @expect);
+    for( 1..1000 ) {
+        my $k = int(rand(300));
+        push @got, $tree->insert_unique($k) ? 1 : 0;
+        push @expect, $seen{$k}++ ? 0 : 1;
+    }
+    is_deeply(\@got, \@expect);
+    is_deeply([$tree->find_min(-1)], [sort { $a <=> $b } keys %seen]);
+    is_deeply([$tree->check], [1, 1, 1]);
+
+    my $map = sbtreea { lc($a) cmp lc($b) };
+    ok($map->insert_unique('a'));
+    ok(!$map->insert_unique('A'));
+    $map->insert('B');
+    ok(!$map->insert_unique('b'));
+    is_deeply([$map->find_min(-1)], [qw(a B)]);
+
+    $map = sbtreeii;
+    ok($map->insert_unique(1, 10));
+    ok(!$map->insert_unique(1, 20));
+    is_deeply([$map->find_min(-1)], [1, 10]);
+}
+
+{
+    srand(67);
+    my $tree = sbtreeni;
+    $tree->insert(int(rand(60)) / 2, $_) for 1..500;
+    my(@got, @expect);
+    for my $key (map { $_ / 4 } -4..130) {
+        push @got, [$tree->exists($key) ? 1 : 0, $tree->count_eq($key)];
+        push @expect, [(() = $tree->find($key)) ? 1 : 0, $tree->count_le($key) - $tree->count_lt($key)];
+    }
+    is_deeply(\@got, \@expect);
+
+    my $any = sbtreea { lc($a) cmp lc($b) };
+    $any->insert($_) for qw(a B A b b c);
+    is_deeply([map { $any->count_eq($_) } qw(A b C d)], [2, 3, 1, 0]);
+    ok($any->exists('C'));
+    ok(!$any->exists('z'));
+    ok(!sbtreei->exists(0));
+}
+
+{
+    srand(71);
+    my $tree = sbtreesi;
+    $tree->insert(chr(97 + int(rand(20))), $_) for 1..300;
+    my(@got, @expect);
+    for my $key (map { chr } 96..118) {
+        push @got, [$tree->equal_range($key)];
+        push @expect, [$tree->count_lt($key), $tree->count_le($key)];
+    }
+    is_deeply(\@got, \@expect);
+
+    my($lower, $upper) = $tree->equal_range('c');
+    is_deeply([$tree->skip_l($lower, $upper - $lower)], [$tree->find('c', -1)]);
+
+    my $any = sbtreea { lc($a) cmp lc($b) };
+    $any->insert($_) for qw(a B A b b c);
+    is_deeply([$any->equal_range('B')], [2, 5]);
+    is_deeply([$any->equal_range('bb')], [5, 5]);
+    is_deeply([sbtreen->equal_range(1)], [0, 0]);
+}
+
+{
+    my $calls = 0;
+    my $tree = sbtreea { ++$calls; $a <=> $b };
+    $tree->insert($_ % 50) for 1..1000;
+    is($tree->cmp_count, $calls);
+
+    $calls = 0;
+    my $before = $tree->cmp_count;
+    my @got = $tree->find_first(20, -1);
+    is(scalar(@got), 20);
+    is($tree->cmp_count - $before, $calls);
+    ok($calls <= 2 * $tree->ever_height + 20 + 1);
+
+    $calls = 0;
+    is_deeply([$tree->find_ge_lt(10, 12)], [(10) x 20, (11) x 20]);
+    ok($calls <= 2 * $tree->ever_height + 40 + 1);
+
+    $calls = 0;
+    is(scalar(() = $tree->find_lt(30, 25)), 25);
+    ok($calls <= $tree->ever_height);
+
+    is(sbtreei->cmp_count, 0);
+}
+
+{
+    my $tree = sbtreesi;
+    $tree->insert("k$_", $_) for 1..1000;
+    $tree->delete("k$_") for grep { $_ % 10 } 1..1000;
+    my @before = $tree->skip_l(0, -1);
+    is($tree->compact, 1024 - 100);
+    is_deeply([$tree->skip_l(0, -1)], \@before);
+    is_deeply([$tree->check], [1, 1, 1]);
+    is($tree->compact, 0);
+    $tree->insert("k$_", $_) for 1..100;
+    is($tree->size, 200);
+    is_deeply([$tree->check], [1, 1, 1]);
+
+    my $any = sbtreea { $a->[0] <=> $b->[0] };
+    $any->insert([$_ % 3]) for 1..100;
+    $any->delete_ranks(0, 40);
+    is($any->compact, 128 - 60);
+    is(join(' ', map { $_->[0] } $any->find_min(-1)), join(' ', (sort { $a <=> $b } map { $_ % 3 } 1..100)[40..99]));
+    $any->delete_ranks(0);
+    is($any->compact, 60);
+    is($any->size, 0);
+}
+
+{
+    my $tree = sbtreeii;
+    $tree->reserve(1000);
+    $tree->insert($_, -$_) for reverse 1..1000;
+    is($tree->compact, 0);
+    is_deeply([$tree->find_min(3)], [1, -1, 2, -2, 3, -3]);
+
+    $tree->reserve(1500);
+    $tree->reserve(10);
+    $tree->insert($_, 0) for 1001..1100;
+    is($tree->compact, 400);
+    is_deeply([$tree->check], [1, 1, 1]);
+
+    my $str = sbtreesa;
+    $str->insert("k$_", [$_]) for 1..150;
+    $str->reserve(300);
+    $str->insert("j$_", [$_]) for 1..150;
+    my $lower = $str->split_lt('k');
+    $str->join($lower);
+    is($str->size, 300);
+    is($str->compact, 256);
+    is(($str->find("j7"))[1][0], 7);
+}
+
+{
+    for my $n (-1, 2**50, 2**58, 2**59, 2**62) {
+        my $tree = sbtreei;
+        eval { $tree->reserve($n) };
+        like($@, qr/^reserve: /);
+    }
+    my $tree = sbtreesa;
+    $tree->insert(a => 1);
+    eval { $tree->reserve(2**50) };
+    like($@, qr/^reserve: out of memory/);
+    $tree->insert_many([qw(b c)]);
+    is_deeply([$tree->size, $tree->check], [3, 1, 1, 1]);
+}
+
+{
+    our $destroyed = 0;
+    sub Tree::SizeBalanced::Test::Counter::DESTROY { ++$destroyed }
+    my $tree = sbtreeia;
+    $tree->insert($_, bless [], 'Tree::SizeBalanced::Test::Counter') for 1..300;
+    $tree->clear;
+    is($destroyed, 300);
+    is($tree->size, 0);
+    is_deeply([$tree->find_min], []);
+
+    $tree->insert($_, bless [], 'Tree::SizeBalanced::Test::Counter') for 1..100;
+    is_deeply([$tree->check], [1, 1, 1]);
+    is($tree->compact, 64 + 64 + 128 + 256 - 100);
+    is(scalar($tree->find_max), 100);
+
+    my $empty = sbtreea { $a cmp $b };
+    $empty->clear;
+    is($empty->size, 0);
+}
+
+{
+    my $tree = sbtreea { die "stop\n" if "$a$b" eq 'de' || "$a$b" eq 'ed'; $a cmp $b };
+    $tree->insert($_) for qw(b d f h);
+    eval { $tree->insert_many([qw(a c e g i j k l m n)]) };
+    is($@, "stop\n");
+    is_deeply([$tree->check], [1, 1, 1]);
+    is_deeply([$tree->find_min(-1)], [qw(a b c d f h)]);
+}
+
+{
+    our($peek_tree, @peeked);
+    sub Tree::SizeBalanced::Test::Peek::DESTROY { push @peeked, scalar($peek_tree->find_min) if $peek_tree }
+    my $tree = sbtreeia;
+    $tree->insert($_, bless [], 'Tree::SizeBalanced::Test::Peek') for 1..20;
+    $peek_tree = $tree;
+    is($tree->delete_many([1..15]), 15);
+    is_deeply(\@peeked, [(16) x 15]);
+    undef $peek_tree;
+
+    my $any = sbtreea { die "stop\n" if "$a$b" eq 'fg' || "$a$b" eq 'gf'; $a cmp $b };
+    $any->insert($_) for qw(a b c d e f);
+    eval { $any->delete_many([qw(a c e g h i j)]) };
+    is($@, "stop\n");
+    is_deeply([$any->check], [1, 1, 1]);
+    is_deeply([$any->find_min(-1)], [qw(b d f)]);
+}
+
+{
+    my $tree = sbtreea { $a <=> $b };
+    $tree->insert_many([map { $_ * 2 } 1..1000]);
+    srand(29);
+    my @keys = map { int(rand(2000)) } 1..300;
+    my $count = $tree->cmp_count;
+    my @many = $tree->count_le_many(\@keys);
+    my $many_cmp = $tree->cmp_count - $count;
+    $count = $tree->cmp_count;
+    my @single = map { $tree->count_le($_) } @keys;
+    my $single_cmp = $tree->cmp_count - $count;
+    is_deeply(\@many, \@single);
+    cmp_ok($many_cmp, '<', $single_cmp * 1.1);
+
+    $count = $tree->cmp_count;
+    $tree->find_gt_many([sort { $a <=> $b } @keys]);
+    cmp_ok($tree->cmp_count - $count, '<', $single_cmp * 0.7);
+}
+
+{
+    my $tree = sbtreesi;
+    $tree->insert("a$_", $_) for 1..100;
+    $tree->delete("a$_") for 1..30;
+    my $other = sbtreesi;
+    $other->insert("b$_", $_) for 1..10;
+    $other->delete("b$_") for 1..5;
+    $tree->join($other);
+    $tree->insert("c$_", $_) for 1..117;
+    is_deeply([$tree->size, $tree->compact], [192, 0]);
+    is_deeply([$tree->check], [1, 1, 1]);
+
+    my $lower = sbtreesi;
+    $lower->insert("x$_", $_) for 1..10;
+    $lower->delete("x$_") for 1..3;
+    $other->insert("w$_", $_) for 1..100;
+    $other->delete("w$_") for 1..20;
+    $lower->join($other);
+    $lower->insert("y$_", $_) for 1..105;
+    is_deeply([$lower->size, $lower->compact], [192, 0]);
+
+    my $empty = sbtreesi;
+    $empty->join($lower);
+    $empty->join($tree);
+    is_deeply([$empty->size, $empty->compact], [384, 0]);
+    is_deeply([$empty->check], [1, 1, 1]);
+    is(($empty->find("w50"))[1], 50);
+}
+
+{
+    our($size_tree, @sizes);
+    sub Tree::SizeBalanced::Test::PeekSize::DESTROY { push @sizes, join(' ', $size_tree->size, scalar($size_tree->find_min)) if $size_tree }
+    my $tree = sbtreeia;
+    $tree->insert($_, bless [], 'Tree::SizeBalanced::Test::PeekSize') for 1..20;
+    $size_tree = $tree;
+    my $other = sbtreeia;
+    $other->insert($_) for 6..15;
+    $tree->intersection($other);
+    is_deeply(\@sizes, [('10 6') x 10]);
+    @sizes = ();
+    $other->delete($_) for 13..15;
+    $tree->difference($other);
+    is_deeply(\@sizes, [('3 13') x 7]);
+    undef $size_tree;
+}
+
+{
+    our $countdown = -1;
+    for my $op (qw(union intersection difference)) {
+        my($good, $died) = (1, 0);
+        for my $n (1..300) {
+            my $tree = sbtreea { die "stop\n" if --$countdown == 0; $a <=> $b };
+            $tree->insert($_ * 2) for 1..30;
+            my $other = sbtreea { $a <=> $b };
+            $other->insert($_ * 3) for 1..30;
+            my %before = map { $_ => 1 } $tree->find_min(-1);
+            my %other = map { $_ => 1 } $other->find_min(-1);
+            $countdown = $n;
+            my $done = eval { $tree->$op($other); 1 };
+            $countdown = -1;
+            ++$died if !$done;
+            my %after = map { $_ => 1 } $tree->find_min(-1);
+            $good = 0 if join(' ', $tree->check) ne '1 1 1' || $tree->size != keys %after;
+            for my $key (keys %before) {
+                my $keep = $op eq 'union' || ($op eq 'intersection' xor !$other{$key});
+                $good = 0 if $keep && !$after{$key};
+            }
+            for my $key (keys %after) {
+                $good = 0 if !$before{$key} && !($op eq 'union' && $other{$key});
+            }
+            last if $done;
+        }
+        ok($good && $died > 10, "$op with a dying comparator");
+    }
+}
+
+{
+    my $tree = sbtreei;
+    $tree->insert_many([$_]) for 1..100;
+    is_deeply([$tree->size, $tree->compact], [100, 128 - 100]);
+    $tree->insert_many([101..300]);
+    is_deeply([$tree->size, $tree->compact], [300, 0]);
+}
@@ -6,6 +6,71 @@
 #include "EXTERN.h"
 #include "perl.h"
 
-#define SEG_SIZE (64)
+#define SEG_SIZE (64) // 第一個 segment 的 cell 數, 之後每次加倍
+#define SEG_MAX_SIZE (65536) // 自動配置時一個 segment 最多的 cell 數
+#define BATCH_RADIX_MIN (256) // batch 至少有這麼多個 key 才用 radix sort, 少的時候 merge sort 比較快
+
+// 確認 ref 是 array reference, return 它指向的 AV
+static inline AV * assure_av(pTHX_ SV * ref, const char * who){
+    if( !SvROK(ref) || SvTYPE(SvRV(ref)) != SVt_PVAV )
+        croak("%s: expect an array reference", who);
+    return (AV*) SvRV(ref);
+}
+
+// 取 av[i], 不存在的話當作 undef
+static inline SV * av_fetch_sv(pTHX_ AV * av, SSize_t i){
+    SV ** svp = av_fetch(av, i, 0);
+    return svp ? *svp : &PL_sv_undef;
+}
+
+// apply 支援的操作
+enum {
+    APPLY_SIZE,
+    APPLY_INSERT_AFTER,
+    APPLY_INSERT_BEFORE,
+    APPLY_DELETE_LAST,
+    APPLY_DELETE_FIRST,
+    APPLY_FIND_FIRST,
+    APPLY_FIND_LAST,
+    APPLY_FIND_LT,
+    APPLY_FIND_LE,
+    APPLY_FIND_GT,
+    APPLY_FIND_GE,
+    APPLY_COUNT_LT,
+    APPLY_COUNT_LE,
+    APPLY_COUNT_GT,
+    APPLY_COUNT_GE
+};
+
+static inline int apply_op(pTHX_ SV * name){
+    static const struct {
+        const char * name;
+        int op;
+    } ops[] = {
+        { "size", APPLY_SIZE },
+        { "insert", APPLY_INSERT_AFTER },
+        { "insert_after", APPLY_INSERT_AFTER },
+        { "insert_before", APPLY_INSERT_BEFORE },
+        { "delete", APPLY_DELETE_LAST },
+        { "delete_last", APPLY_DELETE_LAST },
+        { "delete_first", APPLY_DELETE_FIRST },
+        { "find", APPLY_FIND_FIRST },
+        { "find_first", APPLY_FIND_FIRST },
+        { "find_last", APPLY_FIND_LAST },
+        { "find_lt", APPLY_FIND_LT },
+        { "find_le", APPLY_FIND_LE },
+        { "find_gt", APPLY_FIND_GT },
+        { "find_ge", APPLY_FIND_GE },
+        { "count_lt", APPLY_COUNT_LT },
+        { "count_le", APPLY_COUNT_LE },
+        { "count_gt", APPLY_COUNT_GT },
+        { "count_ge", APPLY_COUNT_GE }
+    };
+    const char * str = SvPV_nolen(name);
+    for(size_t i=0; i<sizeof(ops)/sizeof(ops[0]); ++i)
+        if( strEQ(str, ops[i].name) )
+            return ops[i].op;
+    croak("apply: unknown operation '%s'", str);
+}
 
 #endif
@@ -46,6 +46,49 @@ static inline T(any) copy_sv_any(pTHX_ SV * sv){
     return newSVsv(sv);
 }
 
+static inline T(void) clone_void(pTHX_ T(void) v){
+    return NULL;
+}
+static inline T(int) clone_int(pTHX_ T(int) v){
+    return v;
+}
+static inline T(num) clone_num(pTHX_ T(num) v){
+    return v;
+}
+static inline T(str) clone_str(pTHX_ T(str) v){
+    return newSVsv(v);
+}
+static inline T(any) clone_any(pTHX_ T(any) v){
+    return newSVsv(v);
+}
+
+// 把 sv 的值存進已經有值的 *slot
+// str 和 any 在沒有別人共用舊的 SV 時, 直接改寫它, 省下一次 newSVsv
+static inline void assign_void(pTHX_ T(void) * slot, SV * sv){
+}
+static inline void assign_int(pTHX_ T(int) * slot, SV * sv){
+    *slot = SvIV(sv);
+}
+static inline void assign_num(pTHX_ T(num) * slot, SV * sv){
+    *slot = SvNV(sv);
+}
+static inline void assign_str(pTHX_ T(str) * slot, SV * sv){
+    if( SvREFCNT(*slot) == 1 )
+        sv_setsv(*slot, sv);
+    else{
+        SvREFCNT_dec(*slot);
+        *slot = newSVsv(sv);
+    }
+}
+static inline void assign_any(pTHX_ T(any) * slot, SV * sv){
+    if( SvREFCNT(*slot) == 1 )
+        sv_setsv(*slot, sv);
+    else{
+        SvREFCNT_dec(*slot);
+        *slot = newSVsv(sv);
+    }
+}
+
 static inline SV** ret_int(pTHX_ SV ** SP, T(int) key){
     dTARGET;
     PUSHi(key);
@@ -99,11 +142,47 @@ static inline SV** mxret_any(pTHX_ SV ** SP, T(any) key){
     return SP;
 }
 
+// 和 mxret 一樣, 但 str 和 any 推上去的是複本, 之後 cell 被刪掉也不受影響
+static inline SV** mxcopy_int(pTHX_ SV ** SP, T(int) key){
+    mXPUSHi(key);
+    return SP;
+}
+static inline SV** mxcopy_num(pTHX_ SV ** SP, T(num) key){
+    mXPUSHn(key);
+    return SP;
+}
+static inline SV** mxcopy_str(pTHX_ SV ** SP, T(str) key){
+    XPUSHs(sv_mortalcopy(key));
+    return SP;
+}
+static inline SV** mxcopy_any(pTHX_ SV ** SP, T(any) key){
+    XPUSHs(sv_mortalcopy(key));
+    return SP;
+}
+
+// 和 mret 一樣, 但 str 和 any 把 cell 持有的 refcnt 交給 mortal, 用在要丟掉 cell 的時候
+static inline SV** mtake_int(pTHX_ SV ** SP, T(int) key){
+    mPUSHi(key);
+    return SP;
+}
+static inline SV** mtake_num(pTHX_ SV ** SP, T(num) key){
+    mPUSHn(key);
+    return SP;
+}
+static inline SV** mtake_str(pTHX_ SV ** SP, T(str) key){
+    PUSHs(sv_2mortal(key));
+    return SP;
+}
+static inline SV** mtake_any(pTHX_ SV ** SP, T(any) key){
+    PUSHs(sv_2mortal(key));
+    return SP;
+}
+
 static inline IV cmp_int(pTHX_ SV**SP, T(int) a, T(int) b, SV* cmp){
-    return a - b;
+    return (a > b) - (a < b);
 }
-static inline NV cmp_num(pTHX_ SV**SP, T(num) a, T(num) b, SV* cmp){
-    return a - b;
+static inline IV cmp_num(pTHX_ SV**SP, T(num) a, T(num) b, SV* cmp){
+    return (a > b) - (a < b);
 }
 static inline IV cmp_str(pTHX_ SV**SP, T(str) a, T(str) b, SV* cmp){
     return (IV) sv_cmp(a, b);
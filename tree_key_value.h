@@ -14,8 +14,9 @@ typedef struct KV(tree_t) {
 
 typedef struct KV(tree_seg_t) {
     struct KV(tree_seg_t) * prev_seg;
+    IV n; // cell 數
 
-    KV(tree_t) cell[SEG_SIZE];
+    KV(tree_t) cell[];
 } KV(tree_seg_t);
 
 typedef struct KV(tree_cntr_t) {
@@ -25,8 +26,13 @@ typedef struct KV(tree_cntr_t) {
     SV* cmp;
     KV(tree_t) * root; // (init 後, empty 前) 永不為空, 一開始指向 nil
     KV(tree_t) * free_slot;
+    KV(tree_t) * free_last; // free_slot 串列的最後一個 cell, free_slot 是空的時候沒有意義
     KV(tree_seg_t) * newest_seg;
+    KV(tree_seg_t) * oldest_seg; // newest_seg 串列的最後一個 segment, newest_seg 是空的時候沒有意義
     int ever_height;
+    UV cmp_count; // 呼叫 K(cmp) 的累計次數
+    KV(tree_t) * fresh_cell, * fresh_end; // 最新配置的 segment 裡還沒用過的 cell, 不在 free_slot 裡
+    IV cell_count; // 所有 segment 的 cell 總數
 } KV(tree_cntr_t);
 
 static inline KV(tree_cntr_t) * KV(assure_tree_cntr)(SV * obj){
@@ -53,14 +59,10 @@ static inline KV(tree_cntr_t) * KV(assure_tree_cntr)(SV * obj){
     return cntr;
 }
 
-// 把所有的 cell 以 left 串起來, 最後一個指向 NULL
-// return 開頭的 cell
-static inline KV(tree_t) * KV(init_tree_seg)(KV(tree_seg_t) * seg, KV(tree_seg_t) * prev){
-    seg->prev_seg = prev;
-    seg->cell[SEG_SIZE-1].left = NULL;
-    for(int i=SEG_SIZE-2; i>=0; --i)
-        seg->cell[i].left = &seg->cell[i+1];
-    return &seg->cell[0];
+// 所有 key 的比較都經過這裡, 順便計數
+static inline IV KV(tree_cmp)(pTHX_ SV**SP, KV(tree_cntr_t) * cntr, T(KEY) a, T(KEY) b){
+    ++cntr->cmp_count;
+    return K(cmp)(aTHX_ SP, a, b, cntr->cmp);
 }
 
 #ifndef MAINTAINER
@@ -166,17 +168,197 @@ static inline bool tree_check_balance(void * _cntr){
     return tree_check_subtree_balance(cntr->root);
 }
 
+// *head 是以 right 串起來, 已經排好序的 cell list
+// 取走開頭 n 個 cell 建成一棵完全平衡的子樹, *head 移到第 n+1 個 cell
+// return 子樹的 root
+KV(tree_t) * tree_build_from_list(void * _head, IV n){
+    KV(tree_t) ** head = (KV(tree_t)**) _head;
+    if( n == 0 )
+        return (KV(tree_t)*) &nil;
+
+    IV left_n = n >> 1;
+    KV(tree_t) * left = tree_build_from_list(head, left_n);
+    KV(tree_t) * root = *head;
+    *head = root->right;
+    root->left = left;
+    root->right = tree_build_from_list(head, n - left_n - 1);
+    root->size = n;
+    return root;
+}
+
+// 把子樹的 cell 依序以 right 串起來, 最後接上 tail
+// return list 的開頭
+KV(tree_t) * tree_flatten(void * _tree, void * _tail){
+    KV(tree_t) * tree = (KV(tree_t)*) _tree;
+    KV(tree_t) * tail = (KV(tree_t)*) _tail;
+    while( tree != &nil ){
+        KV(tree_t) * left = tree->left;
+        tree->right = tree_flatten(tree->right, tail);
+        tail = tree;
+        tree = left;
+    }
+    return tail;
+}
+
+// tree_build_from_list 建出的 n 個節點的樹高
+static inline int tree_build_height(IV n){
+    int height = 0;
+    while( n ){
+        ++height;
+        n >>= 1;
+    }
+    return height;
+}
+
+// SBTree 樹高的上界: 樹高 h 的 SBTree 至少有 least(h) 個節點
+// least(1) = 1, least(2) = 2, least(h) = least(h-1) + least(h-2) + 1
+static inline int tree_max_height(IV n){
+    if( n == 0 )
+        return 0;
+    int height = 1;
+    IV least = 1, next_least = 2;
+    while( next_least <= n ){
+        IV t = least + next_least + 1;
+        least = next_least;
+        next_least = t;
+        ++height;
+    }
+    return height;
+}
+
+// 假設 l 裡的 key 都不大於 m 的 key, r 裡的 key 都不小於 m 的 key
+// 以 m 為中間節點把 l 和 r 接成一棵 SBTree, return 新的 root
+KV(tree_t) * tree_join3(void * _l, void * _m, void * _r){
+    KV(tree_t) * l = (KV(tree_t)*) _l;
+    KV(tree_t) * m = (KV(tree_t)*) _m;
+    KV(tree_t) * r = (KV(tree_t)*) _r;
+
+    // m 直接當 root 會失衡的話, 往比較大的一邊裡面接
+    if( l->size > r->size && (l->left->size > r->size || l->right->size > r->size) ){
+        l->right = tree_join3(l->right, m, r);
+        l->size = l->left->size + l->right->size + 1;
+        return maintain_larger_right(l);
+    }
+    if( r->size > l->size && (r->left->size > l->size || r->right->size > l->size) ){
+        r->left = tree_join3(l, m, r->left);
+        r->size = r->left->size + r->right->size + 1;
+        return maintain_larger_left(r);
+    }
+
+    m->left = l;
+    m->right = r;
+    m->size = l->size + r->size + 1;
+    return m;
+}
+
+// 把子樹切成前 rank 個 entry (*lower) 和其餘的 entry (*upper), 不需要比較 key
+void tree_split_rank(void * _tree, IV rank, void * _lower, void * _upper){
+    KV(tree_t) * tree = (KV(tree_t)*) _tree;
+    KV(tree_t) ** lower = (KV(tree_t)**) _lower;
+    KV(tree_t) ** upper = (KV(tree_t)**) _upper;
+
+    if( tree == &nil ){
+        *lower = *upper = (KV(tree_t)*) &nil;
+        return;
+    }
+
+    if( rank <= tree->left->size ){
+        KV(tree_t) * left_upper;
+        tree_split_rank(tree->left, rank, lower, &left_upper);
+        *upper = tree_join3(left_upper, tree, tree->right);
+    }
+    else{
+        KV(tree_t) * right_lower;
+        tree_split_rank(tree->right, rank - tree->left->size - 1, &right_lower, upper);
+        *lower = tree_join3(tree->left, tree, right_lower);
+    }
+}
+
 #endif // MAINTAINER
 
+static inline void KV(free_cell)(KV(tree_cntr_t) * cntr, KV(tree_t) * cell){
+    if( !cntr->free_slot )
+        cntr->free_last = cell;
+    cell->left = cntr->free_slot;
+    cntr->free_slot = cell;
+}
+
+// 把還沒用過的 cell 都放進 free_slot
+static inline void KV(tree_retire_fresh)(KV(tree_cntr_t) * cntr){
+    while( cntr->fresh_end != cntr->fresh_cell )
+        KV(free_cell)(cntr, --cntr->fresh_end);
+    cntr->fresh_cell = cntr->fresh_end = NULL;
+}
+
+// 加上一個有 n 個 cell 的 segment, 它的 cell 要用的時候才依序取出, 不必先串起來
+static inline void KV(tree_add_seg)(KV(tree_cntr_t) * cntr, IV n){
+    KV(tree_seg_t) * new_seg;
+    KV(tree_retire_fresh)(cntr);
+    Newxc(new_seg, sizeof(KV(tree_seg_t)) + n * sizeof(KV(tree_t)), char, KV(tree_seg_t));
+    if( !cntr->newest_seg )
+        cntr->oldest_seg = new_seg;
+    new_seg->prev_seg = cntr->newest_seg;
+    new_seg->n = n;
+    cntr->newest_seg = new_seg;
+    cntr->fresh_cell = new_seg->cell;
+    cntr->fresh_end = new_seg->cell + n;
+    cntr->cell_count += n;
+}
+
+// 一個 segment 最多能有幾個 cell, 再多的話 segment 的 byte 數會超出 SSize_t
+static inline UV KV(tree_max_seg_cells)(void){
+    return (UV) ((SSize_t_MAX - sizeof(KV(tree_seg_t))) / sizeof(KV(tree_t)));
+}
+
+// 確保放得下 n 個 entry, 不必再配置記憶體
+static inline void KV(tree_reserve)(KV(tree_cntr_t) * cntr, IV n){
+    if( n > cntr->cell_count )
+        KV(tree_add_seg)(cntr, n - cntr->cell_count);
+}
+
+// 和 tree_reserve 一樣, 但配置不到記憶體時 return false, 什麼都不改
+// Newx 配置失敗會直接結束程式, 所以先用不會結束程式的 PerlMem_malloc 試試看放不放得下
+static inline bool KV(tree_try_reserve)(pTHX_ KV(tree_cntr_t) * cntr, IV n){
+    if( n <= cntr->cell_count )
+        return TRUE;
+
+    bool nomemok = PL_nomemok; // perl 自己的 malloc 也不要結束程式
+    PL_nomemok = TRUE;
+    void * probe = PerlMem_malloc(sizeof(KV(tree_seg_t)) + (n - cntr->cell_count) * sizeof(KV(tree_t)));
+    PL_nomemok = nomemok;
+    if( !probe )
+        return FALSE;
+    PerlMem_free(probe);
+
+    KV(tree_add_seg)(cntr, n - cntr->cell_count);
+    return TRUE;
+}
+
+// allocate_cell 用完 cell 時要加的 cell 數: 目前的 cell 總數加倍
+static inline IV KV(tree_grow_step)(KV(tree_cntr_t) * cntr){
+    return cntr->cell_count < SEG_SIZE ? SEG_SIZE : cntr->cell_count > SEG_MAX_SIZE ? SEG_MAX_SIZE : cntr->cell_count;
+}
+
+// 和 tree_reserve 一樣, 但不夠的話至少加上 tree_grow_step 個 cell,
+// 常常要一點點空間時不會配置出一堆小 segment
+static inline void KV(tree_grow)(KV(tree_cntr_t) * cntr, IV n){
+    if( n > cntr->cell_count ){
+        IV step = KV(tree_grow_step)(cntr);
+        KV(tree_add_seg)(cntr, n - cntr->cell_count > step ? n - cntr->cell_count : step);
+    }
+}
+
 static inline KV(tree_t) * KV(allocate_cell)(KV(tree_cntr_t) * cntr, T(KEY) key, T(VALUE) value){
-    if( UNLIKELY(!cntr->free_slot) ){
-        KV(tree_seg_t) * new_seg;
-        Newx(new_seg, 1, KV(tree_seg_t));
-        cntr->free_slot = KV(init_tree_seg)(new_seg, cntr->newest_seg);
-        cntr->newest_seg = new_seg;
+    KV(tree_t) * new_cell;
+    if( cntr->free_slot ){
+        new_cell = cntr->free_slot;
+        cntr->free_slot = new_cell->left;
+    }
+    else{
+        if( UNLIKELY(cntr->fresh_cell == cntr->fresh_end) )
+            KV(tree_add_seg)(cntr, KV(tree_grow_step)(cntr));
+        new_cell = cntr->fresh_cell++;
     }
-    KV(tree_t) * new_cell = cntr->free_slot;
-    cntr->free_slot = new_cell->left;
 
     new_cell->left = new_cell->right = (KV(tree_t)*) &nil;
     new_cell->size = 1;
@@ -188,13 +370,20 @@ static inline KV(tree_t) * KV(allocate_cell)(KV(tree_cntr_t) * cntr, T(KEY) key,
     return new_cell;
 }
 
-static inline void KV(free_cell)(KV(tree_cntr_t) * cntr, KV(tree_t) * cell){
-    cell->left = cntr->free_slot;
-    cntr->free_slot = cell;
+// 釋放 cell 裡的 key 和 value, 再放回 free_slot
+static inline void KV(release_cell)(pTHX_ KV(tree_cntr_t) * cntr, KV(tree_t) * cell){
+#if I(KEY) == I(str) || I(KEY) == I(any)
+    SvREFCNT_dec(cell->key);
+#endif
+#if I(VALUE) == I(str) || I(VALUE) == I(any)
+    SvREFCNT_dec(cell->value);
+#endif
+    KV(free_cell)(cntr, cell);
 }
 
 static inline void KV(empty_tree_cntr)(pTHX_ KV(tree_cntr_t) * cntr){
 #if I(KEY) == I(str) || I(KEY) == I(any) || I(VALUE) == I(str) || I(VALUE) == I(any)
+    KV(tree_retire_fresh)(cntr);
     KV(tree_t) * free_slot = cntr->free_slot;
     while( free_slot ){
         KV(tree_t) * next_free_slot = free_slot->left;
@@ -211,7 +400,7 @@ static inline void KV(empty_tree_cntr)(pTHX_ KV(tree_cntr_t) * cntr){
     while( seg ){
         KV(tree_seg_t) * prev = seg->prev_seg;
 #if I(KEY) == I(str) || I(KEY) == I(any) || I(VALUE) == I(str) || I(VALUE) == I(any)
-        for(int i=SEG_SIZE-1; i>=0; --i){
+        for(IV i=seg->n-1; i>=0; --i){
 #   if I(KEY) == I(str) || I(KEY) == I(any)
             SvREFCNT_dec(seg->cell[i].key);
 #   endif
@@ -226,6 +415,8 @@ static inline void KV(empty_tree_cntr)(pTHX_ KV(tree_cntr_t) * cntr){
     cntr->root = (KV(tree_t)*) &nil;
     cntr->free_slot = NULL;
     cntr->newest_seg = NULL;
+    cntr->fresh_cell = cntr->fresh_end = NULL;
+    cntr->cell_count = 0;
 }
 
 // 假設一給定的 tree 不是空的
@@ -282,11 +473,10 @@ static inline KV(tree_t) * KV(tree_replace_cell)(KV(tree_t) * tree){
 }
 
 // 假設 tree 不是空的
-// 刪除 tree 的 root
+// 把 tree 的 root 移出樹外 (不釋放)
 // return 新的 root
-static inline KV(tree_t) * KV(tree_delete_root)(KV(tree_cntr_t) * cntr, KV(tree_t) * tree){
+static inline KV(tree_t) * KV(tree_unlink_root)(KV(tree_t) * tree){
     KV(tree_t) * new_root = KV(tree_replace_cell)(tree);
-    KV(free_cell)(cntr, tree);
     return (KV(tree_t)*) maintain_larger_right(new_root);
 }
 
@@ -294,6 +484,574 @@ static inline int KV(tree_size)(KV(tree_cntr_t) * cntr){
     return cntr->root->size;
 }
 
+// 把以 right 串起來, 已經排好序的 n 個 cell 建成平衡樹, 取代原本的 root
+static inline void KV(tree_assign_list)(KV(tree_cntr_t) * cntr, KV(tree_t) * head, IV n){
+    cntr->root = (KV(tree_t)*) tree_build_from_list((void*) &head, n);
+    int height = tree_build_height(n);
+    if( height > cntr->ever_height )
+        cntr->ever_height = height;
+}
+
+// split 或 join 之後, 依 size 調高 ever_height, 讓它仍是樹高的上界
+static inline void KV(tree_fit_height)(KV(tree_cntr_t) * cntr){
+    int height = tree_max_height(cntr->root->size);
+    if( height > cntr->ever_height )
+        cntr->ever_height = height;
+}
+
+// 把 l 和 r 接成一棵, 假設 l 裡的 key 都不大於 r 裡的 key
+// return 新的 root
+static inline KV(tree_t) * KV(tree_join2)(KV(tree_t) * l, KV(tree_t) * r){
+    if( l == (KV(tree_t)*) &nil )
+        return r;
+    if( r == (KV(tree_t)*) &nil )
+        return l;
+    KV(tree_t) * m = KV(tree_raise_max_cell)(l);
+    return (KV(tree_t)*) tree_join3(m->left, m, r);
+}
+
+// 把 from 裡的子樹 tree 照原樣複製到 to 的 cell, 原本的 cell 放回 from 的 free_slot
+// key 和 value 直接轉手, 不動 refcnt
+// return 新的子樹 root
+static KV(tree_t) * KV(tree_move_subtree)(KV(tree_cntr_t) * from, KV(tree_cntr_t) * to, KV(tree_t) * tree){
+    if( tree == (KV(tree_t)*) &nil )
+        return tree;
+
+#if I(VALUE) != I(void)
+    KV(tree_t) * cell = KV(allocate_cell)(to, tree->key, tree->value);
+#else
+    KV(tree_t) * cell = KV(allocate_cell)(to, tree->key, NULL);
+#endif
+    cell->size = tree->size;
+    cell->left = KV(tree_move_subtree)(from, to, tree->left);
+    cell->right = KV(tree_move_subtree)(from, to, tree->right);
+    KV(free_cell)(from, tree);
+    return cell;
+}
+
+// cell 只能屬於所在 segment 的 cntr
+// 把從 cntr 切下來的子樹 tree 交給空的 dst, 只搬動比較小的一邊:
+// tree 比留下來的大的話, 就讓 dst 接手 cntr 所有的 segment, 改搬留下來的部分
+static inline void KV(tree_hand_over)(KV(tree_cntr_t) * cntr, KV(tree_cntr_t) * dst, KV(tree_t) * tree){
+    if( tree->size <= cntr->root->size )
+        dst->root = KV(tree_move_subtree)(cntr, dst, tree);
+    else{
+        KV(tree_t) * rest = cntr->root;
+        dst->root = tree;
+        dst->free_slot = cntr->free_slot;
+        dst->free_last = cntr->free_last;
+        dst->newest_seg = cntr->newest_seg;
+        dst->oldest_seg = cntr->oldest_seg;
+        dst->fresh_cell = cntr->fresh_cell;
+        dst->fresh_end = cntr->fresh_end;
+        dst->cell_count = cntr->cell_count;
+        cntr->root = (KV(tree_t)*) &nil;
+        cntr->free_slot = NULL;
+        cntr->newest_seg = NULL;
+        cntr->fresh_cell = cntr->fresh_end = NULL;
+        cntr->cell_count = 0;
+        cntr->root = KV(tree_move_subtree)(dst, cntr, rest);
+    }
+    dst->ever_height = cntr->ever_height;
+    KV(tree_fit_height)(cntr);
+    KV(tree_fit_height)(dst);
+}
+
+// 把 other 的 segment 和 free_slot 都併入 cntr, other 變成空的
+// 兩邊的串列都直接接起來, 不必走過 cell 或 segment;
+// 只有還沒用過的 cell 比較少的那一邊要把它們放進 free_slot
+// 假設 other 的 root 已經接到 cntr 裡
+static inline void KV(tree_take_cells)(KV(tree_cntr_t) * cntr, KV(tree_cntr_t) * other){
+    IV cntr_fresh = cntr->fresh_cell ? cntr->fresh_end - cntr->fresh_cell : 0;
+    IV other_fresh = other->fresh_cell ? other->fresh_end - other->fresh_cell : 0;
+    if( other->newest_seg ){
+        if( other_fresh > cntr_fresh ){ // other 的 segment 接在前面, 還沒用過的 cell 用 other 的
+            KV(tree_retire_fresh)(cntr);
+            if( cntr->newest_seg )
+                other->oldest_seg->prev_seg = cntr->newest_seg;
+            else
+                cntr->oldest_seg = other->oldest_seg;
+            cntr->newest_seg = other->newest_seg;
+            cntr->fresh_cell = other->fresh_cell;
+            cntr->fresh_end = other->fresh_end;
+        }
+        else{ // other 的 segment 接在後面
+            KV(tree_retire_fresh)(other);
+            if( cntr->newest_seg )
+                cntr->oldest_seg->prev_seg = other->newest_seg;
+            else
+                cntr->newest_seg = other->newest_seg;
+            cntr->oldest_seg = other->oldest_seg;
+        }
+    }
+    if( other->free_slot ){
+        if( cntr->free_slot )
+            other->free_last->left = cntr->free_slot;
+        else
+            cntr->free_last = other->free_last;
+        cntr->free_slot = other->free_slot;
+    }
+    cntr->cell_count += other->cell_count;
+    other->root = (KV(tree_t)*) &nil;
+    other->free_slot = NULL;
+    other->newest_seg = NULL;
+    other->fresh_cell = other->fresh_end = NULL;
+    other->cell_count = 0;
+}
+
+// 把所有 entry 依序搬到一個剛好放得下的新 segment, 再放掉原本所有的 segment
+// key 和 value 直接轉手, 不動 refcnt; free_slot 裡的 cell 早就釋放過了, 不必再管
+// 沒有多餘的 cell 的話什麼都不做
+// return 還給 allocator 的 cell 數
+static inline IV KV(tree_compact)(KV(tree_cntr_t) * cntr){
+    IV n = cntr->root->size;
+    IV old_cells = cntr->cell_count;
+    if( n >= old_cells )
+        return 0;
+
+    KV(tree_t) * list = (KV(tree_t)*) tree_flatten(cntr->root, &nil);
+    KV(tree_seg_t) * seg = cntr->newest_seg;
+    cntr->root = (KV(tree_t)*) &nil;
+    cntr->free_slot = NULL;
+    cntr->newest_seg = NULL;
+    cntr->fresh_cell = cntr->fresh_end = NULL;
+    cntr->cell_count = 0;
+    if( n )
+        KV(tree_add_seg)(cntr, n);
+
+    // 新的 segment 裡, cell 的順序就是 key 的順序
+    KV(tree_t) * head = (KV(tree_t)*) &nil;
+    KV(tree_t) ** tail = &head;
+    for(; list != (KV(tree_t)*) &nil; list = list->right){
+#if I(VALUE) != I(void)
+        KV(tree_t) * cell = KV(allocate_cell)(cntr, list->key, list->value);
+#else
+        KV(tree_t) * cell = KV(allocate_cell)(cntr, list->key, NULL);
+#endif
+        *tail = cell;
+        tail = &cell->right;
+    }
+
+    while( seg ){
+        KV(tree_seg_t) * prev = seg->prev_seg;
+        Safefree(seg);
+        seg = prev;
+    }
+
+    KV(tree_assign_list)(cntr, head, n);
+    return old_cells - n;
+}
+
+// 把 other 整棵接進 cntr, other 變成空的
+// 兩棵的 key 範圍重疊的話什麼都不做, return FALSE
+static inline bool KV(tree_join)(pTHX_ SV**SP, KV(tree_cntr_t) * cntr, KV(tree_cntr_t) * other){
+    KV(tree_t) * root = cntr->root;
+    KV(tree_t) * other_root = other->root;
+
+    if( other_root == (KV(tree_t)*) &nil )
+        return TRUE;
+
+    if( root != (KV(tree_t)*) &nil ){
+        KV(tree_t) * min = root, * max = root, * other_min = other_root, * other_max = other_root;
+        while( min->left != (KV(tree_t)*) &nil )
+            min = min->left;
+        while( max->right != (KV(tree_t)*) &nil )
+            max = max->right;
+        while( other_min->left != (KV(tree_t)*) &nil )
+            other_min = other_min->left;
+        while( other_max->right != (KV(tree_t)*) &nil )
+            other_max = other_max->right;
+
+        if( KV(tree_cmp)(aTHX_ SP, cntr, max->key, other_min->key) <= 0 )
+            root = KV(tree_join2)(root, other_root);
+        else if( KV(tree_cmp)(aTHX_ SP, cntr, other_max->key, min->key) <= 0 )
+            root = KV(tree_join2)(other_root, root);
+        else
+            return FALSE;
+    }
+    else
+        root = other_root;
+
+    cntr->root = root;
+    KV(tree_take_cells)(cntr, other);
+    if( other->ever_height > cntr->ever_height )
+        cntr->ever_height = other->ever_height;
+    KV(tree_fit_height)(cntr);
+    return TRUE;
+}
+
+#define SPLIT_FUNC tree_split_lt
+#define SPLIT_SUBTREE_FUNC tree_split_lt_subtree
+#define SPLIT_CMP_OP <
+#include "split_gen.h"
+#undef SPLIT_CMP_OP
+#undef SPLIT_SUBTREE_FUNC
+#undef SPLIT_FUNC
+
+#define SPLIT_FUNC tree_split_le
+#define SPLIT_SUBTREE_FUNC tree_split_le_subtree
+#define SPLIT_CMP_OP <=
+#include "split_gen.h"
+#undef SPLIT_CMP_OP
+#undef SPLIT_SUBTREE_FUNC
+#undef SPLIT_FUNC
+
+#define RANGE_DELETE_FUNC tree_delete_gt_lt
+#define RANGE_DELETE_L_SPLIT_FUNC tree_split_le
+#define RANGE_DELETE_R_SPLIT_FUNC tree_split_lt
+#include "range_delete_gen.h"
+#undef RANGE_DELETE_R_SPLIT_FUNC
+#undef RANGE_DELETE_L_SPLIT_FUNC
+#undef RANGE_DELETE_FUNC
+
+#define RANGE_DELETE_FUNC tree_delete_ge_lt
+#define RANGE_DELETE_L_SPLIT_FUNC tree_split_lt
+#define RANGE_DELETE_R_SPLIT_FUNC tree_split_lt
+#include "range_delete_gen.h"
+#undef RANGE_DELETE_R_SPLIT_FUNC
+#undef RANGE_DELETE_L_SPLIT_FUNC
+#undef RANGE_DELETE_FUNC
+
+#define RANGE_DELETE_FUNC tree_delete_gt_le
+#define RANGE_DELETE_L_SPLIT_FUNC tree_split_le
+#define RANGE_DELETE_R_SPLIT_FUNC tree_split_le
+#include "range_delete_gen.h"
+#undef RANGE_DELETE_R_SPLIT_FUNC
+#undef RANGE_DELETE_L_SPLIT_FUNC
+#undef RANGE_DELETE_FUNC
+
+#define RANGE_DELETE_FUNC tree_delete_ge_le
+#define RANGE_DELETE_L_SPLIT_FUNC tree_split_lt
+#define RANGE_DELETE_R_SPLIT_FUNC tree_split_le
+#include "range_delete_gen.h"
+#undef RANGE_DELETE_R_SPLIT_FUNC
+#undef RANGE_DELETE_L_SPLIT_FUNC
+#undef RANGE_DELETE_FUNC
+
+// 釋放整棵子樹
+static void KV(tree_release_subtree)(pTHX_ KV(tree_cntr_t) * cntr, KV(tree_t) * tree){
+    while( tree != (KV(tree_t)*) &nil ){
+        KV(tree_t) * right = tree->right;
+        KV(tree_release_subtree)(aTHX_ cntr, tree->left);
+        KV(release_cell)(aTHX_ cntr, tree);
+        tree = right;
+    }
+}
+
+// 放掉所有的 entry, cell 都留在 free_slot 裡以後再用
+// 先把樹拿下來, 釋放 key 和 value 時觸發的 perl code 只會看到空的樹
+static inline void KV(tree_clear)(pTHX_ KV(tree_cntr_t) * cntr){
+    KV(tree_t) * root = cntr->root;
+    cntr->root = (KV(tree_t)*) &nil;
+    KV(tree_release_subtree)(aTHX_ cntr, root);
+}
+
+// 依序 (backward 的話由大到小) 把子樹裡的 key (和 value) 交給 perl stack, 再把 cell 放回 free_slot
+// 假設 stack 已經 EXTEND 足夠的空間
+static SV ** KV(tree_take_subtree)(pTHX_ SV** SP, KV(tree_cntr_t) * cntr, KV(tree_t) * tree, bool backward){
+    while( tree != (KV(tree_t)*) &nil ){
+        KV(tree_t) * next = backward ? tree->left : tree->right;
+        SP = KV(tree_take_subtree)(aTHX_ SP, cntr, backward ? tree->right : tree->left, backward);
+        SP = K(mtake)(aTHX_ SP, tree->key);
+#if I(VALUE) != I(void)
+        SP = V(mtake)(aTHX_ SP, tree->value);
+#endif
+        KV(free_cell)(cntr, tree);
+        tree = next;
+    }
+    return SP;
+}
+
+// 把 cntr 裡 key 不大於給定 key 的 entry, 從最小的開始取至多 limit 個 (limit < 0 表示不限) 切出來
+// return 切下來的子樹, 它的 cell 仍屬於 cntr 的 segment
+static inline KV(tree_t) * KV(tree_drain_le)(pTHX_ SV**SP, KV(tree_cntr_t) * cntr, T(KEY) key, IV limit){
+    KV(tree_t) * drained = KV(tree_split_le)(aTHX_ SP, cntr, key);
+    if( limit >= 0 && drained->size > limit ){
+        KV(tree_t) * rest;
+        tree_split_rank(drained, limit, &drained, &rest);
+        cntr->root = KV(tree_join2)(rest, cntr->root);
+    }
+    KV(tree_fit_height)(cntr);
+    return drained;
+}
+
+// 把 cntr 裡 key 不小於給定 key 的 entry, 從最大的開始取至多 limit 個 (limit < 0 表示不限) 切出來
+// return 切下來的子樹, 它的 cell 仍屬於 cntr 的 segment
+static inline KV(tree_t) * KV(tree_drain_ge)(pTHX_ SV**SP, KV(tree_cntr_t) * cntr, T(KEY) key, IV limit){
+    KV(tree_t) * rest = KV(tree_split_lt)(aTHX_ SP, cntr, key);
+    KV(tree_t) * drained = cntr->root;
+    if( limit >= 0 && drained->size > limit ){
+        KV(tree_t) * kept;
+        tree_split_rank(drained, drained->size - limit, &kept, &drained);
+        rest = KV(tree_join2)(rest, kept);
+    }
+    cntr->root = rest;
+    KV(tree_fit_height)(cntr);
+    return drained;
+}
+
+// 把 cntr 裡最小 (from_max 的話最大) 的 limit 個 entry 切出來 (limit < 0 表示全部), 不需要比較 key
+// return 切下來的子樹, 它的 cell 仍屬於 cntr 的 segment
+static inline KV(tree_t) * KV(tree_pop)(KV(tree_cntr_t) * cntr, IV limit, bool from_max){
+    KV(tree_t) * popped = cntr->root;
+    if( limit >= 0 && popped->size > limit ){
+        if( from_max )
+            tree_split_rank(popped, popped->size - limit, &cntr->root, &popped);
+        else
+            tree_split_rank(popped, limit, &popped, &cntr->root);
+    }
+    else
+        cntr->root = (KV(tree_t)*) &nil;
+    KV(tree_fit_height)(cntr);
+    return popped;
+}
+
+// 假設 0 <= rank < tree->size
+// 把子樹裡第 rank 個 (由 0 起算) entry 移出樹外, 它的 cell 存進 *removed
+// return 新的子樹 root
+static KV(tree_t) * KV(tree_unlink_rank)(KV(tree_t) * tree, IV rank, KV(tree_t) ** removed){
+    IV left_size = tree->left->size;
+    if( rank < left_size ){
+        tree->left = KV(tree_unlink_rank)(tree->left, rank, removed);
+        --tree->size;
+        return (KV(tree_t)*) maintain_larger_right(tree);
+    }
+    if( rank > left_size ){
+        tree->right = KV(tree_unlink_rank)(tree->right, rank - left_size - 1, removed);
+        --tree->size;
+        return (KV(tree_t)*) maintain_larger_left(tree);
+    }
+    *removed = tree;
+    return KV(tree_unlink_root)(tree);
+}
+
+// 假設 0 <= from < cntr 的 size
+// 把第 from 個開始的 count 個 entry (count < 0 表示到最後) 切出來, 不需要比較 key
+// return 切下來的子樹, 它的 cell 仍屬於 cntr 的 segment
+static inline KV(tree_t) * KV(tree_cut_ranks)(KV(tree_cntr_t) * cntr, IV from, IV count){
+    KV(tree_t) * lower, * middle, * upper = (KV(tree_t)*) &nil;
+    tree_split_rank(cntr->root, from, &lower, &middle);
+    if( count >= 0 && count < middle->size )
+        tree_split_rank(middle, count, &middle, &upper);
+    cntr->root = KV(tree_join2)(lower, upper);
+    KV(tree_fit_height)(cntr);
+    return middle;
+}
+
+// 在 cntr 配置一個 cell, 放入 cell 的 key 和 value 的複本
+static inline KV(tree_t) * KV(tree_clone_cell)(pTHX_ KV(tree_cntr_t) * cntr, KV(tree_t) * cell){
+#if I(VALUE) != I(void)
+    return KV(allocate_cell)(cntr, K(clone)(aTHX_ cell->key), V(clone)(aTHX_ cell->value));
+#else
+    return KV(allocate_cell)(cntr, K(clone)(aTHX_ cell->key), NULL);
+#endif
+}
+
+// 把另一棵樹的子樹 tree 裡第 from 到第 to-1 個 (由 0 起算) entry 依序複製到 cntr 的 cell,
+// 以 right 串起來接在 *tail, return 新的 tail
+static KV(tree_t) ** KV(tree_clone_range)(pTHX_ KV(tree_cntr_t) * cntr, KV(tree_t) * tree, IV from, IV to, KV(tree_t) ** tail){
+    while( tree != (KV(tree_t)*) &nil && from < to ){
+        IV left_size = tree->left->size;
+        if( from < left_size )
+            tail = KV(tree_clone_range)(aTHX_ cntr, tree->left, from, to < left_size ? to : left_size, tail);
+        if( from <= left_size && left_size < to ){
+            KV(tree_t) * cell = KV(tree_clone_cell)(aTHX_ cntr, tree);
+            *tail = cell;
+            tail = &cell->right;
+        }
+        from = from > left_size ? from - left_size - 1 : 0;
+        to -= left_size + 1;
+        tree = tree->right;
+    }
+    return tail;
+}
+
+// union / intersection / difference 遞迴時, 一層手上的三段子樹, 依序接起來就是這一層的結果
+// busy 那段交給了下一層處理
+typedef struct KV(tree_setop_frame_t) {
+    KV(tree_t) * part[3];
+    int busy;
+} KV(tree_setop_frame_t);
+
+typedef struct KV(tree_setop_t) {
+    KV(tree_cntr_t) * cntr;
+    KV(tree_t) * dead; // 要刪掉的 cell, 以 right 串起來, tree 放回 cntr 之後才釋放
+    int top; // 最深一層的 frame
+    KV(tree_setop_frame_t) frame[];
+} KV(tree_setop_t);
+
+// 從最深一層往上把每層的子樹接起來, 放回 cntr 的 root, 之後才釋放 dead 裡的 cell
+// 釋放 key 和 value 時觸發的 perl code 看到的是完整的 tree
+// 正常結束時呼叫; 途中 croak 的話, LEAVE 時也會呼叫, 還沒處理完的部分照原樣接回去
+static void KV(tree_setop_finish)(pTHX_ void * _setop){
+    KV(tree_setop_t) * setop = (KV(tree_setop_t)*) _setop;
+    KV(tree_cntr_t) * cntr = setop->cntr;
+    if( !cntr )
+        return;
+    setop->cntr = NULL;
+
+    KV(tree_t) * tree = (KV(tree_t)*) &nil;
+    for(int d=setop->top; d>=0; --d){
+        KV(tree_setop_frame_t) * frame = &setop->frame[d];
+        if( d < setop->top )
+            frame->part[frame->busy] = tree;
+        tree = KV(tree_join2)(KV(tree_join2)(frame->part[0], frame->part[1]), frame->part[2]);
+    }
+    cntr->root = tree;
+    KV(tree_fit_height)(cntr);
+
+    KV(tree_t) * dead = setop->dead;
+    while( dead != (KV(tree_t)*) &nil ){
+        KV(tree_t) * next = dead->right;
+        KV(release_cell)(aTHX_ cntr, dead);
+        dead = next;
+    }
+}
+
+// 把 cntr 的 tree 拿下來, 開始和 other 的 tree 運算
+// 需要在 ENTER / LEAVE 之間呼叫
+static inline KV(tree_setop_t) * KV(tree_setop_start)(pTHX_ KV(tree_cntr_t) * cntr, KV(tree_cntr_t) * other){
+    KV(tree_setop_t) * setop;
+    // 每一層往 other 的 tree 下走一層, 所以層數不超過它的高度
+    Newxc(setop, sizeof(KV(tree_setop_t)) + (other->ever_height + 1) * sizeof(KV(tree_setop_frame_t)), char, KV(tree_setop_t));
+    SAVEFREEPV(setop);
+    setop->cntr = cntr;
+    setop->dead = (KV(tree_t)*) &nil;
+    setop->top = 0;
+    setop->frame[0].part[0] = setop->frame[0].part[2] = (KV(tree_t)*) &nil;
+    setop->frame[0].part[1] = cntr->root;
+    setop->frame[0].busy = 1;
+    cntr->root = (KV(tree_t)*) &nil;
+    SAVEDESTRUCTOR_X(KV(tree_setop_finish), setop);
+    return setop;
+}
+
+// 以 s 的 key 把 tree 切成三段, 放進新的一層 frame, 交給下一層的是第一段
+// 每切一次都先記下來, 比較時 croak 的話 tree 仍是完整的
+static inline KV(tree_setop_frame_t) * KV(tree_setop_split)(pTHX_ SV**SP, KV(tree_setop_t) * setop, KV(tree_t) * tree, KV(tree_t) * s){
+    KV(tree_t) * lower, * rest;
+    KV(tree_split_lt_subtree)(aTHX_ SP, setop->cntr, tree, s->key, &lower, &rest);
+    KV(tree_setop_frame_t) * frame = &setop->frame[++setop->top];
+    frame->part[0] = lower;
+    frame->part[1] = rest;
+    frame->part[2] = (KV(tree_t)*) &nil;
+    frame->busy = 0;
+    KV(tree_split_le_subtree)(aTHX_ SP, setop->cntr, rest, s->key, &frame->part[1], &frame->part[2]);
+    return frame;
+}
+
+// 把另一棵樹的子樹 s 聯集進 cntr 的子樹 tree, return 新的子樹 root
+// s 裡的 key 在 tree 裡已經有的話就不加入
+// lo 或 hi 不是 NULL 時, 表示 cntr 在 tree 之外已經有和它一樣的 key, s 裡等於它的 entry 也不加入
+static KV(tree_t) * KV(tree_union_subtree)(pTHX_ SV**SP, KV(tree_setop_t) * setop, KV(tree_t) * tree, KV(tree_t) * s, KV(tree_t) * lo, KV(tree_t) * hi){
+    KV(tree_cntr_t) * cntr = setop->cntr;
+    if( s == (KV(tree_t)*) &nil )
+        return tree;
+
+    if( tree == (KV(tree_t)*) &nil ){
+        // s 裡等於 lo 的 entry 都在最前面, 等於 hi 的都在最後面
+        IV from = 0, to = s->size;
+        for(KV(tree_t) * p = s; lo && p != (KV(tree_t)*) &nil; )
+            if( KV(tree_cmp)(aTHX_ SP, cntr, p->key, lo->key) <= 0 ){
+                from += p->left->size + 1;
+                p = p->right;
+            }
+            else
+                p = p->left;
+        for(KV(tree_t) * p = s; hi && p != (KV(tree_t)*) &nil; )
+            if( KV(tree_cmp)(aTHX_ SP, cntr, p->key, hi->key) >= 0 ){
+                to -= p->right->size + 1;
+                p = p->left;
+            }
+            else
+                p = p->right;
+        if( from >= to )
+            return tree;
+
+        KV(tree_t) * head = (KV(tree_t)*) &nil;
+        KV(tree_clone_range)(aTHX_ cntr, s, from, to, &head);
+        return (KV(tree_t)*) tree_build_from_list((void*) &head, to - from);
+    }
+
+    KV(tree_setop_frame_t) * frame = KV(tree_setop_split)(aTHX_ SP, setop, tree, s);
+    bool has_equal = frame->part[1] != (KV(tree_t)*) &nil;
+    frame->part[0] = KV(tree_union_subtree)(aTHX_ SP, setop, frame->part[0], s->left, lo, has_equal ? s : hi);
+    frame->busy = 2;
+    frame->part[2] = KV(tree_union_subtree)(aTHX_ SP, setop, frame->part[2], s->right, has_equal ? s : lo, hi);
+    if( !has_equal && !(lo && KV(tree_cmp)(aTHX_ SP, cntr, s->key, lo->key) == 0) && !(hi && KV(tree_cmp)(aTHX_ SP, cntr, s->key, hi->key) == 0) )
+        frame->part[1] = KV(tree_clone_cell)(aTHX_ cntr, s);
+    --setop->top;
+    if( frame->part[1] != (KV(tree_t)*) &nil && !has_equal )
+        return (KV(tree_t)*) tree_join3(frame->part[0], frame->part[1], frame->part[2]);
+    return KV(tree_join2)(KV(tree_join2)(frame->part[0], frame->part[1]), frame->part[2]);
+}
+
+// 只留下 cntr 的子樹 tree 裡, key 也在另一棵樹的子樹 s 裡的 entry, return 新的子樹 root
+// 不留下的 cell 放進 setop 的 dead
+static KV(tree_t) * KV(tree_intersection_subtree)(pTHX_ SV**SP, KV(tree_setop_t) * setop, KV(tree_t) * tree, KV(tree_t) * s){
+    if( tree == (KV(tree_t)*) &nil )
+        return tree;
+    if( s == (KV(tree_t)*) &nil ){
+        setop->dead = (KV(tree_t)*) tree_flatten(tree, setop->dead);
+        return (KV(tree_t)*) &nil;
+    }
+
+    KV(tree_setop_frame_t) * frame = KV(tree_setop_split)(aTHX_ SP, setop, tree, s);
+    frame->part[0] = KV(tree_intersection_subtree)(aTHX_ SP, setop, frame->part[0], s->left);
+    frame->busy = 2;
+    frame->part[2] = KV(tree_intersection_subtree)(aTHX_ SP, setop, frame->part[2], s->right);
+    --setop->top;
+    return KV(tree_join2)(KV(tree_join2)(frame->part[0], frame->part[1]), frame->part[2]);
+}
+
+// 刪掉 cntr 的子樹 tree 裡, key 也在另一棵樹的子樹 s 裡的 entry, return 新的子樹 root
+// 刪掉的 cell 放進 setop 的 dead
+static KV(tree_t) * KV(tree_difference_subtree)(pTHX_ SV**SP, KV(tree_setop_t) * setop, KV(tree_t) * tree, KV(tree_t) * s){
+    if( tree == (KV(tree_t)*) &nil || s == (KV(tree_t)*) &nil )
+        return tree;
+
+    KV(tree_setop_frame_t) * frame = KV(tree_setop_split)(aTHX_ SP, setop, tree, s);
+    setop->dead = (KV(tree_t)*) tree_flatten(frame->part[1], setop->dead);
+    frame->part[1] = (KV(tree_t)*) &nil;
+    frame->part[0] = KV(tree_difference_subtree)(aTHX_ SP, setop, frame->part[0], s->left);
+    frame->busy = 2;
+    frame->part[2] = KV(tree_difference_subtree)(aTHX_ SP, setop, frame->part[2], s->right);
+    --setop->top;
+    return KV(tree_join2)(frame->part[0], frame->part[2]);
+}
+
+// 把 other 裡 key 不在 cntr 裡的 entry 都複製進 cntr, other 不變
+// 需要在 ENTER / LEAVE 之間呼叫
+static inline void KV(tree_union)(pTHX_ SV**SP, KV(tree_cntr_t) * cntr, KV(tree_cntr_t) * other){
+    if( cntr == other )
+        return;
+    KV(tree_setop_t) * setop = KV(tree_setop_start)(aTHX_ cntr, other);
+    setop->frame[0].part[1] = KV(tree_union_subtree)(aTHX_ SP, setop, setop->frame[0].part[1], other->root, NULL, NULL);
+    KV(tree_setop_finish)(aTHX_ setop);
+}
+
+// 只留下 cntr 裡 key 也在 other 裡的 entry, other 不變
+// 需要在 ENTER / LEAVE 之間呼叫
+static inline void KV(tree_intersection)(pTHX_ SV**SP, KV(tree_cntr_t) * cntr, KV(tree_cntr_t) * other){
+    if( cntr == other )
+        return;
+    KV(tree_setop_t) * setop = KV(tree_setop_start)(aTHX_ cntr, other);
+    setop->frame[0].part[1] = KV(tree_intersection_subtree)(aTHX_ SP, setop, setop->frame[0].part[1], other->root);
+    KV(tree_setop_finish)(aTHX_ setop);
+}
+
+// 刪掉 cntr 裡 key 也在 other 裡的 entry, other 不變
+// 需要在 ENTER / LEAVE 之間呼叫
+static inline void KV(tree_difference)(pTHX_ SV**SP, KV(tree_cntr_t) * cntr, KV(tree_cntr_t) * other){
+    if( cntr == other ){
+        KV(tree_clear)(aTHX_ cntr);
+        return;
+    }
+    KV(tree_setop_t) * setop = KV(tree_setop_start)(aTHX_ cntr, other);
+    setop->frame[0].part[1] = KV(tree_difference_subtree)(aTHX_ SP, setop, setop->frame[0].part[1], other->root);
+    KV(tree_setop_finish)(aTHX_ setop);
+}
+
 #define MIN_MAX_FIND_FUNC tree_find_min
 #define SKIP_FIND_FUNC tree_skip_l
 #define MIN_MAX_FIND_GOOD_DIR left
@@ -320,29 +1078,343 @@ static inline void KV(init_tree_cntr)(KV(tree_cntr_t) * cntr, SV * cmp){
     cntr->newest_seg = NULL;
     cntr->free_slot = NULL;
     cntr->ever_height = 0;
+    cntr->cmp_count = 0;
+    cntr->fresh_cell = cntr->fresh_end = NULL;
+    cntr->cell_count = 0;
 #if I(KEY) == I(any)
     cntr->cmp = SvREFCNT_inc_simple_NN(cmp);
 #endif
 }
 
+// 把 new_cell 接在 tree_insert_* 或 tree_locate_after 找出的路徑底下, 再由下往上調整
+// path[i] 是路徑上第 i 個節點, went_right[i] 表示從 path[i] 往右走
+static inline void KV(tree_commit_insert)(KV(tree_cntr_t) * cntr, KV(tree_t) ** path, bool * went_right, int depth, KV(tree_t) * new_cell){
+    if( depth + 1 > cntr->ever_height )
+        cntr->ever_height = depth + 1;
+
+    if( UNLIKELY(depth == 0) ){
+        cntr->root = new_cell;
+        return;
+    }
+
+    KV(tree_t) * t = path[depth-1];
+    ++t->size;
+    if( went_right[depth-1] )
+        t->right = new_cell;
+    else
+        t->left = new_cell;
+
+    for(int i=depth-2; i>=0; --i){
+        ++path[i]->size;
+        if( went_right[i] ){
+            path[i]->right = t;
+            t = (KV(tree_t)*) maintain_larger_right(path[i]);
+        }
+        else{
+            path[i]->left = t;
+            t = (KV(tree_t)*) maintain_larger_left(path[i]);
+        }
+    }
+    cntr->root = t;
+}
+
 #define INSERT_FUNC tree_insert_after
-#define INSERT_SUBTREE_FUNC tree_insert_after_subtree
 #define INSERT_CMP_OP <=
 #include "insert_gen.h"
 #undef INSERT_CMP_OP
-#undef INSERT_SUBTREE_FUNC
 #undef INSERT_FUNC
 
 #define INSERT_FUNC tree_insert_before
-#define INSERT_SUBTREE_FUNC tree_insert_before_subtree
 #define INSERT_CMP_OP <
 #include "insert_gen.h"
 #undef INSERT_CMP_OP
-#undef INSERT_SUBTREE_FUNC
 #undef INSERT_FUNC
 
+// 沿著 tree_insert_after 的路徑往下走, 每個節點只比較一次
+// 經過的節點依序存進 path, went_right[i] 表示從 path[i] 往右走, 兩者都至少要有 ever_height 格
+// *found 設為 key 相等的 entry 裡最後一個, 沒有的話設為 NULL
+// return 路徑長度
+static inline int KV(tree_locate_after)(pTHX_ SV**SP, KV(tree_cntr_t) * cntr, T(KEY) key, KV(tree_t) ** path, bool * went_right, KV(tree_t) ** found){
+    KV(tree_t) * t = cntr->root;
+    KV(tree_t) * last_le = NULL; // 路徑上最後一個往右走的節點, 也就是 key 不大於給定 key 的最後一個 entry
+    bool last_eq = FALSE;
+    int depth = 0;
+
+    while( t != (KV(tree_t)*) &nil ){
+        IV c = KV(tree_cmp)(aTHX_ SP, cntr, t->key, key);
+        path[depth] = t;
+        if( c <= 0 ){
+            went_right[depth++] = TRUE;
+            last_le = t;
+            last_eq = c == 0;
+            t = t->right;
+        }
+        else{
+            went_right[depth++] = FALSE;
+            t = t->left;
+        }
+    }
+
+    *found = last_eq ? last_le : NULL;
+    return depth;
+}
+
+typedef struct KV(tree_batch_t) {
+    T(KEY) key; // str 和 any 是 array 裡原本的 SV, 還沒有複製
+    SSize_t index; // 在原本 array 裡的位置
+} KV(tree_batch_t);
+
+#if I(KEY) == I(int) || (I(KEY) == I(num) && NVSIZE == UVSIZE)
+#   define BATCH_RADIX_SORT
+// 轉成保持大小順序的 unsigned 整數
+static inline UV KV(tree_radix_key)(T(KEY) key){
+    const UV sign = (UV) 1 << (sizeof(UV) * 8 - 1);
+#   if I(KEY) == I(int)
+    return (UV) key ^ sign;
+#   else
+    UV bits;
+    if( key == 0 ) // -0.0 和 0.0 一樣大
+        key = 0;
+    Copy(&key, &bits, 1, UV);
+    return bits & sign ? ~bits : bits | sign;
+#   endif
+}
+
+static void KV(tree_radix_sort)(KV(tree_batch_t) * batch, KV(tree_batch_t) * buf, SSize_t n){
+    SSize_t count[sizeof(UV)][256];
+    Zero(count, sizeof(UV) * 256, SSize_t);
+    for(SSize_t i=0; i<n; ++i){
+        UV radix = KV(tree_radix_key)(batch[i].key);
+        for(int b=0; b<(int)sizeof(UV); ++b)
+            ++count[b][(radix >> (b * 8)) & 255];
+    }
+
+    KV(tree_batch_t) * from = batch, * to = buf;
+    for(int b=0; b<(int)sizeof(UV); ++b){
+        if( count[b][(KV(tree_radix_key)(from[0].key) >> (b * 8)) & 255] == n ) // 這個 byte 全都一樣
+            continue;
+
+        SSize_t pos = 0;
+        for(int d=0; d<256; ++d){
+            SSize_t c = count[b][d];
+            count[b][d] = pos;
+            pos += c;
+        }
+        for(SSize_t i=0; i<n; ++i)
+            to[count[b][(KV(tree_radix_key)(from[i].key) >> (b * 8)) & 255]++] = from[i];
+
+        KV(tree_batch_t) * t = from;
+        from = to;
+        to = t;
+    }
+    if( from != batch )
+        Copy(from, batch, n, KV(tree_batch_t));
+}
+#endif
+
+// 穩定的 merge sort, key 一樣大的保持原本順序
+static void KV(tree_merge_sort)(pTHX_ SV**SP, KV(tree_cntr_t) * cntr, KV(tree_batch_t) * batch, KV(tree_batch_t) * buf, SSize_t n){
+    if( n <= 8 ){
+        for(SSize_t i=1; i<n; ++i){
+            KV(tree_batch_t) x = batch[i];
+            SSize_t j = i;
+            while( j > 0 && KV(tree_cmp)(aTHX_ SP, cntr, batch[j-1].key, x.key) > 0 ){
+                batch[j] = batch[j-1];
+                --j;
+            }
+            batch[j] = x;
+        }
+        return;
+    }
+
+    SSize_t half = n >> 1;
+    KV(tree_merge_sort)(aTHX_ SP, cntr, batch, buf, half);
+    KV(tree_merge_sort)(aTHX_ SP, cntr, batch + half, buf + half, n - half);
+    if( KV(tree_cmp)(aTHX_ SP, cntr, batch[half-1].key, batch[half].key) <= 0 ) // 已經排好了
+        return;
+
+    Copy(batch, buf, half, KV(tree_batch_t));
+    SSize_t i = 0, j = half, k = 0;
+    while( i < half && j < n ){
+        if( KV(tree_cmp)(aTHX_ SP, cntr, batch[j].key, buf[i].key) < 0 )
+            batch[k++] = batch[j++];
+        else
+            batch[k++] = buf[i++];
+    }
+    while( i < half )
+        batch[k++] = buf[i++];
+}
+
+// 讀入 keys 並依 key 排好序
+// 需要在 ENTER / LEAVE 之間呼叫, 暫存空間會在 LEAVE 時釋放
+static inline KV(tree_batch_t) * KV(tree_load_batch)(pTHX_ SV**SP, KV(tree_cntr_t) * cntr, AV * keys, SSize_t n){
+    KV(tree_batch_t) * batch, * buf;
+    Newx(batch, n + 1, KV(tree_batch_t));
+    SAVEFREEPV(batch);
+    Newx(buf, n + 1, KV(tree_batch_t));
+    SAVEFREEPV(buf);
+
+    for(SSize_t i=0; i<n; ++i){
+        batch[i].key = K(from_sv)(aTHX_ av_fetch_sv(aTHX_ keys, i));
+        batch[i].index = i;
+    }
+
+#ifdef BATCH_RADIX_SORT
+    if( n >= BATCH_RADIX_MIN )
+        KV(tree_radix_sort)(batch, buf, n);
+    else
+#endif
+        KV(tree_merge_sort)(aTHX_ SP, cntr, batch, buf, n);
+    return batch;
+}
+#undef BATCH_RADIX_SORT
+
+// 加入 m 個 entry 時, 攤平合併後重建 O(n+m) 是否比一個一個插入 O(m log n) 划算
+static inline bool KV(tree_prefer_rebuild)(KV(tree_cntr_t) * cntr, IV m){
+    IV n = KV(tree_size)(cntr);
+    return n <= m * tree_build_height(n + m);
+}
+
+// 攤平後重建中的 tree: 處理好的 cell 依序串在 head 到 *tail, 還沒處理的依序串在 rest,
+// 要刪掉的 cell 串在 dead (都以 right 串起來)
+// 過程中 cntr 的 root 是空的
+typedef struct KV(tree_relist_t) {
+    KV(tree_cntr_t) * cntr;
+    KV(tree_t) * head;
+    KV(tree_t) ** tail;
+    KV(tree_t) * rest;
+    KV(tree_t) * dead;
+    IV n; // head 和 rest 裡的 cell 數
+} KV(tree_relist_t);
+
+// 把 head 和 rest 接起來建成平衡樹, 放回 cntr 的 root, 之後才釋放 dead 裡的 cell
+// 釋放 key 和 value 時觸發的 perl code 看到的是完整的 tree
+// 正常結束時呼叫; 途中 croak 的話, LEAVE 時也會呼叫, 讓 tree 保持完整
+static void KV(tree_relist_finish)(pTHX_ void * _relist){
+    KV(tree_relist_t) * relist = (KV(tree_relist_t)*) _relist;
+    KV(tree_cntr_t) * cntr = relist->cntr;
+    if( !cntr )
+        return;
+    relist->cntr = NULL;
+    *relist->tail = relist->rest;
+    KV(tree_assign_list)(cntr, relist->head, relist->n);
+
+    KV(tree_t) * dead = relist->dead;
+    while( dead != (KV(tree_t)*) &nil ){
+        KV(tree_t) * next = dead->right;
+        KV(release_cell)(aTHX_ cntr, dead);
+        dead = next;
+    }
+}
+
+// 攤平 cntr 的 tree, 開始重建
+// 需要在 ENTER / LEAVE 之間呼叫
+static inline KV(tree_relist_t) * KV(tree_relist_start)(pTHX_ KV(tree_cntr_t) * cntr){
+    KV(tree_relist_t) * relist;
+    Newx(relist, 1, KV(tree_relist_t));
+    SAVEFREEPV(relist);
+    relist->cntr = cntr;
+    relist->head = (KV(tree_t)*) &nil;
+    relist->tail = &relist->head;
+    relist->rest = (KV(tree_t)*) tree_flatten(cntr->root, &nil);
+    relist->dead = (KV(tree_t)*) &nil;
+    relist->n = KV(tree_size)(cntr);
+    cntr->root = (KV(tree_t)*) &nil;
+    SAVEDESTRUCTOR_X(KV(tree_relist_finish), relist);
+    return relist;
+}
+
+// 把排好序的 batch 插入 tree, values 可以是 NULL
+// key 一樣大的時候, 效果和依照原本 array 的順序一個一個 insert_after 相同
+// 需要在 ENTER / LEAVE 之間呼叫
+static inline void KV(tree_insert_batch)(pTHX_ SV**SP, KV(tree_cntr_t) * cntr, KV(tree_batch_t) * batch, SSize_t m, AV * values){
+    KV(tree_grow)(cntr, KV(tree_size)(cntr) + m);
+    if( !KV(tree_prefer_rebuild)(cntr, m) ){
+        for(SSize_t i=0; i<m; ++i)
+            KV(tree_insert_after)(aTHX_ SP, cntr,
+                K(clone)(aTHX_ batch[i].key),
+                V(copy_sv)(aTHX_ values ? av_fetch_sv(aTHX_ values, batch[i].index) : &PL_sv_undef)
+            );
+        return;
+    }
+
+    // 比較時可能 croak, 所以隨時保持 relist 完整
+    KV(tree_relist_t) * relist = KV(tree_relist_start)(aTHX_ cntr);
+    for(SSize_t i=0; i<m; ++i){
+        while( relist->rest != (KV(tree_t)*) &nil && KV(tree_cmp)(aTHX_ SP, cntr, relist->rest->key, batch[i].key) <= 0 ){
+            *relist->tail = relist->rest;
+            relist->tail = &relist->rest->right;
+            relist->rest = relist->rest->right;
+        }
+        KV(tree_t) * cell = KV(allocate_cell)(cntr,
+            K(clone)(aTHX_ batch[i].key),
+            V(copy_sv)(aTHX_ values ? av_fetch_sv(aTHX_ values, batch[i].index) : &PL_sv_undef)
+        );
+        *relist->tail = cell;
+        relist->tail = &cell->right;
+        ++relist->n;
+    }
+    KV(tree_relist_finish)(aTHX_ relist);
+}
+
+// 攤平 tree, 對排好序的 batch 裡的每個 key 刪掉一個 key 一樣大的 entry, 再重建
+// from_last 為真時刪掉最後插入的, 否則刪掉最先插入的
+// return 刪掉的數量
+// 需要在 ENTER / LEAVE 之間呼叫
+static inline IV KV(tree_delete_batch_rebuild)(pTHX_ SV**SP, KV(tree_cntr_t) * cntr, KV(tree_batch_t) * batch, SSize_t m, bool from_last){
+    // 比較時可能 croak, 所以只在比較完之後才改動 relist
+    KV(tree_relist_t) * relist = KV(tree_relist_start)(aTHX_ cntr);
+    IV removed = 0;
+    SSize_t i = 0;
+    while( relist->rest != (KV(tree_t)*) &nil && i < m ){
+        KV(tree_t) * old = relist->rest;
+        IV c = KV(tree_cmp)(aTHX_ SP, cntr, old->key, batch[i].key);
+        if( c < 0 ){
+            *relist->tail = old;
+            relist->tail = &old->right;
+            relist->rest = old->right;
+        }
+        else if( c > 0 )
+            ++i;
+        else{
+            IV victim = 1;
+            while( i + victim < m && KV(tree_cmp)(aTHX_ SP, cntr, batch[i].key, batch[i+victim].key) == 0 )
+                ++victim;
+            i += victim;
+
+            IV run = 1;
+            KV(tree_t) * run_end = old->right;
+            while( run_end != (KV(tree_t)*) &nil && KV(tree_cmp)(aTHX_ SP, cntr, old->key, run_end->key) == 0 ){
+                ++run;
+                run_end = run_end->right;
+            }
+
+            IV keep = run > victim ? run - victim : 0;
+            for(IV k=0; k<run; ++k){
+                KV(tree_t) * next = old->right;
+                if( from_last ? k < keep : k >= run - keep ){
+                    *relist->tail = old;
+                    relist->tail = &old->right;
+                }
+                else{
+                    old->right = relist->dead;
+                    relist->dead = old;
+                }
+                old = next;
+            }
+            relist->rest = old;
+            relist->n -= run - keep;
+            removed += run - keep;
+        }
+    }
+    KV(tree_relist_finish)(aTHX_ relist);
+    return removed;
+}
+
 #define DELETE_FUNC tree_delete_last
-#define DELETE_SUBTREE_FUNC tree_delete_subtree_last
+#define DELETE_TAKE_FUNC tree_take_last
+#define DELETE_BATCH_FUNC tree_delete_batch_last
+#define DELETE_FROM_LAST TRUE
 #define DELETE_CMP_OP <=
 #define DELETE_GOOD_DIR right
 #define DELETE_BAD_DIR left
@@ -354,11 +1426,15 @@ static inline void KV(init_tree_cntr)(KV(tree_cntr_t) * cntr, SV * cmp){
 #undef DELETE_BAD_DIR
 #undef DELETE_GOOD_DIR
 #undef DELETE_CMP_OP
-#undef DELETE_SUBTREE_FUNC
+#undef DELETE_FROM_LAST
+#undef DELETE_BATCH_FUNC
+#undef DELETE_TAKE_FUNC
 #undef DELETE_FUNC
 
 #define DELETE_FUNC tree_delete_first
-#define DELETE_SUBTREE_FUNC tree_delete_subtree_first
+#define DELETE_TAKE_FUNC tree_take_first
+#define DELETE_BATCH_FUNC tree_delete_batch_first
+#define DELETE_FROM_LAST FALSE
 #define DELETE_CMP_OP >=
 #define DELETE_GOOD_DIR left
 #define DELETE_BAD_DIR right
@@ -370,10 +1446,13 @@ static inline void KV(init_tree_cntr)(KV(tree_cntr_t) * cntr, SV * cmp){
 #undef DELETE_BAD_DIR
 #undef DELETE_GOOD_DIR
 #undef DELETE_CMP_OP
-#undef DELETE_SUBTREE_FUNC
+#undef DELETE_FROM_LAST
+#undef DELETE_BATCH_FUNC
+#undef DELETE_TAKE_FUNC
 #undef DELETE_FUNC
 
 #define FIND_FUNC tree_find_first
+#define FIND_CELL_FUNC tree_find_first_cell
 #define FIND_CMP_OP >=
 #define FIND_GOOD_DIR left
 #define FIND_BAD_DIR right
@@ -381,9 +1460,11 @@ static inline void KV(init_tree_cntr)(KV(tree_cntr_t) * cntr, SV * cmp){
 #undef FIND_BAD_DIR
 #undef FIND_GOOD_DIR
 #undef FIND_CMP_OP
+#undef FIND_CELL_FUNC
 #undef FIND_FUNC
 
 #define FIND_FUNC tree_find_last
+#define FIND_CELL_FUNC tree_find_last_cell
 #define FIND_CMP_OP <=
 #define FIND_GOOD_DIR right
 #define FIND_BAD_DIR left
@@ -391,10 +1472,27 @@ static inline void KV(init_tree_cntr)(KV(tree_cntr_t) * cntr, SV * cmp){
 #undef FIND_BAD_DIR
 #undef FIND_GOOD_DIR
 #undef FIND_CMP_OP
+#undef FIND_CELL_FUNC
 #undef FIND_FUNC
 
+typedef struct KV(tree_finger_t) {
+    KV(tree_t) * tree;
+    UV count; // 走到 tree 之前數到的數量
+    bool good; // 從 tree 往 GOOD_DIR 走
+} KV(tree_finger_t);
+
+// finger 路徑上最後一個往 GOOD_DIR 走的節點, 就是 find_xx 找到的第一個 entry
+// 沒有的話 return NULL
+static inline KV(tree_t) * KV(tree_finger_found)(KV(tree_finger_t) * finger, int depth){
+    for(int i=depth-1; i>=0; --i)
+        if( finger[i].good )
+            return finger[i].tree;
+    return NULL;
+}
+
 #define FUZZY_FIND_FUNC tree_find_lt
 #define FUZZY_COUNT_FUNC tree_count_lt
+#define FUZZY_FINGER_FUNC tree_finger_lt
 #define FUZZY_FIND_CMP_OP <
 #define FUZZY_FIND_GOOD_DIR right
 #define FUZZY_FIND_BAD_DIR left
@@ -402,11 +1500,13 @@ static inline void KV(init_tree_cntr)(KV(tree_cntr_t) * cntr, SV * cmp){
 #undef FUZZY_FIND_BAD_DIR
 #undef FUZZY_FIND_GOOD_DIR
 #undef FUZZY_FIND_CMP_OP
+#undef FUZZY_FINGER_FUNC
 #undef FUZZY_COUNT_FUNC
 #undef FUZZY_FIND_FUNC
 
 #define FUZZY_FIND_FUNC tree_find_le
 #define FUZZY_COUNT_FUNC tree_count_le
+#define FUZZY_FINGER_FUNC tree_finger_le
 #define FUZZY_FIND_CMP_OP <=
 #define FUZZY_FIND_GOOD_DIR right
 #define FUZZY_FIND_BAD_DIR left
@@ -414,11 +1514,13 @@ static inline void KV(init_tree_cntr)(KV(tree_cntr_t) * cntr, SV * cmp){
 #undef FUZZY_FIND_BAD_DIR
 #undef FUZZY_FIND_GOOD_DIR
 #undef FUZZY_FIND_CMP_OP
+#undef FUZZY_FINGER_FUNC
 #undef FUZZY_COUNT_FUNC
 #undef FUZZY_FIND_FUNC
 
 #define FUZZY_FIND_FUNC tree_find_gt
 #define FUZZY_COUNT_FUNC tree_count_gt
+#define FUZZY_FINGER_FUNC tree_finger_gt
 #define FUZZY_FIND_CMP_OP >
 #define FUZZY_FIND_GOOD_DIR left
 #define FUZZY_FIND_BAD_DIR right
@@ -426,11 +1528,13 @@ static inline void KV(init_tree_cntr)(KV(tree_cntr_t) * cntr, SV * cmp){
 #undef FUZZY_FIND_BAD_DIR
 #undef FUZZY_FIND_GOOD_DIR
 #undef FUZZY_FIND_CMP_OP
+#undef FUZZY_FINGER_FUNC
 #undef FUZZY_COUNT_FUNC
 #undef FUZZY_FIND_FUNC
 
 #define FUZZY_FIND_FUNC tree_find_ge
 #define FUZZY_COUNT_FUNC tree_count_ge
+#define FUZZY_FINGER_FUNC tree_finger_ge
 #define FUZZY_FIND_CMP_OP >=
 #define FUZZY_FIND_GOOD_DIR left
 #define FUZZY_FIND_BAD_DIR right
@@ -438,9 +1542,65 @@ static inline void KV(init_tree_cntr)(KV(tree_cntr_t) * cntr, SV * cmp){
 #undef FUZZY_FIND_BAD_DIR
 #undef FUZZY_FIND_GOOD_DIR
 #undef FUZZY_FIND_CMP_OP
+#undef FUZZY_FINGER_FUNC
 #undef FUZZY_COUNT_FUNC
 #undef FUZZY_FIND_FUNC
 
+// 有沒有 key 相等的 entry, 找到第一個就停
+static inline bool KV(tree_exists)(pTHX_ SV**SP, KV(tree_cntr_t) * cntr, T(KEY) key){
+    KV(tree_t) * t = cntr->root;
+    while( t != (KV(tree_t)*) &nil ){
+        IV c = KV(tree_cmp)(aTHX_ SP, cntr, t->key, key);
+        if( c == 0 )
+            return TRUE;
+        t = c < 0 ? t->right : t->left;
+    }
+    return FALSE;
+}
+
+// 算出 key 相等的 entry 的位置範圍 [*lower, *upper), 也就是 count_lt 和 count_le
+// 兩個邊界共用同一條路徑, 直到遇到第一個 key 相等的節點才分開, 每個節點只比較一次
+static inline void KV(tree_equal_range)(pTHX_ SV**SP, KV(tree_cntr_t) * cntr, T(KEY) key, UV * lower, UV * upper){
+    KV(tree_t) * t = cntr->root;
+    UV count = 0;
+    while( t != (KV(tree_t)*) &nil ){
+        IV c = KV(tree_cmp)(aTHX_ SP, cntr, t->key, key);
+        if( c == 0 )
+            break;
+        if( c < 0 ){
+            count += t->left->size + 1;
+            t = t->right;
+        }
+        else
+            t = t->left;
+    }
+
+    if( t == (KV(tree_t)*) &nil ){
+        *lower = *upper = count;
+        return;
+    }
+
+    // 左子樹的 key 都不大於 key, 只要找 lower
+    *lower = count;
+    for(KV(tree_t) * p = t->left; p != (KV(tree_t)*) &nil; )
+        if( KV(tree_cmp)(aTHX_ SP, cntr, p->key, key) < 0 ){
+            *lower += p->left->size + 1;
+            p = p->right;
+        }
+        else
+            p = p->left;
+
+    // 右子樹的 key 都不小於 key, 只要找 upper
+    *upper = count + t->left->size + 1;
+    for(KV(tree_t) * p = t->right; p != (KV(tree_t)*) &nil; )
+        if( KV(tree_cmp)(aTHX_ SP, cntr, p->key, key) <= 0 ){
+            *upper += p->left->size + 1;
+            p = p->right;
+        }
+        else
+            p = p->left;
+}
+
 #define RANGE_FIND_FUNC tree_find_gt_lt
 #define RANGE_FIND_FALLBACK_FUNC tree_find_gt
 #define RANGE_FIND_CMP_L_OP >
@@ -518,9 +1678,9 @@ static inline SV* KV(tree_dump)(pTHX_ KV(tree_cntr_t) * cntr){
 
 // 假設 tree 不是空的
 bool KV(tree_check_subtree_order)(pTHX_ SV**SP, KV(tree_cntr_t) * cntr, KV(tree_t) * tree){
-    if( tree->left != (KV(tree_t)*) &nil && (K(cmp)(aTHX_ SP, tree->left->key, tree->key, cntr->cmp) > 0 || !KV(tree_check_subtree_order)(aTHX_ SP, cntr, tree->left)) )
+    if( tree->left != (KV(tree_t)*) &nil && (KV(tree_cmp)(aTHX_ SP, cntr, tree->left->key, tree->key) > 0 || !KV(tree_check_subtree_order)(aTHX_ SP, cntr, tree->left)) )
         return FALSE;
-    if( tree->right != (KV(tree_t)*) &nil && (K(cmp)(aTHX_ SP, tree->key, tree->right->key, cntr->cmp) > 0 || !KV(tree_check_subtree_order)(aTHX_ SP, cntr, tree->right)) )
+    if( tree->right != (KV(tree_t)*) &nil && (KV(tree_cmp)(aTHX_ SP, cntr, tree->key, tree->right->key) > 0 || !KV(tree_check_subtree_order)(aTHX_ SP, cntr, tree->right)) )
         return FALSE;
     return TRUE;
 }
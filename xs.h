@@ -1,6 +1,7 @@
 // vim: filetype=xs
 
-inline static SV ** KV(new)(pTHX_ SV ** SP, SV * class, SV * cmp){
+// 建立一個空的 tree 物件, return mortal 的 obj
+static inline SV * KV(new_tree_obj)(pTHX_ HV * stash, SV * cmp){
     KV(tree_cntr_t) * cntr;
     Newx(cntr, 1, KV(tree_cntr_t));
     cntr->sv_refcnt = KV(secret);
@@ -13,11 +14,43 @@ inline static SV ** KV(new)(pTHX_ SV ** SP, SV * class, SV * cmp){
     SvRV(ret) = (SV*) cntr;
 
     SV * obj = newRV_noinc(ret);
+    sv_bless(obj, stash);
+    return sv_2mortal(obj);
+}
+
+static inline HV * KV(class_stash)(pTHX_ SV * class){
     STRLEN classname_len;
     char * classname = SvPVbyte(class, classname_len);
-    HV * stash = gv_stashpvn(classname, classname_len, 0);
-    sv_bless(obj, stash);
-    PUSHs(sv_2mortal(obj));
+    return gv_stashpvn(classname, classname_len, 0);
+}
+
+inline static SV ** KV(new)(pTHX_ SV ** SP, SV * class, SV * cmp){
+    PUSHs(KV(new_tree_obj)(aTHX_ KV(class_stash)(aTHX_ class), cmp));
+    return SP;
+}
+
+inline static SV ** KV(new_from_sorted)(pTHX_ SV ** SP, SV * class, SV * keys, SV * values, SV * cmp){
+    AV * keys_av = assure_av(aTHX_ keys, "new_from_sorted");
+    AV * values_av = SvOK(values) ? assure_av(aTHX_ values, "new_from_sorted") : NULL;
+
+    SV * obj = KV(new_tree_obj)(aTHX_ KV(class_stash)(aTHX_ class), cmp);
+    KV(tree_cntr_t) * cntr = KV(assure_tree_cntr)(obj);
+
+    SSize_t n = av_len(keys_av) + 1;
+    KV(tree_reserve)(cntr, n);
+    KV(tree_t) * head = (KV(tree_t)*) &nil;
+    KV(tree_t) ** tail = &head;
+    for(SSize_t i=0; i<n; ++i){
+        KV(tree_t) * cell = KV(allocate_cell)(cntr,
+            K(copy_sv)(aTHX_ av_fetch_sv(aTHX_ keys_av, i)),
+            V(copy_sv)(aTHX_ values_av ? av_fetch_sv(aTHX_ values_av, i) : &PL_sv_undef)
+        );
+        *tail = cell;
+        tail = &cell->right;
+    }
+    KV(tree_assign_list)(cntr, head, n);
+
+    PUSHs(obj);
     return SP;
 }
 
@@ -43,6 +76,37 @@ inline static SV ** KV(ever_height)(pTHX_ SV** SP, SV *obj){
     return SP;
 }
 
+inline static SV ** KV(cmp_count)(pTHX_ SV** SP, SV *obj){
+    dXSTARG;
+    KV(tree_cntr_t) * cntr = KV(assure_tree_cntr)(obj);
+    PUSHu(cntr->cmp_count);
+    return SP;
+}
+
+inline static SV ** KV(clear)(pTHX_ SV** SP, SV *obj){
+    KV(tree_cntr_t) * cntr = KV(assure_tree_cntr)(obj);
+    KV(tree_clear)(aTHX_ cntr);
+    return SP;
+}
+
+inline static SV ** KV(reserve)(pTHX_ SV** SP, SV *obj, IV n){
+    KV(tree_cntr_t) * cntr = KV(assure_tree_cntr)(obj);
+    if( n < 0 )
+        croak("reserve: negative number of entries (%"IVdf")", n);
+    if( (UV) n > KV(tree_max_seg_cells)() )
+        croak("reserve: too many entries (%"IVdf")", n);
+    if( !KV(tree_try_reserve)(aTHX_ cntr, n) )
+        croak("reserve: out of memory for %"IVdf" entries", n);
+    return SP;
+}
+
+inline static SV ** KV(compact)(pTHX_ SV** SP, SV *obj){
+    dXSTARG;
+    KV(tree_cntr_t) * cntr = KV(assure_tree_cntr)(obj);
+    PUSHi(KV(tree_compact)(cntr));
+    return SP;
+}
+
 inline static SV ** KV(insert_before)(pTHX_ SV** SP, SV * obj, SV * key, SV * value){
     KV(tree_cntr_t) * cntr = KV(assure_tree_cntr)(obj);
 
@@ -67,6 +131,134 @@ inline static SV ** KV(insert)(pTHX_ SV** SP, SV * obj, SV * key, SV * value){
     return KV(insert_after)(aTHX_ SP, obj, key, value);
 }
 
+inline static SV ** KV(set)(pTHX_ SV** SP, SV * obj, SV * key, SV * value){
+    KV(tree_cntr_t) * cntr = KV(assure_tree_cntr)(obj);
+
+    save_scalar(a_GV);
+    save_scalar(b_GV);
+#if I(KEY) == I(any)
+    SvREFCNT_inc_simple_void_NN(key);
+#endif
+
+    KV(tree_t) * path[cntr->ever_height+1];
+    bool went_right[cntr->ever_height+1];
+    KV(tree_t) * found;
+    int depth = KV(tree_locate_after)(aTHX_ SP, cntr, K(from_sv)(aTHX_ key), path, went_right, &found);
+    if( found ){
+#if I(VALUE) != I(void)
+        V(assign)(aTHX_ &found->value, value);
+#endif
+    }
+    else
+        KV(tree_commit_insert)(cntr, path, went_right, depth, KV(allocate_cell)(cntr, K(copy_sv)(aTHX_ key), V(copy_sv)(aTHX_ value)));
+
+#if I(KEY) == I(any)
+#   ifdef SvREFCNT_dec_NN
+    SvREFCNT_dec_NN(key);
+#   else
+    SvREFCNT_dec(key);
+#   endif
+#endif
+    return SP;
+}
+
+inline static SV ** KV(insert_unique)(pTHX_ SV** SP, SV * obj, SV * key, SV * value){
+    KV(tree_cntr_t) * cntr = KV(assure_tree_cntr)(obj);
+
+    save_scalar(a_GV);
+    save_scalar(b_GV);
+#if I(KEY) == I(any)
+    SvREFCNT_inc_simple_void_NN(key);
+#endif
+
+    KV(tree_t) * path[cntr->ever_height+1];
+    bool went_right[cntr->ever_height+1];
+    KV(tree_t) * found;
+    int depth = KV(tree_locate_after)(aTHX_ SP, cntr, K(from_sv)(aTHX_ key), path, went_right, &found);
+    if( !found )
+        KV(tree_commit_insert)(cntr, path, went_right, depth, KV(allocate_cell)(cntr, K(copy_sv)(aTHX_ key), V(copy_sv)(aTHX_ value)));
+
+#if I(KEY) == I(any)
+#   ifdef SvREFCNT_dec_NN
+    SvREFCNT_dec_NN(key);
+#   else
+    SvREFCNT_dec(key);
+#   endif
+#endif
+
+    PUSHs(found ? &PL_sv_no : &PL_sv_yes);
+    return SP;
+}
+
+#if I(VALUE) == I(int) || I(VALUE) == I(num)
+static inline SV ** KV(add_value_by)(pTHX_ SV** SP, SV * obj, SV * key, T(VALUE) delta, int insert){
+    KV(tree_cntr_t) * cntr = KV(assure_tree_cntr)(obj);
+
+    save_scalar(a_GV);
+    save_scalar(b_GV);
+#   if I(KEY) == I(any)
+    SvREFCNT_inc_simple_void_NN(key);
+#   endif
+
+    KV(tree_t) * path[cntr->ever_height+1];
+    bool went_right[cntr->ever_height+1];
+    KV(tree_t) * found;
+    int depth = KV(tree_locate_after)(aTHX_ SP, cntr, K(from_sv)(aTHX_ key), path, went_right, &found);
+    if( found ){
+        found->value += delta;
+        SP = V(ret)(aTHX_ SP, found->value);
+    }
+    else if( insert ){
+        KV(tree_t) * new_cell = KV(allocate_cell)(cntr, K(copy_sv)(aTHX_ key), delta);
+        KV(tree_commit_insert)(cntr, path, went_right, depth, new_cell);
+        SP = V(ret)(aTHX_ SP, delta);
+    }
+    else
+        PUSHs(&PL_sv_undef);
+
+#   if I(KEY) == I(any)
+#       ifdef SvREFCNT_dec_NN
+    SvREFCNT_dec_NN(key);
+#       else
+    SvREFCNT_dec(key);
+#       endif
+#   endif
+    return SP;
+}
+#endif
+
+inline static SV ** KV(add_value)(pTHX_ SV** SP, SV * obj, SV * key, SV * delta, int insert){
+#if I(VALUE) == I(int) || I(VALUE) == I(num)
+    return KV(add_value_by)(aTHX_ SP, obj, key, V(from_sv)(aTHX_ delta), insert);
+#else
+    croak("add_value: the values of this tree are not numbers");
+#endif
+}
+
+inline static SV ** KV(incr)(pTHX_ SV** SP, SV * obj, SV * key){
+#if I(VALUE) == I(int) || I(VALUE) == I(num)
+    return KV(add_value_by)(aTHX_ SP, obj, key, 1, 1);
+#else
+    croak("incr: the values of this tree are not numbers");
+#endif
+}
+
+inline static SV ** KV(insert_many)(pTHX_ SV** SP, SV * obj, SV * keys, SV * values){
+    KV(tree_cntr_t) * cntr = KV(assure_tree_cntr)(obj);
+    AV * keys_av = assure_av(aTHX_ keys, "insert_many");
+    AV * values_av = SvOK(values) ? assure_av(aTHX_ values, "insert_many") : NULL;
+
+    save_scalar(a_GV);
+    save_scalar(b_GV);
+
+    ENTER;
+    SSize_t m = av_len(keys_av) + 1;
+    KV(tree_batch_t) * batch = KV(tree_load_batch)(aTHX_ SP, cntr, keys_av, m);
+    KV(tree_insert_batch)(aTHX_ SP, cntr, batch, m, values_av);
+    LEAVE;
+    return SP;
+}
+
 inline static SV ** KV(delete_first)(pTHX_ SV** SP, SV * obj, SV * key){
     KV(tree_cntr_t) * cntr = KV(assure_tree_cntr)(obj);
 
@@ -119,6 +311,219 @@ inline static SV ** KV(delete)(pTHX_ SV** SP, SV * obj, SV * key){
     return KV(delete_last)(aTHX_ SP, obj, key);
 }
 
+// 把已經移出樹外的 cell 裡的 entry 交給 perl stack, 再把 cell 放回 free_slot
+// list context 給 key (和 value), 否則給 value (set 的話給 key)
+static inline SV ** KV(take_cell)(pTHX_ SV** SP, KV(tree_cntr_t) * cntr, KV(tree_t) * cell){
+    if( !cell ){
+        if( GIMME_V != G_ARRAY )
+            PUSHs(&PL_sv_undef);
+        return SP;
+    }
+
+#if I(VALUE) != I(void)
+    if( GIMME_V == G_ARRAY ){
+        EXTEND(SP, 2);
+        SP = K(mtake)(aTHX_ SP, cell->key);
+    }
+#   if I(KEY) == I(str) || I(KEY) == I(any)
+    else
+        SvREFCNT_dec(cell->key);
+#   endif
+    SP = V(mtake)(aTHX_ SP, cell->value);
+#else
+    SP = K(mtake)(aTHX_ SP, cell->key);
+#endif
+    KV(free_cell)(cntr, cell);
+    return SP;
+}
+
+inline static SV ** KV(take_first)(pTHX_ SV** SP, SV * obj, SV * key){
+    KV(tree_cntr_t) * cntr = KV(assure_tree_cntr)(obj);
+
+    save_scalar(a_GV);
+    save_scalar(b_GV);
+#if I(KEY) == I(any)
+    SvREFCNT_inc_simple_void_NN(key);
+#endif
+
+    KV(tree_t) * cell = KV(tree_take_first)(aTHX_ SP, cntr, K(from_sv)(aTHX_ key));
+
+#if I(KEY) == I(any)
+#   ifdef SvREFCNT_dec_NN
+    SvREFCNT_dec_NN(key);
+#   else
+    SvREFCNT_dec(key);
+#   endif
+#endif
+    return KV(take_cell)(aTHX_ SP, cntr, cell);
+}
+
+inline static SV ** KV(take_last)(pTHX_ SV** SP, SV * obj, SV * key){
+    KV(tree_cntr_t) * cntr = KV(assure_tree_cntr)(obj);
+
+    save_scalar(a_GV);
+    save_scalar(b_GV);
+#if I(KEY) == I(any)
+    SvREFCNT_inc_simple_void_NN(key);
+#endif
+
+    KV(tree_t) * cell = KV(tree_take_last)(aTHX_ SP, cntr, K(from_sv)(aTHX_ key));
+
+#if I(KEY) == I(any)
+#   ifdef SvREFCNT_dec_NN
+    SvREFCNT_dec_NN(key);
+#   else
+    SvREFCNT_dec(key);
+#   endif
+#endif
+    return KV(take_cell)(aTHX_ SP, cntr, cell);
+}
+
+inline static SV ** KV(delete_many_first)(pTHX_ SV** SP, SV * obj, SV * keys){
+    dXSTARG;
+    KV(tree_cntr_t) * cntr = KV(assure_tree_cntr)(obj);
+    AV * keys_av = assure_av(aTHX_ keys, "delete_many_first");
+
+    save_scalar(a_GV);
+    save_scalar(b_GV);
+
+    ENTER;
+    SSize_t m = av_len(keys_av) + 1;
+    KV(tree_batch_t) * batch = KV(tree_load_batch)(aTHX_ SP, cntr, keys_av, m);
+    IV removed = KV(tree_delete_batch_first)(aTHX_ SP, cntr, batch, m);
+    LEAVE;
+
+    PUSHi(removed);
+    return SP;
+}
+
+inline static SV ** KV(delete_many_last)(pTHX_ SV** SP, SV * obj, SV * keys){
+    dXSTARG;
+    KV(tree_cntr_t) * cntr = KV(assure_tree_cntr)(obj);
+    AV * keys_av = assure_av(aTHX_ keys, "delete_many_last");
+
+    save_scalar(a_GV);
+    save_scalar(b_GV);
+
+    ENTER;
+    SSize_t m = av_len(keys_av) + 1;
+    KV(tree_batch_t) * batch = KV(tree_load_batch)(aTHX_ SP, cntr, keys_av, m);
+    IV removed = KV(tree_delete_batch_last)(aTHX_ SP, cntr, batch, m);
+    LEAVE;
+
+    PUSHi(removed);
+    return SP;
+}
+
+inline static SV ** KV(delete_many)(pTHX_ SV** SP, SV * obj, SV * keys){
+    return KV(delete_many_last)(aTHX_ SP, obj, keys);
+}
+
+#define XS_SPLIT_FUNC split_lt
+#define SPLIT_FUNC tree_split_lt
+#include "xs_split_gen.h"
+#undef SPLIT_FUNC
+#undef XS_SPLIT_FUNC
+
+#define XS_SPLIT_FUNC split_le
+#define SPLIT_FUNC tree_split_le
+#include "xs_split_gen.h"
+#undef SPLIT_FUNC
+#undef XS_SPLIT_FUNC
+
+inline static SV ** KV(join)(pTHX_ SV** SP, SV * obj, SV * other){
+    KV(tree_cntr_t) * cntr = KV(assure_tree_cntr)(obj);
+    KV(tree_cntr_t) * other_cntr = KV(assure_tree_cntr)(other);
+    if( cntr == other_cntr )
+        croak("join: can't join a tree with itself");
+
+    save_scalar(a_GV);
+    save_scalar(b_GV);
+
+    if( !KV(tree_join)(aTHX_ SP, cntr, other_cntr) )
+        croak("join: the key ranges of the two trees overlap");
+    return SP;
+}
+
+inline static SV ** KV(union)(pTHX_ SV** SP, SV * obj, SV * other){
+    KV(tree_cntr_t) * cntr = KV(assure_tree_cntr)(obj);
+    KV(tree_cntr_t) * other_cntr = KV(assure_tree_cntr)(other);
+
+    save_scalar(a_GV);
+    save_scalar(b_GV);
+
+    ENTER;
+    KV(tree_union)(aTHX_ SP, cntr, other_cntr);
+    LEAVE;
+    return SP;
+}
+
+inline static SV ** KV(intersection)(pTHX_ SV** SP, SV * obj, SV * other){
+    KV(tree_cntr_t) * cntr = KV(assure_tree_cntr)(obj);
+    KV(tree_cntr_t) * other_cntr = KV(assure_tree_cntr)(other);
+
+    save_scalar(a_GV);
+    save_scalar(b_GV);
+
+    ENTER;
+    KV(tree_intersection)(aTHX_ SP, cntr, other_cntr);
+    LEAVE;
+    return SP;
+}
+
+inline static SV ** KV(difference)(pTHX_ SV** SP, SV * obj, SV * other){
+    KV(tree_cntr_t) * cntr = KV(assure_tree_cntr)(obj);
+    KV(tree_cntr_t) * other_cntr = KV(assure_tree_cntr)(other);
+
+    save_scalar(a_GV);
+    save_scalar(b_GV);
+
+    ENTER;
+    KV(tree_difference)(aTHX_ SP, cntr, other_cntr);
+    LEAVE;
+    return SP;
+}
+
+#define XS_RANGE_DELETE_FUNC delete_gt_lt
+#define RANGE_DELETE_FUNC tree_delete_gt_lt
+#include "xs_range_delete_gen.h"
+#undef RANGE_DELETE_FUNC
+#undef XS_RANGE_DELETE_FUNC
+
+#define XS_RANGE_DELETE_FUNC delete_ge_lt
+#define RANGE_DELETE_FUNC tree_delete_ge_lt
+#include "xs_range_delete_gen.h"
+#undef RANGE_DELETE_FUNC
+#undef XS_RANGE_DELETE_FUNC
+
+#define XS_RANGE_DELETE_FUNC delete_gt_le
+#define RANGE_DELETE_FUNC tree_delete_gt_le
+#include "xs_range_delete_gen.h"
+#undef RANGE_DELETE_FUNC
+#undef XS_RANGE_DELETE_FUNC
+
+#define XS_RANGE_DELETE_FUNC delete_ge_le
+#define RANGE_DELETE_FUNC tree_delete_ge_le
+#include "xs_range_delete_gen.h"
+#undef RANGE_DELETE_FUNC
+#undef XS_RANGE_DELETE_FUNC
+
+#define XS_DRAIN_FUNC drain_le
+#define DRAIN_FUNC tree_drain_le
+#define DRAIN_BACKWARD FALSE
+#include "xs_drain_gen.h"
+#undef DRAIN_BACKWARD
+#undef DRAIN_FUNC
+#undef XS_DRAIN_FUNC
+
+#define XS_DRAIN_FUNC drain_ge
+#define DRAIN_FUNC tree_drain_ge
+#define DRAIN_BACKWARD TRUE
+#include "xs_drain_gen.h"
+#undef DRAIN_BACKWARD
+#undef DRAIN_FUNC
+#undef XS_DRAIN_FUNC
+
 inline static SV ** KV(find_first)(pTHX_ SV** SP, SV * obj, SV * key, int limit){
     KV(tree_cntr_t) * cntr = KV(assure_tree_cntr)(obj);
 
@@ -165,54 +570,324 @@ inline static SV ** KV(find)(pTHX_ SV** SP, SV * obj, SV * key, int limit){
     return KV(find_first)(aTHX_ SP, obj, key, limit);
 }
 
+inline static SV ** KV(get_many)(pTHX_ SV** SP, SV * obj, SV * keys){
+    KV(tree_cntr_t) * cntr = KV(assure_tree_cntr)(obj);
+    AV * keys_av = assure_av(aTHX_ keys, "get_many");
+
+    save_scalar(a_GV);
+    save_scalar(b_GV);
+
+    SSize_t n = av_len(keys_av) + 1;
+    EXTEND(SP, n);
+    for(SSize_t i=0; i<n; ++i){
+        SV * key = av_fetch_sv(aTHX_ keys_av, i);
+#if I(KEY) == I(any)
+        SvREFCNT_inc_simple_void_NN(key);
+#endif
+
+        KV(tree_t) * found = KV(tree_find_first_cell)(aTHX_ SP, cntr, K(from_sv)(aTHX_ key));
+        if( found )
+#if I(VALUE) != I(void)
+            SP = V(mret)(aTHX_ SP, found->value);
+#else
+            SP = K(mret)(aTHX_ SP, found->key);
+#endif
+        else
+            PUSHs(&PL_sv_undef);
+
+#if I(KEY) == I(any)
+#   ifdef SvREFCNT_dec_NN
+        SvREFCNT_dec_NN(key);
+#   else
+        SvREFCNT_dec(key);
+#   endif
+#endif
+    }
+    return SP;
+}
+
 #define XS_FUZZY_FIND_FUNC find_lt
+#define XS_FUZZY_FIND_MANY_FUNC find_lt_many
 #define FUZZY_FIND_FUNC tree_find_lt
+#define FUZZY_FINGER_FUNC tree_finger_lt
 #include "xs_fuzzy_find_gen.h"
+#undef FUZZY_FINGER_FUNC
 #undef FUZZY_FIND_FUNC
+#undef XS_FUZZY_FIND_MANY_FUNC
 #undef XS_FUZZY_FIND_FUNC
 
 #define XS_FUZZY_FIND_FUNC find_le
+#define XS_FUZZY_FIND_MANY_FUNC find_le_many
 #define FUZZY_FIND_FUNC tree_find_le
+#define FUZZY_FINGER_FUNC tree_finger_le
 #include "xs_fuzzy_find_gen.h"
+#undef FUZZY_FINGER_FUNC
 #undef FUZZY_FIND_FUNC
+#undef XS_FUZZY_FIND_MANY_FUNC
 #undef XS_FUZZY_FIND_FUNC
 
 #define XS_FUZZY_FIND_FUNC find_gt
+#define XS_FUZZY_FIND_MANY_FUNC find_gt_many
 #define FUZZY_FIND_FUNC tree_find_gt
+#define FUZZY_FINGER_FUNC tree_finger_gt
 #include "xs_fuzzy_find_gen.h"
+#undef FUZZY_FINGER_FUNC
 #undef FUZZY_FIND_FUNC
+#undef XS_FUZZY_FIND_MANY_FUNC
 #undef XS_FUZZY_FIND_FUNC
 
 #define XS_FUZZY_FIND_FUNC find_ge
+#define XS_FUZZY_FIND_MANY_FUNC find_ge_many
 #define FUZZY_FIND_FUNC tree_find_ge
+#define FUZZY_FINGER_FUNC tree_finger_ge
 #include "xs_fuzzy_find_gen.h"
+#undef FUZZY_FINGER_FUNC
 #undef FUZZY_FIND_FUNC
+#undef XS_FUZZY_FIND_MANY_FUNC
 #undef XS_FUZZY_FIND_FUNC
 
 #define XS_FUZZY_COUNT_FUNC count_lt
+#define XS_FUZZY_COUNT_MANY_FUNC count_lt_many
 #define FUZZY_COUNT_FUNC tree_count_lt
+#define FUZZY_FINGER_FUNC tree_finger_lt
 #include "xs_fuzzy_count_gen.h"
+#undef FUZZY_FINGER_FUNC
 #undef FUZZY_COUNT_FUNC
+#undef XS_FUZZY_COUNT_MANY_FUNC
 #undef XS_FUZZY_COUNT_FUNC
 
 #define XS_FUZZY_COUNT_FUNC count_le
+#define XS_FUZZY_COUNT_MANY_FUNC count_le_many
 #define FUZZY_COUNT_FUNC tree_count_le
+#define FUZZY_FINGER_FUNC tree_finger_le
 #include "xs_fuzzy_count_gen.h"
+#undef FUZZY_FINGER_FUNC
 #undef FUZZY_COUNT_FUNC
+#undef XS_FUZZY_COUNT_MANY_FUNC
 #undef XS_FUZZY_COUNT_FUNC
 
 #define XS_FUZZY_COUNT_FUNC count_gt
+#define XS_FUZZY_COUNT_MANY_FUNC count_gt_many
 #define FUZZY_COUNT_FUNC tree_count_gt
+#define FUZZY_FINGER_FUNC tree_finger_gt
 #include "xs_fuzzy_count_gen.h"
+#undef FUZZY_FINGER_FUNC
 #undef FUZZY_COUNT_FUNC
+#undef XS_FUZZY_COUNT_MANY_FUNC
 #undef XS_FUZZY_COUNT_FUNC
 
 #define XS_FUZZY_COUNT_FUNC count_ge
+#define XS_FUZZY_COUNT_MANY_FUNC count_ge_many
 #define FUZZY_COUNT_FUNC tree_count_ge
+#define FUZZY_FINGER_FUNC tree_finger_ge
 #include "xs_fuzzy_count_gen.h"
+#undef FUZZY_FINGER_FUNC
 #undef FUZZY_COUNT_FUNC
+#undef XS_FUZZY_COUNT_MANY_FUNC
 #undef XS_FUZZY_COUNT_FUNC
 
+// 同一批後面的操作可能刪掉 found, 所以推複本
+static inline SV ** KV(apply_push_found)(pTHX_ SV** SP, KV(tree_t) * found){
+    if( found ){
+        SP = K(mxcopy)(aTHX_ SP, found->key);
+#if I(VALUE) != I(void)
+        SP = V(mxcopy)(aTHX_ SP, found->value);
+#endif
+    }
+    else{
+        XPUSHs(&PL_sv_undef);
+#if I(VALUE) != I(void)
+        XPUSHs(&PL_sv_undef);
+#endif
+    }
+    return SP;
+}
+
+inline static SV ** KV(apply)(pTHX_ SV** SP, SV * obj, SV * ops){
+    KV(tree_cntr_t) * cntr = KV(assure_tree_cntr)(obj);
+    AV * ops_av = assure_av(aTHX_ ops, "apply");
+
+    save_scalar(a_GV);
+    save_scalar(b_GV);
+
+    SSize_t n = av_len(ops_av) + 1;
+    SSize_t i = 0;
+    while( i < n ){
+        int op = apply_op(aTHX_ av_fetch_sv(aTHX_ ops_av, i++));
+        if( op == APPLY_SIZE ){
+            IV size = KV(tree_size)(cntr);
+            mXPUSHi(size);
+            continue;
+        }
+
+        if( i >= n )
+            croak("apply: missing key for the last operation");
+        SV * key = av_fetch_sv(aTHX_ ops_av, i++);
+        SV * value = &PL_sv_undef;
+#if I(VALUE) != I(void)
+        if( op == APPLY_INSERT_AFTER || op == APPLY_INSERT_BEFORE ){
+            if( i >= n )
+                croak("apply: missing value for the last operation");
+            value = av_fetch_sv(aTHX_ ops_av, i++);
+        }
+#endif
+        // 參數都拿齊了才持有 key, 免得 croak 時漏掉
+#if I(KEY) == I(any)
+        SvREFCNT_inc_simple_void_NN(key);
+#endif
+
+        switch( op ){
+            case APPLY_INSERT_AFTER:
+            case APPLY_INSERT_BEFORE: {
+                if( op == APPLY_INSERT_AFTER )
+                    KV(tree_insert_after)(aTHX_ SP, cntr, K(copy_sv)(aTHX_ key), V(copy_sv)(aTHX_ value));
+                else
+                    KV(tree_insert_before)(aTHX_ SP, cntr, K(copy_sv)(aTHX_ key), V(copy_sv)(aTHX_ value));
+                break;
+            }
+            case APPLY_DELETE_LAST:
+            case APPLY_DELETE_FIRST: {
+                bool deleted = op == APPLY_DELETE_LAST
+                    ? KV(tree_delete_last)(aTHX_ SP, cntr, K(from_sv)(aTHX_ key))
+                    : KV(tree_delete_first)(aTHX_ SP, cntr, K(from_sv)(aTHX_ key));
+                XPUSHs(deleted ? &PL_sv_yes : &PL_sv_no);
+                break;
+            }
+            case APPLY_FIND_FIRST:
+            case APPLY_FIND_LAST: {
+                KV(tree_t) * found = op == APPLY_FIND_FIRST
+                    ? KV(tree_find_first_cell)(aTHX_ SP, cntr, K(from_sv)(aTHX_ key))
+                    : KV(tree_find_last_cell)(aTHX_ SP, cntr, K(from_sv)(aTHX_ key));
+                SP = KV(apply_push_found)(aTHX_ SP, found);
+                break;
+            }
+            case APPLY_FIND_LT:
+            case APPLY_FIND_LE:
+            case APPLY_FIND_GT:
+            case APPLY_FIND_GE: {
+                // insert 可能讓 ever_height 變大, 所以每次重新配置 finger
+                KV(tree_finger_t) finger[cntr->ever_height+1];
+                int depth = -1;
+                switch( op ){
+                    case APPLY_FIND_LT:
+                        KV(tree_finger_lt)(aTHX_ SP, cntr, finger, &depth, NULL, K(from_sv)(aTHX_ key));
+                        break;
+                    case APPLY_FIND_LE:
+                        KV(tree_finger_le)(aTHX_ SP, cntr, finger, &depth, NULL, K(from_sv)(aTHX_ key));
+                        break;
+                    case APPLY_FIND_GT:
+                        KV(tree_finger_gt)(aTHX_ SP, cntr, finger, &depth, NULL, K(from_sv)(aTHX_ key));
+                        break;
+                    default:
+                        KV(tree_finger_ge)(aTHX_ SP, cntr, finger, &depth, NULL, K(from_sv)(aTHX_ key));
+                }
+                SP = KV(apply_push_found)(aTHX_ SP, KV(tree_finger_found)(finger, depth));
+                break;
+            }
+            default: {
+                UV count;
+                switch( op ){
+                    case APPLY_COUNT_LT:
+                        count = KV(tree_count_lt)(aTHX_ SP, cntr, K(from_sv)(aTHX_ key));
+                        break;
+                    case APPLY_COUNT_LE:
+                        count = KV(tree_count_le)(aTHX_ SP, cntr, K(from_sv)(aTHX_ key));
+                        break;
+                    case APPLY_COUNT_GT:
+                        count = KV(tree_count_gt)(aTHX_ SP, cntr, K(from_sv)(aTHX_ key));
+                        break;
+                    default:
+                        count = KV(tree_count_ge)(aTHX_ SP, cntr, K(from_sv)(aTHX_ key));
+                }
+                mXPUSHu(count);
+            }
+        }
+
+#if I(KEY) == I(any)
+#   ifdef SvREFCNT_dec_NN
+        SvREFCNT_dec_NN(key);
+#   else
+        SvREFCNT_dec(key);
+#   endif
+#endif
+    }
+    return SP;
+}
+
+inline static SV ** KV(exists)(pTHX_ SV** SP, SV * obj, SV * key){
+    KV(tree_cntr_t) * cntr = KV(assure_tree_cntr)(obj);
+
+    save_scalar(a_GV);
+    save_scalar(b_GV);
+#if I(KEY) == I(any)
+    SvREFCNT_inc_simple_void_NN(key);
+#endif
+
+    bool found = KV(tree_exists)(aTHX_ SP, cntr, K(from_sv)(aTHX_ key));
+
+#if I(KEY) == I(any)
+#   ifdef SvREFCNT_dec_NN
+    SvREFCNT_dec_NN(key);
+#   else
+    SvREFCNT_dec(key);
+#   endif
+#endif
+
+    PUSHs(found ? &PL_sv_yes : &PL_sv_no);
+    return SP;
+}
+
+inline static SV ** KV(count_eq)(pTHX_ SV** SP, SV * obj, SV * key){
+    dXSTARG;
+    KV(tree_cntr_t) * cntr = KV(assure_tree_cntr)(obj);
+
+    save_scalar(a_GV);
+    save_scalar(b_GV);
+#if I(KEY) == I(any)
+    SvREFCNT_inc_simple_void_NN(key);
+#endif
+
+    UV lower, upper;
+    KV(tree_equal_range)(aTHX_ SP, cntr, K(from_sv)(aTHX_ key), &lower, &upper);
+
+#if I(KEY) == I(any)
+#   ifdef SvREFCNT_dec_NN
+    SvREFCNT_dec_NN(key);
+#   else
+    SvREFCNT_dec(key);
+#   endif
+#endif
+
+    PUSHu(upper - lower);
+    return SP;
+}
+
+inline static SV ** KV(equal_range)(pTHX_ SV** SP, SV * obj, SV * key){
+    KV(tree_cntr_t) * cntr = KV(assure_tree_cntr)(obj);
+
+    save_scalar(a_GV);
+    save_scalar(b_GV);
+#if I(KEY) == I(any)
+    SvREFCNT_inc_simple_void_NN(key);
+#endif
+
+    UV lower, upper;
+    KV(tree_equal_range)(aTHX_ SP, cntr, K(from_sv)(aTHX_ key), &lower, &upper);
+
+#if I(KEY) == I(any)
+#   ifdef SvREFCNT_dec_NN
+    SvREFCNT_dec_NN(key);
+#   else
+    SvREFCNT_dec(key);
+#   endif
+#endif
+
+    EXTEND(SP, 2);
+    mPUSHu(lower);
+    mPUSHu(upper);
+    return SP;
+}
+
 #define XS_RANGE_FIND_FUNC find_gt_lt
 #define RANGE_FIND_FUNC tree_find_gt_lt
 #define RANGE_FIND_FALLBACK_FUNC tree_find_gt
@@ -273,6 +948,66 @@ inline static SV ** KV(skip_g)(pTHX_ SV** SP, SV * obj, int offset, int limit){
     return SP;
 }
 
+static inline SV ** KV(pop_extreme)(pTHX_ SV** SP, SV * obj, int limit, bool from_max){
+    KV(tree_cntr_t) * cntr = KV(assure_tree_cntr)(obj);
+    bool list = GIMME_V == G_ARRAY;
+    if( !list )
+        limit = 1;
+
+    KV(tree_t) * popped = KV(tree_pop)(cntr, limit, from_max);
+#if I(VALUE) != I(void)
+    EXTEND(SP, popped->size * 2);
+#else
+    EXTEND(SP, popped->size);
+#endif
+    SP = KV(tree_take_subtree)(aTHX_ SP, cntr, popped, from_max);
+
+#if I(VALUE) != I(void)
+    if( !list && popped != (KV(tree_t)*) &nil )
+        --SP;
+#endif
+    return SP;
+}
+
+inline static SV ** KV(pop_min)(pTHX_ SV** SP, SV * obj, int limit){
+    return KV(pop_extreme)(aTHX_ SP, obj, limit, FALSE);
+}
+
+inline static SV ** KV(pop_max)(pTHX_ SV** SP, SV * obj, int limit){
+    return KV(pop_extreme)(aTHX_ SP, obj, limit, TRUE);
+}
+
+inline static SV ** KV(delete_at)(pTHX_ SV** SP, SV * obj, int offset){
+    KV(tree_cntr_t) * cntr = KV(assure_tree_cntr)(obj);
+    KV(tree_t) * cell = NULL;
+    if( 0 <= offset && offset < KV(tree_size)(cntr) )
+        cntr->root = KV(tree_unlink_rank)(cntr->root, offset, &cell);
+    return KV(take_cell)(aTHX_ SP, cntr, cell);
+}
+
+inline static SV ** KV(delete_ranks)(pTHX_ SV** SP, SV * obj, int from, int count){
+    dXSTARG;
+    KV(tree_cntr_t) * cntr = KV(assure_tree_cntr)(obj);
+    KV(tree_t) * removed = (KV(tree_t)*) &nil;
+    if( 0 <= from && from < KV(tree_size)(cntr) )
+        removed = KV(tree_cut_ranks)(cntr, from, count);
+
+    if( GIMME_V == G_ARRAY ){
+#if I(VALUE) != I(void)
+        EXTEND(SP, removed->size * 2);
+#else
+        EXTEND(SP, removed->size);
+#endif
+        SP = KV(tree_take_subtree)(aTHX_ SP, cntr, removed, FALSE);
+    }
+    else{
+        IV removed_count = removed->size;
+        KV(tree_release_subtree)(aTHX_ cntr, removed);
+        PUSHi(removed_count);
+    }
+    return SP;
+}
+
 inline static SV ** KV(dump)(pTHX_ SV** SP, SV *obj){
     KV(tree_cntr_t) * cntr = KV(assure_tree_cntr)(obj);
     SV * out = KV(tree_dump)(aTHX_ cntr);
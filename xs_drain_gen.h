@@ -0,0 +1,37 @@
+// vim: filetype=xs
+
+SV ** KV(XS_DRAIN_FUNC)(pTHX_ SV** SP, SV * obj, SV * key, int limit){
+    dXSTARG;
+    KV(tree_cntr_t) * cntr = KV(assure_tree_cntr)(obj);
+
+    save_scalar(a_GV);
+    save_scalar(b_GV);
+#if I(KEY) == I(any)
+    SvREFCNT_inc_simple_void_NN(key);
+#endif
+
+    KV(tree_t) * drained = KV(DRAIN_FUNC)(aTHX_ SP, cntr, K(from_sv)(aTHX_ key), limit);
+
+#if I(KEY) == I(any)
+#   ifdef SvREFCNT_dec_NN
+    SvREFCNT_dec_NN(key);
+#   else
+    SvREFCNT_dec(key);
+#   endif
+#endif
+
+    if( GIMME_V == G_ARRAY ){
+#if I(VALUE) != I(void)
+        EXTEND(SP, drained->size * 2);
+#else
+        EXTEND(SP, drained->size);
+#endif
+        SP = KV(tree_take_subtree)(aTHX_ SP, cntr, drained, DRAIN_BACKWARD);
+    }
+    else{
+        IV count = drained->size;
+        KV(tree_release_subtree)(aTHX_ cntr, drained);
+        PUSHi(count);
+    }
+    return SP;
+}
@@ -20,3 +20,56 @@ SV ** KV(XS_FUZZY_FIND_FUNC)(pTHX_ SV** SP, SV * obj, SV * key, int limit){
 #endif
     return SP;
 }
+
+SV ** KV(XS_FUZZY_FIND_MANY_FUNC)(pTHX_ SV** SP, SV * obj, SV * keys){
+    KV(tree_cntr_t) * cntr = KV(assure_tree_cntr)(obj);
+    AV * keys_av = assure_av(aTHX_ keys, S(XS_FUZZY_FIND_MANY_FUNC));
+
+    save_scalar(a_GV);
+    save_scalar(b_GV);
+
+    SSize_t n = av_len(keys_av) + 1;
+#if I(VALUE) != I(void)
+    EXTEND(SP, n * 2);
+#else
+    EXTEND(SP, n);
+#endif
+
+    KV(tree_finger_t) finger[cntr->ever_height+1];
+    int depth = -1;
+    int shared = 0;
+    for(SSize_t i=0; i<n; ++i){
+        SV * key = av_fetch_sv(aTHX_ keys_av, i);
+#if I(KEY) == I(any)
+        SvREFCNT_inc_simple_void_NN(key);
+#endif
+
+        // 上一次的路徑和再上一次的只有前半段相同的話, key 在亂跳 (或往回跳很遠),
+        // 從 finger 往上找會比從 root 往下走還多比較, 改從 root 開始
+        if( shared * 2 < depth )
+            shared = -1;
+        KV(FUZZY_FINGER_FUNC)(aTHX_ SP, cntr, finger, &depth, &shared, K(from_sv)(aTHX_ key));
+        KV(tree_t) * found = KV(tree_finger_found)(finger, depth);
+        if( found ){
+            SP = K(mret)(aTHX_ SP, found->key);
+#if I(VALUE) != I(void)
+            SP = V(mret)(aTHX_ SP, found->value);
+#endif
+        }
+        else{
+            PUSHs(&PL_sv_undef);
+#if I(VALUE) != I(void)
+            PUSHs(&PL_sv_undef);
+#endif
+        }
+
+#if I(KEY) == I(any)
+#   ifdef SvREFCNT_dec_NN
+        SvREFCNT_dec_NN(key);
+#   else
+        SvREFCNT_dec(key);
+#   endif
+#endif
+    }
+    return SP;
+}
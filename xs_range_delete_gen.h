@@ -0,0 +1,40 @@
+// vim: filetype=xs
+
+SV ** KV(XS_RANGE_DELETE_FUNC)(pTHX_ SV** SP, SV * obj, SV * lower_key, SV * upper_key){
+    dXSTARG;
+    KV(tree_cntr_t) * cntr = KV(assure_tree_cntr)(obj);
+
+    save_scalar(a_GV);
+    save_scalar(b_GV);
+#if I(KEY) == I(any)
+    SvREFCNT_inc_simple_void_NN(lower_key);
+    SvREFCNT_inc_simple_void_NN(upper_key);
+#endif
+
+    KV(tree_t) * removed = KV(RANGE_DELETE_FUNC)(aTHX_ SP, cntr, K(from_sv)(aTHX_ lower_key), K(from_sv)(aTHX_ upper_key));
+
+#if I(KEY) == I(any)
+#   ifdef SvREFCNT_dec_NN
+    SvREFCNT_dec_NN(upper_key);
+    SvREFCNT_dec_NN(lower_key);
+#   else
+    SvREFCNT_dec(upper_key);
+    SvREFCNT_dec(lower_key);
+#   endif
+#endif
+
+    if( GIMME_V == G_ARRAY ){
+#if I(VALUE) != I(void)
+        EXTEND(SP, removed->size * 2);
+#else
+        EXTEND(SP, removed->size);
+#endif
+        SP = KV(tree_take_subtree)(aTHX_ SP, cntr, removed, FALSE);
+    }
+    else{
+        IV count = removed->size;
+        KV(tree_release_subtree)(aTHX_ cntr, removed);
+        PUSHi(count);
+    }
+    return SP;
+}
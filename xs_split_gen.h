@@ -0,0 +1,28 @@
+// vim: filetype=xs
+
+SV ** KV(XS_SPLIT_FUNC)(pTHX_ SV** SP, SV * obj, SV * key){
+    KV(tree_cntr_t) * cntr = KV(assure_tree_cntr)(obj);
+
+    save_scalar(a_GV);
+    save_scalar(b_GV);
+#if I(KEY) == I(any)
+    SvREFCNT_inc_simple_void_NN(key);
+#endif
+
+    KV(tree_t) * lower = KV(SPLIT_FUNC)(aTHX_ SP, cntr, K(from_sv)(aTHX_ key));
+
+#if I(KEY) == I(any)
+#   ifdef SvREFCNT_dec_NN
+    SvREFCNT_dec_NN(key);
+#   else
+    SvREFCNT_dec(key);
+#   endif
+    SV * ret = KV(new_tree_obj)(aTHX_ SvSTASH(SvRV(obj)), cntr->cmp);
+#else
+    SV * ret = KV(new_tree_obj)(aTHX_ SvSTASH(SvRV(obj)), &PL_sv_undef);
+#endif
+    KV(tree_hand_over)(cntr, KV(assure_tree_cntr)(ret), lower);
+
+    PUSHs(ret);
+    return SP;
+}